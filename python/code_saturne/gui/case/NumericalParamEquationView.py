@@ -131,6 +131,8 @@ class SolverChoiceDelegate(QItemDelegate):
         editor.addItem("Gauss Seidel")
         editor.addItem("Symmetric Gauss Seidel")
         editor.addItem("conjugate residual")
+        editor.addItem("Pipelined conjugate gradient")
+        editor.addItem("Pipelined GMRES")
         if mg:
             editor.addItem("Multigrid, V-cycle")
             editor.addItem("Multigrid, K-cycle")
@@ -151,8 +153,10 @@ class SolverChoiceDelegate(QItemDelegate):
                 "gauss_seidel": 9,
                 "symmetric_gauss_seidel": 10,
                 "PCR3": 11,
-                "multigrid": 12,
-                "multigrid_k_cycle": 13}
+                "pipelined_conjugate_gradient": 12,
+                "pipelined_gmres": 13,
+                "multigrid": 14,
+                "multigrid_k_cycle": 15}
         row = index.row()
         string = index.model().dataSolver[row]['iresol']
         idx = dico[string]
@@ -535,6 +539,8 @@ class StandardItemModelSolver(QStandardItemModel):
                        "Gauss Seidel"           : "gauss_seidel",
                        "Symmetric Gauss Seidel" : "symmetric_gauss_seidel",
                        "conjugate residual"     : "PCR3",
+                       "Pipelined conjugate gradient" : "pipelined_conjugate_gradient",
+                       "Pipelined GMRES"        : "pipelined_gmres",
                        "None"                   : "none",
                        "Polynomial"             : "polynomial"}
         self.dicoM2V= {"multigrid"              : 'Multigrid, V-cycle',
@@ -552,6 +558,8 @@ class StandardItemModelSolver(QStandardItemModel):
                        "gauss_seidel"           : "Gauss Seidel",
                        "symmetric_gauss_seidel" : "Symmetric Gauss Seidel",
                        "PCR3"                   : "conjugate residual",
+                       "pipelined_conjugate_gradient" : "Pipelined conjugate gradient",
+                       "pipelined_gmres"        : "Pipelined GMRES",
                        "none"                   : "None",
                        "polynomial"             : "Polynomial"}
 
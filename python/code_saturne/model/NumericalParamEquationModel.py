@@ -576,7 +576,9 @@ class NumericalParamEquationModel(Model):
                               'inexact_conjugate_gradient', 'jacobi',
                               'bi_cgstab', 'bi_cgstab2', 'gmres', 'gcr',
                               'PCR3', 'automatic',
-                              'gauss_seidel', 'symmetric_gauss_seidel'))
+                              'gauss_seidel', 'symmetric_gauss_seidel',
+                              'pipelined_conjugate_gradient',
+                              'pipelined_gmres'))
         node = self._getSolverNameNode(name)
 
         default = self._defaultValues()['solver_choice']
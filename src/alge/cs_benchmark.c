@@ -76,6 +76,7 @@
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_cartesian.h"
 #include "cs_mesh_quantities.h"
 #include "cs_matrix.h"
 #include "cs_matrix_assembler.h"
@@ -1132,6 +1133,7 @@ cs_benchmark(int  mpi_trace_mode)
   cs_matrix_finalize();
 
   cs_mesh_adjacencies_finalize();
+  cs_mesh_cartesian_stencil_free();
 
   cs_log_separator(CS_LOG_PERFORMANCE);
 
@@ -642,6 +642,57 @@ _variant_build_list(int                             n_fill_types,
 
   }
 
+  if (type_filter[CS_MATRIX_SELL]) {
+
+    _variant_add("SELL-C-sigma",
+                 NULL,
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 op_flag_ae,
+                 "baseline",
+                 "default",
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#if defined(__AVX2__) && !defined(HAVE_LONG_LNUM)
+
+    _variant_add("SELL-C-sigma, AVX2",
+                 NULL,
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 op_flag_ae,
+                 "avx2",
+                 NULL,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif /* defined(__AVX2__) */
+
+#if defined(__AVX512F__) && !defined(HAVE_LONG_LNUM)
+
+    _variant_add("SELL-C-sigma, AVX-512",
+                 NULL,
+                 CS_MATRIX_SELL,
+                 n_fill_types,
+                 fill_types,
+                 op_flag_ae,
+                 "avx512",
+                 NULL,
+                 NULL,
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+#endif /* defined(__AVX512F__) */
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_timing_variant_t);
 }
@@ -1631,6 +1682,7 @@ cs_benchmark_matrix(double                 t_measure,
   int  t_id, f_id, v_id, ed_flag;
 
   bool                   type_filter[CS_MATRIX_N_BUILTIN_TYPES] = {true,
+                                                                   true,
                                                                    true,
                                                                    true,
                                                                    true};
@@ -79,13 +79,11 @@
 
 /*----------------------------------------------------------------------------*/
 
-BEGIN_C_DECLS
-
 /*=============================================================================
  * Additional Doxygen documentation
  *============================================================================*/
 
-/*! \file  cs_convection_diffusion.c
+/*! \file  cs_convection_diffusion.cxx
  *
  * \brief Convection-diffusion operators.
  *
@@ -358,7 +356,7 @@ _beta_limiter_denom(const int              f_id,
           if (courant != NULL)
             courant_c = courant[ic];
 
-          cs_i_cd_unsteady_nvd(limiter_choice,
+          cs_i_cd_unsteady_nvd((cs_nvd_type_t)limiter_choice,
                                blencp,
                                cell_cen[ic],
                                cell_cen[id],
@@ -373,7 +371,7 @@ _beta_limiter_denom(const int              f_id,
                                &pif,
                                &pjf);
 
-          cs_i_cd_unsteady_nvd(limiter_choice,
+          cs_i_cd_unsteady_nvd((cs_nvd_type_t)limiter_choice,
                                blencp,
                                cell_cen[ic],
                                cell_cen[id],
@@ -597,233 +595,999 @@ _beta_limiter_num(const int           f_id,
   }
 }
 
-/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
-
-/*============================================================================
- * Public function definitions for Fortran API
- *============================================================================*/
-
 /*----------------------------------------------------------------------------
- * Wrapper to cs_face_diffusion_potential
+ * Add the explicit interior face convection-diffusion balance of a scalar
+ * to the right-hand side, for the unsteady algorithm.
+ *
+ * Options selecting a branch in the face loop are template parameters,
+ * so that the loop body of each instantiation is free of tests on
+ * those options.
+ *
+ * template parameters:
+ *   ischcp         convection scheme (-1 for pure upwind, 0 to 4 otherwise)
+ *   isstpp         0: slope test, 1: no slope test, 2: beta limiter
+ *   local_rc       true if reconstruction is limited locally
+ *
+ * parameters:
+ *   m              <-- pointer to mesh
+ *   fvq            <-- pointer to finite volume quantities
+ *   iconvp         <-- convection flag
+ *   idiffp         <-- diffusion flag
+ *   imasac         <-- take mass accumulation into account?
+ *   ircflp         <-- flux reconstruction flag
+ *   limiter_choice <-- NVD limiter type (ischcp = 4)
+ *   blencp         <-- proportion of second order scheme
+ *   blend_st       <-- proportion of second order scheme after slope test
+ *   thetap         <-- weighting coefficient for the theta-scheme
+ *   cv_limiter     <-- convection limiter (isstpp = 2)
+ *   df_limiter     <-- diffusion limiter (local_rc)
+ *   hybrid_blend   <-- blending between SOLU and centered (ischcp = 3)
+ *   courant        <-- cell Courant number, or NULL (ischcp = 4)
+ *   local_max      <-- local maximum of variable (ischcp = 4)
+ *   local_min      <-- local minimum of variable (ischcp = 4)
+ *   grad           <-- cell gradient
+ *   gradup         <-- upwind gradient (ischcp = 2)
+ *   gradst         <-- slope test gradient (isstpp = 0)
+ *   pvar           <-- variable values
+ *   i_massflux     <-- mass flux at interior faces
+ *   i_visc         <-- diffusion coefficient at interior faces
+ *   v_slope_test   <-> upwind flux switched by slope test, or NULL
+ *   rhs            <-> right hand side
+ *
+ * returns:
+ *   number of local faces with upwind flux
  *----------------------------------------------------------------------------*/
 
-void CS_PROCF (itrmas, ITRMAS)
-(
- const int       *const   f_id,
- const int       *const   init,
- const int       *const   inc,
- const int       *const   imrgra,
- const int       *const   nswrgp,
- const int       *const   imligp,
- const int       *const   iphydp,
- const int       *const   iwgrp,
- const int       *const   iwarnp,
- const cs_real_t *const   epsrgp,
- const cs_real_t *const   climgp,
- const cs_real_t *const   extrap,
- cs_real_3_t              frcxt[],
- cs_real_t                pvar[],
- const cs_real_t          coefap[],
- const cs_real_t          coefbp[],
- const cs_real_t          cofafp[],
- const cs_real_t          cofbfp[],
- const cs_real_t          i_visc[],
- const cs_real_t          b_visc[],
- cs_real_t                visel[],
- cs_real_t                i_massflux[],
- cs_real_t                b_massflux[]
-)
+template <int ischcp, int isstpp, bool local_rc>
+static cs_gnum_t
+_i_conv_diff_scalar_unsteady(const cs_mesh_t             *m,
+                             const cs_mesh_quantities_t  *fvq,
+                             int                          iconvp,
+                             int                          idiffp,
+                             int                          imasac,
+                             int                          ircflp,
+                             cs_nvd_type_t                limiter_choice,
+                             double                       blencp,
+                             double                       blend_st,
+                             double                       thetap,
+                             const cs_real_t    *restrict cv_limiter,
+                             const cs_real_t    *restrict df_limiter,
+                             const cs_real_t    *restrict hybrid_blend,
+                             const cs_real_t    *restrict courant,
+                             const cs_real_t    *restrict local_max,
+                             const cs_real_t    *restrict local_min,
+                             const cs_real_3_t  *restrict grad,
+                             const cs_real_3_t  *restrict gradup,
+                             const cs_real_3_t  *restrict gradst,
+                             const cs_real_t    *restrict pvar,
+                             const cs_real_t              i_massflux[],
+                             const cs_real_t              i_visc[],
+                             cs_real_t          *restrict v_slope_test,
+                             cs_real_t          *restrict rhs)
 {
-  CS_UNUSED(extrap);
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
 
-  const cs_mesh_t  *m = cs_glob_mesh;
-  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
 
-  cs_face_diffusion_potential(*f_id,
-                              m,
-                              fvq,
-                              *init,
-                              *inc,
-                              *imrgra,
-                              *nswrgp,
-                              *imligp,
-                              *iphydp,
-                              *iwgrp,
-                              *iwarnp,
-                              *epsrgp,
-                              *climgp,
-                              frcxt,
-                              pvar,
-                              coefap,
-                              coefbp,
-                              cofafp,
-                              cofbfp,
-                              i_visc,
-                              b_visc,
-                              visel,
-                              i_massflux,
-                              b_massflux);
-}
+  cs_gnum_t n_upwind = 0;
 
-/*----------------------------------------------------------------------------
- * Wrapper to cs_face_anisotropic_diffusion_potential
- *----------------------------------------------------------------------------*/
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for reduction(+:n_upwind)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
 
-void CS_PROCF (itrmav, ITRMAV)
-(
- const int       *const   f_id,
- const int       *const   init,
- const int       *const   inc,
- const int       *const   imrgra,
- const int       *const   nswrgp,
- const int       *const   imligp,
- const int       *const   ircflp,
- const int       *const   iphydp,
- const int       *const   iwgrp,
- const int       *const   iwarnp,
- const cs_real_t *const   epsrgp,
- const cs_real_t *const   climgp,
- const cs_real_t *const   extrap,
- cs_real_3_t              frcxt[],
- cs_real_t                pvar[],
- const cs_real_t          coefap[],
- const cs_real_t          coefbp[],
- const cs_real_t          cofafp[],
- const cs_real_t          cofbfp[],
- const cs_real_t          i_visc[],
- const cs_real_t          b_visc[],
- cs_real_6_t              viscel[],
- const cs_real_2_t        weighf[],
- const cs_real_t          weighb[],
- cs_real_t                i_massflux[],
- cs_real_t                b_massflux[]
-)
-{
-  CS_UNUSED(extrap);
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
 
-  const cs_mesh_t  *m = cs_glob_mesh;
-  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+        cs_real_2_t fluxij = {0.,0.};
 
-  cs_face_anisotropic_diffusion_potential(*f_id,
-                                          m,
-                                          fvq,
-                                          *init,
-                                          *inc,
-                                          *imrgra,
-                                          *nswrgp,
-                                          *imligp,
-                                          *ircflp,
-                                          *iphydp,
-                                          *iwgrp,
-                                          *iwarnp,
-                                          *epsrgp,
-                                          *climgp,
-                                          frcxt,
-                                          pvar,
-                                          coefap,
-                                          coefbp,
-                                          cofafp,
-                                          cofbfp,
-                                          i_visc,
-                                          b_visc,
-                                          viscel,
-                                          weighf,
-                                          weighb,
-                                          i_massflux,
-                                          b_massflux);
-}
+        cs_real_t pif, pjf;
+        cs_real_t pip, pjp;
 
-/*----------------------------------------------------------------------------
- * Wrapper to cs_diffusion_potential
- *----------------------------------------------------------------------------*/
+        cs_real_t bldfrp = (cs_real_t) ircflp;
+        /* Local limitation of the reconstruction */
+        if (local_rc)
+          bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
-void CS_PROCF (itrgrp, ITRGRP)
-(
- const int       *const   f_id,
- const int       *const   init,
- const int       *const   inc,
- const int       *const   imrgra,
- const int       *const   nswrgp,
- const int       *const   imligp,
- const int       *const   iphydp,
- const int       *const   iwgrp,
- const int       *const   iwarnp,
- const cs_real_t *const   epsrgp,
- const cs_real_t *const   climgp,
- const cs_real_t *const   extrap,
- cs_real_3_t              frcxt[],
- cs_real_t                pvar[],
- const cs_real_t          coefap[],
- const cs_real_t          coefbp[],
- const cs_real_t          cofafp[],
- const cs_real_t          cofbfp[],
- const cs_real_t          i_visc[],
- const cs_real_t          b_visc[],
- cs_real_t                visel[],
- cs_real_t                diverg[]
-)
-{
-  CS_UNUSED(extrap);
+        if (ischcp < 0) {
 
-  const cs_mesh_t  *m = cs_glob_mesh;
-  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+          /* in parallel, face will be counted by one and only one rank */
+          if (ii < n_cells)
+            n_upwind++;
 
-  cs_diffusion_potential(*f_id,
-                         m,
-                         fvq,
-                         *init,
-                         *inc,
-                         *imrgra,
-                         *nswrgp,
-                         *imligp,
-                         *iphydp,
-                         *iwgrp,
-                         *iwarnp,
-                         *epsrgp,
-                         *climgp,
-                         frcxt,
-                         pvar,
-                         coefap,
-                         coefbp,
-                         cofafp,
-                         cofbfp,
-                         i_visc,
-                         b_visc,
-                         visel,
-                         diverg);
-}
+          cs_i_cd_unsteady_upwind(bldfrp,
+                                  diipf[face_id],
+                                  djjpf[face_id],
+                                  grad[ii],
+                                  grad[jj],
+                                  pvar[ii],
+                                  pvar[jj],
+                                  &pif,
+                                  &pjf,
+                                  &pip,
+                                  &pjp);
 
-/*----------------------------------------------------------------------------
- * Wrapper to cs_anisotropic_diffusion_potential
- *----------------------------------------------------------------------------*/
+        }
+        else if (isstpp == 0) {
 
-void CS_PROCF (itrgrv, ITRGRV)
-(
- const int       *const   f_id,
- const int       *const   init,
- const int       *const   inc,
- const int       *const   imrgra,
- const int       *const   nswrgp,
- const int       *const   imligp,
- const int       *const   ircflp,
- const int       *const   iphydp,
- const int       *const   iwgrp,
- const int       *const   iwarnp,
- const cs_real_t *const   epsrgp,
- const cs_real_t *const   climgp,
- const cs_real_t *const   extrap,
- cs_real_3_t              frcxt[],
- cs_real_t                pvar[],
- const cs_real_t          coefap[],
- const cs_real_t          coefbp[],
- const cs_real_t          cofafp[],
- const cs_real_t          cofbfp[],
- const cs_real_t          i_visc[],
- const cs_real_t          b_visc[],
- cs_real_6_t              viscel[],
- const cs_real_2_t        weighf[],
- const cs_real_t          weighb[],
- cs_real_t                diverg[]
+          bool upwind_switch = false;
+
+          cs_i_cd_unsteady_slope_test(&upwind_switch,
+                                      iconvp,
+                                      bldfrp,
+                                      ischcp,
+                                      blencp,
+                                      blend_st,
+                                      weight[face_id],
+                                      i_dist[face_id],
+                                      i_face_surf[face_id],
+                                      cell_cen[ii],
+                                      cell_cen[jj],
+                                      i_face_normal[face_id],
+                                      i_face_cog[face_id],
+                                      diipf[face_id],
+                                      djjpf[face_id],
+                                      i_massflux[face_id],
+                                      grad[ii],
+                                      grad[jj],
+                                      gradup[ii],
+                                      gradup[jj],
+                                      gradst[ii],
+                                      gradst[jj],
+                                      pvar[ii],
+                                      pvar[jj],
+                                      &pif,
+                                      &pjf,
+                                      &pip,
+                                      &pjp);
+
+          if (upwind_switch) {
+            /* in parallel, face will be counted by one and only one rank */
+            if (ii < n_cells)
+              n_upwind++;
+
+            if (v_slope_test != NULL) {
+              v_slope_test[ii] += fabs(i_massflux[face_id]) / cell_vol[ii];
+              v_slope_test[jj] += fabs(i_massflux[face_id]) / cell_vol[jj];
+            }
+          }
+
+        }
+        else {
+
+          cs_real_t beta = blencp;
+
+          /* Beta blending coefficient ensuring positivity of the scalar */
+          if (isstpp == 2)
+            beta = CS_MAX(CS_MIN(cv_limiter[ii], cv_limiter[jj]), 0.);
+
+          if (ischcp != 4) {
+            cs_real_t hybrid_coef_ii = 0., hybrid_coef_jj = 0.;
+            if (ischcp == 3) {
+              hybrid_coef_ii = hybrid_blend[ii];
+              hybrid_coef_jj = hybrid_blend[jj];
+            }
+            cs_i_cd_unsteady(bldfrp,
+                             ischcp,
+                             beta,
+                             weight[face_id],
+                             cell_cen[ii],
+                             cell_cen[jj],
+                             i_face_cog[face_id],
+                             hybrid_coef_ii,
+                             hybrid_coef_jj,
+                             diipf[face_id],
+                             djjpf[face_id],
+                             grad[ii],
+                             grad[jj],
+                             gradup[ii],
+                             gradup[jj],
+                             pvar[ii],
+                             pvar[jj],
+                             &pif,
+                             &pjf,
+                             &pip,
+                             &pjp);
+          }
+          else {
+            /* NVD/TVD family of high accuracy schemes */
+
+            cs_lnum_t ic, id;
+
+            /* Determine central and downwind sides w.r.t. current face */
+            cs_central_downwind_cells(ii,
+                                      jj,
+                                      i_massflux[face_id],
+                                      &ic,  /* central cell id */
+                                      &id); /* downwind cell id */
+
+            cs_real_t courant_c = -1.;
+            if (courant != NULL)
+              courant_c = courant[ic];
+
+            cs_i_cd_unsteady_nvd(limiter_choice,
+                                 beta,
+                                 cell_cen[ic],
+                                 cell_cen[id],
+                                 i_face_normal[face_id],
+                                 i_face_cog[face_id],
+                                 grad[ic],
+                                 pvar[ic],
+                                 pvar[id],
+                                 local_max[ic],
+                                 local_min[ic],
+                                 courant_c,
+                                 &pif,
+                                 &pjf);
+
+            /* Compute required quantities for diffusive flux */
+            cs_real_t recoi, recoj;
+
+            cs_i_compute_quantities(bldfrp,
+                                    diipf[face_id],
+                                    djjpf[face_id],
+                                    grad[ii],
+                                    grad[jj],
+                                    pvar[ii],
+                                    pvar[jj],
+                                    &recoi,
+                                    &recoj,
+                                    &pip,
+                                    &pjp);
+          }
+
+        }
+
+        cs_i_conv_flux(iconvp,
+                       thetap,
+                       imasac,
+                       pvar[ii],
+                       pvar[jj],
+                       pif,
+                       pif, /* no relaxation */
+                       pjf,
+                       pjf, /* no relaxation */
+                       i_massflux[face_id],
+                       1., /* xcpp */
+                       1., /* xcpp */
+                       fluxij);
+
+        cs_i_diff_flux(idiffp,
+                       thetap,
+                       pip,
+                       pjp,
+                       pip, /* no relaxation */
+                       pjp, /* no relaxation */
+                       i_visc[face_id],
+                       fluxij);
+
+        rhs[ii] -= fluxij[0];
+        rhs[jj] += fluxij[1];
+
+      }
+    }
+  }
+
+  return n_upwind;
+}
+
+/*----------------------------------------------------------------------------
+ * Add the explicit interior face convection-diffusion balance of a vector
+ * to the right-hand side, for the unsteady algorithm.
+ *
+ * Options selecting a branch in the face loop are template parameters,
+ * so that the loop body of each instantiation is free of tests on
+ * those options.
+ *
+ * template parameters:
+ *   ischcp         convection scheme (-1 for pure upwind, 0 to 3 otherwise)
+ *   slope_test     true if the slope test is used
+ *   local_rc       true if reconstruction is limited locally
+ *   porous_vel     true for the discontinuous porous velocity treatment
+ *
+ * parameters:
+ *   m              <-- pointer to mesh
+ *   fvq            <-- pointer to finite volume quantities
+ *   iconvp         <-- convection flag
+ *   idiffp         <-- diffusion flag
+ *   imasac         <-- take mass accumulation into account?
+ *   ircflp         <-- flux reconstruction flag
+ *   blencp         <-- proportion of second order scheme
+ *   blend_st       <-- proportion of second order scheme after slope test
+ *   thetap         <-- weighting coefficient for the theta-scheme
+ *   df_limiter     <-- diffusion limiter (local_rc)
+ *   hybrid_blend   <-- blending between SOLU and centered (ischcp = 3)
+ *   grad           <-- cell gradient
+ *   grdpa          <-- slope test gradient (slope_test)
+ *   pvar           <-- variable values
+ *   i_massflux     <-- mass flux at interior faces
+ *   i_visc         <-- diffusion coefficient at interior faces
+ *   v_slope_test   <-> upwind flux switched by slope test, or NULL
+ *   rhs            <-> right hand side
+ *
+ * returns:
+ *   number of local faces with upwind flux
+ *----------------------------------------------------------------------------*/
+
+template <int ischcp, bool slope_test, bool local_rc, bool porous_vel>
+static cs_gnum_t
+_i_conv_diff_vector_unsteady(const cs_mesh_t             *m,
+                             const cs_mesh_quantities_t  *fvq,
+                             int                          iconvp,
+                             int                          idiffp,
+                             int                          imasac,
+                             int                          ircflp,
+                             double                       blencp,
+                             double                       blend_st,
+                             double                       thetap,
+                             const cs_real_t    *restrict df_limiter,
+                             const cs_real_t    *restrict hybrid_blend,
+                             const cs_real_33_t *restrict grad,
+                             const cs_real_33_t *restrict grdpa,
+                             const cs_real_3_t  *restrict pvar,
+                             const cs_real_t              i_massflux[],
+                             const cs_real_t              i_visc[],
+                             cs_real_t          *restrict v_slope_test,
+                             cs_real_3_t        *restrict rhs)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_real_t *restrict weight = fvq->weight;
+  const cs_real_t *restrict i_dist = fvq->i_dist;
+  const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
+  const cs_real_t *restrict cell_vol = fvq->cell_vol;
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict i_face_normal
+    = (const cs_real_3_t *restrict)fvq->i_face_normal;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict diipf
+    = (const cs_real_3_t *restrict)fvq->diipf;
+  const cs_real_3_t *restrict djjpf
+    = (const cs_real_3_t *restrict)fvq->djjpf;
+  const cs_real_2_t *restrict i_f_face_factor
+    = (const cs_real_2_t *restrict)fvq->i_f_face_factor;
+
+  cs_gnum_t n_upwind = 0;
+
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+#   pragma omp parallel for reduction(+:n_upwind)
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
+      for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           face_id++) {
+
+        cs_lnum_t ii = i_face_cells[face_id][0];
+        cs_lnum_t jj = i_face_cells[face_id][1];
+
+        cs_real_t fluxi[3], fluxj[3] ;
+        for (int isou = 0; isou < 3; isou++) {
+          fluxi[isou] = 0;
+          fluxj[isou] = 0;
+        }
+
+        cs_real_3_t pip, pjp;
+        cs_real_3_t pif, pjf;
+        cs_real_3_t _pi, _pj;
+
+        for (int i = 0; i < 3; i++) {
+          _pi[i]  = pvar[ii][i];
+          _pj[i]  = pvar[jj][i];
+        }
+
+        /* Scaling due to mass balance in porous modelling */
+        if (porous_vel) {
+          cs_real_3_t n;
+          cs_math_3_normalize(i_face_normal[face_id], n);
+
+          cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
+          cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
+        }
+
+        cs_real_t bldfrp = (cs_real_t) ircflp;
+        /* Local limitation of the reconstruction */
+        if (local_rc)
+          bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
+
+        if (ischcp < 0) {
+
+          /* in parallel, face will be counted by one and only one rank */
+          if (ii < n_cells)
+            n_upwind++;
+
+          cs_i_cd_unsteady_upwind_vector(bldfrp,
+                                         diipf[face_id],
+                                         djjpf[face_id],
+                                         (const cs_real_3_t *)grad[ii],
+                                         (const cs_real_3_t *)grad[jj],
+                                         _pi,
+                                         _pj,
+                                         pif,
+                                         pjf,
+                                         pip,
+                                         pjp);
+
+        }
+        else if (slope_test) {
+
+          bool upwind_switch = false;
+
+          cs_i_cd_unsteady_slope_test_vector(&upwind_switch,
+                                             iconvp,
+                                             bldfrp,
+                                             ischcp,
+                                             blencp,
+                                             blend_st,
+                                             weight[face_id],
+                                             i_dist[face_id],
+                                             i_face_surf[face_id],
+                                             cell_cen[ii],
+                                             cell_cen[jj],
+                                             i_face_normal[face_id],
+                                             i_face_cog[face_id],
+                                             diipf[face_id],
+                                             djjpf[face_id],
+                                             i_massflux[face_id],
+                                             (const cs_real_3_t *)grad[ii],
+                                             (const cs_real_3_t *)grad[jj],
+                                             (const cs_real_3_t *)grdpa[ii],
+                                             (const cs_real_3_t *)grdpa[jj],
+                                             _pi,
+                                             _pj,
+                                             pif,
+                                             pjf,
+                                             pip,
+                                             pjp);
+
+          if (upwind_switch) {
+            /* in parallel, face will be counted by one and only one rank */
+            if (ii < n_cells)
+              n_upwind++;
+
+            if (v_slope_test != NULL) {
+              v_slope_test[ii] += fabs(i_massflux[face_id]) / cell_vol[ii];
+              v_slope_test[jj] += fabs(i_massflux[face_id]) / cell_vol[jj];
+            }
+          }
+
+        }
+        else {
+
+          cs_real_t hybrid_coef_ii = 0., hybrid_coef_jj = 0.;
+          if (ischcp == 3) {
+            hybrid_coef_ii = hybrid_blend[ii];
+            hybrid_coef_jj = hybrid_blend[jj];
+          }
+
+          cs_i_cd_unsteady_vector(bldfrp,
+                                  ischcp,
+                                  blencp,
+                                  weight[face_id],
+                                  cell_cen[ii],
+                                  cell_cen[jj],
+                                  i_face_cog[face_id],
+                                  hybrid_coef_ii,
+                                  hybrid_coef_jj,
+                                  diipf[face_id],
+                                  djjpf[face_id],
+                                  (const cs_real_3_t *)grad[ii],
+                                  (const cs_real_3_t *)grad[jj],
+                                  _pi,
+                                  _pj,
+                                  pif,
+                                  pjf,
+                                  pip,
+                                  pjp);
+
+        }
+
+        cs_i_conv_flux_vector(iconvp,
+                              thetap,
+                              imasac,
+                              pvar[ii],
+                              pvar[jj],
+                              pif,
+                              pif, /* no relaxation */
+                              pjf,
+                              pjf, /* no relaxation */
+                              i_massflux[face_id],
+                              fluxi,
+                              fluxj);
+
+        cs_i_diff_flux_vector(idiffp,
+                              thetap,
+                              pip,
+                              pjp,
+                              pip, /* no relaxation */
+                              pjp, /* no relaxation */
+                              i_visc[face_id],
+                              fluxi,
+                              fluxj);
+
+        for (int isou = 0; isou < 3; isou++) {
+          rhs[ii][isou] -= fluxi[isou];
+          rhs[jj][isou] += fluxj[isou];
+        }
+
+      }
+    }
+  }
+
+  return n_upwind;
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer types for specialized interior face kernels.
+ *----------------------------------------------------------------------------*/
+
+typedef decltype(&_i_conv_diff_scalar_unsteady<1, 1, false>)
+  _i_conv_diff_scalar_t;
+
+typedef decltype(&_i_conv_diff_vector_unsteady<1, false, false, false>)
+  _i_conv_diff_vector_t;
+
+/*----------------------------------------------------------------------------
+ * Select the scalar unsteady interior face kernel instantiation
+ * matching given convection scheme and reconstruction options.
+ *
+ * template parameters:
+ *   ischcp         convection scheme (-1 for pure upwind, 0 to 4 otherwise)
+ *   isstpp         0: slope test, 1: no slope test, 2: beta limiter
+ *
+ * parameters:
+ *   local_rc       <-- true if reconstruction is limited locally
+ *
+ * returns:
+ *   pointer to matching kernel
+ *----------------------------------------------------------------------------*/
+
+template <int ischcp, int isstpp>
+static _i_conv_diff_scalar_t
+_i_conv_diff_scalar_select(bool  local_rc)
+{
+  if (local_rc)
+    return _i_conv_diff_scalar_unsteady<ischcp, isstpp, true>;
+  else
+    return _i_conv_diff_scalar_unsteady<ischcp, isstpp, false>;
+}
+
+/*----------------------------------------------------------------------------
+ * Select the scalar unsteady interior face kernel instantiation
+ * matching given options.
+ *
+ * parameters:
+ *   iupwin         <-- 1 for pure upwind, 0 otherwise
+ *   ischcp         <-- convection scheme
+ *   isstpp         <-- 1: no slope test, 2: beta limiter, slope test otherwise
+ *   local_rc       <-- true if reconstruction is limited locally
+ *
+ * returns:
+ *   pointer to matching kernel
+ *----------------------------------------------------------------------------*/
+
+static _i_conv_diff_scalar_t
+_i_conv_diff_scalar_unsteady_kernel(int   iupwin,
+                                    int   ischcp,
+                                    int   isstpp,
+                                    bool  local_rc)
+{
+  _i_conv_diff_scalar_t k = NULL;
+
+  if (iupwin == 1)
+    k = _i_conv_diff_scalar_select<-1, 1>(local_rc);
+
+  else if (isstpp == 1) {
+    switch (ischcp) {
+    case 0:
+      k = _i_conv_diff_scalar_select<0, 1>(local_rc);
+      break;
+    case 1:
+      k = _i_conv_diff_scalar_select<1, 1>(local_rc);
+      break;
+    case 2:
+      k = _i_conv_diff_scalar_select<2, 1>(local_rc);
+      break;
+    case 3:
+      k = _i_conv_diff_scalar_select<3, 1>(local_rc);
+      break;
+    case 4:
+      k = _i_conv_diff_scalar_select<4, 1>(local_rc);
+      break;
+    default:
+      break;
+    }
+  }
+
+  else if (isstpp == 2) {
+    switch (ischcp) {
+    case 0:
+      k = _i_conv_diff_scalar_select<0, 2>(local_rc);
+      break;
+    case 1:
+      k = _i_conv_diff_scalar_select<1, 2>(local_rc);
+      break;
+    case 2:
+      k = _i_conv_diff_scalar_select<2, 2>(local_rc);
+      break;
+    case 3:
+      k = _i_conv_diff_scalar_select<3, 2>(local_rc);
+      break;
+    case 4:
+      k = _i_conv_diff_scalar_select<4, 2>(local_rc);
+      break;
+    default:
+      break;
+    }
+  }
+
+  else {
+    switch (ischcp) {
+    case 0:
+      k = _i_conv_diff_scalar_select<0, 0>(local_rc);
+      break;
+    case 1:
+      k = _i_conv_diff_scalar_select<1, 0>(local_rc);
+      break;
+    case 2:
+      k = _i_conv_diff_scalar_select<2, 0>(local_rc);
+      break;
+    default:
+      break;
+    }
+  }
+
+  return k;
+}
+
+/*----------------------------------------------------------------------------
+ * Select the vector unsteady interior face kernel instantiation
+ * matching given convection scheme and slope test options.
+ *
+ * template parameters:
+ *   ischcp         convection scheme (-1 for pure upwind, 0 to 3 otherwise)
+ *   slope_test     true if the slope test is used
+ *
+ * parameters:
+ *   local_rc       <-- true if reconstruction is limited locally
+ *   porous_vel     <-- true for the discontinuous porous velocity treatment
+ *
+ * returns:
+ *   pointer to matching kernel
+ *----------------------------------------------------------------------------*/
+
+template <int ischcp, bool slope_test>
+static _i_conv_diff_vector_t
+_i_conv_diff_vector_select(bool  local_rc,
+                           bool  porous_vel)
+{
+  if (local_rc) {
+    if (porous_vel)
+      return _i_conv_diff_vector_unsteady<ischcp, slope_test, true, true>;
+    else
+      return _i_conv_diff_vector_unsteady<ischcp, slope_test, true, false>;
+  }
+  else {
+    if (porous_vel)
+      return _i_conv_diff_vector_unsteady<ischcp, slope_test, false, true>;
+    else
+      return _i_conv_diff_vector_unsteady<ischcp, slope_test, false, false>;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Select the vector unsteady interior face kernel instantiation
+ * matching given options.
+ *
+ * parameters:
+ *   iupwin         <-- 1 for pure upwind, 0 otherwise
+ *   ischcp         <-- convection scheme
+ *   isstpp         <-- 1 for no slope test, slope test otherwise
+ *   local_rc       <-- true if reconstruction is limited locally
+ *   porous_vel     <-- true for the discontinuous porous velocity treatment
+ *
+ * returns:
+ *   pointer to matching kernel
+ *----------------------------------------------------------------------------*/
+
+static _i_conv_diff_vector_t
+_i_conv_diff_vector_unsteady_kernel(int   iupwin,
+                                    int   ischcp,
+                                    int   isstpp,
+                                    bool  local_rc,
+                                    bool  porous_vel)
+{
+  _i_conv_diff_vector_t k = NULL;
+
+  if (iupwin == 1)
+    k = _i_conv_diff_vector_select<-1, false>(local_rc, porous_vel);
+
+  else if (isstpp == 1) {
+    switch (ischcp) {
+    case 0:
+      k = _i_conv_diff_vector_select<0, false>(local_rc, porous_vel);
+      break;
+    case 1:
+      k = _i_conv_diff_vector_select<1, false>(local_rc, porous_vel);
+      break;
+    case 3:
+      k = _i_conv_diff_vector_select<3, false>(local_rc, porous_vel);
+      break;
+    default:
+      break;
+    }
+  }
+
+  else {
+    switch (ischcp) {
+    case 0:
+      k = _i_conv_diff_vector_select<0, true>(local_rc, porous_vel);
+      break;
+    case 1:
+      k = _i_conv_diff_vector_select<1, true>(local_rc, porous_vel);
+      break;
+    default:
+      break;
+    }
+  }
+
+  return k;
+}
+
+/*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
+
+BEGIN_C_DECLS
+
+/*============================================================================
+ * Public function definitions for Fortran API
+ *============================================================================*/
+
+/*----------------------------------------------------------------------------
+ * Wrapper to cs_face_diffusion_potential
+ *----------------------------------------------------------------------------*/
+
+void CS_PROCF (itrmas, ITRMAS)
+(
+ const int       *const   f_id,
+ const int       *const   init,
+ const int       *const   inc,
+ const int       *const   imrgra,
+ const int       *const   nswrgp,
+ const int       *const   imligp,
+ const int       *const   iphydp,
+ const int       *const   iwgrp,
+ const int       *const   iwarnp,
+ const cs_real_t *const   epsrgp,
+ const cs_real_t *const   climgp,
+ const cs_real_t *const   extrap,
+ cs_real_3_t              frcxt[],
+ cs_real_t                pvar[],
+ const cs_real_t          coefap[],
+ const cs_real_t          coefbp[],
+ const cs_real_t          cofafp[],
+ const cs_real_t          cofbfp[],
+ const cs_real_t          i_visc[],
+ const cs_real_t          b_visc[],
+ cs_real_t                visel[],
+ cs_real_t                i_massflux[],
+ cs_real_t                b_massflux[]
+)
+{
+  CS_UNUSED(extrap);
+
+  const cs_mesh_t  *m = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  cs_face_diffusion_potential(*f_id,
+                              m,
+                              fvq,
+                              *init,
+                              *inc,
+                              *imrgra,
+                              *nswrgp,
+                              *imligp,
+                              *iphydp,
+                              *iwgrp,
+                              *iwarnp,
+                              *epsrgp,
+                              *climgp,
+                              frcxt,
+                              pvar,
+                              coefap,
+                              coefbp,
+                              cofafp,
+                              cofbfp,
+                              i_visc,
+                              b_visc,
+                              visel,
+                              i_massflux,
+                              b_massflux);
+}
+
+/*----------------------------------------------------------------------------
+ * Wrapper to cs_face_anisotropic_diffusion_potential
+ *----------------------------------------------------------------------------*/
+
+void CS_PROCF (itrmav, ITRMAV)
+(
+ const int       *const   f_id,
+ const int       *const   init,
+ const int       *const   inc,
+ const int       *const   imrgra,
+ const int       *const   nswrgp,
+ const int       *const   imligp,
+ const int       *const   ircflp,
+ const int       *const   iphydp,
+ const int       *const   iwgrp,
+ const int       *const   iwarnp,
+ const cs_real_t *const   epsrgp,
+ const cs_real_t *const   climgp,
+ const cs_real_t *const   extrap,
+ cs_real_3_t              frcxt[],
+ cs_real_t                pvar[],
+ const cs_real_t          coefap[],
+ const cs_real_t          coefbp[],
+ const cs_real_t          cofafp[],
+ const cs_real_t          cofbfp[],
+ const cs_real_t          i_visc[],
+ const cs_real_t          b_visc[],
+ cs_real_6_t              viscel[],
+ const cs_real_2_t        weighf[],
+ const cs_real_t          weighb[],
+ cs_real_t                i_massflux[],
+ cs_real_t                b_massflux[]
+)
+{
+  CS_UNUSED(extrap);
+
+  const cs_mesh_t  *m = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  cs_face_anisotropic_diffusion_potential(*f_id,
+                                          m,
+                                          fvq,
+                                          *init,
+                                          *inc,
+                                          *imrgra,
+                                          *nswrgp,
+                                          *imligp,
+                                          *ircflp,
+                                          *iphydp,
+                                          *iwgrp,
+                                          *iwarnp,
+                                          *epsrgp,
+                                          *climgp,
+                                          frcxt,
+                                          pvar,
+                                          coefap,
+                                          coefbp,
+                                          cofafp,
+                                          cofbfp,
+                                          i_visc,
+                                          b_visc,
+                                          viscel,
+                                          weighf,
+                                          weighb,
+                                          i_massflux,
+                                          b_massflux);
+}
+
+/*----------------------------------------------------------------------------
+ * Wrapper to cs_diffusion_potential
+ *----------------------------------------------------------------------------*/
+
+void CS_PROCF (itrgrp, ITRGRP)
+(
+ const int       *const   f_id,
+ const int       *const   init,
+ const int       *const   inc,
+ const int       *const   imrgra,
+ const int       *const   nswrgp,
+ const int       *const   imligp,
+ const int       *const   iphydp,
+ const int       *const   iwgrp,
+ const int       *const   iwarnp,
+ const cs_real_t *const   epsrgp,
+ const cs_real_t *const   climgp,
+ const cs_real_t *const   extrap,
+ cs_real_3_t              frcxt[],
+ cs_real_t                pvar[],
+ const cs_real_t          coefap[],
+ const cs_real_t          coefbp[],
+ const cs_real_t          cofafp[],
+ const cs_real_t          cofbfp[],
+ const cs_real_t          i_visc[],
+ const cs_real_t          b_visc[],
+ cs_real_t                visel[],
+ cs_real_t                diverg[]
+)
+{
+  CS_UNUSED(extrap);
+
+  const cs_mesh_t  *m = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+
+  cs_diffusion_potential(*f_id,
+                         m,
+                         fvq,
+                         *init,
+                         *inc,
+                         *imrgra,
+                         *nswrgp,
+                         *imligp,
+                         *iphydp,
+                         *iwgrp,
+                         *iwarnp,
+                         *epsrgp,
+                         *climgp,
+                         frcxt,
+                         pvar,
+                         coefap,
+                         coefbp,
+                         cofafp,
+                         cofbfp,
+                         i_visc,
+                         b_visc,
+                         visel,
+                         diverg);
+}
+
+/*----------------------------------------------------------------------------
+ * Wrapper to cs_anisotropic_diffusion_potential
+ *----------------------------------------------------------------------------*/
+
+void CS_PROCF (itrgrv, ITRGRV)
+(
+ const int       *const   f_id,
+ const int       *const   init,
+ const int       *const   inc,
+ const int       *const   imrgra,
+ const int       *const   nswrgp,
+ const int       *const   imligp,
+ const int       *const   ircflp,
+ const int       *const   iphydp,
+ const int       *const   iwgrp,
+ const int       *const   iwarnp,
+ const cs_real_t *const   epsrgp,
+ const cs_real_t *const   climgp,
+ const cs_real_t *const   extrap,
+ cs_real_3_t              frcxt[],
+ cs_real_t                pvar[],
+ const cs_real_t          coefap[],
+ const cs_real_t          coefbp[],
+ const cs_real_t          cofafp[],
+ const cs_real_t          cofbfp[],
+ const cs_real_t          i_visc[],
+ const cs_real_t          b_visc[],
+ cs_real_6_t              viscel[],
+ const cs_real_2_t        weighf[],
+ const cs_real_t          weighb[],
+ cs_real_t                diverg[]
 )
 {
   CS_UNUSED(extrap);
@@ -1968,7 +2732,7 @@ cs_convection_diffusion_scalar(int                       idtvar,
                                     0, /* hyd_p_flag */
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     NULL, /* f_ext exterior force */
@@ -2138,76 +2902,6 @@ cs_convection_diffusion_scalar(int                       idtvar,
         }
       }
 
-    /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            /* in parallel, face will be counted by one and only one rank */
-            if (ii < n_cells) {
-              n_upwind++;
-            }
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
-
-            cs_real_t bldfrp = (cs_real_t) ircflp;
-            /* Local limitation of the reconstruction */
-            if (df_limiter != NULL && ircflp > 0)
-              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
-
-            cs_i_cd_unsteady_upwind(bldfrp,
-                                    diipf[face_id],
-                                    djjpf[face_id],
-                                    grad[ii],
-                                    grad[jj],
-                                    _pvar[ii],
-                                    _pvar[jj],
-                                    &pif,
-                                    &pjf,
-                                    &pip,
-                                    &pjp);
-
-            cs_i_conv_flux(iconvp,
-                           thetap,
-                           imasac,
-                           _pvar[ii],
-                           _pvar[jj],
-                           pif,
-                           pif, /* no relaxation */
-                           pjf,
-                           pjf, /* no relaxation */
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           thetap,
-                           pip,
-                           pjp,
-                           pip,/* no relaxation */
-                           pjp,/* no relaxation */
-                           i_visc[face_id],
-                           fluxij);
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
     }
 
   /* --> Flux with no slope test or Min/Max Beta limiter
@@ -2240,208 +2934,56 @@ cs_convection_diffusion_scalar(int                       idtvar,
 
             cs_real_t bldfrp = (cs_real_t) ircflp;
             /* Local limitation of the reconstruction */
-            if (df_limiter != NULL && ircflp > 0)
-              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
-
-            cs_i_cd_steady(bldfrp,
-                           ischcp,
-                           relaxp,
-                           blencp,
-                           weight[face_id],
-                           cell_cen[ii],
-                           cell_cen[jj],
-                           i_face_cog[face_id],
-                           diipf[face_id],
-                           djjpf[face_id],
-                           grad[ii],
-                           grad[jj],
-                           gradup[ii],
-                           gradup[jj],
-                           _pvar[ii],
-                           _pvar[jj],
-                           pvara[ii],
-                           pvara[jj],
-                           &pifri,
-                           &pifrj,
-                           &pjfri,
-                           &pjfrj,
-                           &pip,
-                           &pjp,
-                           &pipr,
-                           &pjpr);
-
-            cs_i_conv_flux(iconvp,
-                           1.,
-                           1,
-                           _pvar[ii],
-                           _pvar[jj],
-                           pifri,
-                           pifrj,
-                           pjfri,
-                           pjfrj,
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           1.,
-                           pip,
-                           pjp,
-                           pipr,
-                           pjpr,
-                           i_visc[face_id],
-                           fluxij);
-
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
-
-          }
-        }
-      }
-
-    /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            cs_real_t beta = blencp;
-
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
-
-            /* Beta blending coefficient ensuring positivity of the scalar */
-            if (isstpp == 2) {
-              beta = CS_MAX(CS_MIN(cv_limiter[ii], cv_limiter[jj]), 0.);
-            }
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_real_t bldfrp = (cs_real_t) ircflp;
-            /* Local limitation of the reconstruction */
-            if (df_limiter != NULL && ircflp > 0)
-              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
-
-            if (ischcp != 4) {
-              cs_real_t hybrid_coef_ii, hybrid_coef_jj;
-              if (ischcp == 3) {
-                hybrid_coef_ii = CS_F_(hybrid_blend)->val[ii];
-                hybrid_coef_jj = CS_F_(hybrid_blend)->val[jj];
-              } else {
-                hybrid_coef_ii = 0.;
-                hybrid_coef_jj = 0.;
-              }
-              cs_i_cd_unsteady(bldfrp,
-                              ischcp,
-                              beta,
-                              weight[face_id],
-                              cell_cen[ii],
-                              cell_cen[jj],
-                              i_face_cog[face_id],
-                              hybrid_coef_ii,
-                              hybrid_coef_jj,
-                              diipf[face_id],
-                              djjpf[face_id],
-                              grad[ii],
-                              grad[jj],
-                              gradup[ii],
-                              gradup[jj],
-                              _pvar[ii],
-                              _pvar[jj],
-                              &pif,
-                              &pjf,
-                              &pip,
-                              &pjp);
-
-              cs_i_conv_flux(iconvp,
-                             thetap,
-                             imasac,
-                             _pvar[ii],
-                             _pvar[jj],
-                             pif,
-                             pif, /* no relaxation */
-                             pjf,
-                             pjf, /* no relaxation */
-                             i_massflux[face_id],
-                             1., /* xcpp */
-                             1., /* xcpp */
-                             fluxij);
-
-            } else {
-              /* NVD/TVD family of high accuracy schemes */
-
-              cs_lnum_t ic, id;
-
-              /* Determine central and downwind sides w.r.t. current face */
-              cs_central_downwind_cells(ii,
-                                        jj,
-                                        i_massflux[face_id],
-                                        &ic,  /* central cell id */
-                                        &id); /* downwind cell id */
-
-              cs_real_t courant_c = -1.;
-              if (courant != NULL)
-                courant_c = courant[ic];
-
-              cs_i_cd_unsteady_nvd(limiter_choice,
-                                   beta,
-                                   cell_cen[ic],
-                                   cell_cen[id],
-                                   i_face_normal[face_id],
-                                   i_face_cog[face_id],
-                                   grad[ic],
-                                   _pvar[ic],
-                                   _pvar[id],
-                                   local_max[ic],
-                                   local_min[ic],
-                                   courant_c,
-                                   &pif,
-                                   &pjf);
-
-              cs_i_conv_flux(iconvp,
-                             thetap,
-                             imasac,
-                             _pvar[ii],
-                             _pvar[jj],
-                             pif,
-                             pif, /* no relaxation */
-                             pjf,
-                             pjf, /* no relaxation */
-                             i_massflux[face_id],
-                             1., /* xcpp */
-                             1., /* xcpp */
-                             fluxij);
+            if (df_limiter != NULL && ircflp > 0)
+              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
-              /* Compute required quantities for diffusive flux */
-              cs_real_t recoi, recoj;
+            cs_i_cd_steady(bldfrp,
+                           ischcp,
+                           relaxp,
+                           blencp,
+                           weight[face_id],
+                           cell_cen[ii],
+                           cell_cen[jj],
+                           i_face_cog[face_id],
+                           diipf[face_id],
+                           djjpf[face_id],
+                           grad[ii],
+                           grad[jj],
+                           gradup[ii],
+                           gradup[jj],
+                           _pvar[ii],
+                           _pvar[jj],
+                           pvara[ii],
+                           pvara[jj],
+                           &pifri,
+                           &pifrj,
+                           &pjfri,
+                           &pjfrj,
+                           &pip,
+                           &pjp,
+                           &pipr,
+                           &pjpr);
 
-              cs_i_compute_quantities(bldfrp,
-                                      diipf[face_id],
-                                      djjpf[face_id],
-                                      grad[ii],
-                                      grad[jj],
-                                      _pvar[ii],
-                                      _pvar[jj],
-                                      &recoi,
-                                      &recoj,
-                                      &pip,
-                                      &pjp);
-            }
+            cs_i_conv_flux(iconvp,
+                           1.,
+                           1,
+                           _pvar[ii],
+                           _pvar[jj],
+                           pifri,
+                           pifrj,
+                           pjfri,
+                           pjfrj,
+                           i_massflux[face_id],
+                           1., /* xcpp */
+                           1., /* xcpp */
+                           fluxij);
 
             cs_i_diff_flux(idiffp,
-                           thetap,
+                           1.,
                            pip,
                            pjp,
-                           pip, /* no relaxation */
-                           pjp, /* no relaxation */
+                           pipr,
+                           pjpr,
                            i_visc[face_id],
                            fluxij);
 
@@ -2566,104 +3108,52 @@ cs_convection_diffusion_scalar(int                       idtvar,
         }
       }
 
-    /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            bool upwind_switch = false;
-
-            cs_real_2_t fluxij = {0.,0.};
-
-            cs_real_t pif, pjf;
-            cs_real_t pip, pjp;
-
-            cs_real_t bldfrp = (cs_real_t) ircflp;
-            /* Local limitation of the reconstruction */
-            if (df_limiter != NULL && ircflp > 0)
-              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
-
-            cs_i_cd_unsteady_slope_test(&upwind_switch,
-                                        iconvp,
-                                        bldfrp,
-                                        ischcp,
-                                        blencp,
-                                        blend_st,
-                                        weight[face_id],
-                                        i_dist[face_id],
-                                        i_face_surf[face_id],
-                                        cell_cen[ii],
-                                        cell_cen[jj],
-                                        i_face_normal[face_id],
-                                        i_face_cog[face_id],
-                                        diipf[face_id],
-                                        djjpf[face_id],
-                                        i_massflux[face_id],
-                                        grad[ii],
-                                        grad[jj],
-                                        gradup[ii],
-                                        gradup[jj],
-                                        gradst[ii],
-                                        gradst[jj],
-                                        _pvar[ii],
-                                        _pvar[jj],
-                                        &pif,
-                                        &pjf,
-                                        &pip,
-                                        &pjp);
-
-            cs_i_conv_flux(iconvp,
-                           thetap,
-                           imasac,
-                           _pvar[ii],
-                           _pvar[jj],
-                           pif,
-                           pif, /* no relaxation */
-                           pjf,
-                           pjf, /* no relaxation */
-                           i_massflux[face_id],
-                           1., /* xcpp */
-                           1., /* xcpp */
-                           fluxij);
-
-            cs_i_diff_flux(idiffp,
-                           thetap,
-                           pip,
-                           pjp,
-                           pip, /* no relaxation */
-                           pjp, /* no relaxation */
-                           i_visc[face_id],
-                           fluxij);
-
-            if (upwind_switch) {
-              /* in parallel, face will be counted by one and only one rank */
-              if (ii < n_cells)
-                n_upwind++;
-
-              if (v_slope_test != NULL) {
-                v_slope_test[ii] += fabs(i_massflux[face_id]) / cell_vol[ii];
-                v_slope_test[jj] += fabs(i_massflux[face_id]) / cell_vol[jj];
-              }
-            }
+    }
 
-            rhs[ii] -= fluxij[0];
-            rhs[jj] += fluxij[1];
+  } /* iupwin */
 
-          }
-        }
-      }
+  /* Unsteady: use the face kernel specialized for the current options */
+
+  if (idtvar >= 0) {
+
+    _i_conv_diff_scalar_t k
+      = _i_conv_diff_scalar_unsteady_kernel(iupwin,
+                                            ischcp,
+                                            isstpp,
+                                            (df_limiter != NULL && ircflp > 0));
+    assert(k != NULL);
+
+    const cs_real_t *hybrid_blend = NULL;
+    if (ischcp == 3)
+      hybrid_blend = CS_F_(hybrid_blend)->val;
+
+    n_upwind += k(m,
+                  fvq,
+                  iconvp,
+                  idiffp,
+                  imasac,
+                  ircflp,
+                  (cs_nvd_type_t)limiter_choice,
+                  blencp,
+                  blend_st,
+                  thetap,
+                  cv_limiter,
+                  df_limiter,
+                  hybrid_blend,
+                  courant,
+                  local_max,
+                  local_min,
+                  (const cs_real_3_t *)grad,
+                  (const cs_real_3_t *)gradup,
+                  (const cs_real_3_t *)gradst,
+                  _pvar,
+                  i_massflux,
+                  i_visc,
+                  v_slope_test,
+                  rhs);
 
-    } /* idtvar */
+  }
 
-  } /* iupwin */
 
 
   if (iwarnp >= 2 && iconvp == 1) {
@@ -3370,7 +3860,7 @@ cs_face_convection_scalar(int                       idtvar,
                                     0, /* hyd_p_flag */
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     NULL, /* f_ext exterior force */
@@ -3741,7 +4231,7 @@ cs_face_convection_scalar(int                       idtvar,
               if (courant != NULL)
                 courant_c = courant[ic];
 
-              cs_i_cd_unsteady_nvd(limiter_choice,
+              cs_i_cd_unsteady_nvd((cs_nvd_type_t)limiter_choice,
                                    beta,
                                    cell_cen[ic],
                                    cell_cen[id],
@@ -4303,7 +4793,6 @@ cs_convection_diffusion_vector(int                         idtvar,
   const cs_real_t *restrict weight = fvq->weight;
   const cs_real_t *restrict i_dist = fvq->i_dist;
   const cs_real_t *restrict i_face_surf = fvq->i_face_surf;
-  const cs_real_t *restrict cell_vol = fvq->cell_vol;
   const cs_real_3_t *restrict cell_cen
     = (const cs_real_3_t *restrict)fvq->cell_cen;
   const cs_real_3_t *restrict i_face_normal
@@ -4476,7 +4965,7 @@ cs_convection_diffusion_vector(int                         idtvar,
                                     inc,
                                     nswrgp,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     coefav,
@@ -4572,108 +5061,7 @@ cs_convection_diffusion_vector(int                         idtvar,
               _pi[i]  = _pvar[ii][i];
               _pj[i]  = _pvar[jj][i];
               _pia[i] = pvara[ii][i];
-              _pja[i] = pvara[jj][i];
-            }
-
-            /* Scaling due to mass balance in porous modelling */
-            if (i_f_face_factor != NULL) {
-              cs_real_3_t n;
-              cs_math_3_normalize(i_face_normal[face_id], n);
-
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pia);
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pja);
-            }
-
-            cs_real_t bldfrp = (cs_real_t) ircflp;
-            /* Local limitation of the reconstruction */
-            if (df_limiter != NULL && ircflp > 0)
-              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
-
-            cs_i_cd_steady_upwind_vector(bldfrp,
-                                         relaxp,
-                                         diipf[face_id],
-                                         djjpf[face_id],
-                                         (const cs_real_3_t *)grad[ii],
-                                         (const cs_real_3_t *)grad[jj],
-                                         _pi,
-                                         _pj,
-                                         _pia,
-                                         _pja,
-                                         pifri,
-                                         pifrj,
-                                         pjfri,
-                                         pjfrj,
-                                         pip,
-                                         pjp,
-                                         pipr,
-                                         pjpr);
-
-
-            cs_i_conv_flux_vector(iconvp,
-                                  1.,
-                                  1,
-                                  _pvar[ii],
-                                  _pvar[jj],
-                                  pifri,
-                                  pifrj,
-                                  pjfri,
-                                  pjfrj,
-                                  i_massflux[face_id],
-                                  fluxi,
-                                  fluxj);
-
-
-            cs_i_diff_flux_vector(idiffp,
-                                  1.,
-                                  pip,
-                                  pjp,
-                                  pipr,
-                                  pjpr,
-                                  i_visc[face_id],
-                                  fluxi,
-                                  fluxj);
-
-           for (int isou = 0; isou < 3; isou++) {
-              rhs[ii][isou] -= fluxi[isou];
-              rhs[jj][isou] += fluxj[isou];
-           }
-
-          }
-        }
-      }
-
-    /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            /* in parallel, face will be counted by one and only one rank */
-            if (ii < n_cells) {
-              n_upwind++;
-            }
-
-            cs_real_t fluxi[3], fluxj[3] ;
-            for (int i = 0; i < 3; i++) {
-              fluxi[i] = 0;
-              fluxj[i] = 0;
-            }
-            cs_real_3_t pip, pjp;
-            cs_real_3_t pif, pjf;
-            cs_real_3_t _pi, _pj;
-
-            for (int i = 0; i < 3; i++) {
-              _pi[i]  = _pvar[ii][i];
-              _pj[i]  = _pvar[jj][i];
+              _pja[i] = pvara[jj][i];
             }
 
             /* Scaling due to mass balance in porous modelling */
@@ -4682,7 +5070,9 @@ cs_convection_diffusion_vector(int                         idtvar,
               cs_math_3_normalize(i_face_normal[face_id], n);
 
               cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
+              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pia);
               cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
+              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pja);
             }
 
             cs_real_t bldfrp = (cs_real_t) ircflp;
@@ -4690,46 +5080,54 @@ cs_convection_diffusion_vector(int                         idtvar,
             if (df_limiter != NULL && ircflp > 0)
               bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
 
-            cs_i_cd_unsteady_upwind_vector(bldfrp,
-                                           diipf[face_id],
-                                           djjpf[face_id],
-                                           (const cs_real_3_t *)grad[ii],
-                                           (const cs_real_3_t *)grad[jj],
-                                           _pi,
-                                           _pj,
-                                           pif,
-                                           pjf,
-                                           pip,
-                                           pjp);
+            cs_i_cd_steady_upwind_vector(bldfrp,
+                                         relaxp,
+                                         diipf[face_id],
+                                         djjpf[face_id],
+                                         (const cs_real_3_t *)grad[ii],
+                                         (const cs_real_3_t *)grad[jj],
+                                         _pi,
+                                         _pj,
+                                         _pia,
+                                         _pja,
+                                         pifri,
+                                         pifrj,
+                                         pjfri,
+                                         pjfrj,
+                                         pip,
+                                         pjp,
+                                         pipr,
+                                         pjpr);
+
 
             cs_i_conv_flux_vector(iconvp,
-                                  thetap,
-                                  imasac,
+                                  1.,
+                                  1,
                                   _pvar[ii],
                                   _pvar[jj],
-                                  pif,
-                                  pif, /* no relaxation */
-                                  pjf,
-                                  pjf, /* no relaxation */
+                                  pifri,
+                                  pifrj,
+                                  pjfri,
+                                  pjfrj,
                                   i_massflux[face_id],
                                   fluxi,
                                   fluxj);
 
 
             cs_i_diff_flux_vector(idiffp,
-                                  thetap,
+                                  1.,
                                   pip,
                                   pjp,
-                                  pip, /* no relaxation */
-                                  pjp, /* no relaxation */
+                                  pipr,
+                                  pjpr,
                                   i_visc[face_id],
                                   fluxi,
                                   fluxj);
 
-            for (int isou = 0; isou < 3; isou++) {
+           for (int isou = 0; isou < 3; isou++) {
               rhs[ii][isou] -= fluxi[isou];
               rhs[jj][isou] += fluxj[isou];
-            }
+           }
 
           }
         }
@@ -4850,110 +5248,6 @@ cs_convection_diffusion_vector(int                         idtvar,
         }
       }
 
-      /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            cs_real_t fluxi[3], fluxj[3] ;
-            for (int isou =  0; isou < 3; isou++) {
-              fluxi[isou] = 0;
-              fluxj[isou] = 0;
-            }
-
-            cs_real_3_t pip, pjp;
-            cs_real_3_t pif, pjf;
-            cs_real_3_t _pi, _pj;
-
-            for (int i = 0; i < 3; i++) {
-              _pi[i]  = _pvar[ii][i];
-              _pj[i]  = _pvar[jj][i];
-            }
-
-            /* Scaling due to mass balance in porous modelling */
-            if (i_f_face_factor != NULL) {
-              cs_real_3_t n;
-              cs_math_3_normalize(i_face_normal[face_id], n);
-
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
-            }
-
-            cs_real_t hybrid_coef_ii, hybrid_coef_jj;
-            if (ischcp == 3) {
-              hybrid_coef_ii = CS_F_(hybrid_blend)->val[ii];
-              hybrid_coef_jj = CS_F_(hybrid_blend)->val[jj];
-            } else {
-              hybrid_coef_ii = 0.;
-              hybrid_coef_jj = 0.;
-            }
-
-            cs_real_t bldfrp = (cs_real_t) ircflp;
-            /* Local limitation of the reconstruction */
-            if (df_limiter != NULL && ircflp > 0)
-              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
-
-            cs_i_cd_unsteady_vector(bldfrp,
-                                    ischcp,
-                                    blencp,
-                                    weight[face_id],
-                                    cell_cen[ii],
-                                    cell_cen[jj],
-                                    i_face_cog[face_id],
-                                    hybrid_coef_ii,
-                                    hybrid_coef_jj,
-                                    diipf[face_id],
-                                    djjpf[face_id],
-                                    (const cs_real_3_t *)grad[ii],
-                                    (const cs_real_3_t *)grad[jj],
-                                    _pi,
-                                    _pj,
-                                    pif,
-                                    pjf,
-                                    pip,
-                                    pjp);
-
-            cs_i_conv_flux_vector(iconvp,
-                                  thetap,
-                                  imasac,
-                                  _pvar[ii],
-                                  _pvar[jj],
-                                  pif,
-                                  pif, /* no relaxation */
-                                  pjf,
-                                  pjf, /* no relaxation */
-                                  i_massflux[face_id],
-                                  fluxi,
-                                  fluxj);
-
-
-            cs_i_diff_flux_vector(idiffp,
-                                  thetap,
-                                  pip,
-                                  pjp,
-                                  pip, /* no relaxation */
-                                  pjp, /* no relaxation */
-                                  i_visc[face_id],
-                                  fluxi,
-                                  fluxj);
-
-            for (int isou = 0; isou < 3; isou++) {
-              rhs[ii][isou] -= fluxi[isou];
-              rhs[jj][isou] += fluxj[isou];
-            }
-
-          }
-        }
-      }
-
     }
 
     /* --> Flux with slope test
@@ -5079,125 +5373,47 @@ cs_convection_diffusion_vector(int                         idtvar,
         }
       }
 
-      /* Unsteady */
-    } else {
-
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
-#       pragma omp parallel for reduction(+:n_upwind)
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-          for (cs_lnum_t face_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               face_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               face_id++) {
-
-            cs_lnum_t ii = i_face_cells[face_id][0];
-            cs_lnum_t jj = i_face_cells[face_id][1];
-
-            cs_real_t fluxi[3], fluxj[3] ;
-            for (int isou =  0; isou < 3; isou++) {
-              fluxi[isou] = 0;
-              fluxj[isou] = 0;
-            }
-            cs_real_3_t pip, pjp;
-            cs_real_3_t pif, pjf;
-            bool upwind_switch = false;
-            cs_real_3_t _pi, _pj;
-
-            for (int i = 0; i < 3; i++) {
-              _pi[i]  = _pvar[ii][i];
-              _pj[i]  = _pvar[jj][i];
-            }
-
-            /* Scaling due to mass balance in porous modelling */
-            if (i_f_face_factor != NULL) {
-              cs_real_3_t n;
-              cs_math_3_normalize(i_face_normal[face_id], n);
-
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][0], _pi);
-              cs_math_3_normal_scaling(n, i_f_face_factor[face_id][1], _pj);
-            }
-
-            cs_real_t bldfrp = (cs_real_t) ircflp;
-            /* Local limitation of the reconstruction */
-            if (df_limiter != NULL && ircflp > 0)
-              bldfrp = CS_MAX(CS_MIN(df_limiter[ii], df_limiter[jj]), 0.);
-
-            cs_i_cd_unsteady_slope_test_vector(&upwind_switch,
-                                               iconvp,
-                                               bldfrp,
-                                               ischcp,
-                                               blencp,
-                                               blend_st,
-                                               weight[face_id],
-                                               i_dist[face_id],
-                                               i_face_surf[face_id],
-                                               cell_cen[ii],
-                                               cell_cen[jj],
-                                               i_face_normal[face_id],
-                                               i_face_cog[face_id],
-                                               diipf[face_id],
-                                               djjpf[face_id],
-                                               i_massflux[face_id],
-                                               (const cs_real_3_t *)grad[ii],
-                                               (const cs_real_3_t *)grad[jj],
-                                               (const cs_real_3_t *)grdpa[ii],
-                                               (const cs_real_3_t *)grdpa[jj],
-                                               _pi,
-                                               _pj,
-                                               pif,
-                                               pjf,
-                                               pip,
-                                               pjp);
-
-            cs_i_conv_flux_vector(iconvp,
-                                  thetap,
-                                  imasac,
-                                  _pvar[ii],
-                                  _pvar[jj],
-                                  pif,
-                                  pif, /* no relaxation */
-                                  pjf,
-                                  pjf, /* no relaxation */
-                                  i_massflux[face_id],
-                                  fluxi,
-                                  fluxj);
-
-
-            cs_i_diff_flux_vector(idiffp,
-                                  thetap,
-                                  pip,
-                                  pjp,
-                                  pip, /* no relaxation */
-                                  pjp, /* no relaxation */
-                                  i_visc[face_id],
-                                  fluxi,
-                                  fluxj);
-
-            if (upwind_switch) {
+    }
 
-              /* in parallel, face will be counted by one and only one rank */
-              if (ii < n_cells)
-                n_upwind++;
+  } /* iupwin */
 
-              if (v_slope_test != NULL) {
-                v_slope_test[ii] += fabs(i_massflux[face_id]) / cell_vol[ii];
-                v_slope_test[jj] += fabs(i_massflux[face_id]) / cell_vol[jj];
-              }
-            }
+  /* Unsteady: use the face kernel specialized for the current options */
 
-            for (int isou = 0; isou < 3; isou++) {
+  if (idtvar >= 0) {
 
-              rhs[ii][isou] -= fluxi[isou];
-              rhs[jj][isou] += fluxj[isou];
+    _i_conv_diff_vector_t k
+      = _i_conv_diff_vector_unsteady_kernel(iupwin,
+                                            ischcp,
+                                            isstpp,
+                                            (df_limiter != NULL && ircflp > 0),
+                                            (i_f_face_factor != NULL));
+    assert(k != NULL);
 
-            } /* isou */
+    const cs_real_t *hybrid_blend = NULL;
+    if (ischcp == 3)
+      hybrid_blend = CS_F_(hybrid_blend)->val;
 
-          }
-        }
-      }
+    n_upwind += k(m,
+                  fvq,
+                  iconvp,
+                  idiffp,
+                  imasac,
+                  ircflp,
+                  blencp,
+                  blend_st,
+                  thetap,
+                  df_limiter,
+                  hybrid_blend,
+                  (const cs_real_33_t *)grad,
+                  (const cs_real_33_t *)grdpa,
+                  _pvar,
+                  i_massflux,
+                  i_visc,
+                  v_slope_test,
+                  rhs);
 
-    } /* idtvar */
+  }
 
-  } /* iupwin */
 
   if (iwarnp >= 2 && iconvp == 1) {
 
@@ -6096,7 +6312,7 @@ cs_convection_diffusion_tensor(int                         idtvar,
                                     inc,
                                     nswrgp,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     coefa,
@@ -7112,7 +7328,7 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                     0, /* hyd_p_flag */
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     NULL, /* f_ext exterior force */
@@ -7525,7 +7741,7 @@ cs_convection_diffusion_thermal(int                       idtvar,
                                         &ic,  /* central cell id */
                                         &id); /* downwind cell id */
 
-              cs_i_cd_unsteady_nvd(limiter_choice,
+              cs_i_cd_unsteady_nvd((cs_nvd_type_t)limiter_choice,
                                    beta,
                                    cell_cen[ic],
                                    cell_cen[id],
@@ -8417,7 +8633,7 @@ cs_anisotropic_diffusion_scalar(int                       idtvar,
                                     0, /* hyd_p_flag */
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     NULL, /* f_ext exterior force */
@@ -9093,7 +9309,7 @@ cs_anisotropic_left_diffusion_vector(int                         idtvar,
                                     inc,
                                     nswrgp,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     coefav,
@@ -9636,7 +9852,7 @@ cs_anisotropic_right_diffusion_vector(int                         idtvar,
                                     inc,
                                     nswrgp,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     coefav,
@@ -10366,7 +10582,7 @@ cs_anisotropic_diffusion_tensor(int                         idtvar,
                                     inc,
                                     nswrgp,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     coefa,
@@ -10989,7 +11205,7 @@ cs_face_diffusion_potential(const int                 f_id,
                                     iphydp,
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     frcxt,
@@ -11394,7 +11610,7 @@ cs_face_anisotropic_diffusion_potential(const int                 f_id,
                                     iphydp,
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     frcxt,
@@ -11810,7 +12026,7 @@ cs_diffusion_potential(const int                 f_id,
                                     iphydp,
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     frcxt,
@@ -12235,7 +12451,7 @@ cs_anisotropic_diffusion_potential(const int                 f_id,
                                     iphydp,
                                     w_stride,
                                     iwarnp,
-                                    imligp,
+                                    (cs_gradient_limit_t)imligp,
                                     epsrgp,
                                     climgp,
                                     frcxt,
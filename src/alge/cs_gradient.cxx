@@ -64,6 +64,7 @@
 #include "cs_math.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_cartesian.h"
 #include "cs_mesh_quantities.h"
 #include "cs_parall.h"
 #include "cs_porous_model.h"
@@ -169,11 +170,21 @@ const char *cs_gradient_type_name[]
 static cs_timer_counter_t   _gradient_t_tot;     /* Total time in gradients */
 static int _gradient_stat_id = -1;
 
+/* Maximum number of variables handled together by batched gradients
+   (larger blocks increase the working set of each face traversal) */
+
+static const int _n_multi_vars_max = 4;
+
 /* Gradient quantities */
 
 static int                        _n_gradient_quantities = 0;
 static cs_gradient_quantities_t  *_gradient_quantities = NULL;
 
+/* Local stencil of cartesian meshes, used for least-squares gradients
+   if requested and available */
+
+static bool  _use_cartesian_stencil = false;
+
 /* Multithread assembly algorithm selection */
 
 const cs_e2n_sum_t _e2n_sum_type = CS_E2N_SUM_STORE_THEN_GATHER;
@@ -272,6 +283,26 @@ _gradient_quantities_destroy(void)
   _n_gradient_quantities = 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Return the local stencil of a cartesian mesh, if its use is
+ *         requested and the mesh structure allows it.
+ *
+ * \param[in]  m  pointer to associated mesh structure
+ *
+ * \return  pointer to cartesian mesh stencil, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static const cs_mesh_cartesian_stencil_t *
+_get_cartesian_stencil(const cs_mesh_t  *m)
+{
+  if (_use_cartesian_stencil == false)
+    return NULL;
+
+  return cs_mesh_cartesian_get_stencil(m);
+}
+
 /*----------------------------------------------------------------------------
  * Factorize dense p*p symmetric matrices.
  * Only the lower triangular part is stored and the factorization is performed
@@ -676,6 +707,38 @@ _sync_scalar_gradient_halo(const cs_mesh_t  *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Synchronize halos for a vector or tensor gradient.
+ *
+ * template parameters:
+ *   stride         3 for vectors, 6 for symmetric tensors
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   halo_type      <-- halo type (extended or not)
+ *   grad           <-> gradient (dv_i/dx_j : grad[][i][j])
+ *----------------------------------------------------------------------------*/
+
+template <const cs_lnum_t stride>
+static void
+_sync_strided_gradient_halo(const cs_mesh_t  *m,
+                            cs_halo_type_t    halo_type,
+                            cs_real_t (*restrict grad)[stride][3])
+{
+  if (m->halo != NULL) {
+    cs_halo_sync_var_strided
+      (m->halo, halo_type, (cs_real_t *)grad, stride*3);
+    if (m->have_rotation_perio) {
+      if (stride == 3)
+        cs_halo_perio_sync_var_tens
+          (m->halo, halo_type, (cs_real_t *)grad);
+      else if (stride == 6)
+        cs_halo_perio_sync_var_sym_tens_grad
+          (m->halo, halo_type, (cs_real_t *)grad);
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Clip the gradient of a scalar if necessary. This function deals with
  * the standard or extended neighborhood.
@@ -2762,6 +2825,86 @@ _recompute_lsq_scalar_cocg(const cs_mesh_t                *m,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Add interior face contributions to the right-hand side of the unweighted
+ * least-squares gradient using the local stencil of a cartesian mesh.
+ *
+ * Contributions are gathered by cell from its stencil neighbors, with
+ * no indirect addressing or write conflicts, so no face renumbering
+ * is required. Faces out of stencil are handled in the usual way.
+ *
+ * parameters:
+ *   s              <-- pointer to cartesian mesh stencil
+ *   i_face_cells   <-- interior faces -> cells connectivity
+ *   cell_cen       <-- cell centers
+ *   rhsv           <-> right-hand side (variable value in 4th component)
+ *----------------------------------------------------------------------------*/
+
+static void
+_lsq_scalar_rhs_cartesian(const cs_mesh_cartesian_stencil_t  *s,
+                          const cs_lnum_2_t         *restrict i_face_cells,
+                          const cs_real_3_t         *restrict cell_cen,
+                          cs_real_4_t               *restrict rhsv)
+{
+  const cs_lnum_t n_cells = s->n_cells;
+  const int n_dirs = s->n_dirs;
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+
+    const unsigned char c_nbr = s->cell_nbr[ii];
+    cs_real_t c_rhs[3] = {0., 0., 0.};
+
+    for (int d = 0; d < n_dirs; d++) {
+      for (int l = 0; l < 2; l++) {
+
+        if ((c_nbr & (1 << (2*d + l))) == 0)
+          continue;
+
+        cs_lnum_t jj = (l == 0) ? ii + s->shift[d] : ii - s->shift[d];
+
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+        /* (P_j - P_i) / ||d||^2 */
+        cs_real_t pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                         / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          c_rhs[ll] += dc[ll] * pfac;
+
+      }
+    }
+
+    for (cs_lnum_t ll = 0; ll < 3; ll++)
+      rhsv[ii][ll] += c_rhs[ll];
+
+  }
+
+  /* Faces out of stencil */
+
+  for (cs_lnum_t i = 0; i < s->n_x_faces; i++) {
+
+    cs_lnum_t f_id = s->x_face_id[i];
+    cs_lnum_t ii = i_face_cells[f_id][0];
+    cs_lnum_t jj = i_face_cells[f_id][1];
+
+    cs_real_t dc[3];
+    for (cs_lnum_t ll = 0; ll < 3; ll++)
+      dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+    cs_real_t pfac =   (rhsv[jj][3] - rhsv[ii][3])
+                     / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
+
+    for (cs_lnum_t ll = 0; ll < 3; ll++) {
+      rhsv[ii][ll] += dc[ll] * pfac;
+      rhsv[jj][ll] += dc[ll] * pfac;
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient using least-squares reconstruction.
  *
@@ -2901,7 +3044,13 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
 
   /* Contribution from interior faces */
 
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  const cs_mesh_cartesian_stencil_t *c_stencil
+    = (c_weight == NULL) ? _get_cartesian_stencil(m) : NULL;
+
+  if (c_stencil != NULL)
+    _lsq_scalar_rhs_cartesian(c_stencil, i_face_cells, cell_cen, rhsv);
+
+  for (int g_id = 0; c_stencil == NULL && g_id < n_i_groups; g_id++) {
 
 #   pragma omp parallel for
     for (int t_id = 0; t_id < n_i_threads; t_id++) {
@@ -3049,50 +3198,58 @@ _lsq_scalar_gradient(const cs_mesh_t                *m,
   _sync_scalar_gradient_halo(m, CS_HALO_STANDARD, grad);
 
   BFT_FREE(rhsv);
-}
 
+}
 /*----------------------------------------------------------------------------
- * Compute cell gradient by least-squares reconstruction with a volume force
- * generating a hydrostatic pressure component.
+ * Compute cell gradients of several scalars using least-squares
+ * reconstruction, with a single traversal of the mesh faces.
+ *
+ * Values are interleaved by cell, so that the geometric quantities of each
+ * face are loaded only once for all variables. The shared cocg matrices
+ * are used for interior cells, and boundary cell matrices are completed
+ * locally for each variable, so the saved cocg values are not modified.
+ *
+ * The right-hand side is stored by cell, then component, then variable,
+ * so that loops on variables have a unit stride.
  *
  * template parameters:
- *   e2n           type of assembly algorithm used
+ *   n              number of variables
  *
  * parameters:
  *   m              <-- pointer to associated mesh structure
  *   fvq            <-- pointer to associated finite volume quantities
- *   cpl            <-- structure associated with internal coupling, or NULL
  *   halo_type      <-- halo type (extended or not)
- *   recompute_cocg <-- flag to recompute cocg
- *   hyd_p_flag     <-- flag for hydrostatic pressure
  *   inc            <-- if 0, solve on increment; 1 otherwise
- *   f_ext          <-- exterior force generating pressure
- *   coefap         <-- B.C. coefficients for boundary face normals
- *   coefbp         <-- B.C. coefficients for boundary face normals
- *   pvar           <-- variable
- *   c_weight_s     <-- weighted gradient coefficient variable,
- *                      or NULL
- *   grad           --> gradient of pvar (halo prepared for periodicity
- *                      of rotation)
+ *   coefap         <-- B.C. coefficients for boundary face normals,
+ *                      for each variable
+ *   coefbp         <-- B.C. coefficients for boundary face normals,
+ *                      for each variable
+ *   pvar           <-- interleaved variables (size: n_cells_ext*n),
+ *                      with synchronized ghost values
+ *   rhsv           --- work array (size: n_cells_ext*3*n)
+ *   grad           --> gradient of each variable (halo prepared for
+ *                      periodicity of rotation)
  *----------------------------------------------------------------------------*/
 
-template <const cs_e2n_sum_t e2n>
+template <const cs_lnum_t n>
 static void
-_lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
-                           const cs_mesh_quantities_t     *fvq,
-                           cs_halo_type_t                  halo_type,
-                           bool                            recompute_cocg,
-                           cs_real_t                       inc,
-                           const cs_real_3_t               f_ext[],
-                           const cs_real_t                 coefap[],
-                           const cs_real_t                 coefbp[],
-                           const cs_real_t                 pvar[],
-                           const cs_real_t       *restrict c_weight_s,
-                           cs_real_3_t           *restrict grad)
+_lsq_scalar_gradient_multi(const cs_mesh_t              *m,
+                           const cs_mesh_quantities_t   *fvq,
+                           cs_halo_type_t                halo_type,
+                           cs_real_t                     inc,
+                           const cs_real_t              *coefap[],
+                           const cs_real_t              *coefbp[],
+                           const cs_real_t     *restrict pvar,
+                           cs_real_t           *restrict rhsv,
+                           cs_real_3_t                  *grad[])
 {
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_t n_b_cells = m->n_b_cells;
+  const int n_i_groups = m->i_face_numbering->n_groups;
+  const int n_i_threads = m->i_face_numbering->n_threads;
   const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
   const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
 
   const cs_lnum_2_t *restrict i_face_cells
@@ -3112,171 +3269,393 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
     = (const cs_real_t *restrict)fvq->b_face_surf;
   const cs_real_t *restrict b_dist
     = (const cs_real_t *restrict)fvq->b_dist;
-  const cs_real_3_t *restrict i_face_cog
-    = (const cs_real_3_t *restrict)fvq->i_face_cog;
-  const cs_real_3_t *restrict b_face_cog
-    = (const cs_real_3_t *restrict)fvq->b_face_cog;
   const cs_real_3_t *restrict diipb
     = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_t *restrict weight = fvq->weight;
+
+  const cs_lnum_t n3 = n*3;
 
   cs_cocg_6_t  *restrict cocgb = NULL;
   cs_cocg_6_t  *restrict cocg = NULL;
 
-  /* Additional terms due to porosity */
-  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
-
-  cs_real_t *i_poro_duq_0;
-  cs_real_t *i_poro_duq_1;
-  cs_real_t *b_poro_duq;
-  cs_real_t _f_ext = 0.;
-
-  int is_porous = 0;
-  if (f_i_poro_duq_0 != NULL) {
-    is_porous = 1;
-    i_poro_duq_0 = f_i_poro_duq_0->val;
-    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
-    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
-  } else {
-    i_poro_duq_0 = &_f_ext;
-    i_poro_duq_1 = &_f_ext;
-    b_poro_duq = &_f_ext;
-  }
-
   _get_cell_cocg_lsq(m,
                      halo_type,
-                     false, /* accel, not yet handled */
+                     false,
                      fvq,
-                     NULL,  /* cpl, handled locally here */
+                     NULL,
                      &cocg,
                      &cocgb);
 
-  /* Reconstruct gradients using least squares for non-orthogonal meshes */
-  /*---------------------------------------------------------------------*/
-
-  /* Compute cocg and save contribution at boundaries */
-
-  if (recompute_cocg)
-    _recompute_lsq_scalar_cocg(m,
-                               fvq,
-                               NULL,  /* cpl */
-                               coefbp,
-                               cocgb,
-                               cocg);
-
   /* Compute Right-Hand Side */
   /*-------------------------*/
 
-  cs_real_4_t  *restrict rhsv;
-  BFT_MALLOC(rhsv, n_cells_ext, cs_real_4_t);
-
-# pragma omp parallel for
+# pragma omp parallel for if(n_cells_ext > CS_THR_MIN)
   for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    rhsv[c_id][0] = 0.0;
-    rhsv[c_id][1] = 0.0;
-    rhsv[c_id][2] = 0.0;
-    rhsv[c_id][3] = pvar[c_id];
+    for (cs_lnum_t i = 0; i < n3; i++)
+      rhsv[c_id*n3 + i] = 0.0;
   }
 
-  /* Contribution from interior faces
-     -------------------------------- */
+  /* Contribution from interior faces */
 
-  /* Test on e2n (template argument for algorithm type) */
+  for (int g_id = 0; g_id < n_i_groups; g_id++) {
 
-  if (e2n != CS_E2N_SUM_GATHER) {
+#   pragma omp parallel for
+    for (int t_id = 0; t_id < n_i_threads; t_id++) {
 
-    cs_real_3_t *f_ctb = NULL;
+      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
+           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
+           f_id++) {
 
-    if (e2n == CS_E2N_SUM_STORE_THEN_GATHER) {
-      BFT_MALLOC(f_ctb, m->n_i_faces, cs_real_3_t);
-    }
+        cs_lnum_t ii = i_face_cells[f_id][0];
+        cs_lnum_t jj = i_face_cells[f_id][1];
 
-    cs_lnum_t n_i_groups, n_i_threads;
-    cs_mesh_i_faces_thread_block_count(m, e2n, 0, &n_i_groups, &n_i_threads);
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+        const cs_real_t *restrict pvar_i = pvar + ii*n;
+        const cs_real_t *restrict pvar_j = pvar + jj*n;
+        cs_real_t *restrict rhsv_i = rhsv + ii*n3;
+        cs_real_t *restrict rhsv_j = rhsv + jj*n3;
 
-        cs_lnum_t s_id, e_id;
-        cs_mesh_i_faces_thread_block_range(m, e2n, g_id, t_id, n_i_threads, 0,
-                                           &s_id, &e_id);
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          cs_real_t dcd = dc[ll] * ddc;
+          for (cs_lnum_t k = 0; k < n; k++) {
+            /* (P_j - P_i) / ||d||^2 */
+            cs_real_t fctb = (pvar_j[k] - pvar_i[k]) * dcd;
+            rhsv_i[ll*n + k] += fctb;
+            rhsv_j[ll*n + k] += fctb;
+          }
+        }
 
-        if (c_weight_s != NULL) {  /* With cell weighting */
+      } /* loop on faces */
 
-          for (cs_lnum_t f_id = s_id; f_id < e_id; f_id++) {
+    } /* loop on threads */
 
-            cs_lnum_t ii = i_face_cells[f_id][0];
-            cs_lnum_t jj = i_face_cells[f_id][1];
+  } /* loop on thread groups */
 
-            cs_real_2_t poro = {i_poro_duq_0[is_porous*f_id],
-                                i_poro_duq_1[is_porous*f_id]};
+  /* Contribution from extended neighborhood */
 
-            cs_real_t dvarij, pfac, dc[3];
+  if (halo_type == CS_HALO_EXTENDED && cell_cells_idx != NULL) {
 
-            for (cs_lnum_t ll = 0; ll < 3; ll++)
-              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+#   pragma omp parallel for
+    for (cs_lnum_t ii = 0; ii < n_cells; ii++) {
+      for (cs_lnum_t cidx = cell_cells_idx[ii];
+           cidx < cell_cells_idx[ii+1];
+           cidx++) {
 
-            if (e2n == CS_E2N_SUM_STORE_THEN_GATHER) {
-              /* In this case, we do not use other terms of rhsv in this loop,
-                 so caching will be better directly using pvar. */
-              dvarij = pvar[jj] - pvar[ii];
-            }
-            else {
-              /* In this case, use rhsv, as access patterns lead to better
-                 caching behavior (or did when last tested) */
-              dvarij = rhsv[jj][3] - rhsv[ii][3];
-            }
+        cs_lnum_t jj = cell_cells_lst[cidx];
 
-            pfac =  (  dvarij
-                     + cs_math_3_distance_dot_product(i_face_cog[f_id],
-                                                      cell_cen[ii],
-                                                      f_ext[ii])
-                     + poro[0]
-                     - cs_math_3_distance_dot_product(i_face_cog[f_id],
-                                                      cell_cen[jj],
-                                                      f_ext[jj])
-                     - poro[1])
-                   / cs_math_3_square_norm(dc);
+        cs_real_t dc[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
 
-            cs_real_t pond = weight[f_id];
+        cs_real_t ddc = 1. / (dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-            pfac /= (  pond       *c_weight_s[ii]
-                     + (1. - pond)*c_weight_s[jj]);
+        const cs_real_t *restrict pvar_i = pvar + ii*n;
+        const cs_real_t *restrict pvar_j = pvar + jj*n;
+        cs_real_t *restrict rhsv_i = rhsv + ii*n3;
 
-            if (e2n == CS_E2N_SUM_SCATTER) {
-              cs_real_t fctb[3];
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                fctb[ll] = dc[ll] * pfac;
+        for (cs_lnum_t ll = 0; ll < 3; ll++) {
+          cs_real_t dcd = dc[ll] * ddc;
+          for (cs_lnum_t k = 0; k < n; k++)
+            rhsv_i[ll*n + k] += (pvar_j[k] - pvar_i[k]) * dcd;
+        }
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[ii][ll] += c_weight_s[jj] * fctb[ll];
+      }
+    }
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[jj][ll] += c_weight_s[ii] * fctb[ll];
-            }
-            else if (e2n == CS_E2N_SUM_SCATTER_ATOMIC) {
-              cs_real_t fctb[3];
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                fctb[ll] = dc[ll] * pfac;
+  } /* End for extended neighborhood */
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                #pragma omp atomic
-                rhsv[ii][ll] += c_weight_s[jj] * fctb[ll];
+  /* Boundary cell cocg, completed for each variable
+     (see _recompute_lsq_scalar_cocg) */
 
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                #pragma omp atomic
-                rhsv[jj][ll] += c_weight_s[ii] * fctb[ll];
-            }
-            else if (e2n == CS_E2N_SUM_STORE_THEN_GATHER) {
-              for (cs_lnum_t ll = 0; ll < 3; ll++)
-                f_ctb[f_id][ll] = dc[ll] * pfac;
-            }
-          }
+  cs_lnum_t *c_b_id;
+  BFT_MALLOC(c_b_id, n_cells, cs_lnum_t);
 
-        }
-        else { /* Without cell weights */
+  cs_real_t *restrict b_cocg;
+  BFT_MALLOC(b_cocg, n_b_cells*6*n, cs_real_t);
+
+# pragma omp parallel for if(n_cells > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    c_b_id[c_id] = -1;
+
+# pragma omp parallel for if(n_b_cells > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_b_cells; ii++) {
+    c_b_id[m->b_cells[ii]] = ii;
+    for (cs_lnum_t ll = 0; ll < 6; ll++) {
+      for (cs_lnum_t k = 0; k < n; k++)
+        b_cocg[(ii*6 + ll)*n + k] = cocgb[ii][ll];
+    }
+  }
+
+  /* Contribution from boundary faces */
+
+# pragma omp parallel for
+  for (int t_id = 0; t_id < n_b_threads; t_id++) {
+
+    for (cs_lnum_t f_id = b_group_index[t_id*2];
+         f_id < b_group_index[t_id*2 + 1];
+         f_id++) {
+
+      cs_lnum_t ii = b_face_cells[f_id];
+
+      cs_real_t unddij = 1. / b_dist[f_id];
+      cs_real_t udbfs = 1. / b_face_surf[f_id];
+
+      const cs_real_t *restrict pvar_i = pvar + ii*n;
+      cs_real_t *restrict rhsv_i = rhsv + ii*n3;
+      cs_real_t *restrict b_cocg_i = b_cocg + c_b_id[ii]*6*n;
+
+      for (cs_lnum_t k = 0; k < n; k++) {
+
+        cs_real_t umcbdd = (1. - coefbp[k][f_id]) * unddij;
+
+        cs_real_t dsij[3];
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          dsij[ll] =   udbfs * b_face_normal[f_id][ll]
+                     + umcbdd*diipb[f_id][ll];
+
+        b_cocg_i[0*n + k] += dsij[0]*dsij[0];
+        b_cocg_i[1*n + k] += dsij[1]*dsij[1];
+        b_cocg_i[2*n + k] += dsij[2]*dsij[2];
+        b_cocg_i[3*n + k] += dsij[0]*dsij[1];
+        b_cocg_i[4*n + k] += dsij[1]*dsij[2];
+        b_cocg_i[5*n + k] += dsij[0]*dsij[2];
+
+        cs_real_t pfac =   (coefap[k][f_id]*inc + (coefbp[k][f_id] -1.)
+                         * pvar_i[k]) * unddij;
+
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          rhsv_i[ll*n + k] += dsij[ll] * pfac;
+
+      }
+
+    } /* loop on faces */
+
+  } /* loop on threads */
+
+  /* Compute gradient */
+  /*------------------*/
+
+  /* Gradients are also saved in the right-hand side array, which is
+     used for a single halo exchange for all variables */
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    cs_real_t *restrict rhsv_c = rhsv + c_id*n3;
+
+    for (cs_lnum_t k = 0; k < n; k++) {
+
+      cs_cocg_t _cocg[6];
+      if (c_b_id[c_id] < 0) {
+        for (cs_lnum_t ll = 0; ll < 6; ll++)
+          _cocg[ll] = cocg[c_id][ll];
+      }
+      else {
+        const cs_real_t *restrict b_cocg_c = b_cocg + c_b_id[c_id]*6*n;
+        for (cs_lnum_t ll = 0; ll < 6; ll++)
+          _cocg[ll] = b_cocg_c[ll*n + k];
+        _math_6_inv_cramer_sym_in_place(_cocg);
+      }
+
+      cs_real_t r0 = rhsv_c[k], r1 = rhsv_c[n + k], r2 = rhsv_c[2*n + k];
+
+      rhsv_c[k]       = _cocg[0]*r0 + _cocg[3]*r1 + _cocg[5]*r2;
+      rhsv_c[n + k]   = _cocg[3]*r0 + _cocg[1]*r1 + _cocg[4]*r2;
+      rhsv_c[2*n + k] = _cocg[5]*r0 + _cocg[4]*r1 + _cocg[2]*r2;
+
+      for (cs_lnum_t ll = 0; ll < 3; ll++)
+        grad[k][c_id][ll] = rhsv_c[ll*n + k];
+
+    }
+
+  }
+
+  BFT_FREE(b_cocg);
+  BFT_FREE(c_b_id);
+
+  /* Synchronize halos */
+
+  if (m->halo != NULL) {
+
+    cs_halo_sync_var_strided(m->halo, CS_HALO_STANDARD, rhsv, n3);
+
+#   pragma omp parallel for if(n_cells_ext - n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++) {
+      const cs_real_t *restrict rhsv_c = rhsv + c_id*n3;
+      for (cs_lnum_t k = 0; k < n; k++) {
+        for (cs_lnum_t ll = 0; ll < 3; ll++)
+          grad[k][c_id][ll] = rhsv_c[ll*n + k];
+      }
+    }
+
+    if (m->have_rotation_perio) {
+      for (cs_lnum_t k = 0; k < n; k++)
+        cs_halo_perio_sync_var_vect(m->halo, CS_HALO_STANDARD,
+                                    (cs_real_t *)grad[k], 3);
+    }
+
+  }
+}
+
+
+
+/*----------------------------------------------------------------------------
+ * Compute cell gradient by least-squares reconstruction with a volume force
+ * generating a hydrostatic pressure component.
+ *
+ * template parameters:
+ *   e2n           type of assembly algorithm used
+ *
+ * parameters:
+ *   m              <-- pointer to associated mesh structure
+ *   fvq            <-- pointer to associated finite volume quantities
+ *   cpl            <-- structure associated with internal coupling, or NULL
+ *   halo_type      <-- halo type (extended or not)
+ *   recompute_cocg <-- flag to recompute cocg
+ *   hyd_p_flag     <-- flag for hydrostatic pressure
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   f_ext          <-- exterior force generating pressure
+ *   coefap         <-- B.C. coefficients for boundary face normals
+ *   coefbp         <-- B.C. coefficients for boundary face normals
+ *   pvar           <-- variable
+ *   c_weight_s     <-- weighted gradient coefficient variable,
+ *                      or NULL
+ *   grad           --> gradient of pvar (halo prepared for periodicity
+ *                      of rotation)
+ *----------------------------------------------------------------------------*/
+
+template <const cs_e2n_sum_t e2n>
+static void
+_lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
+                           const cs_mesh_quantities_t     *fvq,
+                           cs_halo_type_t                  halo_type,
+                           bool                            recompute_cocg,
+                           cs_real_t                       inc,
+                           const cs_real_3_t               f_ext[],
+                           const cs_real_t                 coefap[],
+                           const cs_real_t                 coefbp[],
+                           const cs_real_t                 pvar[],
+                           const cs_real_t       *restrict c_weight_s,
+                           cs_real_3_t           *restrict grad)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const int n_b_threads = m->b_face_numbering->n_threads;
+  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+
+  const cs_lnum_2_t *restrict i_face_cells
+    = (const cs_lnum_2_t *restrict)m->i_face_cells;
+  const cs_lnum_t *restrict b_face_cells
+    = (const cs_lnum_t *restrict)m->b_face_cells;
+  const cs_lnum_t *restrict cell_cells_idx
+    = (const cs_lnum_t *restrict)m->cell_cells_idx;
+  const cs_lnum_t *restrict cell_cells_lst
+    = (const cs_lnum_t *restrict)m->cell_cells_lst;
+
+  const cs_real_3_t *restrict cell_cen
+    = (const cs_real_3_t *restrict)fvq->cell_cen;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_face_surf
+    = (const cs_real_t *restrict)fvq->b_face_surf;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
+  const cs_real_3_t *restrict i_face_cog
+    = (const cs_real_3_t *restrict)fvq->i_face_cog;
+  const cs_real_3_t *restrict b_face_cog
+    = (const cs_real_3_t *restrict)fvq->b_face_cog;
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
+  const cs_real_t *restrict weight = fvq->weight;
+
+  cs_cocg_6_t  *restrict cocgb = NULL;
+  cs_cocg_6_t  *restrict cocg = NULL;
+
+  /* Additional terms due to porosity */
+  cs_field_t *f_i_poro_duq_0 = cs_field_by_name_try("i_poro_duq_0");
+
+  cs_real_t *i_poro_duq_0;
+  cs_real_t *i_poro_duq_1;
+  cs_real_t *b_poro_duq;
+  cs_real_t _f_ext = 0.;
+
+  int is_porous = 0;
+  if (f_i_poro_duq_0 != NULL) {
+    is_porous = 1;
+    i_poro_duq_0 = f_i_poro_duq_0->val;
+    i_poro_duq_1 = cs_field_by_name("i_poro_duq_1")->val;
+    b_poro_duq = cs_field_by_name("b_poro_duq")->val;
+  } else {
+    i_poro_duq_0 = &_f_ext;
+    i_poro_duq_1 = &_f_ext;
+    b_poro_duq = &_f_ext;
+  }
+
+  _get_cell_cocg_lsq(m,
+                     halo_type,
+                     false, /* accel, not yet handled */
+                     fvq,
+                     NULL,  /* cpl, handled locally here */
+                     &cocg,
+                     &cocgb);
+
+  /* Reconstruct gradients using least squares for non-orthogonal meshes */
+  /*---------------------------------------------------------------------*/
+
+  /* Compute cocg and save contribution at boundaries */
+
+  if (recompute_cocg)
+    _recompute_lsq_scalar_cocg(m,
+                               fvq,
+                               NULL,  /* cpl */
+                               coefbp,
+                               cocgb,
+                               cocg);
+
+  /* Compute Right-Hand Side */
+  /*-------------------------*/
+
+  cs_real_4_t  *restrict rhsv;
+  BFT_MALLOC(rhsv, n_cells_ext, cs_real_4_t);
+
+# pragma omp parallel for
+  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
+    rhsv[c_id][0] = 0.0;
+    rhsv[c_id][1] = 0.0;
+    rhsv[c_id][2] = 0.0;
+    rhsv[c_id][3] = pvar[c_id];
+  }
+
+  /* Contribution from interior faces
+     -------------------------------- */
+
+  /* Test on e2n (template argument for algorithm type) */
+
+  if (e2n != CS_E2N_SUM_GATHER) {
+
+    cs_real_3_t *f_ctb = NULL;
+
+    if (e2n == CS_E2N_SUM_STORE_THEN_GATHER) {
+      BFT_MALLOC(f_ctb, m->n_i_faces, cs_real_3_t);
+    }
+
+    cs_lnum_t n_i_groups, n_i_threads;
+    cs_mesh_i_faces_thread_block_count(m, e2n, 0, &n_i_groups, &n_i_threads);
+
+    for (int g_id = 0; g_id < n_i_groups; g_id++) {
+
+#     pragma omp parallel for
+      for (int t_id = 0; t_id < n_i_threads; t_id++) {
+
+        cs_lnum_t s_id, e_id;
+        cs_mesh_i_faces_thread_block_range(m, e2n, g_id, t_id, n_i_threads, 0,
+                                           &s_id, &e_id);
+
+        if (c_weight_s != NULL) {  /* With cell weighting */
 
           for (cs_lnum_t f_id = s_id; f_id < e_id; f_id++) {
 
@@ -3313,30 +3692,34 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
                      - poro[1])
                    / cs_math_3_square_norm(dc);
 
+            cs_real_t pond = weight[f_id];
+
+            pfac /= (  pond       *c_weight_s[ii]
+                     + (1. - pond)*c_weight_s[jj]);
+
             if (e2n == CS_E2N_SUM_SCATTER) {
               cs_real_t fctb[3];
               for (cs_lnum_t ll = 0; ll < 3; ll++)
                 fctb[ll] = dc[ll] * pfac;
 
               for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[ii][ll] += fctb[ll];
+                rhsv[ii][ll] += c_weight_s[jj] * fctb[ll];
 
               for (cs_lnum_t ll = 0; ll < 3; ll++)
-                rhsv[jj][ll] += fctb[ll];
+                rhsv[jj][ll] += c_weight_s[ii] * fctb[ll];
             }
             else if (e2n == CS_E2N_SUM_SCATTER_ATOMIC) {
               cs_real_t fctb[3];
-
               for (cs_lnum_t ll = 0; ll < 3; ll++)
                 fctb[ll] = dc[ll] * pfac;
 
               for (cs_lnum_t ll = 0; ll < 3; ll++)
                 #pragma omp atomic
-                rhsv[ii][ll] += fctb[ll];
+                rhsv[ii][ll] += c_weight_s[jj] * fctb[ll];
 
               for (cs_lnum_t ll = 0; ll < 3; ll++)
                 #pragma omp atomic
-                rhsv[jj][ll] += fctb[ll];
+                rhsv[jj][ll] += c_weight_s[ii] * fctb[ll];
             }
             else if (e2n == CS_E2N_SUM_STORE_THEN_GATHER) {
               for (cs_lnum_t ll = 0; ll < 3; ll++)
@@ -3344,7 +3727,76 @@ _lsq_scalar_gradient_hyd_p(const cs_mesh_t                *m,
             }
           }
 
-        } /* End of loop on faces */
+        }
+        else { /* Without cell weights */
+
+          for (cs_lnum_t f_id = s_id; f_id < e_id; f_id++) {
+
+            cs_lnum_t ii = i_face_cells[f_id][0];
+            cs_lnum_t jj = i_face_cells[f_id][1];
+
+            cs_real_2_t poro = {i_poro_duq_0[is_porous*f_id],
+                                i_poro_duq_1[is_porous*f_id]};
+
+            cs_real_t dvarij, pfac, dc[3];
+
+            for (cs_lnum_t ll = 0; ll < 3; ll++)
+              dc[ll] = cell_cen[jj][ll] - cell_cen[ii][ll];
+
+            if (e2n == CS_E2N_SUM_STORE_THEN_GATHER) {
+              /* In this case, we do not use other terms of rhsv in this loop,
+                 so caching will be better directly using pvar. */
+              dvarij = pvar[jj] - pvar[ii];
+            }
+            else {
+              /* In this case, use rhsv, as access patterns lead to better
+                 caching behavior (or did when last tested) */
+              dvarij = rhsv[jj][3] - rhsv[ii][3];
+            }
+
+            pfac =  (  dvarij
+                     + cs_math_3_distance_dot_product(i_face_cog[f_id],
+                                                      cell_cen[ii],
+                                                      f_ext[ii])
+                     + poro[0]
+                     - cs_math_3_distance_dot_product(i_face_cog[f_id],
+                                                      cell_cen[jj],
+                                                      f_ext[jj])
+                     - poro[1])
+                   / cs_math_3_square_norm(dc);
+
+            if (e2n == CS_E2N_SUM_SCATTER) {
+              cs_real_t fctb[3];
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[ii][ll] += fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                rhsv[jj][ll] += fctb[ll];
+            }
+            else if (e2n == CS_E2N_SUM_SCATTER_ATOMIC) {
+              cs_real_t fctb[3];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                fctb[ll] = dc[ll] * pfac;
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                #pragma omp atomic
+                rhsv[ii][ll] += fctb[ll];
+
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                #pragma omp atomic
+                rhsv[jj][ll] += fctb[ll];
+            }
+            else if (e2n == CS_E2N_SUM_STORE_THEN_GATHER) {
+              for (cs_lnum_t ll = 0; ll < 3; ll++)
+                f_ctb[f_id][ll] = dc[ll] * pfac;
+            }
+          }
+
+        } /* End of loop on faces */
 
       } /* End of loop on threads */
 
@@ -5549,34 +6001,40 @@ _vector_gradient_clipping(const cs_mesh_t              *m,
 }
 
 /*----------------------------------------------------------------------------
- * Initialize the gradient of a vector for gradient reconstruction.
+ * Initialize the gradient of a vector or symmetric tensor for gradient
+ * reconstruction.
  *
  * A non-reconstructed gradient is computed at this stage.
  *
+ * template parameters:
+ *   stride         3 for vectors, 6 for symmetric tensors
+ *
  * parameters:
  *   m              <-- pointer to associated mesh structure
  *   fvq            <-- pointer to associated finite volume quantities
  *   cpl            <-- structure associated with internal coupling, or NULL
+ *                      (vectors only)
  *   halo_type      <-- halo type (extended or not)
  *   inc            <-- if 0, solve on increment; 1 otherwise
  *   coefav         <-- B.C. coefficients for boundary face normals
  *   coefbv         <-- B.C. coefficients for boundary face normals
  *   pvar           <-- variable
- *   c_weight       <-- weighted gradient coefficient variable
+ *   c_weight       <-- weighted gradient coefficient variable, or NULL
  *   grad           --> gradient of pvar (du_i/dx_j : grad[][i][j])
  *----------------------------------------------------------------------------*/
 
+template <const cs_lnum_t stride>
 static void
-_initialize_vector_gradient(const cs_mesh_t              *m,
-                            const cs_mesh_quantities_t   *fvq,
-                            const cs_internal_coupling_t *cpl,
-                            cs_halo_type_t                halo_type,
-                            int                           inc,
-                            const cs_real_3_t   *restrict coefav,
-                            const cs_real_33_t  *restrict coefbv,
-                            const cs_real_3_t   *restrict pvar,
-                            const cs_real_t     *restrict c_weight,
-                            cs_real_33_t        *restrict grad)
+_initialize_strided_gradient(const cs_mesh_t              *m,
+                             const cs_mesh_quantities_t   *fvq,
+                             const cs_internal_coupling_t *cpl,
+                             cs_halo_type_t                halo_type,
+                             int                           inc,
+                             const cs_real_t (*restrict coefav)[stride],
+                             const cs_real_t (*restrict coefbv)[stride][stride],
+                             const cs_real_t (*restrict pvar)[stride],
+                             const cs_real_t     *restrict c_weight,
+                             cs_real_t (*restrict grad)[stride][3])
 {
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
@@ -5619,7 +6077,7 @@ _initialize_vector_gradient(const cs_mesh_t              *m,
 
 # pragma omp parallel for
   for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    for (cs_lnum_t i = 0; i < 3; i++) {
+    for (cs_lnum_t i = 0; i < stride; i++) {
       for (cs_lnum_t j = 0; j < 3; j++)
         grad[c_id][i][j] = 0.0;
     }
@@ -5655,7 +6113,7 @@ _initialize_vector_gradient(const cs_mesh_t              *m,
                    and for the cell \f$ \cellj \f$ we remove
                    \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
         */
-        for (cs_lnum_t i = 0; i < 3; i++) {
+        for (cs_lnum_t i = 0; i < stride; i++) {
           cs_real_t pfaci = (1.0-ktpond) * (pvar[c_id2][i] - pvar[c_id1][i]);
           cs_real_t pfacj = - ktpond * (pvar[c_id2][i] - pvar[c_id1][i]);
 
@@ -5671,10 +6129,12 @@ _initialize_vector_gradient(const cs_mesh_t              *m,
 
   } /* End of loop on thread groups */
 
-  /* Contribution from coupled faces */
-  if (cpl != NULL)
+  /* Contribution from coupled faces (vectors only) */
+  if (cpl != NULL) {
+    assert(stride == 3);
     cs_internal_coupling_initialize_vector_gradient
-      (cpl, c_weight, pvar, grad);
+      (cpl, c_weight, (const cs_real_3_t *)pvar, (cs_real_33_t *)grad);
+  }
 
   /* Boundary face treatment */
 
@@ -5690,15 +6150,15 @@ _initialize_vector_gradient(const cs_mesh_t              *m,
 
       cs_lnum_t c_id = b_face_cells[f_id];
 
-      for (cs_lnum_t i = 0; i < 3; i++) {
-        cs_real_t pfac = inc*coefav[f_id][i];
+      /*
+        Remark: for the cell \f$ \celli \f$ we remove
+                 \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
+      */
+      for (cs_lnum_t i = 0; i < stride; i++) {
+        cs_real_t pfac = inc*coefav[f_id][i] - pvar[c_id][i];
 
-        for (cs_lnum_t k = 0; k < 3; k++) {
-          if (i == k)
-            pfac += (coefbv[f_id][i][k] - 1.0) * pvar[c_id][k];
-          else
-            pfac += coefbv[f_id][i][k] * pvar[c_id][k];
-        }
+        for (cs_lnum_t k = 0; k < stride; k++)
+          pfac += coefbv[f_id][i][k] * pvar[c_id][k];
 
         for (cs_lnum_t j = 0; j < 3; j++)
           grad[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
@@ -5717,7 +6177,7 @@ _initialize_vector_gradient(const cs_mesh_t              *m,
     else
       dvol = 0.;
 
-    for (cs_lnum_t i = 0; i < 3; i++) {
+    for (cs_lnum_t i = 0; i < stride; i++) {
       for (cs_lnum_t j = 0; j < 3; j++)
         grad[c_id][i][j] *= dvol;
     }
@@ -5725,11 +6185,7 @@ _initialize_vector_gradient(const cs_mesh_t              *m,
 
   /* Periodicity and parallelism treatment */
 
-  if (m->halo != NULL) {
-    cs_halo_sync_var_strided(m->halo, halo_type, (cs_real_t *)grad, 9);
-    if (cs_glob_mesh->have_rotation_perio)
-      cs_halo_perio_sync_var_tens(m->halo, halo_type, (cs_real_t *)grad);
-  }
+  _sync_strided_gradient_halo<stride>(m, halo_type, grad);
 }
 
 /*----------------------------------------------------------------------------
@@ -5963,15 +6419,19 @@ _reconstruct_vector_gradient(const cs_mesh_t              *m,
 }
 
 /*----------------------------------------------------------------------------
- * Compute the gradient of a vector with an iterative technique in order to
- * handle non-orthoganalities (n_r_sweeps > 1).
+ * Compute the gradient of a vector or symmetric tensor with an iterative
+ * technique in order to handle non-orthoganalities (n_r_sweeps > 1).
  *
  * We do not take into account any volumic force here.
  *
+ * template parameters:
+ *   stride         3 for vectors, 6 for symmetric tensors
+ *
  * parameters:
  *   m              <-- pointer to associated mesh structure
  *   fvq            <-> pointer to associated finite volume quantities
  *   cpl            <-> structure associated with internal coupling, or NULL
+ *                      (vectors only)
  *   var_name       <-- variable's name
  *   gradient_info  <-- pointer to performance logging structure, or NULL
  *   halo_type      <-- halo type (extended or not)
@@ -5982,30 +6442,33 @@ _reconstruct_vector_gradient(const cs_mesh_t              *m,
  *   coefav         <-- B.C. coefficients for boundary face normals
  *   coefbv         <-- B.C. coefficients for boundary face normals
  *   pvar           <-- variable
- *   c_weight       <-- weighted gradient coefficient variable
+ *   c_weight       <-- weighted gradient coefficient variable, or NULL
  *   grad           <-> gradient of pvar (du_i/dx_j : grad[][i][j])
  *----------------------------------------------------------------------------*/
 
+template <const cs_lnum_t stride>
 static void
-_iterative_vector_gradient(const cs_mesh_t               *m,
-                           const cs_mesh_quantities_t    *fvq,
-                           const cs_internal_coupling_t  *cpl,
-                           const char                    *var_name,
-                           cs_gradient_info_t            *gradient_info,
-                           cs_halo_type_t                 halo_type,
-                           int                            inc,
-                           int                            n_r_sweeps,
-                           int                            verbosity,
-                           cs_real_t                      epsrgp,
-                           const cs_real_3_t   *restrict  coefav,
-                           const cs_real_33_t  *restrict  coefbv,
-                           const cs_real_3_t   *restrict  pvar,
-                           const cs_real_t               *c_weight,
-                           cs_real_33_t         *restrict grad)
+_iterative_strided_gradient(const cs_mesh_t               *m,
+                            const cs_mesh_quantities_t    *fvq,
+                            const cs_internal_coupling_t  *cpl,
+                            const char                    *var_name,
+                            cs_gradient_info_t            *gradient_info,
+                            cs_halo_type_t                 halo_type,
+                            int                            inc,
+                            int                            n_r_sweeps,
+                            int                            verbosity,
+                            cs_real_t                      epsrgp,
+                            const cs_real_t (*restrict coefav)[stride],
+                            const cs_real_t (*restrict coefbv)[stride][stride],
+                            const cs_real_t (*restrict pvar)[stride],
+                            const cs_real_t               *c_weight,
+                            cs_real_t (*restrict grad)[stride][3])
 {
+  typedef cs_real_t grad_t[stride][3];
+
   int isweep = 0;
 
-  cs_real_33_t *rhs;
+  grad_t *rhs;
 
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
@@ -6051,14 +6514,14 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
     coupled_faces = (const bool *)cpl->coupled_faces;
   }
 
-  BFT_MALLOC(rhs, n_cells_ext, cs_real_33_t);
+  BFT_MALLOC(rhs, n_cells_ext, grad_t);
 
   /* Gradient reconstruction to handle non-orthogonal meshes */
   /*---------------------------------------------------------*/
 
   /* L2 norm */
 
-  cs_real_t l2_norm = _l2_norm_1(9*n_cells, (cs_real_t *)grad);
+  cs_real_t l2_norm = _l2_norm_1(stride*3*n_cells, (cs_real_t *)grad);
   cs_real_t l2_residual = l2_norm;
 
   if (l2_norm > cs_math_epzero) {
@@ -6072,7 +6535,7 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
 #     pragma omp parallel for
       for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-        for (cs_lnum_t i = 0; i < 3; i++) {
+        for (cs_lnum_t i = 0; i < stride; i++) {
           for (cs_lnum_t j = 0; j < 3; j++)
             rhs[c_id][i][j] = -grad[c_id][i][j] * cell_f_vol[c_id];
         }
@@ -6108,7 +6571,7 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
                        \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
             */
 
-            for (cs_lnum_t i = 0; i < 3; i++) {
+            for (cs_lnum_t i = 0; i < stride; i++) {
 
               /* Reconstruction part */
               cs_real_t
@@ -6135,10 +6598,13 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
       } /* loop on thread groups */
 
-      /* Contribution from coupled faces */
-      if (cpl != NULL)
+      /* Contribution from coupled faces (vectors only) */
+      if (cpl != NULL) {
+        assert(stride == 3);
         cs_internal_coupling_iterative_vector_gradient
-          (cpl, c_weight, grad, pvar, rhs);
+          (cpl, c_weight, (cs_real_33_t *)grad, (const cs_real_3_t *)pvar,
+           (cs_real_33_t *)rhs);
+      }
 
       /* Boundary face treatment */
 
@@ -6154,27 +6620,26 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
           cs_lnum_t c_id = b_face_cells[f_id];
 
-          for (cs_lnum_t i = 0; i < 3; i++) {
+          /* Reconstructed value at I' (computed once for all components) */
+
+          cs_real_t pip[stride];
+          for (cs_lnum_t k = 0; k < stride; k++)
+            pip[k] =   pvar[c_id][k]
+                     + grad[c_id][k][0] * diipb[f_id][0]
+                     + grad[c_id][k][1] * diipb[f_id][1]
+                     + grad[c_id][k][2] * diipb[f_id][2];
+
+          for (cs_lnum_t i = 0; i < stride; i++) {
 
             /*
               Remark: for the cell \f$ \celli \f$ we remove
               \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
             */
 
-            cs_real_t pfac = inc*coefav[f_id][i];
+            cs_real_t pfac = inc*coefav[f_id][i] - pvar[c_id][i];
 
-            for (cs_lnum_t k = 0; k < 3; k++) {
-              /* Reconstruction part */
-              cs_real_t vecfac =   grad[c_id][k][0] * diipb[f_id][0]
-                                 + grad[c_id][k][1] * diipb[f_id][1]
-                                 + grad[c_id][k][2] * diipb[f_id][2];
-              pfac += coefbv[f_id][i][k] * vecfac;
-
-              if (i == k)
-                pfac += (coefbv[f_id][i][k] - 1.0) * pvar[c_id][k];
-              else
-                pfac += coefbv[f_id][i][k] * pvar[c_id][k];
-            }
+            for (cs_lnum_t k = 0; k < stride; k++)
+              pfac += coefbv[f_id][i][k] * pip[k];
 
             for (cs_lnum_t j = 0; j < 3; j++)
               rhs[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
@@ -6196,12 +6661,12 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
         else
           dvol = 0.;
 
-        for (cs_lnum_t i = 0; i < 3; i++) {
+        for (cs_lnum_t i = 0; i < stride; i++) {
           for (cs_lnum_t j = 0; j < 3; j++)
             rhs[c_id][i][j] *= dvol;
         }
 
-        for (cs_lnum_t i = 0; i < 3; i++) {
+        for (cs_lnum_t i = 0; i < stride; i++) {
           for (cs_lnum_t j = 0; j < 3; j++) {
             for (cs_lnum_t k = 0; k < 3; k++)
               grad[c_id][i][j] += rhs[c_id][i][k] * cocg[c_id][k][j];
@@ -6211,15 +6676,11 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 
       /* Periodicity and parallelism treatment */
 
-      if (m->halo != NULL) {
-        cs_halo_sync_var_strided(m->halo, halo_type, (cs_real_t *)grad, 9);
-        if (cs_glob_mesh->have_rotation_perio)
-          cs_halo_perio_sync_var_tens(m->halo, halo_type, (cs_real_t *)grad);
-      }
+      _sync_strided_gradient_halo<stride>(m, halo_type, grad);
 
       /* Convergence test (L2 norm) */
 
-      l2_residual = _l2_norm_1(9*n_cells, (cs_real_t *)rhs);
+      l2_residual = _l2_norm_1(stride*3*n_cells, (cs_real_t *)rhs);
 
     } /* End of the iterative process */
 
@@ -6252,987 +6713,274 @@ _iterative_vector_gradient(const cs_mesh_t               *m,
 }
 
 /*----------------------------------------------------------------------------
- * Compute the gradient of a vector with an iterative technique in order to
- * handle non-orthoganalities (n_r_sweeps > 1).
- *
- * We do not take into account any volumic force here.
+ * Complete initialization of cocg for lsq vector and tensor gradient.
  *
  * parameters:
- *   m              <-- pointer to associated mesh structure
- *   fvq            <-> pointer to associated finite volume quantities
- *   var_name       <-- variable's name
- *   gradient_info  <-- pointer to performance logging structure, or NULL
- *   halo_type      <-- halo type (extended or not)
- *   inc            <-- if 0, solve on increment; 1 otherwise
- *   n_r_sweeps     --> >1: with reconstruction
- *   verbosity      --> verbosity level
- *   epsrgp         --> precision for iterative gradient calculation
- *   coefav         <-- B.C. coefficients for boundary face normals
- *   coefbv         <-- B.C. coefficients for boundary face normals
- *   pvar           <-- variable
- *   grad          <-> gradient of pvar (du_i/dx_j : grad[][i][j])
+ *   c_id          <-- cell id
+ *   halo_type     <-- halo type
+ *   madj          <-- pointer to mesh adjacencies structure
+ *   fvq           <-- pointer to associated finite volume quantities
+ *   cocgb         --> cocg
  *----------------------------------------------------------------------------*/
 
+#if defined(__INTEL_COMPILER)
+#pragma optimization_level 2 /* Bug with O3 or above with icc 18.0.1 20171018
+                                at least on Xeon(R) Gold 6140 ? */
+#endif
+
 static void
-_iterative_tensor_gradient(const cs_mesh_t              *m,
-                           const cs_mesh_quantities_t   *fvq,
-                           const char                   *var_name,
-                           cs_gradient_info_t           *gradient_info,
-                           cs_halo_type_t                halo_type,
-                           int                           inc,
-                           int                           n_r_sweeps,
-                           int                           verbosity,
-                           cs_real_t                     epsrgp,
-                           const cs_real_6_t   *restrict coefat,
-                           const cs_real_66_t  *restrict coefbt,
-                           const cs_real_6_t   *restrict pvar,
-                           cs_real_63_t        *restrict grad)
+_complete_cocg_lsq(cs_lnum_t                     c_id,
+                   const cs_mesh_adjacencies_t  *madj,
+                   const cs_mesh_quantities_t   *fvq,
+                   const cs_cocg_t               cocg[6],
+                   cs_real_t                     cocgb[restrict 3][3])
 {
-  int isweep = 0;
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
 
-  cs_real_63_t *rhs;
+  /* initialize cocgb */
 
-  const cs_lnum_t n_cells = m->n_cells;
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
-  const int n_b_threads = m->b_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
-  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
+  cocgb[0][0] = cocg[0];
+  cocgb[0][1] = cocg[3];
+  cocgb[0][2] = cocg[5];
+  cocgb[1][0] = cocg[3];
+  cocgb[1][1] = cocg[1];
+  cocgb[1][2] = cocg[4];
+  cocgb[2][0] = cocg[5];
+  cocgb[2][1] = cocg[4];
+  cocgb[2][2] = cocg[2];
 
-  const cs_lnum_2_t *restrict i_face_cells
-    = (const cs_lnum_2_t *restrict)m->i_face_cells;
-  const cs_lnum_t *restrict b_face_cells
-    = (const cs_lnum_t *restrict)m->b_face_cells;
+  /* Contribution from boundary faces.
 
-  const int *restrict c_disable_flag = fvq->c_disable_flag;
-  cs_lnum_t has_dc = fvq->has_disable_flag; /* Has cells disabled? */
+     Note that for scalars, the matching part involves a sum of face normals
+     and a term in (coefb -1)*diipb, but coefb is not scalar for vector fields,
+     so things need to be handled a bit differently here. */
 
-  const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
-  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
-    cell_f_vol = fvq->cell_vol;
-  const cs_real_3_t *restrict i_f_face_normal
-    = (const cs_real_3_t *restrict)fvq->i_f_face_normal;
-  const cs_real_3_t *restrict b_f_face_normal
-    = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
-  const cs_real_3_t *restrict diipb
-    = (const cs_real_3_t *restrict)fvq->diipb;
-  const cs_real_3_t *restrict dofij
-    = (const cs_real_3_t *restrict)fvq->dofij;
+  const cs_lnum_t  *restrict cell_b_faces
+    = (const cs_lnum_t  *restrict)(madj->cell_b_faces);
 
-  cs_gradient_quantities_t  *gq = _gradient_quantities_get(0);
+  cs_lnum_t s_id = madj->cell_b_faces_idx[c_id];
+  cs_lnum_t e_id = madj->cell_b_faces_idx[c_id+1];
 
-  cs_real_33_t *restrict cocg = gq->cocg_it;
-  if (cocg == NULL)
-    cocg = _compute_cell_cocg_it(m, fvq, NULL, gq);
+  for (cs_lnum_t i = s_id; i < e_id; i++) {
 
-  BFT_MALLOC(rhs, n_cells_ext, cs_real_63_t);
+    cs_lnum_t f_id = cell_b_faces[i];
 
-  /* Gradient reconstruction to handle non-orthogonal meshes */
-  /*---------------------------------------------------------*/
+    cs_real_3_t normal;
+    /* Normal is vector 0 if the b_face_normal norm is too small */
+    cs_math_3_normalize(b_face_normal[f_id], normal);
 
-  /* L2 norm */
+    for (cs_lnum_t ii = 0; ii < 3; ii++) {
+      for (cs_lnum_t jj = 0; jj < 3; jj++)
+        cocgb[ii][jj] += normal[ii] * normal[jj];
+    }
 
-  cs_real_t l2_norm = _l2_norm_1(18*n_cells, (cs_real_t *)grad);
-  cs_real_t l2_residual = l2_norm ;
+  }
+}
 
-  if (l2_norm > cs_math_epzero) {
+/*----------------------------------------------------------------------------
+ * Compute cocg and RHS at boundaries for lsq vector or tensor gradient.
+ *
+ * The stride*3 unknowns t[kk][qq] of the local system are numbered
+ * kk*3 + qq, and the symmetric matrix is stored as a lower triangle.
+ *
+ * template parameters:
+ *   stride           3 for vectors, 6 for symmetric tensors
+ *
+ * parameters:
+ *   c_id             <-- cell id
+ *   inc              <-- if 0, solve on increment; 1 otherwise
+ *   madj             <-- pointer to mesh adjacencies structure
+ *   fvq              <-- pointer to associated finite volume quantities
+ *   pvar             <-- variable
+ *   coefav           <-- B.C. coefficients for boundary face normals
+ *   coefbv           <-- B.C. coefficients for boundary face normals
+ *   cocg             <-- cocg values
+ *   rhs              <-- right hand side
+ *   cocgb_v          --> boundary cocg values, factorized
+ *                        (size: stride*3*(stride*3+1)/2)
+ *   rhsb_v           --> boundary RHS values (size: stride*3)
+ *----------------------------------------------------------------------------*/
 
-    /* Iterative process */
-    /*-------------------*/
+template <const cs_lnum_t stride>
+static void
+_compute_cocgb_rhsb_lsq_s(cs_lnum_t                     c_id,
+                          const int                     inc,
+                          const cs_mesh_adjacencies_t  *madj,
+                          const cs_mesh_quantities_t   *fvq,
+                          const cs_real_t (*restrict pvar)[stride],
+                          const cs_real_t (*restrict coefav)[stride],
+                          const cs_real_t (*restrict coefbv)[stride][stride],
+                          const cs_real_t               cocg[3][3],
+                          const cs_real_t               rhs[stride][3],
+                          cs_real_t                     cocgb_v[restrict],
+                          cs_real_t                     rhsb_v[restrict])
+{
+  const cs_lnum_t n = stride*3;
 
-    for (isweep = 1; isweep < n_r_sweeps && l2_residual > epsrgp*l2_norm; isweep++) {
+  /* Short variable accesses */
 
-      /* Computation of the Right Hand Side*/
+  const cs_real_3_t *restrict diipb
+    = (const cs_real_3_t *restrict)fvq->diipb;
 
-#     pragma omp parallel for
-      for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-        for (cs_lnum_t i = 0; i < 6; i++) {
-          for (cs_lnum_t j = 0; j < 3; j++)
-            rhs[c_id][i][j] = - cell_f_vol[c_id] * grad[c_id][i][j];
-        }
-      }
+  const cs_real_3_t *restrict b_face_normal
+    = (const cs_real_3_t *restrict)fvq->b_face_normal;
+  const cs_real_t *restrict b_dist
+    = (const cs_real_t *restrict)fvq->b_dist;
 
-      /* Interior face treatment */
+  cs_lnum_t s_id, e_id;
 
-      for (int g_id = 0; g_id < n_i_groups; g_id++) {
+  /* initialize cocg and rhs for lsq gradient */
 
-#       pragma omp parallel for
-        for (int t_id = 0; t_id < n_i_threads; t_id++) {
-
-          for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-               f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-               f_id++) {
-
-            cs_lnum_t c_id1 = i_face_cells[f_id][0];
-            cs_lnum_t c_id2 = i_face_cells[f_id][1];
-            cs_real_t pond = weight[f_id];
-
-            /*
-               Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
-                                        + (1-\alpha_\ij) \varia_\cellj\f$
-                       but for the cell \f$ \celli \f$ we remove
-                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-                       and for the cell \f$ \cellj \f$ we remove
-                       \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
-            */
-
-            for (cs_lnum_t i = 0; i < 6; i++) {
-
-              /* Reconstruction part */
-              cs_real_t
-                pfaci = 0.5 * (    (grad[c_id1][i][0] + grad[c_id2][i][0])
-                                 * dofij[f_id][0]
-                               +   (grad[c_id1][i][1] + grad[c_id2][i][1])
-                                 * dofij[f_id][1]
-                               +   (grad[c_id1][i][2] + grad[c_id2][i][2])
-                                 * dofij[f_id][2]);
-              cs_real_t pfacj = pfaci;
-
-              pfaci += (1.0-pond) * (pvar[c_id2][i] - pvar[c_id1][i]);
-              pfacj -=       pond * (pvar[c_id2][i] - pvar[c_id1][i]);
-              for (cs_lnum_t j = 0; j < 3; j++) {
-                rhs[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
-                rhs[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
-              }
-            }
-
-          } /* loop on faces */
-
-        } /* loop on threads */
-
-      } /* loop on thread groups */
-
-      /* Boundary face treatment */
-
-#     pragma omp parallel for
-      for (int t_id = 0; t_id < n_b_threads; t_id++) {
-
-        for (cs_lnum_t f_id = b_group_index[t_id*2];
-             f_id < b_group_index[t_id*2 + 1];
-             f_id++) {
-
-          cs_lnum_t c_id = b_face_cells[f_id];
-
-          for (cs_lnum_t i = 0; i < 6; i++) {
-
-            /*
-              Remark: for the cell \f$ \celli \f$ we remove
-                       \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-            */
-
-            cs_real_t pfac = inc*coefat[f_id][i];
-
-            for (cs_lnum_t k = 0; k < 6; k++) {
-              /* Reconstruction part */
-              cs_real_t vecfac =   grad[c_id][k][0] * diipb[f_id][0]
-                                 + grad[c_id][k][1] * diipb[f_id][1]
-                                 + grad[c_id][k][2] * diipb[f_id][2];
-              pfac += coefbt[f_id][i][k] * vecfac;
-
-              if (i == k)
-                pfac += (coefbt[f_id][i][k] - 1.0) * pvar[c_id][k];
-              else
-                pfac += coefbt[f_id][i][k] * pvar[c_id][k];
-            }
-
-            for (cs_lnum_t j = 0; j < 3; j++)
-              rhs[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
-
-          }
-
-        } /* loop on faces */
-
-      } /* loop on threads */
-
-      /* Increment of the gradient */
-
-#     pragma omp parallel for
-      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-        cs_real_t dvol;
-        /* Is the cell disabled (for solid or porous)? Not the case if coupled */
-        if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-          dvol = 1. / cell_f_vol[c_id];
-        else
-          dvol = 0.;
-
-        for (cs_lnum_t i = 0; i < 6; i++) {
-          for (cs_lnum_t j = 0; j < 3; j++)
-            rhs[c_id][i][j] *= dvol;
-        }
-
-        for (cs_lnum_t i = 0; i < 6; i++) {
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            for (cs_lnum_t k = 0; k < 3; k++)
-              grad[c_id][i][j] += rhs[c_id][i][k] * cocg[c_id][k][j];
-          }
-        }
-      }
-
-      /* Periodicity and parallelism treatment */
-
-      if (m->halo != NULL) {
-        cs_halo_sync_var_strided(m->halo, halo_type, (cs_real_t *)grad, 18);
-        if (cs_glob_mesh->have_rotation_perio)
-          cs_halo_perio_sync_var_sym_tens_grad(m->halo,
-                                               halo_type,
-                                               (cs_real_t *)grad);
-      }
-
-      /* Convergence test (L2 norm) */
-
-      ///FIXME
-      l2_residual = _l2_norm_1(18*n_cells, (cs_real_t *)rhs);
-
-    } /* End of the iterative process */
-
-    /* Printing */
-
-    if (l2_residual < epsrgp*l2_norm) {
-      if (verbosity >= 2) {
-        bft_printf
-          (_(" %s: isweep = %d, normed residual: %e, norm: %e, var: %s\n"),
-           __func__, isweep, l2_residual/l2_norm, l2_norm, var_name);
-      }
-    }
-    else if (isweep >= n_r_sweeps) {
-      if (verbosity >= 0) {
-        bft_printf(_(" Warning:\n"
-                     " --------\n"
-                     "   %s; variable: %s; sweeps: %d\n"
-                     "   %*s  normed residual: %11.4e; norm: %11.4e\n"),
-                   __func__, var_name, isweep,
-                   (int)(strlen(__func__)), " ", l2_residual/l2_norm, l2_norm);
-      }
-    }
-
-  }
-
-  if (gradient_info != NULL)
-    _gradient_info_update_iter(gradient_info, isweep);
-
-  BFT_FREE(rhs);
-}
-
-/*----------------------------------------------------------------------------
- * Complete initialization of cocg for lsq vector and tensor gradient.
- *
- * parameters:
- *   c_id          <-- cell id
- *   halo_type     <-- halo type
- *   madj          <-- pointer to mesh adjacencies structure
- *   fvq           <-- pointer to associated finite volume quantities
- *   cocgb         --> cocg
- *----------------------------------------------------------------------------*/
-
-#if defined(__INTEL_COMPILER)
-#pragma optimization_level 2 /* Bug with O3 or above with icc 18.0.1 20171018
-                                at least on Xeon(R) Gold 6140 ? */
-#endif
-
-static void
-_complete_cocg_lsq(cs_lnum_t                     c_id,
-                   const cs_mesh_adjacencies_t  *madj,
-                   const cs_mesh_quantities_t   *fvq,
-                   const cs_cocg_t               cocg[6],
-                   cs_real_t                     cocgb[restrict 3][3])
-{
-  const cs_real_3_t *restrict b_face_normal
-    = (const cs_real_3_t *restrict)fvq->b_face_normal;
-
-  /* initialize cocgb */
-
-  cocgb[0][0] = cocg[0];
-  cocgb[0][1] = cocg[3];
-  cocgb[0][2] = cocg[5];
-  cocgb[1][0] = cocg[3];
-  cocgb[1][1] = cocg[1];
-  cocgb[1][2] = cocg[4];
-  cocgb[2][0] = cocg[5];
-  cocgb[2][1] = cocg[4];
-  cocgb[2][2] = cocg[2];
-
-  /* Contribution from boundary faces.
-
-     Note that for scalars, the matching part involves a sum of face normals
-     and a term in (coefb -1)*diipb, but coefb is not scalar for vector fields,
-     so things need to be handled a bit differently here. */
-
-  const cs_lnum_t  *restrict cell_b_faces
-    = (const cs_lnum_t  *restrict)(madj->cell_b_faces);
-
-  cs_lnum_t s_id = madj->cell_b_faces_idx[c_id];
-  cs_lnum_t e_id = madj->cell_b_faces_idx[c_id+1];
-
-  for (cs_lnum_t i = s_id; i < e_id; i++) {
-
-    cs_lnum_t f_id = cell_b_faces[i];
-
-    cs_real_3_t normal;
-    /* Normal is vector 0 if the b_face_normal norm is too small */
-    cs_math_3_normalize(b_face_normal[f_id], normal);
-
-    for (cs_lnum_t ii = 0; ii < 3; ii++) {
-      for (cs_lnum_t jj = 0; jj < 3; jj++)
-        cocgb[ii][jj] += normal[ii] * normal[jj];
-    }
-
-  }
-}
-
-/*----------------------------------------------------------------------------
- * Compute cocg and RHS at boundaries for lsq vector gradient.
- *
- * parameters:
- *   c_id             <-- cell id
- *   inc              <-- if 0, solve on increment; 1 otherwise
- *   madj             <-- pointer to mesh adjacencies structure
- *   fvq              <-- pointer to associated finite volume quantities
- *   _33_9_idx        <-- symmetric indexes mapping
- *   pvar             <-- variable
- *   coefav           <-- B.C. coefficients for boundary face normals
- *   coefbv           <-- B.C. coefficients for boundary face normals
- *   cocg             <-- cocg values
- *   rhs              <-- right hand side
- *   cocgb_v          --> boundary cocg vector values
- *   rhsb_v           --> boundary RHS values
- *----------------------------------------------------------------------------*/
-
-static void
-_compute_cocgb_rhsb_lsq_v(cs_lnum_t                     c_id,
-                          const int                     inc,
-                          const cs_mesh_adjacencies_t  *madj,
-                          const cs_mesh_quantities_t   *fvq,
-                          const cs_lnum_t              _33_9_idx[9][2],
-                          const cs_real_3_t            *restrict pvar,
-                          const cs_real_3_t            *restrict coefav,
-                          const cs_real_33_t           *restrict coefbv,
-                          const cs_real_t               cocg[3][3],
-                          const cs_real_t               rhs[3][3],
-                          cs_real_t                     cocgb_v[restrict 45],
-                          cs_real_t                     rhsb_v[restrict 9])
-{
-  /* Short variable accesses */
-
-  const cs_real_3_t *restrict diipb
-    = (const cs_real_3_t *restrict)fvq->diipb;
-
-  const cs_real_3_t *restrict b_face_normal
-    = (const cs_real_3_t *restrict)fvq->b_face_normal;
-  const cs_real_t *restrict b_dist
-    = (const cs_real_t *restrict)fvq->b_dist;
-
-  cs_lnum_t s_id, e_id;
-
-  /* initialize cocg and rhsfor lsq vector gradient */
-
-  for (int ll = 0; ll < 9; ll++) {
+  for (cs_lnum_t ll = 0; ll < n; ll++) {
 
     /* index of row first coefficient */
-    int ll_9 = ll*(ll+1)/2;
+    cs_lnum_t ll_n = ll*(ll+1)/2;
 
-    for (int mm = 0; mm <= ll; mm++) {
-      /* initialize */
-      cocgb_v[ll_9+mm] = 0.;
+    /* contribution of t[pp][qq] */
+    cs_lnum_t pp = ll / 3;
+    cs_lnum_t qq = ll % 3;
 
-      /* contribution of t[kk][qq] */
-      int pp = _33_9_idx[ll][0];
-      int qq = _33_9_idx[ll][1];
+    for (cs_lnum_t mm = 0; mm <= ll; mm++) {
 
       /* derivative with respect to t[rr][ss] */
-      int rr = _33_9_idx[mm][0];
-      int ss = _33_9_idx[mm][1];
+      cs_lnum_t rr = mm / 3;
+      cs_lnum_t ss = mm % 3;
 
       /* part from cocg_s (BCs independant) */
-      if (pp == rr)
-        cocgb_v[ll_9+mm] = cocg[qq][ss];
-
-      /* part already computed from rhs */
-      rhsb_v[ll] = rhs[pp][qq];
-    }
-  }
-
-  s_id = madj->cell_b_faces_idx[c_id];
-  e_id = madj->cell_b_faces_idx[c_id+1];
-
-  const cs_lnum_t   *restrict cell_b_faces
-    = (const cs_lnum_t *restrict)(madj->cell_b_faces);
-
-  for (cs_lnum_t i = s_id; i < e_id; i++) {
-
-    cs_lnum_t f_id = cell_b_faces[i];
-
-    /* build cocgb_v matrix */
-
-    const cs_real_t *restrict iipbf = diipb[f_id];
-
-    cs_real_3_t nb;
-    /* Normal is vector 0 if the b_face_normal norm is too small */
-    cs_math_3_normalize(b_face_normal[f_id], nb);
-
-    cs_real_t db = 1./b_dist[f_id];
-    cs_real_t db2 = db*db;
-
-    /* A and (B - I) */
-    cs_real_t a[3];
-    cs_real_t bt[3][3];
-    for (int ll = 0; ll < 3; ll++) {
-      for (int pp = 0; pp < 3; pp++)
-        bt[ll][pp] = coefbv[f_id][ll][pp];
+      cocgb_v[ll_n+mm] = (pp == rr) ? cocg[qq][ss] : 0.;
     }
-    for (int ll = 0; ll < 3; ll++) {
-      a[ll] = inc*coefav[f_id][ll];
-      bt[ll][ll] -= 1;
-    }
-
-    /* cocgb */
-
-    for (int ll = 0; ll < 9; ll++) {
-
-      /* contribution of t[kk][qq] */
-      int kk = _33_9_idx[ll][0];
-      int qq = _33_9_idx[ll][1];
-
-      int ll_9 = ll*(ll+1)/2;
-      for (int pp = 0; pp <= ll; pp++) {
-
-        /* derivative with respect to t[rr][ss] */
-        int rr = _33_9_idx[pp][0];
-        int ss = _33_9_idx[pp][1];
-
-        /* part from derivative of 1/2*|| B*t*II'/db ||^2 */
-        cs_real_t cocgv = 0.;
-        for (int mm = 0; mm < 3; mm++)
-          cocgv += bt[mm][kk]*bt[mm][rr];
-        cocgb_v[ll_9+pp] += cocgv*(iipbf[qq]*iipbf[ss])*db2;
-
-        /* part from derivative of -< t*nb , B*t*II'/db > */
-        cocgb_v[ll_9+pp] -= (  nb[ss]*bt[rr][kk]*iipbf[qq]
-                             + nb[qq]*bt[kk][rr]*iipbf[ss])
-                             *db;
-      }
-    }
-
-    /* rhsb */
-
-    for (int ll = 0; ll < 9; ll++) {
-      int pp = _33_9_idx[ll][0];
-      int qq = _33_9_idx[ll][1];
-
-      /* part from derivative of < (B-1)*t*II'/db , (A+(B-1)*v)/db > */
-      cs_real_t rhsv = 0.;
-      for (int rr = 0; rr < 3; rr++) {
-        rhsv +=   bt[rr][pp]*diipb[f_id][qq]
-                            *(a[rr]+ bt[rr][0]*pvar[c_id][0]
-                                   + bt[rr][1]*pvar[c_id][1]
-                                   + bt[rr][2]*pvar[c_id][2]);
-      }
-
-      rhsb_v[ll] -= rhsv*db2;
-    }
-
-  }
-
-  /* Crout factorization of 9x9 symmetric cocg at boundaries */
-
-  _fact_crout_pp(9, cocgb_v);
-}
-
-/*----------------------------------------------------------------------------
- * Compute cocg and RHS at boundaries for lsq tensor gradient.
- *
- * parameters:
- *   c_id             <-- cell id
- *   inc              <-- if 0, solve on increment; 1 otherwise
- *   madj             <-- pointer to mesh adjacencies structure
- *   fvq              <-- pointer to associated finite volume quantities
- *   _63_18_idx       <-- symmetric indexes mapping
- *   pvar             <-- variable
- *   coefat           <-- B.C. coefficients for boundary face normals
- *   coefbt           <-- B.C. coefficients for boundary face normals
- *   cocg             <-- cocg values
- *   rhs              <-- right hand side
- *   cocgb_t          --> boundary cocg vector values
- *   rhsb_t           --> boundary RHS values
- *----------------------------------------------------------------------------*/
-
-static void
-_compute_cocgb_rhsb_lsq_t(cs_lnum_t                     c_id,
-                          const int                     inc,
-                          const cs_mesh_adjacencies_t  *madj,
-                          const cs_mesh_quantities_t   *fvq,
-                          const cs_lnum_t               _63_18_idx[18][2],
-                          const cs_real_6_t            *restrict pvar,
-                          const cs_real_6_t            *restrict coefat,
-                          const cs_real_66_t           *restrict coefbt,
-                          const cs_real_t               cocg[3][3],
-                          const cs_real_t               rhs[6][3],
-                          cs_real_t                     cocgb_t[restrict 171],
-                          cs_real_t                     rhsb_t[restrict 18])
-{
-  /* Short variable accesses */
-
-  const cs_real_3_t *restrict diipb
-    = (const cs_real_3_t *restrict)fvq->diipb;
-
-  const cs_real_3_t *restrict b_face_normal
-    = (const cs_real_3_t *restrict)fvq->b_face_normal;
-  const cs_real_t *restrict b_face_surf
-    = (const cs_real_t *restrict)fvq->b_face_surf;
-  const cs_real_t *restrict b_dist
-    = (const cs_real_t *restrict)fvq->b_dist;
-
-  cs_lnum_t s_id, e_id;
-
-  /* initialize cocg and rhs for lsq tensor gradient */
-
-  for (int ll = 0; ll < 18; ll++) {
-
-    /* index of row first coefficient */
-    int ll_18 = ll*(ll+1)/2;
-
-    for (int mm = 0; mm <= ll; mm++) {
-      /* initialize */
-      cocgb_t[ll_18+mm] = 0.;
-
-      /* contribution of t[kk][qq] */
-      int pp = _63_18_idx[ll][0];
-      int qq = _63_18_idx[ll][1];
-
-      /* derivative with respect to t[rr][ss] */
-      int rr = _63_18_idx[mm][0];
-      int ss = _63_18_idx[mm][1];
-
-      /* part from cocg (BCs independant) */
-      if (pp == rr)
-        cocgb_t[ll_18+mm] = cocg[qq][ss];
-
-      /* part already computed from rhs */
-      rhsb_t[ll] = rhs[pp][qq];
-    }
-  }
-
-  s_id = madj->cell_b_faces_idx[c_id];
-  e_id = madj->cell_b_faces_idx[c_id+1];
-
-  const cs_lnum_t   *restrict cell_b_faces
-    = (const cs_lnum_t *restrict)(madj->cell_b_faces);
-
-  for (cs_lnum_t i = s_id; i < e_id; i++) {
-
-    cs_lnum_t f_id = cell_b_faces[i];
-
-    /* build cocgb_v matrix */
-
-    cs_real_t udbfs = 1. / b_face_surf[f_id];
-    const cs_real_t *restrict iipbf = diipb[f_id];
-
-    /* db = I'F / ||I'F|| */
-    cs_real_t  nb[3];
-    for (int ii = 0; ii < 3; ii++)
-      nb[ii] = udbfs * b_face_normal[f_id][ii];
-
-    cs_real_t db = 1./b_dist[f_id];
-    cs_real_t db2 = db*db;
-
-    /* A and (B - I) */
-    cs_real_t a[6];
-    cs_real_t bt[6][6];
-    for (int ll = 0; ll < 6; ll++) {
-      for (int pp = 0; pp < 6; pp++)
-        bt[ll][pp] = coefbt[f_id][ll][pp];
-    }
-    for (int ll = 0; ll < 6; ll++) {
-      a[ll] = inc*coefat[f_id][ll];
-      bt[ll][ll] -= 1;
-    }
-
-    /* cocgb */
-
-    for (int ll = 0; ll < 18; ll++) {
-
-      /* contribution of t[kk][qq] */
-      int kk = _63_18_idx[ll][0];
-      int qq = _63_18_idx[ll][1];
-
-      int ll_18 = ll*(ll+1)/2;
-      for (int pp = 0; pp <= ll; pp++) {
-
-        /* derivative with respect to t[rr][ss] */
-        int rr = _63_18_idx[pp][0];
-        int ss = _63_18_idx[pp][1];
-
-        /* part from derivative of 1/2*|| B*t*IIp/db ||^2 */
-        cs_real_t cocgt = 0.;
-        for (int mm = 0; mm < 6; mm++)
-          cocgt += bt[mm][kk]*bt[mm][rr];
-        cocgb_t[ll_18+pp] += cocgt * (iipbf[qq]*iipbf[ss]) * db2;
-
-        /* part from derivative of -< t*nb , B*t*IIp/db > */
-        cocgb_t[ll_18+pp] -= (  nb[ss]*bt[rr][kk]*iipbf[qq]
-                              + nb[qq]*bt[kk][rr]*iipbf[ss])
-                              *db;
-      }
-    }
-
-    /* rhsb */
-
-    for (int ll = 0; ll < 18; ll++) {
-      int pp = _63_18_idx[ll][0];
-      int qq = _63_18_idx[ll][1];
-
-      /* part from derivative of < (B-1)*t*IIp/db , (A+(B-1)*v)/db > */
-      cs_real_t rhst = 0.;
-      for (int rr = 0; rr < 6; rr++) {
-        cs_real_t tfac = a[rr];
-        for (int kk = 0; kk < 6; kk++) {
-          tfac += bt[rr][kk]*pvar[c_id][kk];
-        }
-        rhst += bt[rr][pp]*diipb[f_id][qq]*tfac;
-      }
-
-      rhsb_t[ll] -= rhst*db2;
-    }
-
-  }
-
-  /* Crout factorization of 18x18 symmetric cocg at boundaries */
-
-  _fact_crout_pp(18, cocgb_t);
-}
-
-/*----------------------------------------------------------------------------
- * Compute cell gradient of a vector using least-squares reconstruction for
- * non-orthogonal meshes (n_r_sweeps > 1).
- *
- * parameters:
- *   m              <-- pointer to associated mesh structure
- *   madj           <-- pointer to mesh adjacencies structure
- *   fvq            <-- pointer to associated finite volume quantities
- *   cpl            <-- structure associated with internal coupling, or NULL
- *   halo_type      <-- halo type (extended or not)
- *   inc            <-- if 0, solve on increment; 1 otherwise
- *   coefav         <-- B.C. coefficients for boundary face normals
- *   coefbv         <-- B.C. coefficients for boundary face normals
- *   pvar           <-- variable
- *   gradv          --> gradient of pvar (du_i/dx_j : gradv[][i][j])
- *----------------------------------------------------------------------------*/
-
-static void
-_lsq_vector_gradient(const cs_mesh_t               *m,
-                     const cs_mesh_adjacencies_t   *madj,
-                     const cs_mesh_quantities_t    *fvq,
-                     const cs_internal_coupling_t  *cpl,
-                     const cs_halo_type_t           halo_type,
-                     const int                      inc,
-                     const cs_real_3_t    *restrict coefav,
-                     const cs_real_33_t   *restrict coefbv,
-                     const cs_real_3_t    *restrict pvar,
-                     const cs_real_t      *restrict c_weight,
-                     cs_real_33_t         *restrict gradv)
-{
-  const cs_lnum_t n_cells = m->n_cells;
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
-  const int n_b_threads = m->b_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
-  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
-
-  const cs_lnum_2_t *restrict i_face_cells
-    = (const cs_lnum_2_t *restrict)m->i_face_cells;
-  const cs_lnum_t *restrict b_face_cells
-    = (const cs_lnum_t *restrict)m->b_face_cells;
-  const cs_lnum_t *restrict cell_cells_idx
-    = (const cs_lnum_t *restrict)m->cell_cells_idx;
-  const cs_lnum_t *restrict cell_cells_lst
-    = (const cs_lnum_t *restrict)m->cell_cells_lst;
-
-  const cs_real_3_t *restrict cell_cen
-    = (const cs_real_3_t *restrict)fvq->cell_cen;
-  const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict b_dist = fvq->b_dist;
-  const cs_real_3_t *restrict b_face_normal
-    = (const cs_real_3_t *restrict)fvq->b_face_normal;
-
-  cs_cocg_6_t  *restrict cocgb_s = NULL;
-  cs_cocg_6_t *restrict cocg = NULL;
-  _get_cell_cocg_lsq(m, halo_type, false, fvq, cpl, &cocg, &cocgb_s);
-
-  cs_real_33_t *rhs;
-
-  BFT_MALLOC(rhs, n_cells_ext, cs_real_33_t);
-
-  cs_lnum_t   cpl_stride = 0;
-  const bool _coupled_faces[1] = {false};
-  const bool  *coupled_faces = _coupled_faces;
-  if (cpl != NULL) {
-    cpl_stride = 1;
-    coupled_faces = (const bool *)cpl->coupled_faces;
-  }
-
-  /* Compute Right-Hand Side */
-  /*-------------------------*/
-
-# pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    for (cs_lnum_t i = 0; i < 3; i++)
-      for (cs_lnum_t j = 0; j < 3; j++)
-        rhs[c_id][i][j] = 0.0;
-  }
-
-  /* Contribution from interior faces */
-
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
-
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
-
-      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           f_id++) {
-
-        cs_lnum_t c_id1 = i_face_cells[f_id][0];
-        cs_lnum_t c_id2 = i_face_cells[f_id][1];
-
-        cs_real_t  dc[3], fctb[3];
-
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
-
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
-
-        if (c_weight != NULL) {
-          cs_real_t pond = weight[f_id];
-          cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
-                                  + (1. - pond)*c_weight[c_id2]);
-
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
-
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += c_weight[c_id2] * denom * fctb[j];
-              rhs[c_id2][i][j] += c_weight[c_id1] * denom * fctb[j];
-            }
-          }
-        }
-        else {
-          for (cs_lnum_t i = 0; i < 3; i++) {
-            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
-
-            for (cs_lnum_t j = 0; j < 3; j++) {
-              fctb[j] = dc[j] * pfac;
-              rhs[c_id1][i][j] += fctb[j];
-              rhs[c_id2][i][j] += fctb[j];
-            }
-          }
-        }
-
-      } /* loop on faces */
-
-    } /* loop on threads */
-
-  } /* loop on thread groups */
-
-  /* Contribution from extended neighborhood */
-
-  if (halo_type == CS_HALO_EXTENDED) {
-
-#   pragma omp parallel for
-    for (cs_lnum_t c_id1 = 0; c_id1 < n_cells; c_id1++) {
-      for (cs_lnum_t cidx = cell_cells_idx[c_id1];
-           cidx < cell_cells_idx[c_id1+1];
-           cidx++) {
-
-        cs_lnum_t c_id2 = cell_cells_lst[cidx];
-
-        cs_real_t dc[3];
-
-        for (cs_lnum_t i = 0; i < 3; i++)
-          dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
-
-        cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
-
-        for (cs_lnum_t i = 0; i < 3; i++) {
-
-          cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
-
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            rhs[c_id1][i][j] += dc[j] * pfac;
-          }
-        }
-      }
-    }
-
-  } /* End for extended neighborhood */
-
-  /* Contribution from coupled faces */
-
-  if (cpl != NULL)
-    cs_internal_coupling_lsq_vector_gradient(cpl,
-                                             c_weight,
-                                             1, /* w_stride */
-                                             pvar,
-                                             rhs);
-
-  /* Contribution from boundary faces */
-
-# pragma omp parallel for
-  for (int t_id = 0; t_id < n_b_threads; t_id++) {
-
-    for (cs_lnum_t f_id = b_group_index[t_id*2];
-         f_id < b_group_index[t_id*2 + 1];
-         f_id++) {
-
-      if (coupled_faces[f_id * cpl_stride])
-        continue;
-
-      cs_lnum_t c_id1 = b_face_cells[f_id];
-
-      cs_real_t n_d_dist[3];
-      /* Normal is vector 0 if the b_face_normal norm is too small */
-      cs_math_3_normalize(b_face_normal[f_id], n_d_dist);
-
-      cs_real_t d_b_dist = 1. / b_dist[f_id];
-
-      /* Normal divided by b_dist */
-      for (cs_lnum_t i = 0; i < 3; i++)
-        n_d_dist[i] *= d_b_dist;
-
-      for (cs_lnum_t i = 0; i < 3; i++) {
-        cs_real_t pfac =   coefav[f_id][i]*inc
-                         + (  coefbv[f_id][0][i] * pvar[c_id1][0]
-                            + coefbv[f_id][1][i] * pvar[c_id1][1]
-                            + coefbv[f_id][2][i] * pvar[c_id1][2]
-                            - pvar[c_id1][i]);
-
-        for (cs_lnum_t j = 0; j < 3; j++)
-          rhs[c_id1][i][j] += n_d_dist[j] * pfac;
-      }
 
-    } /* loop on faces */
+    /* part already computed from rhs */
+    rhsb_v[ll] = rhs[pp][qq];
+  }
 
-  } /* loop on threads */
+  s_id = madj->cell_b_faces_idx[c_id];
+  e_id = madj->cell_b_faces_idx[c_id+1];
 
-  /* Compute gradient */
-  /*------------------*/
+  const cs_lnum_t   *restrict cell_b_faces
+    = (const cs_lnum_t *restrict)(madj->cell_b_faces);
 
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    for (cs_lnum_t i = 0; i < 3; i++) {
-      gradv[c_id][i][0] =   rhs[c_id][i][0] * cocg[c_id][0]
-                          + rhs[c_id][i][1] * cocg[c_id][3]
-                          + rhs[c_id][i][2] * cocg[c_id][5];
+  for (cs_lnum_t i = s_id; i < e_id; i++) {
 
-      gradv[c_id][i][1] =   rhs[c_id][i][0] * cocg[c_id][3]
-                          + rhs[c_id][i][1] * cocg[c_id][1]
-                          + rhs[c_id][i][2] * cocg[c_id][4];
+    cs_lnum_t f_id = cell_b_faces[i];
 
-      gradv[c_id][i][2] =   rhs[c_id][i][0] * cocg[c_id][5]
-                          + rhs[c_id][i][1] * cocg[c_id][4]
-                          + rhs[c_id][i][2] * cocg[c_id][2];
-    }
-  }
+    /* build cocgb_v matrix */
 
-  /* Compute gradient on boundary cells */
-  /*------------------------------------*/
+    const cs_real_t *restrict iipbf = diipb[f_id];
 
-  #pragma omp parallel
-  {
-    cs_lnum_t t_s_id, t_e_id;
-    cs_parall_thread_range(m->n_b_cells, sizeof(cs_real_t), &t_s_id, &t_e_id);
+    cs_real_3_t nb;
+    /* Normal is vector 0 if the b_face_normal norm is too small */
+    cs_math_3_normalize(b_face_normal[f_id], nb);
 
-    /* Build indices bijection between [1-9] and [1-3]*[1-3] */
+    cs_real_t db = 1./b_dist[f_id];
+    cs_real_t db2 = db*db;
 
-    cs_lnum_t _33_9_idx[9][2];
-    int nn = 0;
-    for (int ll = 0; ll < 3; ll++) {
-      for (int mm = 0; mm < 3; mm++) {
-        _33_9_idx[nn][0] = ll;
-        _33_9_idx[nn][1] = mm;
-        nn++;
-      }
+    /* (B - I) */
+    cs_real_t bt[stride][stride];
+    for (cs_lnum_t ll = 0; ll < stride; ll++) {
+      for (cs_lnum_t pp = 0; pp < stride; pp++)
+        bt[ll][pp] = coefbv[f_id][ll][pp];
+      bt[ll][ll] -= 1;
     }
 
-    /* Loop on boundary cells */
+    /* (B - I)^t.(B - I) and A + (B - I).v, shared by all unknowns */
+    cs_real_t btb[stride][stride], tfac[stride];
+    for (cs_lnum_t kk = 0; kk < stride; kk++) {
+      for (cs_lnum_t rr = 0; rr < stride; rr++) {
+        btb[kk][rr] = 0.;
+        for (cs_lnum_t mm = 0; mm < stride; mm++)
+          btb[kk][rr] += bt[mm][kk]*bt[mm][rr];
+      }
+      tfac[kk] = inc*coefav[f_id][kk];
+      for (cs_lnum_t mm = 0; mm < stride; mm++)
+        tfac[kk] += bt[kk][mm]*pvar[c_id][mm];
+    }
 
-    for (cs_lnum_t b_c_id = t_s_id; b_c_id < t_e_id; b_c_id++) {
+    /* cocgb */
 
-      cs_lnum_t c_id = m->b_cells[b_c_id];
+    for (cs_lnum_t ll = 0; ll < n; ll++) {
 
-      cs_real_t cocgb[3][3], cocgb_v[45], rhsb_v[9], x[9];
+      /* contribution of t[kk][qq] */
+      cs_lnum_t kk = ll / 3;
+      cs_lnum_t qq = ll % 3;
 
-      _complete_cocg_lsq(c_id, madj, fvq, cocgb_s[b_c_id], cocgb);
+      cs_lnum_t ll_n = ll*(ll+1)/2;
+      for (cs_lnum_t pp = 0; pp <= ll; pp++) {
 
-      _compute_cocgb_rhsb_lsq_v
-        (c_id,
-         inc,
-         madj,
-         fvq,
-         _33_9_idx,
-         (const cs_real_3_t *)pvar,
-         (const cs_real_3_t *)coefav,
-         (const cs_real_33_t *)coefbv,
-         (const cs_real_3_t *)cocgb,
-         (const cs_real_3_t *)rhs[c_id],
-         cocgb_v,
-         rhsb_v);
+        /* derivative with respect to t[rr][ss] */
+        cs_lnum_t rr = pp / 3;
+        cs_lnum_t ss = pp % 3;
 
-      _fw_and_bw_ldtl_pp(cocgb_v,
-                         9,
-                         x,
-                         rhsb_v);
+        /* part from derivative of 1/2*|| B*t*II'/db ||^2 */
+        cocgb_v[ll_n+pp] += btb[kk][rr]*(iipbf[qq]*iipbf[ss])*db2;
 
-      for (int kk = 0; kk < 9; kk++) {
-        int ii = _33_9_idx[kk][0];
-        int jj = _33_9_idx[kk][1];
-        gradv[c_id][ii][jj] = x[kk];
+        /* part from derivative of -< t*nb , B*t*II'/db > */
+        cocgb_v[ll_n+pp] -= (  nb[ss]*bt[rr][kk]*iipbf[qq]
+                             + nb[qq]*bt[kk][rr]*iipbf[ss])
+                             *db;
       }
-
     }
 
-  }
+    /* rhsb */
 
-  /* Periodicity and parallelism treatment */
+    for (cs_lnum_t ll = 0; ll < n; ll++) {
+      cs_lnum_t pp = ll / 3;
+      cs_lnum_t qq = ll % 3;
+
+      /* part from derivative of < (B-1)*t*II'/db , (A+(B-1)*v)/db > */
+      cs_real_t rhsv = 0.;
+      for (cs_lnum_t rr = 0; rr < stride; rr++)
+        rhsv += bt[rr][pp]*tfac[rr];
+
+      rhsb_v[ll] -= rhsv*iipbf[qq]*db2;
+    }
 
-  if (m->halo != NULL) {
-    cs_halo_sync_var_strided(m->halo, halo_type, (cs_real_t *)gradv, 9);
-    if (cs_glob_mesh->have_rotation_perio)
-      cs_halo_perio_sync_var_tens(m->halo, halo_type, (cs_real_t *)gradv);
   }
 
-  BFT_FREE(rhs);
+  /* Crout factorization of symmetric cocg at boundaries */
+
+  _fact_crout_pp(n, cocgb_v);
 }
 
 /*----------------------------------------------------------------------------
- * Compute cell gradient of a tensor using least-squares reconstruction for
- * non-orthogonal meshes (n_r_sweeps > 1).
+ * Compute cell gradient of a vector or symmetric tensor using least-squares
+ * reconstruction for non-orthogonal meshes (n_r_sweeps > 1).
+ *
+ * template parameters:
+ *   stride         3 for vectors, 6 for symmetric tensors
  *
  * parameters:
  *   m              <-- pointer to associated mesh structure
  *   madj           <-- pointer to mesh adjacencies structure
  *   fvq            <-- pointer to associated finite volume quantities
+ *   cpl            <-- structure associated with internal coupling, or NULL
+ *                      (vectors only)
  *   halo_type      <-- halo type (extended or not)
  *   inc            <-- if 0, solve on increment; 1 otherwise
- *   coefat         <-- B.C. coefficients for boundary face normals
- *   coefbt         <-- B.C. coefficients for boundary face normals
+ *   coefav         <-- B.C. coefficients for boundary face normals
+ *   coefbv         <-- B.C. coefficients for boundary face normals
  *   pvar           <-- variable
- *   gradt          --> gradient of pvar (du_i/dx_j : gradv[][i][j])
+ *   c_weight       <-- weighted gradient coefficient variable, or NULL
+ *   grad           --> gradient of pvar (du_i/dx_j : grad[][i][j])
  *----------------------------------------------------------------------------*/
 
+template <const cs_lnum_t stride>
 static void
-_lsq_tensor_gradient(const cs_mesh_t              *m,
-                     const cs_mesh_adjacencies_t  *madj,
-                     const cs_mesh_quantities_t   *fvq,
-                     const cs_halo_type_t          halo_type,
-                     const int                     inc,
-                     const cs_real_6_t   *restrict coefat,
-                     const cs_real_66_t  *restrict coefbt,
-                     const cs_real_6_t   *restrict pvar,
-                     const cs_real_t     *restrict c_weight,
-                     cs_real_63_t        *restrict gradt)
+_lsq_strided_gradient(const cs_mesh_t               *m,
+                      const cs_mesh_adjacencies_t   *madj,
+                      const cs_mesh_quantities_t    *fvq,
+                      const cs_internal_coupling_t  *cpl,
+                      const cs_halo_type_t           halo_type,
+                      const int                      inc,
+                      const cs_real_t (*restrict coefav)[stride],
+                      const cs_real_t (*restrict coefbv)[stride][stride],
+                      const cs_real_t (*restrict pvar)[stride],
+                      const cs_real_t      *restrict c_weight,
+                      cs_real_t (*restrict grad)[stride][3])
 {
+  typedef cs_real_t grad_t[stride][3];
+
   const cs_lnum_t n_cells = m->n_cells;
   const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
   const int n_i_groups = m->i_face_numbering->n_groups;
@@ -7257,21 +7005,20 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
   const cs_real_3_t *restrict b_face_normal
     = (const cs_real_3_t *restrict)fvq->b_face_normal;
 
-  cs_cocg_6_t *restrict cocgb_s = NULL;
+  cs_cocg_6_t  *restrict cocgb_s = NULL;
   cs_cocg_6_t *restrict cocg = NULL;
-  _get_cell_cocg_lsq(m, halo_type, false, fvq, NULL, &cocg, &cocgb_s);
-
-  cs_real_63_t *rhs;
+  _get_cell_cocg_lsq(m, halo_type, false, fvq, cpl, &cocg, &cocgb_s);
 
-  BFT_MALLOC(rhs, n_cells_ext, cs_real_63_t);
+  grad_t *rhs;
 
-  /* Reinitialize cocg at boundaries, using saved cocgb */
+  BFT_MALLOC(rhs, n_cells_ext, grad_t);
 
-# pragma omp parallel for
-  for (cs_lnum_t ii = 0; ii < m->n_b_cells; ii++) {
-    cs_lnum_t c_id = m->b_cells[ii];
-    for (cs_lnum_t ll = 0; ll < 6; ll++)
-      cocg[c_id][ll] = cocgb_s[ii][ll];
+  cs_lnum_t   cpl_stride = 0;
+  const bool _coupled_faces[1] = {false};
+  const bool  *coupled_faces = _coupled_faces;
+  if (cpl != NULL) {
+    cpl_stride = 1;
+    coupled_faces = (const bool *)cpl->coupled_faces;
   }
 
   /* Compute Right-Hand Side */
@@ -7279,10 +7026,9 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
 
 # pragma omp parallel for
   for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    for (cs_lnum_t i = 0; i < 6; i++) {
+    for (cs_lnum_t i = 0; i < stride; i++)
       for (cs_lnum_t j = 0; j < 3; j++)
         rhs[c_id][i][j] = 0.0;
-    }
   }
 
   /* Contribution from interior faces */
@@ -7299,7 +7045,8 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
         cs_lnum_t c_id1 = i_face_cells[f_id][0];
         cs_lnum_t c_id2 = i_face_cells[f_id][1];
 
-        cs_real_3_t dc, fctb;
+        cs_real_t  dc[3], fctb[3];
+
         for (cs_lnum_t i = 0; i < 3; i++)
           dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
 
@@ -7310,8 +7057,8 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
           cs_real_t denom = 1. / (  pond       *c_weight[c_id1]
                                   + (1. - pond)*c_weight[c_id2]);
 
-          for (cs_lnum_t i = 0; i < 6; i++) {
-            cs_real_t pfac =  (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+          for (cs_lnum_t i = 0; i < stride; i++) {
+            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
             for (cs_lnum_t j = 0; j < 3; j++) {
               fctb[j] = dc[j] * pfac;
@@ -7321,8 +7068,8 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
           }
         }
         else {
-          for (cs_lnum_t i = 0; i < 6; i++) {
-            cs_real_t pfac =  (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
+          for (cs_lnum_t i = 0; i < stride; i++) {
+            cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
             for (cs_lnum_t j = 0; j < 3; j++) {
               fctb[j] = dc[j] * pfac;
@@ -7350,13 +7097,14 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
 
         cs_lnum_t c_id2 = cell_cells_lst[cidx];
 
-        cs_real_3_t dc;
+        cs_real_t dc[3];
+
         for (cs_lnum_t i = 0; i < 3; i++)
           dc[i] = cell_cen[c_id2][i] - cell_cen[c_id1][i];
 
         cs_real_t ddc = 1./(dc[0]*dc[0] + dc[1]*dc[1] + dc[2]*dc[2]);
 
-        for (cs_lnum_t i = 0; i < 6; i++) {
+        for (cs_lnum_t i = 0; i < stride; i++) {
 
           cs_real_t pfac = (pvar[c_id2][i] - pvar[c_id1][i]) * ddc;
 
@@ -7369,6 +7117,17 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
 
   } /* End for extended neighborhood */
 
+  /* Contribution from coupled faces (vectors only) */
+
+  if (cpl != NULL) {
+    assert(stride == 3);
+    cs_internal_coupling_lsq_vector_gradient(cpl,
+                                             c_weight,
+                                             1, /* w_stride */
+                                             (const cs_real_3_t *)pvar,
+                                             (cs_real_33_t *)rhs);
+  }
+
   /* Contribution from boundary faces */
 
 # pragma omp parallel for
@@ -7378,9 +7137,12 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
          f_id < b_group_index[t_id*2 + 1];
          f_id++) {
 
+      if (coupled_faces[f_id * cpl_stride])
+        continue;
+
       cs_lnum_t c_id1 = b_face_cells[f_id];
 
-      cs_real_3_t n_d_dist;
+      cs_real_t n_d_dist[3];
       /* Normal is vector 0 if the b_face_normal norm is too small */
       cs_math_3_normalize(b_face_normal[f_id], n_d_dist);
 
@@ -7390,13 +7152,13 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
       for (cs_lnum_t i = 0; i < 3; i++)
         n_d_dist[i] *= d_b_dist;
 
-      for (cs_lnum_t i = 0; i < 6; i++) {
-        cs_real_t pfac = coefat[f_id][i]*inc - pvar[c_id1][i];
-        for (cs_lnum_t j = 0; j < 6; j++)
-          pfac += coefbt[f_id][j][i] * pvar[c_id1][j];
+      for (cs_lnum_t i = 0; i < stride; i++) {
+        cs_real_t pfac = coefav[f_id][i]*inc - pvar[c_id1][i];
+        for (cs_lnum_t k = 0; k < stride; k++)
+          pfac += coefbv[f_id][k][i] * pvar[c_id1][k];
 
         for (cs_lnum_t j = 0; j < 3; j++)
-          rhs[c_id1][i][j] += pfac * n_d_dist[j];
+          rhs[c_id1][i][j] += n_d_dist[j] * pfac;
       }
 
     } /* loop on faces */
@@ -7406,253 +7168,76 @@ _lsq_tensor_gradient(const cs_mesh_t              *m,
   /* Compute gradient */
   /*------------------*/
 
+# pragma omp parallel for
   for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    for (cs_lnum_t i = 0; i < 6; i++) {
-      gradt[c_id][i][0] =   rhs[c_id][i][0] * cocg[c_id][0]
-                          + rhs[c_id][i][1] * cocg[c_id][3]
-                          + rhs[c_id][i][2] * cocg[c_id][5];
-
-      gradt[c_id][i][1] =   rhs[c_id][i][0] * cocg[c_id][3]
-                          + rhs[c_id][i][1] * cocg[c_id][1]
-                          + rhs[c_id][i][2] * cocg[c_id][4];
-
-      gradt[c_id][i][2] =   rhs[c_id][i][0] * cocg[c_id][5]
-                          + rhs[c_id][i][1] * cocg[c_id][4]
-                          + rhs[c_id][i][2] * cocg[c_id][2];
+    for (cs_lnum_t i = 0; i < stride; i++) {
+      grad[c_id][i][0] =   rhs[c_id][i][0] * cocg[c_id][0]
+                         + rhs[c_id][i][1] * cocg[c_id][3]
+                         + rhs[c_id][i][2] * cocg[c_id][5];
+
+      grad[c_id][i][1] =   rhs[c_id][i][0] * cocg[c_id][3]
+                         + rhs[c_id][i][1] * cocg[c_id][1]
+                         + rhs[c_id][i][2] * cocg[c_id][4];
+
+      grad[c_id][i][2] =   rhs[c_id][i][0] * cocg[c_id][5]
+                         + rhs[c_id][i][1] * cocg[c_id][4]
+                         + rhs[c_id][i][2] * cocg[c_id][2];
     }
   }
 
   /* Compute gradient on boundary cells */
   /*------------------------------------*/
 
+  /* The boundary cocg is completed locally for each cell, from the
+     saved values, so the shared cocg array is not modified. */
+
   #pragma omp parallel
   {
+    const cs_lnum_t n = stride*3;
+
     cs_lnum_t t_s_id, t_e_id;
     cs_parall_thread_range(m->n_b_cells, sizeof(cs_real_t), &t_s_id, &t_e_id);
 
-    /* Build indices bijection between [1-18] and [1-6]*[1-3] */
-
-    cs_lnum_t _63_18_idx[18][2];
-    int nn = 0;
-    for (int ll = 0; ll < 6; ll++) {
-      for (int mm = 0; mm < 3; mm++) {
-        _63_18_idx[nn][0] = ll;
-        _63_18_idx[nn][1] = mm;
-        nn++;
-      }
-    }
-
-    /* Loop on boundary cells */
-
-    for (cs_lnum_t b_c_id = t_s_id; b_c_id < t_e_id; b_c_id++) {
-
-      cs_lnum_t c_id = m->b_cells[b_c_id];
-
-      cs_real_t cocgb[3][3], cocgb_t[171], rhsb_t[18], x[18];
-
-      _complete_cocg_lsq(c_id, madj, fvq, cocg[c_id], cocgb);
-
-      _compute_cocgb_rhsb_lsq_t
-        (c_id,
-         inc,
-         madj,
-         fvq,
-         _63_18_idx,
-         (const cs_real_6_t *)pvar,
-         (const cs_real_6_t *)coefat,
-         (const cs_real_66_t *)coefbt,
-         (const cs_real_3_t *)cocgb,
-         (const cs_real_3_t *)rhs[c_id],
-         cocgb_t,
-         rhsb_t);
-
-      _fw_and_bw_ldtl_pp(cocgb_t,
-                         18,
-                         x,
-                         rhsb_t);
-
-      for (int kk = 0; kk < 18; kk++) {
-        int ii = _63_18_idx[kk][0];
-        int jj = _63_18_idx[kk][1];
-        gradt[c_id][ii][jj] = x[kk];
-      }
-
-    }
-
-  }
-
-  /* Periodicity and parallelism treatment */
-
-  if (m->halo != NULL) {
-    cs_halo_sync_var_strided(m->halo, halo_type, (cs_real_t *)gradt, 18);
-    if (cs_glob_mesh->have_rotation_perio)
-      cs_halo_perio_sync_var_tens(m->halo, halo_type, (cs_real_t *)gradt);
-  }
-
-  BFT_FREE(rhs);
-}
-
-/*----------------------------------------------------------------------------
- * Initialize the gradient of a tensor for gradient reconstruction.
- *
- * A non-reconstructed gradient is computed at this stage.
- *
- * parameters:
- *   m              <-- pointer to associated mesh structure
- *   fvq            <-- pointer to associated finite volume quantities
- *   halo_type      <-- halo type (extended or not)
- *   inc            <-- if 0, solve on increment; 1 otherwise
- *   coefat         <-- B.C. coefficients for boundary face normals
- *   coefbt         <-- B.C. coefficients for boundary face normals
- *   pvar           <-- variable
- *   grad          --> gradient of pvar (dts_i/dx_j : grad[][i][j])
- *----------------------------------------------------------------------------*/
-
-static void
-_initialize_tensor_gradient(const cs_mesh_t              *m,
-                            const cs_mesh_quantities_t   *fvq,
-                            cs_halo_type_t                halo_type,
-                            int                           inc,
-                            const cs_real_6_t   *restrict coefat,
-                            const cs_real_66_t  *restrict coefbt,
-                            const cs_real_6_t   *restrict pvar,
-                            cs_real_63_t        *restrict grad)
-{
-  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
-  const cs_lnum_t n_cells = m->n_cells;
-  const int n_i_groups = m->i_face_numbering->n_groups;
-  const int n_i_threads = m->i_face_numbering->n_threads;
-  const int n_b_threads = m->b_face_numbering->n_threads;
-  const cs_lnum_t *restrict i_group_index = m->i_face_numbering->group_index;
-  const cs_lnum_t *restrict b_group_index = m->b_face_numbering->group_index;
-
-  const cs_lnum_2_t *restrict i_face_cells
-    = (const cs_lnum_2_t *restrict)m->i_face_cells;
-  const cs_lnum_t *restrict b_face_cells
-    = (const cs_lnum_t *restrict)m->b_face_cells;
-
-  const int *restrict c_disable_flag = fvq->c_disable_flag;
-  cs_lnum_t has_dc = fvq->has_disable_flag; /* Has cells disabled? */
-
-  const cs_real_t *restrict weight = fvq->weight;
-  const cs_real_t *restrict cell_f_vol = fvq->cell_f_vol;
-  if (cs_glob_porous_model == 1 || cs_glob_porous_model == 2)
-    cell_f_vol = fvq->cell_vol;
-  const cs_real_3_t *restrict i_f_face_normal
-    = (const cs_real_3_t *restrict)fvq->i_f_face_normal;
-  const cs_real_3_t *restrict b_f_face_normal
-    = (const cs_real_3_t *restrict)fvq->b_f_face_normal;
-
-  /* Computation without reconstruction */
-  /*------------------------------------*/
-
-  /* Initialization */
-
-# pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells_ext; c_id++) {
-    for (cs_lnum_t i = 0; i < 6; i++) {
-      for (cs_lnum_t j = 0; j < 3; j++)
-        grad[c_id][i][j] = 0.0;
-    }
-  }
-
-  /* Interior faces contribution */
-
-  for (int g_id = 0; g_id < n_i_groups; g_id++) {
-
-#   pragma omp parallel for
-    for (int t_id = 0; t_id < n_i_threads; t_id++) {
-
-      for (cs_lnum_t f_id = i_group_index[(t_id*n_i_groups + g_id)*2];
-           f_id < i_group_index[(t_id*n_i_groups + g_id)*2 + 1];
-           f_id++) {
-
-        cs_lnum_t c_id1 = i_face_cells[f_id][0];
-        cs_lnum_t c_id2 = i_face_cells[f_id][1];
-
-        cs_real_t pond = weight[f_id];
-
-        /*
-           Remark: \f$ \varia_\face = \alpha_\ij \varia_\celli
-                                    + (1-\alpha_\ij) \varia_\cellj\f$
-                   but for the cell \f$ \celli \f$ we remove
-                   \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-                   and for the cell \f$ \cellj \f$ we remove
-                   \f$ \varia_\cellj \sum_\face \vect{S}_\face = \vect{0} \f$
-        */
-        for (cs_lnum_t i = 0; i < 6; i++) {
-          cs_real_t pfaci = (1.0-pond) * (pvar[c_id2][i] - pvar[c_id1][i]);
-          cs_real_t pfacj =     - pond * (pvar[c_id2][i] - pvar[c_id1][i]);
-          for (cs_lnum_t j = 0; j < 3; j++) {
-            grad[c_id1][i][j] += pfaci * i_f_face_normal[f_id][j];
-            grad[c_id2][i][j] -= pfacj * i_f_face_normal[f_id][j];
-          }
-        }
-
-      } /* End of loop on faces */
-
-    } /* End of loop on threads */
-
-  } /* End of loop on thread groups */
-
-  /* Boundary face treatment */
-
-# pragma omp parallel for
-  for (int t_id = 0; t_id < n_b_threads; t_id++) {
-
-    for (cs_lnum_t f_id = b_group_index[t_id*2];
-         f_id < b_group_index[t_id*2 + 1];
-         f_id++) {
-
-      cs_lnum_t c_id = b_face_cells[f_id];
-
-      /*
-        Remark: for the cell \f$ \celli \f$ we remove
-                 \f$ \varia_\celli \sum_\face \vect{S}_\face = \vect{0} \f$
-      */
-      for (cs_lnum_t i = 0; i < 6; i++) {
-        cs_real_t pfac = inc*coefat[f_id][i];
+    /* Loop on boundary cells */
 
-        for (cs_lnum_t k = 0; k < 6; k++) {
-          if (i == k)
-            pfac += (coefbt[f_id][i][k] - 1.0) * pvar[c_id][k];
-          else
-            pfac += coefbt[f_id][i][k] * pvar[c_id][k] ;
+    for (cs_lnum_t b_c_id = t_s_id; b_c_id < t_e_id; b_c_id++) {
 
-        }
+      cs_lnum_t c_id = m->b_cells[b_c_id];
 
-        for (cs_lnum_t j = 0; j < 3; j++)
-          grad[c_id][i][j] += pfac * b_f_face_normal[f_id][j];
-      }
+      cs_real_t cocgb[3][3], cocgb_v[n*(n+1)/2], rhsb_v[n], x[n];
 
-    } /* loop on faces */
+      _complete_cocg_lsq(c_id, madj, fvq, cocgb_s[b_c_id], cocgb);
 
-  } /* loop on threads */
+      _compute_cocgb_rhsb_lsq_s<stride>
+        (c_id,
+         inc,
+         madj,
+         fvq,
+         pvar,
+         coefav,
+         coefbv,
+         (const cs_real_3_t *)cocgb,
+         (const cs_real_3_t *)rhs[c_id],
+         cocgb_v,
+         rhsb_v);
 
-# pragma omp parallel for
-  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
-    cs_real_t dvol;
-    /* Is the cell disabled (for solid or porous)? Not the case if coupled */
-    if (has_dc * c_disable_flag[has_dc * c_id] == 0)
-      dvol = 1. / cell_f_vol[c_id];
-    else
-      dvol = 0.;
+      _fw_and_bw_ldtl_pp(cocgb_v,
+                         n,
+                         x,
+                         rhsb_v);
+
+      for (cs_lnum_t kk = 0; kk < n; kk++)
+        grad[c_id][kk / 3][kk % 3] = x[kk];
 
-    for (cs_lnum_t i = 0; i < 6; i++) {
-      for (cs_lnum_t j = 0; j < 3; j++)
-        grad[c_id][i][j] *= dvol;
     }
+
   }
 
   /* Periodicity and parallelism treatment */
 
-  if (m->halo != NULL) {
-    cs_halo_sync_var_strided(m->halo, halo_type, (cs_real_t *)grad, 18);
-    if (cs_glob_mesh->have_rotation_perio)
-      cs_halo_perio_sync_var_sym_tens_grad(m->halo,
-                                           halo_type,
-                                           (cs_real_t *)grad);
-  }
+  _sync_strided_gradient_halo<stride>(m, halo_type, grad);
+
+  BFT_FREE(rhs);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -8039,51 +7624,51 @@ _gradient_vector(const char                     *var_name,
 
   case CS_GRADIENT_GREEN_ITER:
 
-    _initialize_vector_gradient(mesh,
-                                fvq,
-                                cpl,
-                                halo_type,
-                                inc,
-                                bc_coeff_a,
-                                bc_coeff_b,
-                                var,
-                                c_weight,
-                                grad);
+    _initialize_strided_gradient<3>(mesh,
+                                    fvq,
+                                    cpl,
+                                    halo_type,
+                                    inc,
+                                    bc_coeff_a,
+                                    bc_coeff_b,
+                                    var,
+                                    c_weight,
+                                    grad);
 
     /* If reconstructions are required */
 
     if (n_r_sweeps > 1)
-      _iterative_vector_gradient(mesh,
-                                 fvq,
-                                 cpl,
-                                 var_name,
-                                 gradient_info,
-                                 halo_type,
-                                 inc,
-                                 n_r_sweeps,
-                                 verbosity,
-                                 epsilon,
-                                 bc_coeff_a,
-                                 bc_coeff_b,
-                                 (const cs_real_3_t *)var,
-                                 c_weight,
-                                 grad);
+      _iterative_strided_gradient<3>(mesh,
+                                     fvq,
+                                     cpl,
+                                     var_name,
+                                     gradient_info,
+                                     halo_type,
+                                     inc,
+                                     n_r_sweeps,
+                                     verbosity,
+                                     epsilon,
+                                     bc_coeff_a,
+                                     bc_coeff_b,
+                                     (const cs_real_3_t *)var,
+                                     c_weight,
+                                     grad);
 
     break;
 
   case CS_GRADIENT_LSQ:
 
-    _lsq_vector_gradient(mesh,
-                         cs_glob_mesh_adjacencies,
-                         fvq,
-                         cpl,
-                         halo_type,
-                         inc,
-                         bc_coeff_a,
-                         bc_coeff_b,
-                         (const cs_real_3_t *)var,
-                         c_weight,
-                         grad);
+    _lsq_strided_gradient<3>(mesh,
+                             cs_glob_mesh_adjacencies,
+                             fvq,
+                             cpl,
+                             halo_type,
+                             inc,
+                             bc_coeff_a,
+                             bc_coeff_b,
+                             (const cs_real_3_t *)var,
+                             c_weight,
+                             grad);
 
     _vector_gradient_clipping(mesh,
                               fvq,
@@ -8103,17 +7688,17 @@ _gradient_vector(const char                     *var_name,
       cs_real_33_t  *restrict r_gradv;
       BFT_MALLOC(r_gradv, n_cells_ext, cs_real_33_t);
 
-      _lsq_vector_gradient(mesh,
-                           cs_glob_mesh_adjacencies,
-                           fvq,
-                           cpl,
-                           halo_type,
-                           inc,
-                           bc_coeff_a,
-                           bc_coeff_b,
-                           (const cs_real_3_t *)var,
-                           c_weight,
-                           r_gradv);
+      _lsq_strided_gradient<3>(mesh,
+                               cs_glob_mesh_adjacencies,
+                               fvq,
+                               cpl,
+                               halo_type,
+                               inc,
+                               bc_coeff_a,
+                               bc_coeff_b,
+                               (const cs_real_3_t *)var,
+                               c_weight,
+                               r_gradv);
 
       _vector_gradient_clipping(mesh,
                                 fvq,
@@ -8711,46 +8296,51 @@ _gradient_tensor(const char                *var_name,
 
   case CS_GRADIENT_GREEN_ITER:
 
-    _initialize_tensor_gradient(mesh,
-                                fvq,
-                                halo_type,
-                                inc,
-                                bc_coeff_a,
-                                bc_coeff_b,
-                                var,
-                                grad);
+    _initialize_strided_gradient<6>(mesh,
+                                    fvq,
+                                    NULL, /* cpl */
+                                    halo_type,
+                                    inc,
+                                    bc_coeff_a,
+                                    bc_coeff_b,
+                                    var,
+                                    NULL, /* c_weight */
+                                    grad);
 
     /* If reconstructions are required */
 
     if (n_r_sweeps > 1)
-      _iterative_tensor_gradient(mesh,
-                                 fvq,
-                                 var_name,
-                                 gradient_info,
-                                 halo_type,
-                                 inc,
-                                 n_r_sweeps,
-                                 verbosity,
-                                 epsilon,
-                                 bc_coeff_a,
-                                 bc_coeff_b,
-                                 (const cs_real_6_t *)var,
-                                 grad);
+      _iterative_strided_gradient<6>(mesh,
+                                     fvq,
+                                     NULL, /* cpl */
+                                     var_name,
+                                     gradient_info,
+                                     halo_type,
+                                     inc,
+                                     n_r_sweeps,
+                                     verbosity,
+                                     epsilon,
+                                     bc_coeff_a,
+                                     bc_coeff_b,
+                                     (const cs_real_6_t *)var,
+                                     NULL, /* c_weight */
+                                     grad);
 
     break;
 
   case CS_GRADIENT_LSQ:
 
-    _lsq_tensor_gradient(mesh,
-                         cs_glob_mesh_adjacencies,
-                         fvq,
-                         halo_type,
-                         inc,
-                         bc_coeff_a,
-                         bc_coeff_b,
-                         (const cs_real_6_t *)var,
-                         NULL, /* c_weight */
-                         grad);
+    _lsq_strided_gradient<6>(mesh,
+                             cs_glob_mesh_adjacencies,
+                             fvq,
+                             NULL, /* cpl */
+                             halo_type,
+                             inc,
+                             bc_coeff_a,
+                             bc_coeff_b,
+                             (const cs_real_6_t *)var,
+                             NULL, /* c_weight */
+                             grad);
 
     _tensor_gradient_clipping(mesh,
                               fvq,
@@ -9215,6 +8805,27 @@ cs_gradient_free_quantities(void)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether the local stencil of cartesian meshes should be
+ *         used for least-squares gradients.
+ *
+ * When the mesh is generated as a cartesian mesh and its cells are not
+ * renumbered (and in parallel, partitioned by blocks), interior face
+ * contributions to unweighted least-squares gradients are then gathered
+ * by cell from stencil neighbors, with no face -> cell indirection.
+ * Otherwise, the usual face-based computation is used.
+ *
+ * \param[in]  use_stencil  true to use the cartesian stencil if available
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_cartesian_stencil(bool  use_stencil)
+{
+  _use_cartesian_stencil = use_stencil;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -9330,6 +8941,251 @@ cs_gradient_scalar(const char                    *var_name,
     cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several scalar fields at once.
+ *
+ * All variables share the same gradient and clipping options, and are
+ * handled by small blocks. Ghost cell values of the variables of a block
+ * are synchronized with a single halo exchange.
+ *
+ * For least-squares based gradient types, the gradients of a block of
+ * variables are computed in a single traversal of the mesh faces, reusing
+ * the saved cocg matrices, and are also synchronized with a single halo
+ * exchange. Other gradient types are computed for each variable in turn.
+ *
+ * \param[in]       batch_name     name used for performance logging
+ * \param[in]       n_vars         number of variables
+ * \param[in]       var_name       name of each variable
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       bc_coeff_a     boundary condition term a for each
+ *                                 variable (or NULL)
+ * \param[in]       bc_coeff_b     boundary condition term b for each
+ *                                 variable (or NULL)
+ * \param[in, out]  var            gradient's base variable for each variable
+ * \param[out]      grad           gradient for each variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                    *batch_name,
+                         int                            n_vars,
+                         const char                    *var_name[],
+                         cs_gradient_type_t             gradient_type,
+                         cs_halo_type_t                 halo_type,
+                         int                            inc,
+                         int                            n_r_sweeps,
+                         int                            verbosity,
+                         cs_gradient_limit_t            clip_mode,
+                         double                         epsilon,
+                         double                         clip_coeff,
+                         const cs_real_t               *bc_coeff_a[],
+                         const cs_real_t               *bc_coeff_b[],
+                         cs_real_t                     *var[],
+                         cs_real_3_t                   *grad[])
+{
+  if (n_vars < 1)
+    return;
+
+  const cs_mesh_t  *mesh = cs_glob_mesh;
+  cs_mesh_quantities_t  *fvq = cs_glob_mesh_quantities;
+  cs_gradient_info_t *gradient_info = NULL;
+  cs_timer_t t0, t1;
+
+  const cs_lnum_t n_cells = mesh->n_cells;
+  const cs_lnum_t n_cells_ext = mesh->n_cells_with_ghosts;
+  const cs_lnum_t n_b_faces = mesh->n_b_faces;
+
+  t0 = cs_timer_time();
+
+  gradient_info = _find_or_add_system(batch_name, gradient_type);
+
+  bool fused = (   gradient_type == CS_GRADIENT_LSQ
+                || gradient_type == CS_GRADIENT_GREEN_LSQ) ? true : false;
+
+#if defined(HAVE_CUDA)
+  if (cs_get_device_id() > -1)
+    fused = false;
+#endif
+
+  /* Use Neumann BC's as default if not provided */
+
+  const cs_real_t **_bc_coeff_a, **_bc_coeff_b;
+  BFT_MALLOC(_bc_coeff_a, n_vars, const cs_real_t *);
+  BFT_MALLOC(_bc_coeff_b, n_vars, const cs_real_t *);
+
+  cs_real_t *bc_coeff_a_0 = NULL, *bc_coeff_b_1 = NULL;
+
+  for (int k = 0; k < n_vars; k++) {
+    _bc_coeff_a[k] = (bc_coeff_a != NULL) ? bc_coeff_a[k] : NULL;
+    _bc_coeff_b[k] = (bc_coeff_b != NULL) ? bc_coeff_b[k] : NULL;
+    if (_bc_coeff_a[k] == NULL) {
+      if (bc_coeff_a_0 == NULL) {
+        BFT_MALLOC(bc_coeff_a_0, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          bc_coeff_a_0[i] = 0;
+      }
+      _bc_coeff_a[k] = bc_coeff_a_0;
+    }
+    if (_bc_coeff_b[k] == NULL) {
+      if (bc_coeff_b_1 == NULL) {
+        BFT_MALLOC(bc_coeff_b_1, n_b_faces, cs_real_t);
+        for (cs_lnum_t i = 0; i < n_b_faces; i++)
+          bc_coeff_b_1[i] = 1;
+      }
+      _bc_coeff_b[k] = bc_coeff_b_1;
+    }
+  }
+
+  /* Variables are handled by blocks, to bound the size of interleaved
+     work arrays */
+
+  const int n_b_max = CS_MIN(n_vars, _n_multi_vars_max);
+
+  cs_real_t *pvar;
+  BFT_MALLOC(pvar, n_cells_ext*n_b_max, cs_real_t);
+
+  cs_real_t *rhsv = NULL;
+  if (fused)
+    BFT_MALLOC(rhsv, n_cells_ext*n_b_max*3, cs_real_t);
+
+  for (int s_id = 0; s_id < n_vars; s_id += n_b_max) {
+
+    const cs_lnum_t n = CS_MIN(n_vars - s_id, n_b_max);
+
+    cs_real_t **_var = var + s_id;
+    cs_real_3_t **_grad = grad + s_id;
+
+    /* Interleave and synchronize variables */
+
+#   pragma omp parallel for if(n_cells > CS_THR_MIN)
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (cs_lnum_t k = 0; k < n; k++)
+        pvar[c_id*n + k] = _var[k][c_id];
+    }
+
+    if (mesh->halo != NULL) {
+      cs_halo_sync_var_strided(mesh->halo, halo_type, pvar, n);
+      for (cs_lnum_t c_id = n_cells; c_id < n_cells_ext; c_id++) {
+        for (cs_lnum_t k = 0; k < n; k++)
+          _var[k][c_id] = pvar[c_id*n + k];
+      }
+    }
+
+    if (fused == false) {
+      for (cs_lnum_t k = 0; k < n; k++)
+        _gradient_scalar(var_name[s_id + k],
+                         gradient_info,
+                         gradient_type,
+                         halo_type,
+                         inc,
+                         false, /* Do not use previous cocg at boundary */
+                         n_r_sweeps,
+                         0,     /* hyd_p_flag */
+                         1,     /* w_stride */
+                         verbosity,
+                         clip_mode,
+                         epsilon,
+                         clip_coeff,
+                         NULL,  /* f_ext */
+                         _bc_coeff_a[s_id + k],
+                         _bc_coeff_b[s_id + k],
+                         _var[k],
+                         NULL,  /* c_weight */
+                         NULL,  /* cpl */
+                         _grad[k]);
+      continue;
+    }
+
+    switch (n) {
+    case 1:
+      _lsq_scalar_gradient_multi<1>(mesh, fvq, halo_type, inc,
+                                    _bc_coeff_a + s_id, _bc_coeff_b + s_id,
+                                    pvar, rhsv, _grad);
+      break;
+    case 2:
+      _lsq_scalar_gradient_multi<2>(mesh, fvq, halo_type, inc,
+                                    _bc_coeff_a + s_id, _bc_coeff_b + s_id,
+                                    pvar, rhsv, _grad);
+      break;
+    case 3:
+      _lsq_scalar_gradient_multi<3>(mesh, fvq, halo_type, inc,
+                                    _bc_coeff_a + s_id, _bc_coeff_b + s_id,
+                                    pvar, rhsv, _grad);
+      break;
+    default:
+      _lsq_scalar_gradient_multi<4>(mesh, fvq, halo_type, inc,
+                                    _bc_coeff_a + s_id, _bc_coeff_b + s_id,
+                                    pvar, rhsv, _grad);
+    }
+
+    for (cs_lnum_t k = 0; k < n; k++) {
+
+      cs_real_3_t  *restrict r_grad = _grad[k];
+      if (gradient_type == CS_GRADIENT_GREEN_LSQ) {
+        BFT_MALLOC(r_grad, n_cells_ext, cs_real_3_t);
+        memcpy(r_grad, _grad[k], n_cells_ext*sizeof(cs_real_3_t));
+      }
+
+      _scalar_gradient_clipping(halo_type,
+                                clip_mode,
+                                verbosity,
+                                clip_coeff,
+                                var_name[s_id + k],
+                                _var[k], r_grad);
+
+      if (gradient_type == CS_GRADIENT_GREEN_LSQ) {
+        _reconstruct_scalar_gradient(mesh,
+                                     fvq,
+                                     NULL, /* cpl */
+                                     1,    /* w_stride */
+                                     0,    /* hyd_p_flag */
+                                     inc,
+                                     NULL, /* f_ext */
+                                     _bc_coeff_a[s_id + k],
+                                     _bc_coeff_b[s_id + k],
+                                     NULL, /* c_weight */
+                                     _var[k],
+                                     r_grad,
+                                     _grad[k]);
+
+        BFT_FREE(r_grad);
+      }
+
+      if (cs_glob_mesh_quantities_flag & CS_BAD_CELLS_REGULARISATION)
+        cs_bad_cells_regularisation_vector(_grad[k], 0);
+
+    }
+
+  }
+
+  BFT_FREE(rhsv);
+  BFT_FREE(pvar);
+  BFT_FREE(bc_coeff_a_0);
+  BFT_FREE(bc_coeff_b_1);
+  BFT_FREE(_bc_coeff_a);
+  BFT_FREE(_bc_coeff_b);
+
+  t1 = cs_timer_time();
+
+  cs_timer_counter_add_diff(&_gradient_t_tot, &t0, &t1);
+
+  gradient_info->n_calls += 1;
+  cs_timer_counter_add_diff(&(gradient_info->t_tot), &t0, &t1);
+
+  if (_gradient_stat_id > -1)
+    cs_timer_stats_add_diff(_gradient_stat_id, &t0, &t1);
+}
+
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -10274,42 +10130,27 @@ cs_gradient_vector_cell(const cs_mesh_t             *m,
 
     }
 
-    /* Build indices bijection between [1-9] and [1-3]*[1-3] */
-    cs_lnum_t _33_9_idx[9][2];
-    int nn = 0;
-    for (int ll = 0; ll < 3; ll++) {
-      for (int mm = 0; mm < 3; mm++) {
-        _33_9_idx[nn][0] = ll;
-        _33_9_idx[nn][1] = mm;
-        nn++;
-      }
-    }
-
     cs_real_t cocgb_v[45], rhsb_v[9], x[9];
 
-    _compute_cocgb_rhsb_lsq_v(c_id,
-                              1,
-                              ma,
-                              fvq,
-                              _33_9_idx,
-                              (const cs_real_3_t *)var,
-                              (const cs_real_3_t *)bc_coeff_a,
-                              (const cs_real_33_t *)bc_coeff_b,
-                              (const cs_real_3_t *)cocg,
-                              (const cs_real_3_t *)rhs,
-                              cocgb_v,
-                              rhsb_v);
+    _compute_cocgb_rhsb_lsq_s<3>(c_id,
+                                 1,
+                                 ma,
+                                 fvq,
+                                 (const cs_real_3_t *)var,
+                                 (const cs_real_3_t *)bc_coeff_a,
+                                 (const cs_real_33_t *)bc_coeff_b,
+                                 (const cs_real_3_t *)cocg,
+                                 (const cs_real_3_t *)rhs,
+                                 cocgb_v,
+                                 rhsb_v);
 
     _fw_and_bw_ldtl_pp(cocgb_v,
                        9,
                        x,
                        rhsb_v);
 
-    for (int kk = 0; kk < 9; kk++) {
-      int ii = _33_9_idx[kk][0];
-      int jj = _33_9_idx[kk][1];
-      grad[ii][jj] = x[kk];
-    }
+    for (int kk = 0; kk < 9; kk++)
+      grad[kk / 3][kk % 3] = x[kk];
   }
 
   /* Case with no boundary conditions or known face values */
@@ -10597,42 +10438,27 @@ cs_gradient_tensor_cell(const cs_mesh_t             *m,
 
     }
 
-    /* Build indices bijection between [1-18] and [1-6]*[1-3] */
-    cs_lnum_t _63_18_idx[18][2];
-    cs_lnum_t nn = 0;
-    for (cs_lnum_t ll = 0; ll < 6; ll++) {
-      for (cs_lnum_t mm = 0; mm < 3; mm++) {
-        _63_18_idx[nn][0] = ll;
-        _63_18_idx[nn][1] = mm;
-        nn++;
-      }
-    }
-
     cs_real_t cocgb_t[171], rhsb_t[18], x[18];
 
-    _compute_cocgb_rhsb_lsq_t(c_id,
-                              1,
-                              ma,
-                              fvq,
-                              _63_18_idx,
-                              (const cs_real_6_t *)var,
-                              (const cs_real_6_t *)bc_coeff_a,
-                              (const cs_real_66_t *)bc_coeff_b,
-                              (const cs_real_3_t *)cocg,
-                              (const cs_real_3_t *)rhs,
-                              cocgb_t,
-                              rhsb_t);
+    _compute_cocgb_rhsb_lsq_s<6>(c_id,
+                                 1,
+                                 ma,
+                                 fvq,
+                                 (const cs_real_6_t *)var,
+                                 (const cs_real_6_t *)bc_coeff_a,
+                                 (const cs_real_66_t *)bc_coeff_b,
+                                 (const cs_real_3_t *)cocg,
+                                 (const cs_real_3_t *)rhs,
+                                 cocgb_t,
+                                 rhsb_t);
 
     _fw_and_bw_ldtl_pp(cocgb_t,
                        18,
                        x,
                        rhsb_t);
 
-    for (int kk = 0; kk < 18; kk++) {
-      int ii = _63_18_idx[kk][0];
-      int jj = _63_18_idx[kk][1];
-      grad[ii][jj] = x[kk];
-    }
+    for (int kk = 0; kk < 18; kk++)
+      grad[kk / 3][kk % 3] = x[kk];
 
   }
 
@@ -156,6 +156,24 @@ cs_gradient_finalize(void);
 void
 cs_gradient_free_quantities(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Set whether the local stencil of cartesian meshes should be
+ *         used for least-squares gradients.
+ *
+ * When the mesh is generated as a cartesian mesh and its cells are not
+ * renumbered (and in parallel, partitioned by blocks), interior face
+ * contributions to unweighted least-squares gradients are then gathered
+ * by cell from stencil neighbors, with no face -> cell indirection.
+ * Otherwise, the usual face-based computation is used.
+ *
+ * \param[in]  use_stencil  true to use the cartesian stencil if available
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_set_cartesian_stencil(bool  use_stencil);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -204,6 +222,57 @@ cs_gradient_scalar(const char                    *var_name,
                    const cs_internal_coupling_t  *cpl,
                    cs_real_t                      grad[restrict][3]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Compute cell gradients of several scalar fields at once.
+ *
+ * All variables share the same gradient and clipping options, and are
+ * handled by small blocks. Ghost cell values of the variables of a block
+ * are synchronized with a single halo exchange.
+ *
+ * For least-squares based gradient types, the gradients of a block of
+ * variables are computed in a single traversal of the mesh faces, reusing
+ * the saved cocg matrices, and are also synchronized with a single halo
+ * exchange. Other gradient types are computed for each variable in turn.
+ *
+ * \param[in]       batch_name     name used for performance logging
+ * \param[in]       n_vars         number of variables
+ * \param[in]       var_name       name of each variable
+ * \param[in]       gradient_type  gradient type
+ * \param[in]       halo_type      halo type
+ * \param[in]       inc            if 0, solve on increment; 1 otherwise
+ * \param[in]       n_r_sweeps     if > 1, number of reconstruction sweeps
+ *                                 (only used by CS_GRADIENT_GREEN_ITER)
+ * \param[in]       verbosity      verbosity level
+ * \param[in]       clip_mode      clipping mode
+ * \param[in]       epsilon        precision for iterative gradient calculation
+ * \param[in]       clip_coeff     clipping coefficient
+ * \param[in]       bc_coeff_a     boundary condition term a for each
+ *                                 variable (or NULL)
+ * \param[in]       bc_coeff_b     boundary condition term b for each
+ *                                 variable (or NULL)
+ * \param[in, out]  var            gradient's base variable for each variable
+ * \param[out]      grad           gradient for each variable
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_gradient_scalar_multi(const char                    *batch_name,
+                         int                            n_vars,
+                         const char                    *var_name[],
+                         cs_gradient_type_t             gradient_type,
+                         cs_halo_type_t                 halo_type,
+                         int                            inc,
+                         int                            n_r_sweeps,
+                         int                            verbosity,
+                         cs_gradient_limit_t            clip_mode,
+                         double                         epsilon,
+                         double                         clip_coeff,
+                         const cs_real_t               *bc_coeff_a[],
+                         const cs_real_t               *bc_coeff_b[],
+                         cs_real_t                     *var[],
+                         cs_real_3_t                   *grad[]);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of vector field.
@@ -117,6 +117,11 @@ struct _cs_grid_t {
   bool                symmetric;    /* Symmetric matrix coefficients
                                        indicator */
   bool                use_faces;    /* True if face information is present */
+  bool                galerkin_msr; /* True if matrix coefficients are
+                                       obtained only through the Galerkin
+                                       (aggregation) product of the parent
+                                       MSR matrix, so may be updated
+                                       without rebuilding the grid */
 
   cs_lnum_t           db_size;      /* Block sizes for diagonal */
   cs_lnum_t           eb_size;      /* Block sizes for extra diagonal */
@@ -352,6 +357,8 @@ _create_grid(void)
 
   g->conv_diff = false;
   g->symmetric = false;
+  g->use_faces = false;
+  g->galerkin_msr = false;
 
   g->db_size = 1;
   g->eb_size = 1;
@@ -4432,17 +4439,30 @@ _compute_coarse_quantities_conv_diff(const cs_grid_t  *fine_grid,
 }
 
 /*----------------------------------------------------------------------------
- * Build a coarse level from a finer level with an MSR matrix.
+ * Compute coarse MSR matrix values from a finer level's MSR matrix,
+ * given the coarse matrix structure (with ordered column ids).
  *
  * parameters:
  *   fine_grid   <-- Fine grid structure
- *   coarse_grid <-> Coarse grid structure
+ *   coarse_grid <-- Coarse grid structure
+ *   c_row_index <-- coarse MSR row index (0 to n-1)
+ *   c_col_id    <-- coarse MSR column id (0 to n-1)
+ *   c_d_val     --> coarse diagonal values
+ *   c_x_val     --> coarse extradiagonal values
+ *
+ * returns:
+ *   true if all fine matrix couplings match an entry of the given
+ *   coarse structure, false otherwise (in which case values are
+ *   incomplete)
  *----------------------------------------------------------------------------*/
 
-static void
-_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
-                               cs_grid_t        *coarse_grid)
-
+static bool
+_compute_coarse_values_msr(const cs_grid_t            *fine_grid,
+                           const cs_grid_t            *coarse_grid,
+                           const cs_lnum_t  *restrict  c_row_index,
+                           const cs_lnum_t  *restrict  c_col_id,
+                           cs_real_t        *restrict  c_d_val,
+                           cs_real_t        *restrict  c_x_val)
 {
   const cs_lnum_t db_size = fine_grid->db_size;
   const cs_lnum_t db_stride = db_size*db_size;
@@ -4453,9 +4473,10 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
   const cs_lnum_t f_n_rows = fine_grid->n_rows;
 
   const cs_lnum_t c_n_rows = coarse_grid->n_rows;
-  const cs_lnum_t c_n_cols = coarse_grid->n_cols_ext;
   const cs_lnum_t *c_coarse_row = coarse_grid->coarse_row;
 
+  const cs_lnum_t c_size = c_row_index[c_n_rows];
+
   /* Fine matrix in the MSR format */
 
   const cs_lnum_t  *f_row_index, *f_col_id;
@@ -4467,16 +4488,9 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
                            &f_d_val,
                            &f_x_val);
 
-  /* Coarse matrix elements in the MSR format */
-
-  cs_lnum_t *restrict c_row_index,  *restrict c_col_id;
-  cs_real_t *restrict c_d_val, *restrict c_x_val;
-
   /* Diagonal elements
      ----------------- */
 
-  BFT_MALLOC(c_d_val, c_n_rows*db_stride, cs_real_t);
-
   for (cs_lnum_t i = 0; i < c_n_rows*db_stride; i++)
     c_d_val[i] = 0.0;
 
@@ -4503,6 +4517,105 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
     }
   }
 
+  /* Extradiagonal elements
+     ---------------------- */
+
+  bool matched = true;
+
+  {
+    for (cs_lnum_t i = 0; i < c_size*eb_stride; i++)
+      c_x_val[i] = 0;
+
+    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
+
+      cs_lnum_t i = c_coarse_row[ii];
+
+      if (i > -1 && i < c_n_rows) {
+
+        for (cs_lnum_t jj_ind = f_row_index[ii];
+             jj_ind < f_row_index[ii+1];
+             jj_ind++) {
+
+          cs_lnum_t jj = f_col_id[jj_ind];
+
+          cs_lnum_t j = c_coarse_row[jj];
+
+          if (j > -1) {
+
+            if (i != j) {
+              cs_lnum_t s_id = c_row_index[i];
+              cs_lnum_t n_cols = c_row_index[i+1] - s_id;
+              /* ids are sorted, so binary search possible */
+              cs_lnum_t k = _l_id_binary_search(n_cols, j, c_col_id + s_id);
+              if (k < 0) {
+                matched = false;
+                continue;
+              }
+              for (cs_lnum_t l = 0; l < eb_stride; l++)
+                c_x_val[(k + s_id)*eb_stride + l]
+                  += f_x_val[jj_ind*eb_stride + l];
+            }
+            else { /* i == j */
+              for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+                /* diagonal terms only */
+                /* Extra-diag block being isotropic, first entry suffices */
+                c_d_val[i*db_stride + db_size*kk + kk]
+                  += f_x_val[jj_ind*eb_stride];
+              }
+            }
+
+          }
+        }
+
+      }
+
+    }
+
+  }
+
+  return matched;
+}
+
+/*----------------------------------------------------------------------------
+ * Build a coarse level from a finer level with an MSR matrix.
+ *
+ * parameters:
+ *   fine_grid   <-- Fine grid structure
+ *   coarse_grid <-> Coarse grid structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
+                               cs_grid_t        *coarse_grid)
+
+{
+  const cs_lnum_t db_size = fine_grid->db_size;
+  const cs_lnum_t db_stride = db_size*db_size;
+
+  const cs_lnum_t eb_size = fine_grid->eb_size;
+  const cs_lnum_t eb_stride = eb_size*eb_size;
+
+  const cs_lnum_t f_n_rows = fine_grid->n_rows;
+
+  const cs_lnum_t c_n_rows = coarse_grid->n_rows;
+  const cs_lnum_t c_n_cols = coarse_grid->n_cols_ext;
+  const cs_lnum_t *c_coarse_row = coarse_grid->coarse_row;
+
+  /* Fine matrix in the MSR format */
+
+  const cs_lnum_t  *f_row_index, *f_col_id;
+
+  cs_matrix_get_msr_arrays(fine_grid->matrix,
+                           &f_row_index,
+                           &f_col_id,
+                           NULL,
+                           NULL);
+
+  /* Coarse matrix elements in the MSR format */
+
+  cs_lnum_t *restrict c_row_index,  *restrict c_col_id;
+  cs_real_t *restrict c_d_val, *restrict c_x_val;
+
   /* Extradiagonal elements
      ---------------------- */
 
@@ -4589,7 +4702,6 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
   cs_lnum_t c_size = c_row_index[c_n_rows];
 
-  BFT_MALLOC(c_x_val, c_size*eb_stride, cs_real_t);
   BFT_MALLOC(c_col_id, c_size, cs_lnum_t);
 
   /* Assignment pass */
@@ -4648,52 +4760,16 @@ _compute_coarse_quantities_msr(const cs_grid_t  *fine_grid,
 
   /* Values assignment pass */
 
-  {
-    for (cs_lnum_t i = 0; i < c_size*eb_stride; i++)
-      c_x_val[i] = 0;
-
-    for (cs_lnum_t ii = 0; ii < f_n_rows; ii++) {
-
-      cs_lnum_t i = c_coarse_row[ii];
-
-      if (i > -1 && i < c_n_rows) {
-
-        for (cs_lnum_t jj_ind = f_row_index[ii];
-             jj_ind < f_row_index[ii+1];
-             jj_ind++) {
-
-          cs_lnum_t jj = f_col_id[jj_ind];
-
-          cs_lnum_t j = c_coarse_row[jj];
-
-          if (j > -1) {
-
-            if (i != j) {
-              cs_lnum_t s_id = c_row_index[i];
-              cs_lnum_t n_cols = c_row_index[i+1] - s_id;
-              /* ids are sorted, so binary search possible */
-              cs_lnum_t k = _l_id_binary_search(n_cols, j, c_col_id + s_id);
-              for (cs_lnum_t l = 0; l < eb_stride; l++)
-                c_x_val[(k + s_id)*eb_stride + l]
-                  += f_x_val[jj_ind*eb_stride + l];
-            }
-            else { /* i == j */
-              for (cs_lnum_t kk = 0; kk < db_size; kk++) {
-                /* diagonal terms only */
-                /* Extra-diag block being isotropic, first entry suffices */
-                c_d_val[i*db_stride + db_size*kk + kk]
-                  += f_x_val[jj_ind*eb_stride];
-              }
-            }
-
-          }
-        }
-
-      }
+  BFT_MALLOC(c_d_val, c_n_rows*db_stride, cs_real_t);
+  BFT_MALLOC(c_x_val, c_size*eb_stride, cs_real_t);
 
-    }
+  bool matched
+    = _compute_coarse_values_msr(fine_grid, coarse_grid,
+                                 c_row_index, c_col_id,
+                                 c_d_val, c_x_val);
 
-  }
+  assert(matched == true);
+  CS_UNUSED(matched);
 
   _build_coarse_matrix_msr(coarse_grid, fine_grid->symmetric,
                            c_row_index, c_col_id,
@@ -5397,6 +5473,28 @@ cs_grid_get_matrix(const cs_grid_t  *g)
   return m;
 }
 
+/*----------------------------------------------------------------------------
+ * Set whether a grid's private matrix should use single-precision
+ * coefficients for matrix-vector products.
+ *
+ * Matrices shared with the caller (usually the finest grid's) are
+ * not modified.
+ *
+ * parameters:
+ *   g     <-> Grid structure
+ *   mixed <-- true to use single-precision coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_mixed_precision(cs_grid_t  *g,
+                                   bool        mixed)
+{
+  assert(g != NULL);
+
+  if (g->_matrix != NULL)
+    cs_matrix_set_mixed_precision(g->_matrix, mixed);
+}
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -5560,6 +5658,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
                                        c->coarse_row);
       break;
     case CS_MATRIX_MSR:
+    case CS_MATRIX_SELL:
       _automatic_aggregation_mx_msr(f, aggregation_limit, verbosity,
                                     c->coarse_row);
       break;
@@ -5574,6 +5673,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
   else if (coarsening_type == CS_GRID_COARSENING_SPD_PW) {
     switch (fine_matrix_type) {
     case CS_MATRIX_MSR:
+    case CS_MATRIX_SELL:
       _automatic_aggregation_pw_msr(f, verbosity, c->coarse_row);
       if (aggregation_limit > 2)
         recurse = 2;
@@ -5647,10 +5747,14 @@ cs_grid_coarsen(const cs_grid_t  *f,
 
   }
 
-  if (fine_matrix_type == CS_MATRIX_MSR && c->relaxation <= 0) {
+  if (   (   fine_matrix_type == CS_MATRIX_MSR
+          || fine_matrix_type == CS_MATRIX_SELL)
+      && c->relaxation <= 0) {
 
    _compute_coarse_quantities_msr(f, c);
 
+   c->galerkin_msr = true;
+
     /* Merge grids if we are below the threshold */
 #if defined(HAVE_MPI)
    if (merge_stride > 1 && c->n_ranks > 1 && recurse == 0) {
@@ -5661,6 +5765,7 @@ cs_grid_coarsen(const cs_grid_t  *f,
         _native_from_msr(c);
         _merge_grids(c, merge_stride, verbosity);
         _msr_from_native(c);
+        c->galerkin_msr = false;
       }
     }
 #endif
@@ -5825,6 +5930,92 @@ cs_grid_coarsen(const cs_grid_t  *f,
   return c;
 }
 
+/*----------------------------------------------------------------------------
+ * Update a coarse grid's matrix coefficients from a (possibly new) parent
+ * grid, keeping the existing aggregation and coarse matrix structure.
+ *
+ * This is possible only if the coarse matrix was obtained through the
+ * Galerkin (aggregation) product of an MSR parent matrix, without P0/P1
+ * relaxation or grid merging. The given parent grid's matrix must have
+ * the same structure as the one used to build the coarse grid; it then
+ * replaces the coarse grid's previous parent. If some fine matrix
+ * couplings are not matched by the coarse structure, false is returned
+ * (consistently on all ranks) and the coarse grid is left unchanged.
+ *
+ * parameters:
+ *   f <-- Parent (fine) grid structure
+ *   c <-> Coarse grid structure
+ *
+ * returns:
+ *   true if coefficients were updated, false if the coarse grid
+ *   must be rebuilt instead
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_from_parent(const cs_grid_t  *f,
+                           cs_grid_t        *c)
+{
+  assert(f != NULL && c != NULL);
+
+  if (c->galerkin_msr == false || c->level != f->level + 1)
+    return false;
+
+  cs_matrix_type_t f_type = cs_matrix_get_type(f->matrix);
+  if (f_type != CS_MATRIX_MSR && f_type != CS_MATRIX_SELL)
+    return false;
+
+  if (   f->symmetric != c->symmetric
+      || f->db_size != c->db_size
+      || f->eb_size != c->eb_size)
+    return false;
+
+  const cs_lnum_t db_stride = c->db_size*c->db_size;
+  const cs_lnum_t eb_stride = c->eb_size*c->eb_size;
+
+  const cs_lnum_t *c_row_index, *c_col_id;
+
+  cs_matrix_get_msr_arrays(c->matrix,
+                           &c_row_index, &c_col_id,
+                           NULL, NULL);
+
+  cs_real_t *c_d_val, *c_x_val;
+  BFT_MALLOC(c_d_val, c->n_rows*db_stride, cs_real_t);
+  BFT_MALLOC(c_x_val, c_row_index[c->n_rows]*eb_stride, cs_real_t);
+
+  /* If the fine structure does not match the aggregation (i.e. the
+     fine matrix structure changed), the grid must be rebuilt; this
+     must be decided consistently on all ranks. */
+
+  int matched = _compute_coarse_values_msr(f, c, c_row_index, c_col_id,
+                                           c_d_val, c_x_val);
+
+#if defined(HAVE_MPI)
+  if (c->n_ranks > 1) {
+    int _matched = matched;
+    MPI_Allreduce(&_matched, &matched, 1, MPI_INT, MPI_MIN, c->comm);
+  }
+#endif
+
+  if (matched == 0) {
+    BFT_FREE(c_x_val);
+    BFT_FREE(c_d_val);
+    return false;
+  }
+
+  c->parent = f;
+
+  cs_matrix_transfer_coefficients_msr(c->_matrix,
+                                      c->symmetric,
+                                      c->db_size,
+                                      c->eb_size,
+                                      c_row_index,
+                                      c_col_id,
+                                      &c_d_val,
+                                      &c_x_val);
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------
  * Create coarse grid with only one row per rank from fine grid.
  *
@@ -5878,7 +6069,8 @@ cs_grid_coarsen_to_single(const cs_grid_t  *f,
   if (verbosity > 3)
     _aggregation_stats_log(f, c, verbosity);
 
-  if (fine_matrix_type == CS_MATRIX_MSR) {
+  if (   fine_matrix_type == CS_MATRIX_MSR
+      || fine_matrix_type == CS_MATRIX_SELL) {
     _compute_coarse_quantities_msr(f, c);
 
 #if defined(HAVE_MPI)
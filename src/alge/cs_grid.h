@@ -252,6 +252,22 @@ cs_grid_get_n_g_rows(const cs_grid_t  *g);
 const cs_matrix_t *
 cs_grid_get_matrix(const cs_grid_t  *g);
 
+/*----------------------------------------------------------------------------
+ * Set whether a grid's private matrix should use single-precision
+ * coefficients for matrix-vector products.
+ *
+ * Matrices shared with the caller (usually the finest grid's) are
+ * not modified.
+ *
+ * parameters:
+ *   g     <-> Grid structure
+ *   mixed <-- true to use single-precision coefficients
+ *----------------------------------------------------------------------------*/
+
+void
+cs_grid_set_matrix_mixed_precision(cs_grid_t  *g,
+                                   bool        mixed);
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -313,6 +329,31 @@ cs_grid_coarsen(const cs_grid_t  *f,
                 cs_gnum_t         merge_rows_glob_threshold,
                 double            relaxation_parameter);
 
+/*----------------------------------------------------------------------------
+ * Update a coarse grid's matrix coefficients from a (possibly new) parent
+ * grid, keeping the existing aggregation and coarse matrix structure.
+ *
+ * This is possible only if the coarse matrix was obtained through the
+ * Galerkin (aggregation) product of an MSR parent matrix, without P0/P1
+ * relaxation or grid merging. The given parent grid's matrix must have
+ * the same structure as the one used to build the coarse grid; it then
+ * replaces the coarse grid's previous parent. If some fine matrix
+ * couplings are not matched by the coarse structure, false is returned
+ * (consistently on all ranks) and the coarse grid is left unchanged.
+ *
+ * parameters:
+ *   f <-- Parent (fine) grid structure
+ *   c <-> Coarse grid structure
+ *
+ * returns:
+ *   true if coefficients were updated, false if the coarse grid
+ *   must be rebuilt instead
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_grid_update_from_parent(const cs_grid_t  *f,
+                           cs_grid_t        *c);
+
 /*----------------------------------------------------------------------------
  * Create coarse grid with only one row per rank from fine grid.
  *
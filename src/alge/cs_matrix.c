@@ -64,6 +64,14 @@
  * The "distributed" format is thus a variation of the MSR format with
  * separate distant elements.
  *
+ * The "SELL" (SELL-C-sigma, or sliced ELLPACK) format is another variation
+ * of the MSR format, in which the extra-diagonal coefficients are also
+ * stored by chunks of consecutive rows (after sorting rows by length
+ * inside small windows), column-major and padded inside each chunk.
+ * This allows SIMD vectorization of the matrix.vector product across rows,
+ * at the cost of some padding and of keeping an MSR copy of the
+ * coefficients for row-based access.
+ *
  * The specific access requirements of Gauss-Seidel solvers and smoothers
  * lead us to only consider the MSR format for their implementation.
  * When requesting a Gauss-Seidel solver or smoother for another storage
@@ -155,6 +163,7 @@ static const char  *_matrix_type_name[] = {N_("native"),
                                            N_("CSR"),
                                            N_("MSR"),
                                            N_("distributed"),
+                                           N_("SELL"),
                                            N_("external")};
 
 /* Full names for matrix types */
@@ -164,6 +173,7 @@ static const char
                             N_("Compressed Sparse Row"),
                             N_("Modified Compressed Sparse Row"),
                             N_("Distributed (D+E+H)"),
+                            N_("Sliced ELLPACK (SELL-C-sigma)"),
                             N_("External")};
 
 /* Fill type names for matrices */
@@ -192,6 +202,19 @@ static char _no_exclude_diag_error_str[]
 
 cs_lnum_t _base_assembler_thr_min = 128;
 
+/* Row sorting window (sigma) for SELL-C-sigma structures; rows are only
+   reordered inside a window, so as to preserve locality of the
+   mesh numbering */
+
+static cs_lnum_t _sell_sigma = 32*CS_MATRIX_SELL_CHUNK_SIZE;
+
+/* Last structure generation stamp; a new stamp is assigned to each
+   matrix structure created or modified, so that users of a structure
+   may detect changes even when arrays are reallocated at the same
+   address */
+
+static unsigned long _structure_generation = 0;
+
 /*============================================================================
  * Private function definitions
 - *============================================================================*/
@@ -374,6 +397,13 @@ _create_struct_native(cs_lnum_t        n_rows,
 
   ms->edges = edges;
 
+  ms->st_n_dirs = 0;
+  for (int i = 0; i < 3; i++)
+    ms->st_shift[i] = 0;
+  ms->st_edge_dir = NULL;
+  ms->st_n_x_edges = 0;
+  ms->st_x_edge_id = NULL;
+
   return ms;
 }
 
@@ -390,6 +420,7 @@ _destroy_struct_native(void  **ms)
   if (ms != NULL && *ms !=NULL) {
     cs_matrix_struct_native_t  *_ms = *ms;
 
+    BFT_FREE(_ms->st_x_edge_id);
     BFT_FREE(_ms);
 
     *ms= NULL;
@@ -470,10 +501,34 @@ _set_coeffs_native(cs_matrix_t        *matrix,
       mc->e_val = xa;
 
   }
+
+  /* Coefficients by stencil direction (for structured layout) are
+     only built when needed by the matching matrix.vector product */
+
+  BFT_FREE(mc->_st_val);
 }
 
 /*----------------------------------------------------------------------------
- * Copy diagonal of native, MSR, or distributed matrix.
+ * Free coefficients by stencil direction of a native matrix, if present.
+ *
+ * They are rebuilt on demand by the structured matrix.vector product,
+ * so they are not kept when tuning selects another variant.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_free_st_coeffs_native(cs_matrix_t  *matrix)
+{
+  if (matrix->type == CS_MATRIX_NATIVE && matrix->coeffs != NULL) {
+    cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+    BFT_FREE(mc->_st_val);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Copy diagonal of native, MSR, SELL, or distributed matrix.
  *
  * parameters:
  *   matrix <-- pointer to matrix structure
@@ -490,6 +545,7 @@ _copy_diagonal_separate(const cs_matrix_t  *matrix,
     _d_val = mc->d_val;
   }
   else if (   matrix->type == CS_MATRIX_MSR
+           || matrix->type == CS_MATRIX_SELL
            || matrix->type == CS_MATRIX_DIST) {
     const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
     _d_val = mc->d_val;
@@ -2513,6 +2569,80 @@ _msr_assembler_values_add(void             *matrix_p,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Update single-precision copies of MSR matrix coefficients.
+ *
+ * Copies are built only if mixed precision was requested for the matrix;
+ * extra-diagonal blocks (eb_size > 1) are not handled, so in that case,
+ * or if mixed precision is not active, copies are freed.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_coeffs_msr_f(cs_matrix_t  *matrix)
+{
+  if (matrix->type != CS_MATRIX_MSR)
+    return;
+
+  cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+
+  if (   mc->mixed_precision == false
+      || mc->eb_size != 1
+      || mc->e_val == NULL) {
+    BFT_FREE(mc->_d_val_f);
+    BFT_FREE(mc->_e_val_f);
+    return;
+  }
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t d_stride = mc->db_size*mc->db_size;
+  const cs_lnum_t n_d_vals = n_rows*d_stride;
+  const cs_lnum_t n_e_vals = ms->e.row_index[n_rows];
+
+  BFT_REALLOC(mc->_e_val_f, n_e_vals, float);
+
+  const cs_real_t *restrict e_val = mc->e_val;
+  float *restrict e_val_f = mc->_e_val_f;
+
+# pragma omp parallel for  if(n_e_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_e_vals; ii++)
+    e_val_f[ii] = (float)(e_val[ii]);
+
+  if (mc->d_val != NULL) {
+    BFT_REALLOC(mc->_d_val_f, n_d_vals, float);
+
+    const cs_real_t *restrict d_val = mc->d_val;
+    float *restrict d_val_f = mc->_d_val_f;
+
+#   pragma omp parallel for  if(n_d_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_d_vals; ii++)
+      d_val_f[ii] = (float)(d_val[ii]);
+  }
+  else
+    BFT_FREE(mc->_d_val_f);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function for final assembly of MSR matrix coefficients.
+ *
+ * Only single-precision copies of coefficients need to be updated here.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_msr_assembler_values_end(void  *matrix_p)
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  _update_coeffs_msr_f(matrix);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create and initialize an MSR matrix assembler values structure.
@@ -2543,7 +2673,7 @@ _assembler_values_create_msr(cs_matrix_t      *matrix,
                                         _msr_assembler_values_add,
                                         NULL,
                                         NULL,
-                                        NULL);
+                                        _msr_assembler_values_end);
 
   return mav;
 }
@@ -2939,6 +3069,11 @@ _create_struct_dist(cs_alloc_mode_t     alloc_mode,
 
   ms->h_row_id = NULL;
 
+  ms->s_n_chunks = 0;
+  ms->s_chunk_index = NULL;
+  ms->s_row_id = NULL;
+  ms->s_col_id = NULL;
+
   if (n_edges == 0 || edges == NULL)
     return ms;
 
@@ -3084,6 +3219,11 @@ _create_struct_msr(cs_alloc_mode_t     alloc_mode,
 
   ms->h_row_id = NULL;
 
+  ms->s_n_chunks = 0;
+  ms->s_chunk_index = NULL;
+  ms->s_row_id = NULL;
+  ms->s_col_id = NULL;
+
   if (n_edges == 0 || edges == NULL)
     return ms;
 
@@ -3185,6 +3325,11 @@ _create_struct_msr_from_shared(bool              direct_assembly,
 
   ms->h_row_id = NULL;
 
+  ms->s_n_chunks = 0;
+  ms->s_chunk_index = NULL;
+  ms->s_row_id = NULL;
+  ms->s_col_id = NULL;
+
   return ms;
 }
 
@@ -3235,6 +3380,11 @@ _create_struct_msr_from_msr(bool         transfer,
 
   ms->h_row_id = NULL;
 
+  ms->s_n_chunks = 0;
+  ms->s_chunk_index = NULL;
+  ms->s_row_id = NULL;
+  ms->s_col_id = NULL;
+
   return ms;
 }
 
@@ -3302,6 +3452,11 @@ _create_struct_msr_from_csr(bool              direct_assembly,
 
   ms->h_row_id = NULL;
 
+  ms->s_n_chunks = 0;
+  ms->s_chunk_index = NULL;
+  ms->s_row_id = NULL;
+  ms->s_col_id = NULL;
+
   return ms;
 }
 
@@ -3393,6 +3548,11 @@ _create_struct_dist_from_csr(bool              direct_assembly,
 
   ms->h_row_id = NULL;
 
+  ms->s_n_chunks = 0;
+  ms->s_chunk_index = NULL;
+  ms->s_row_id = NULL;
+  ms->s_col_id = NULL;
+
   return ms;
 }
 
@@ -3484,6 +3644,11 @@ _create_struct_dist_from_msr(bool              direct_assembly,
 
   ms->h_row_id = NULL;
 
+  ms->s_n_chunks = 0;
+  ms->s_chunk_index = NULL;
+  ms->s_row_id = NULL;
+  ms->s_col_id = NULL;
+
   return ms;
 }
 
@@ -3507,6 +3672,10 @@ _destroy_struct_dist(void  **ms)
 
     CS_FREE_HD(_ms->h_row_id);
 
+    CS_FREE_HD(_ms->s_chunk_index);
+    CS_FREE_HD(_ms->s_row_id);
+    CS_FREE_HD(_ms->s_col_id);
+
     BFT_FREE(_ms);
 
     *ms= NULL;
@@ -3546,6 +3715,13 @@ _create_coeff_dist(void)
 
   mc->d_idx = NULL;
 
+  mc->_s_val = NULL;
+  mc->_st_val = NULL;
+
+  mc->mixed_precision = false;
+  mc->_d_val_f = NULL;
+  mc->_e_val_f = NULL;
+
   return mc;
 }
 
@@ -3566,6 +3742,10 @@ _destroy_coeff_dist(cs_matrix_t  *m)
     CS_FREE(mc->_e_val);
     CS_FREE(mc->_d_val);
     CS_FREE_HD(mc->d_idx);
+    CS_FREE_HD(mc->_s_val);
+    BFT_FREE(mc->_st_val);
+    BFT_FREE(mc->_e_val_f);
+    BFT_FREE(mc->_d_val_f);
 
     BFT_FREE(m->coeffs);
   }
@@ -3864,6 +4044,258 @@ _get_diagonal_dist(const cs_matrix_t  *matrix)
   return diag;
 }
 
+/*----------------------------------------------------------------------------
+ * Build the SELL-C-sigma (sliced ELLPACK) layout of the local
+ * extra-diagonal part of an MSR-configured distributed matrix structure.
+ *
+ * Rows are sorted by decreasing length inside windows of sigma rows,
+ * then grouped in chunks of CS_MATRIX_SELL_CHUNK_SIZE rows. Inside each
+ * chunk, column ids are stored column-major and padded to the length of
+ * the longest row, so that rows of a chunk map to consecutive SIMD lanes.
+ * Padding entries reference the row's own column (or column 0 for padding
+ * rows), so they may be safely gathered with a zero coefficient.
+ *
+ * The MSR arrays are kept, as Gauss-Seidel smoothers, ILU(0) and multigrid
+ * coarsening access coefficients through them, so SELL matrices use about
+ * twice the extra-diagonal coefficient memory of MSR matrices.
+ *
+ * parameters:
+ *   ms          <-> pointer to distributed (MSR configured) structure
+ *   alloc_mode  <-- allocation mode
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_struct_sell(cs_matrix_struct_dist_t  *ms,
+                   cs_alloc_mode_t           alloc_mode)
+{
+  const cs_lnum_t c_size = CS_MATRIX_SELL_CHUNK_SIZE;
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t *restrict row_index = ms->e.row_index;
+  const cs_lnum_t *restrict col_id = ms->e.col_id;
+
+  cs_lnum_t sigma = (_sell_sigma / c_size) * c_size;
+  if (sigma < c_size)
+    sigma = c_size;
+
+  const cs_lnum_t n_chunks = (n_rows + c_size - 1) / c_size;
+  const cs_lnum_t n_slots = n_chunks * c_size;
+
+  ms->s_n_chunks = n_chunks;
+
+  CS_FREE_HD(ms->s_chunk_index);
+  CS_FREE_HD(ms->s_row_id);
+  CS_FREE_HD(ms->s_col_id);
+
+  CS_MALLOC_HD(ms->s_chunk_index, n_chunks + 1, cs_lnum_t, alloc_mode);
+  CS_MALLOC_HD(ms->s_row_id, n_slots, cs_lnum_t, alloc_mode);
+
+  /* Sort rows by decreasing length inside each window, using
+     a counting sort (stable, so the original order is kept
+     for rows of equal length) */
+
+  cs_lnum_t max_len = 0;
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    cs_lnum_t n_cols = row_index[ii+1] - row_index[ii];
+    if (n_cols > max_len)
+      max_len = n_cols;
+  }
+
+  cs_lnum_t *l_count;
+  BFT_MALLOC(l_count, max_len + 2, cs_lnum_t);
+
+  for (cs_lnum_t w_s = 0; w_s < n_rows; w_s += sigma) {
+    cs_lnum_t w_e = CS_MIN(w_s + sigma, n_rows);
+    for (cs_lnum_t l = 0; l < max_len + 2; l++)
+      l_count[l] = 0;
+    for (cs_lnum_t ii = w_s; ii < w_e; ii++)
+      l_count[max_len - (row_index[ii+1] - row_index[ii]) + 1] += 1;
+    for (cs_lnum_t l = 0; l < max_len + 1; l++)
+      l_count[l+1] += l_count[l];
+    for (cs_lnum_t ii = w_s; ii < w_e; ii++) {
+      cs_lnum_t l = max_len - (row_index[ii+1] - row_index[ii]);
+      ms->s_row_id[w_s + l_count[l]] = ii;
+      l_count[l] += 1;
+    }
+  }
+
+  BFT_FREE(l_count);
+
+  for (cs_lnum_t s_id = n_rows; s_id < n_slots; s_id++)
+    ms->s_row_id[s_id] = -1;
+
+  /* Chunk widths (longest row in each chunk) */
+
+  ms->s_chunk_index[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    cs_lnum_t c_width = 0;
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+      cs_lnum_t ii = ms->s_row_id[c_id*c_size + r_id];
+      if (ii > -1 && row_index[ii+1] - row_index[ii] > c_width)
+        c_width = row_index[ii+1] - row_index[ii];
+    }
+    ms->s_chunk_index[c_id+1] = ms->s_chunk_index[c_id] + c_width*c_size;
+  }
+
+  /* Padded column ids */
+
+  CS_MALLOC_HD(ms->s_col_id, ms->s_chunk_index[n_chunks], cs_lnum_t,
+               alloc_mode);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t c_width
+      = (ms->s_chunk_index[c_id+1] - ms->s_chunk_index[c_id]) / c_size;
+    cs_lnum_t *restrict c_col_id = ms->s_col_id + ms->s_chunk_index[c_id];
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+      cs_lnum_t ii = ms->s_row_id[c_id*c_size + r_id];
+      cs_lnum_t n_cols = 0, pad_id = 0;
+      if (ii > -1) {
+        n_cols = row_index[ii+1] - row_index[ii];
+        pad_id = ii;
+      }
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        c_col_id[jj*c_size + r_id] = col_id[row_index[ii] + jj];
+      for (cs_lnum_t jj = n_cols; jj < c_width; jj++)
+        c_col_id[jj*c_size + r_id] = pad_id;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Update SELL-C-sigma extra-diagonal coefficients from their MSR
+ * counterpart.
+ *
+ * Only scalar extra-diagonal coefficients are handled; for other
+ * extra-diagonal block sizes, the SELL-ordered values are freed.
+ *
+ * parameters:
+ *   matrix <-> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_s_coeffs_sell(cs_matrix_t  *matrix)
+{
+  cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+
+  const cs_lnum_t c_size = CS_MATRIX_SELL_CHUNK_SIZE;
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t n_chunks = ms->s_n_chunks;
+  const cs_lnum_t *restrict row_index = ms->e.row_index;
+
+  CS_FREE_HD(mc->_s_val);
+
+  if (mc->eb_size != 1)
+    return;
+
+  CS_MALLOC_HD(mc->_s_val, ms->s_chunk_index[n_chunks], cs_real_t,
+               matrix->alloc_mode);
+
+  const cs_real_t *restrict e_val = mc->e_val;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+    const cs_lnum_t c_width
+      = (ms->s_chunk_index[c_id+1] - ms->s_chunk_index[c_id]) / c_size;
+    cs_real_t *restrict c_val = mc->_s_val + ms->s_chunk_index[c_id];
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+      cs_lnum_t ii = ms->s_row_id[c_id*c_size + r_id];
+      cs_lnum_t n_cols = 0;
+      if (ii > -1 && e_val != NULL)
+        n_cols = row_index[ii+1] - row_index[ii];
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        c_val[jj*c_size + r_id] = e_val[row_index[ii] + jj];
+      for (cs_lnum_t jj = n_cols; jj < c_width; jj++)
+        c_val[jj*c_size + r_id] = 0.;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Set SELL-C-sigma matrix coefficients.
+ *
+ * Coefficients are first assigned in MSR form (which remains available
+ * for row-based access), then copied to the SELL-C-sigma layout.
+ *
+ * parameters:
+ *   matrix      <-> pointer to matrix structure
+ *   symmetric   <-- indicates if extradiagonal values are symmetric
+ *   copy        <-- indicates if coefficients should be copied
+ *   n_edges     <-- local number of graph edges
+ *   edges       <-- edges (symmetric row <-> column) connectivity
+ *   da          <-- diagonal values (NULL if all zero)
+ *   xa          <-- extradiagonal values (NULL if all zero)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs_sell(cs_matrix_t         *matrix,
+                 bool                 symmetric,
+                 bool                 copy,
+                 cs_lnum_t            n_edges,
+                 const cs_lnum_2_t  *restrict edges,
+                 const cs_real_t    *restrict da,
+                 const cs_real_t    *restrict xa)
+{
+  _set_coeffs_msr(matrix, symmetric, copy, n_edges, edges, da, xa);
+
+  _update_s_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Function for final assembly of SELL-C-sigma matrix coefficients.
+ *
+ * Coefficients are assembled in MSR form, and copied to the SELL-C-sigma
+ * layout here.
+ *
+ * \param[in, out]  matrix_p  untyped pointer to matrix description structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_sell_assembler_values_end(void  *matrix_p)
+{
+  cs_matrix_t  *matrix = (cs_matrix_t *)matrix_p;
+
+  _update_s_coeffs_sell(matrix);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create and initialize a SELL-C-sigma matrix assembler values
+ *        structure.
+ *
+ * The associated matrix's structure must have been created using
+ * \ref cs_matrix_structure_create_from_assembler.
+ *
+ * \param[in, out]  matrix                 pointer to matrix structure
+ * \param[in]       diag_block_size        block sizes for diagonal
+ * \param[in]       extra_diag_block_size  block sizes for extra diagonal
+ *
+ * \return  pointer to initialized matrix assembler values structure;
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_matrix_assembler_values_t *
+_assembler_values_create_sell(cs_matrix_t      *matrix,
+                              const cs_lnum_t   diag_block_size,
+                              const cs_lnum_t   extra_diag_block_size)
+{
+  cs_matrix_assembler_values_t *mav
+    = cs_matrix_assembler_values_create(matrix->assembler,
+                                        true,
+                                        diag_block_size,
+                                        extra_diag_block_size,
+                                        (void *)matrix,
+                                        _msr_assembler_values_init,
+                                        _msr_assembler_values_add,
+                                        NULL,
+                                        NULL,
+                                        _sell_assembler_values_end);
+
+  return mav;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Create matrix structure internals using a matrix assembler.
@@ -3968,6 +4400,24 @@ _structure_from_assembler(cs_matrix_type_t        type,
     }
     break;
 
+  case CS_MATRIX_SELL:
+    if (ma_sep_diag == true)
+      structure = _create_struct_msr_from_shared(false, /* for safety */
+                                                 n_rows,
+                                                 n_cols_ext,
+                                                 row_index,
+                                                 col_id);
+    else {
+      structure = _create_struct_msr_from_csr(true,
+                                              alloc_mode,
+                                              n_rows,
+                                              n_cols_ext,
+                                              row_index,
+                                              col_id);
+    }
+    _build_struct_sell(structure, alloc_mode);
+    break;
+
   default:
     if (type >= 0 && type < CS_MATRIX_N_BUILTIN_TYPES)
       bft_error(__FILE__, __LINE__, 0,
@@ -4012,6 +4462,9 @@ _structure_destroy(cs_matrix_type_t   type,
   case CS_MATRIX_DIST:
     _destroy_struct_dist(structure);
     break;
+  case CS_MATRIX_SELL:
+    _destroy_struct_dist(structure);
+    break;
   default:
     assert(0);
     break;
@@ -4058,8 +4511,9 @@ _matrix_create(cs_matrix_type_t  type)
   m->eb_size = 0;
 
   m->alloc_mode = cs_alloc_mode;
-  /* Native and distributed matrix types not on accelerator yet */
-  if (m->type == CS_MATRIX_NATIVE || m->type == CS_MATRIX_DIST)
+  /* Native, distributed and SELL matrix types not on accelerator yet */
+  if (   m->type == CS_MATRIX_NATIVE || m->type == CS_MATRIX_DIST
+      || m->type == CS_MATRIX_SELL)
     m->alloc_mode = CS_ALLOC_HOST;
 
   m->fill_type = CS_MATRIX_N_FILL_TYPES;
@@ -4070,6 +4524,7 @@ _matrix_create(cs_matrix_type_t  type)
   m->halo = NULL;
   m->numbering = NULL;
   m->assembler = NULL;
+  m->generation = ++_structure_generation;
 
   for (mft = 0; mft < CS_MATRIX_N_FILL_TYPES; mft++) {
     for (cs_matrix_spmv_type_t i = 0; i < CS_MATRIX_SPMV_N_TYPES; i++) {
@@ -4096,6 +4551,9 @@ _matrix_create(cs_matrix_type_t  type)
   case CS_MATRIX_DIST:
     m->coeffs = _create_coeff_dist();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_dist();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4160,6 +4618,16 @@ _matrix_create(cs_matrix_type_t  type)
     m->assembler_values_create = _assembler_values_create_dist;
     break;
 
+  case CS_MATRIX_SELL:
+    m->set_coefficients = _set_coeffs_sell;
+    m->release_coefficients = _release_coeffs_dist;
+    m->copy_diagonal = _copy_diagonal_separate;
+    m->get_diagonal = _get_diagonal_dist;
+    m->destroy_structure = _destroy_struct_dist;
+    m->destroy_coefficients = _destroy_coeff_dist;
+    m->assembler_values_create = _assembler_values_create_sell;
+    break;
+
   default:
     assert(0);
     break;
@@ -4264,6 +4732,14 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
                                         n_edges,
                                         edges);
     break;
+  case CS_MATRIX_SELL:
+    ms->structure = _create_struct_msr(ms->alloc_mode,
+                                       n_rows,
+                                       n_cols_ext,
+                                       n_edges,
+                                       edges);
+    _build_struct_sell(ms->structure, ms->alloc_mode);
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4278,6 +4754,8 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
   ms->numbering = numbering;
   ms->assembler = NULL;
 
+  ms->generation = ++_structure_generation;
+
   return ms;
 }
 
@@ -4285,7 +4763,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 /*!
  * \brief Create a matrix structure based on a MSR connectivity definition.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * col_id is sorted row by row during the creation of this structure.
  *
@@ -4352,6 +4830,15 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
                                                 row_index,
                                                 col_id);
     break;
+  case CS_MATRIX_SELL:
+    ms->structure = _create_struct_msr_from_msr(transfer,
+                                                false,
+                                                n_rows,
+                                                n_cols_ext,
+                                                row_index,
+                                                col_id);
+    _build_struct_sell(ms->structure, CS_ALLOC_HOST);
+    break;
   default:
     if (type >= 0 && type < CS_MATRIX_N_BUILTIN_TYPES)
       bft_error(__FILE__, __LINE__, 0,
@@ -4373,6 +4860,8 @@ cs_matrix_structure_create_msr(cs_matrix_type_t        type,
   ms->numbering = numbering;
   ms->assembler = NULL;
 
+  ms->generation = ++_structure_generation;
+
   return ms;
 }
 
@@ -4436,6 +4925,8 @@ cs_matrix_structure_create_msr_shared(bool                    direct_assembly,
   ms->numbering = numbering;
   ms->assembler = NULL;
 
+  ms->generation = ++_structure_generation;
+
   return ms;
 }
 
@@ -4482,9 +4973,73 @@ cs_matrix_structure_create_from_assembler(cs_matrix_type_t        type,
 
   ms->assembler = ma;
 
+  ms->generation = ++_structure_generation;
+
   return ms;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a structured stencil layout for a native matrix structure.
+ *
+ * With such a layout, row ii is coupled to rows ii +/- shift[d] for each
+ * stencil direction d, so that the "structured" matrix.vector product
+ * variant may be used, with no indirect addressing. That variant also
+ * stores the matching coefficients by direction, on its first use after
+ * they are assigned. Edges out of the stencil (usually those adjacent to
+ * ghost rows) are handled separately.
+ *
+ * Each row and direction must match at most one edge. Only scalar fill
+ * types exploit this layout.
+ *
+ * The edge_dir array is mapped, so it must not be freed before the
+ * matrix structure is destroyed.
+ *
+ * \param[in, out]  ms        pointer to matrix structure
+ * \param[in]       n_dirs    number of stencil directions (1 to 3)
+ * \param[in]       shift     row offset for each stencil direction
+ * \param[in]       edge_dir  stencil direction of each edge, or -1
+ *                            for edges out of stencil
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_structure_set_stencil(cs_matrix_structure_t  *ms,
+                                int                     n_dirs,
+                                const cs_lnum_t         shift[],
+                                const signed char       edge_dir[])
+{
+  if (ms->type != CS_MATRIX_NATIVE)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: only handled for matrix structures of type \"%s\"."),
+              __func__, _(_matrix_type_name[CS_MATRIX_NATIVE]));
+
+  assert(n_dirs > 0 && n_dirs <= 3);
+
+  cs_matrix_struct_native_t  *_ms = ms->structure;
+
+  _ms->st_n_dirs = n_dirs;
+  for (int i = 0; i < 3; i++)
+    _ms->st_shift[i] = (i < n_dirs) ? shift[i] : 0;
+  _ms->st_edge_dir = edge_dir;
+
+  _ms->st_n_x_edges = 0;
+  for (cs_lnum_t e_id = 0; e_id < _ms->n_edges; e_id++) {
+    if (edge_dir[e_id] < 0)
+      _ms->st_n_x_edges += 1;
+  }
+
+  BFT_REALLOC(_ms->st_x_edge_id, _ms->st_n_x_edges, cs_lnum_t);
+
+  cs_lnum_t j = 0;
+  for (cs_lnum_t e_id = 0; e_id < _ms->n_edges; e_id++) {
+    if (edge_dir[e_id] < 0)
+      _ms->st_x_edge_id[j++] = e_id;
+  }
+
+  ms->generation = ++_structure_generation;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Destroy a matrix structure.
@@ -4538,6 +5093,7 @@ cs_matrix_create(const cs_matrix_structure_t  *ms)
   m->halo = ms->halo;
   m->numbering = ms->numbering;
   m->assembler = ms->assembler;
+  m->generation = ms->generation;
 
   return m;
 }
@@ -4626,6 +5182,9 @@ cs_matrix_create_by_copy(cs_matrix_t   *src)
   case CS_MATRIX_DIST:
     m->coeffs = _create_coeff_dist();
     break;
+  case CS_MATRIX_SELL:
+    m->coeffs = _create_coeff_dist();
+    break;
   default:
     bft_error(__FILE__, __LINE__, 0,
               _("Handling of matrixes in format type %d\n"
@@ -4682,6 +5241,7 @@ cs_matrix_create_by_local_restrict(const cs_matrix_t  *src)
     {
       m->_structure = _create_struct_csr_from_restrict_local(src->structure);
       m->structure = m->_structure;
+      m->generation = ++_structure_generation;
       m->coeffs = _create_coeff_dist();
       cs_matrix_coeff_dist_t  *mc = m->coeffs;
       cs_matrix_coeff_dist_t  *mc_src = src->coeffs;
@@ -4813,6 +5373,29 @@ cs_matrix_get_n_columns(const cs_matrix_t  *matrix)
   return matrix->n_cols_ext;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return generation stamp of a matrix's structure.
+ *
+ * A new stamp is assigned whenever a matrix structure is created or
+ * modified, so comparing stamps allows detecting structure changes even
+ * when the structure's arrays are reallocated at the same address
+ * (such as after a mesh modification). Matrices sharing a structure
+ * share its stamp.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ */
+/*----------------------------------------------------------------------------*/
+
+unsigned long
+cs_matrix_get_structure_generation(const cs_matrix_t  *matrix)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+  return matrix->generation;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return number of rows in matrix.
@@ -4864,6 +5447,7 @@ cs_matrix_get_n_entries(const cs_matrix_t  *matrix)
     }
     break;
   case CS_MATRIX_MSR:
+  case CS_MATRIX_SELL:
     {
       const cs_matrix_struct_dist_t  *ms = matrix->structure;
       retval = ms->e.row_index[ms->n_rows] + ms->n_rows;
@@ -5102,6 +5686,7 @@ cs_matrix_set_coefficients(cs_matrix_t        *matrix,
   if (matrix->set_coefficients != NULL) {
     matrix->xa = xa;
     matrix->set_coefficients(matrix, symmetric, false, n_edges, edges, da, xa);
+    _update_coeffs_msr_f(matrix);
   }
   else
     bft_error
@@ -5155,8 +5740,10 @@ cs_matrix_copy_coefficients(cs_matrix_t        *matrix,
                  diag_block_size,
                  extra_diag_block_size);
 
-  if (matrix->set_coefficients != NULL)
+  if (matrix->set_coefficients != NULL) {
     matrix->set_coefficients(matrix, symmetric, true, n_edges, edges, da, xa);
+    _update_coeffs_msr_f(matrix);
+  }
   else
     bft_error
       (__FILE__, __LINE__, 0,
@@ -5234,6 +5821,19 @@ cs_matrix_transfer_coefficients_msr(cs_matrix_t         *matrix,
                              d_val,
                              x_val_p,
                              x_val);
+    _update_coeffs_msr_f(matrix);
+    break;
+
+  case CS_MATRIX_SELL:
+    _set_coeffs_msr_from_msr(matrix,
+                             false, /* ignored in case of transfer */
+                             row_index,
+                             col_id,
+                             d_val_p,
+                             d_val,
+                             x_val_p,
+                             x_val);
+    _update_s_coeffs_sell(matrix);
     break;
 
   default:
@@ -5276,6 +5876,11 @@ cs_matrix_release_coefficients(cs_matrix_t  *matrix)
   if (matrix->release_coefficients != NULL) {
     matrix->xa = NULL;
     matrix->release_coefficients(matrix);
+    if (matrix->type == CS_MATRIX_MSR) {
+      cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+      BFT_FREE(mc->_d_val_f);
+      BFT_FREE(mc->_e_val_f);
+    }
   }
   else {
     bft_error
@@ -5884,7 +6489,7 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
   if (x_val != NULL)
     *x_val = NULL;
 
-  if (matrix->type == CS_MATRIX_MSR) {
+  if (matrix->type == CS_MATRIX_MSR || matrix->type == CS_MATRIX_SELL) {
     const cs_matrix_struct_dist_t  *ms = matrix->structure;
     const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
     if (row_index != NULL)
@@ -5906,6 +6511,109 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
        matrix->type_name);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether a matrix should use single-precision coefficients
+ *        for matrix-vector products.
+ *
+ * When active, single-precision copies of the matrix coefficients are
+ * maintained in addition to the regular (double-precision) coefficients,
+ * and are updated whenever coefficients are assigned. Vectors and
+ * accumulation remain in double precision, so this reduces memory traffic
+ * for bandwidth-bound operations such as matrix-vector products or
+ * smoothers, at the cost of a lower precision of the operator.
+ *
+ * Only matrices in MSR format with scalar extra-diagonal coefficients
+ * are currently handled; this setting is ignored for others.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ * \param[in]       mixed   true to use single-precision coefficients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_mixed_precision(cs_matrix_t  *matrix,
+                              bool          mixed)
+{
+  if (matrix == NULL)
+    bft_error(__FILE__, __LINE__, 0,
+              _("The matrix is not defined."));
+
+  if (matrix->type != CS_MATRIX_MSR || matrix->coeffs == NULL)
+    return;
+
+  cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  mc->mixed_precision = mixed;
+
+  if (matrix->fill_type < CS_MATRIX_N_FILL_TYPES)
+    _update_coeffs_msr_f(matrix);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether a matrix uses single-precision coefficients
+ *        for matrix-vector products.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  true if mixed precision was requested and is handled
+ *          by the matrix type, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_mixed_precision(const cs_matrix_t  *matrix)
+{
+  bool retval = false;
+
+  if (matrix->type == CS_MATRIX_MSR && matrix->coeffs != NULL) {
+    const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+    retval = mc->mixed_precision;
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get single-precision coefficient arrays of an MSR matrix.
+ *
+ * Arrays are only available when mixed precision is active for this
+ * matrix (see \ref cs_matrix_set_mixed_precision) and coefficients have
+ * been assigned; otherwise, the returned values pointers are set to NULL.
+ *
+ * \param[in]   matrix     pointer to matrix structure
+ * \param[out]  row_index  MSR row index
+ * \param[out]  col_id     MSR column id
+ * \param[out]  d_val      diagonal values (single precision), or NULL
+ * \param[out]  x_val      extra-diagonal values (single precision), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_msr_arrays_f(const cs_matrix_t   *matrix,
+                           const cs_lnum_t    **row_index,
+                           const cs_lnum_t    **col_id,
+                           const float        **d_val,
+                           const float        **x_val)
+{
+  cs_matrix_get_msr_arrays(matrix, row_index, col_id, NULL, NULL);
+
+  if (d_val != NULL)
+    *d_val = NULL;
+  if (x_val != NULL)
+    *x_val = NULL;
+
+  if (matrix->type == CS_MATRIX_MSR && matrix->coeffs != NULL) {
+    const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+    if (d_val != NULL)
+      *d_val = mc->_d_val_f;
+    if (x_val != NULL)
+      *x_val = mc->_e_val_f;
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Matrix.vector product y = A.x
@@ -6265,6 +6973,21 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
     }
 
+    const cs_matrix_struct_native_t  *ms = m->structure;
+
+    if (   ms->st_n_dirs > 0
+        && (   m->fill_type == CS_MATRIX_SCALAR
+            || m->fill_type == CS_MATRIX_SCALAR_SYM)) {
+      _variant_add(_("native, structured"),
+                   m->type,
+                   m->fill_type,
+                   m->numbering,
+                   "structured",
+                   n_variants,
+                   &n_variants_max,
+                   m_variant);
+    }
+
   }
 
   if (m->type == CS_MATRIX_CSR) {
@@ -6386,6 +7109,37 @@ cs_matrix_variant_build_list(const cs_matrix_t       *m,
 
   }
 
+  if (m->type == CS_MATRIX_SELL) {
+
+    _variant_add(_("SELL-C-sigma"),
+                 m->type,
+                 m->fill_type,
+                 m->numbering,
+                 "baseline",
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+    _variant_add(_("SELL-C-sigma, AVX2"),
+                 m->type,
+                 m->fill_type,
+                 m->numbering,
+                 "avx2",
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+    _variant_add(_("SELL-C-sigma, AVX-512"),
+                 m->type,
+                 m->fill_type,
+                 m->numbering,
+                 "avx512",
+                 n_variants,
+                 &n_variants_max,
+                 m_variant);
+
+  }
+
   n_variants_max = *n_variants;
   BFT_REALLOC(*m_variant, *n_variants, cs_matrix_variant_t);
 }
@@ -6438,6 +7192,8 @@ cs_matrix_variant_apply(cs_matrix_t          *m,
       m->vector_multiply_d[m->fill_type][i] = mv->vector_multiply[i];
 #endif
   }
+
+  _free_st_coeffs_native(m);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -6480,6 +7236,8 @@ cs_matrix_variant_apply_tuned(cs_matrix_t          *m,
       m->vector_multiply_d[m->fill_type][i] = NULL;
   }
 #endif
+
+  _free_st_coeffs_native(m);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -6495,6 +7253,8 @@ cs_matrix_variant_apply_tuned(cs_matrix_t          *m,
  *     omp             (for OpenMP with compatible numbering)
  *     omp_atomic      (for OpenMP with atomics)
  *     vector          (For vector machine with compatible numbering)
+ *     structured      (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM,
+ *                      with a structured stencil layout)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     default
@@ -6505,6 +7265,13 @@ cs_matrix_variant_apply_tuned(cs_matrix_t          *m,
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     omp_sched       (For OpenMP with scheduling)
  *
+ *   CS_MATRIX_SELL    (all fill types except CS_MATRIX_BLOCK)
+ *     default
+ *     baseline
+ *     avx2            (with AVX2, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     avx512          (with AVX-512, for CS_MATRIX_SCALAR or
+ *                      CS_MATRIX_SCALAR_SYM)
+ *
  * parameters:
  *   mv         <->  pointer to matrix variant
  *   numbering  <--  mesh numbering info, or NULL
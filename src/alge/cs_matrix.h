@@ -60,6 +60,12 @@ typedef enum {
   CS_MATRIX_DIST,             /*!< Distributed matrix storage
                                    (separate diagonal, off-diagonal, and
                                    distant coefficients) */
+  CS_MATRIX_SELL,             /*!< Sliced ELLPACK (SELL-C-sigma) storage
+                                   (separate diagonal, row chunks with
+                                   column-major, padded extra-diagonal
+                                   coefficients); MSR arrays are kept,
+                                   so extra-diagonal coefficients are
+                                   stored twice */
 
   CS_MATRIX_N_BUILTIN_TYPES,  /*!< Number of known and built-in matrix types */
 
@@ -181,7 +187,7 @@ cs_matrix_structure_create(cs_matrix_type_t       type,
 /*----------------------------------------------------------------------------
  * Create a matrix structure based on a MSR connectivity definition.
  *
- * Only CSR and MSR formats are handled.
+ * Only CSR, MSR and SELL formats are handled.
  *
  * col_id is sorted row by row during the creation of this structure.
  *
@@ -266,6 +272,37 @@ cs_matrix_structure_t *
 cs_matrix_structure_create_from_assembler(cs_matrix_type_t        type,
                                           cs_matrix_assembler_t  *ma);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define a structured stencil layout for a native matrix structure.
+ *
+ * With such a layout, row ii is coupled to rows ii +/- shift[d] for each
+ * stencil direction d, so that the "structured" matrix.vector product
+ * variant may be used, with no indirect addressing. That variant also
+ * stores the matching coefficients by direction, on its first use after
+ * they are assigned. Edges out of the stencil (usually those adjacent to
+ * ghost rows) are handled separately.
+ *
+ * Each row and direction must match at most one edge. Only scalar fill
+ * types exploit this layout.
+ *
+ * The edge_dir array is mapped, so it must not be freed before the
+ * matrix structure is destroyed.
+ *
+ * \param[in, out]  ms        pointer to matrix structure
+ * \param[in]       n_dirs    number of stencil directions (1 to 3)
+ * \param[in]       shift     row offset for each stencil direction
+ * \param[in]       edge_dir  stencil direction of each edge, or -1
+ *                            for edges out of stencil
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_structure_set_stencil(cs_matrix_structure_t  *ms,
+                                int                     n_dirs,
+                                const cs_lnum_t         shift[],
+                                const signed char       edge_dir[]);
+
 /*----------------------------------------------------------------------------
  * Destroy a matrix structure.
  *
@@ -396,6 +433,20 @@ cs_matrix_get_type_fullname(const cs_matrix_t  *matrix);
 cs_lnum_t
 cs_matrix_get_n_columns(const cs_matrix_t  *matrix);
 
+/*----------------------------------------------------------------------------
+ * Return generation stamp of a matrix's structure.
+ *
+ * A new stamp is assigned whenever a matrix structure is created or
+ * modified, so comparing stamps allows detecting structure changes even
+ * when the structure's arrays are reallocated at the same address.
+ *
+ * parameters:
+ *   matrix --> pointer to matrix structure
+ *----------------------------------------------------------------------------*/
+
+unsigned long
+cs_matrix_get_structure_generation(const cs_matrix_t  *matrix);
+
 /*----------------------------------------------------------------------------
  * Return number of rows in matrix.
  *
@@ -842,6 +893,68 @@ cs_matrix_get_msr_arrays(const cs_matrix_t   *matrix,
                          const cs_real_t    **d_val,
                          const cs_real_t    **x_val);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether a matrix should use single-precision coefficients
+ *        for matrix-vector products.
+ *
+ * When active, single-precision copies of the matrix coefficients are
+ * maintained in addition to the regular (double-precision) coefficients,
+ * and are updated whenever coefficients are assigned. Vectors and
+ * accumulation remain in double precision, so this reduces memory traffic
+ * for bandwidth-bound operations such as matrix-vector products or
+ * smoothers, at the cost of a lower precision of the operator.
+ *
+ * Only matrices in MSR format with scalar extra-diagonal coefficients
+ * are currently handled; this setting is ignored for others.
+ *
+ * \param[in, out]  matrix  pointer to matrix structure
+ * \param[in]       mixed   true to use single-precision coefficients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_set_mixed_precision(cs_matrix_t  *matrix,
+                              bool          mixed);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Query whether a matrix uses single-precision coefficients
+ *        for matrix-vector products.
+ *
+ * \param[in]  matrix  pointer to matrix structure
+ *
+ * \return  true if mixed precision was requested and is handled
+ *          by the matrix type, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_matrix_get_mixed_precision(const cs_matrix_t  *matrix);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Get single-precision coefficient arrays of an MSR matrix.
+ *
+ * Arrays are only available when mixed precision is active for this
+ * matrix (see \ref cs_matrix_set_mixed_precision) and coefficients have
+ * been assigned; otherwise, the returned values pointers are set to NULL.
+ *
+ * \param[in]   matrix     pointer to matrix structure
+ * \param[out]  row_index  MSR row index
+ * \param[out]  col_id     MSR column id
+ * \param[out]  d_val      diagonal values (single precision), or NULL
+ * \param[out]  x_val      extra-diagonal values (single precision), or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_matrix_get_msr_arrays_f(const cs_matrix_t   *matrix,
+                           const cs_lnum_t    **row_index,
+                           const cs_lnum_t    **col_id,
+                           const float        **d_val,
+                           const float        **x_val);
+
 /*----------------------------------------------------------------------------
  * Assign functions based on a variant to a given matrix.
  *
@@ -1055,6 +1168,8 @@ cs_matrix_variant_apply_tuned(cs_matrix_t          *m,
  *     omp             (for OpenMP with compatible numbering)
  *     omp_atomic      (for OpenMP with atomics)
  *     vector          (For vector machine with compatible numbering)
+ *     structured      (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM,
+ *                      with a structured stencil layout)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *     default
@@ -58,6 +58,7 @@
 #include "cs_log.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_cartesian.h"
 #include "cs_numbering.h"
 #include "cs_prototypes.h"
 #include "cs_range_set.h"
@@ -267,6 +268,30 @@ _update_matrix_struct(cs_matrix_type_t  t)
     }
     break;
 
+  case CS_MATRIX_NATIVE:
+    {
+      _matrix_struct[t]
+        = cs_matrix_structure_create(t,
+                                     mesh->n_cells,
+                                     mesh->n_cells_with_ghosts,
+                                     mesh->n_i_faces,
+                                     (const cs_lnum_2_t *)(mesh->i_face_cells),
+                                     mesh->halo,
+                                     mesh->i_face_numbering);
+
+      /* Use structured layout for cartesian meshes */
+
+      const cs_mesh_cartesian_stencil_t  *c_stencil
+        = cs_mesh_cartesian_get_stencil(mesh);
+
+      if (c_stencil != NULL)
+        cs_matrix_structure_set_stencil(_matrix_struct[t],
+                                        c_stencil->n_dirs,
+                                        c_stencil->shift,
+                                        c_stencil->i_face_dir);
+    }
+    break;
+
   default:
     {
       _matrix_struct[t]
@@ -45,6 +45,11 @@ BEGIN_C_DECLS
  * Macro definitions
  *============================================================================*/
 
+/* Number of rows per chunk for SELL-C-sigma storage (matches the number
+   of double precision values in an AVX-512 register) */
+
+#define CS_MATRIX_SELL_CHUNK_SIZE 8
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -54,6 +59,8 @@ BEGIN_C_DECLS
  *  - Native
  *  - Compressed Sparse Row (CSR)
  *  - Modified Compressed Sparse Row (MSR), with separate diagonal
+ *  - Distributed (MSR with separate halo part)
+ *  - Sliced ELLPACK (SELL-C-sigma), with separate diagonal
  */
 
 /*----------------------------------------------------------------------------
@@ -135,6 +142,19 @@ typedef struct _cs_matrix_struct_native_t {
   const cs_lnum_2_t  *edges;        /* Edges (symmetric row <-> column)
                                        connectivity */
 
+  /* Optional structured stencil layout, where row ii is coupled to rows
+     ii +/- st_shift[d] for each stencil direction d */
+
+  int                 st_n_dirs;    /* Number of stencil directions
+                                       (0 if no stencil is defined) */
+  cs_lnum_t           st_shift[3];  /* Row offset for each direction */
+
+  const signed char  *st_edge_dir;  /* Stencil direction of each edge,
+                                       or -1 for edges out of stencil */
+
+  cs_lnum_t           st_n_x_edges; /* Number of edges out of stencil */
+  cs_lnum_t          *st_x_edge_id; /* Ids of edges out of stencil */
+
 } cs_matrix_struct_native_t;
 
 /* CSR (Compressed Sparse Row) matrix structure representation */
@@ -198,6 +218,17 @@ typedef struct _cs_matrix_struct_dist_t {
   cs_lnum_t               *h_row_id;  /* Optional row id for coordinates
                                          format (col_id in h structure) */
 
+  /* Optional SELL-C-sigma layout of the E part (for CS_MATRIX_SELL) */
+
+  cs_lnum_t                s_n_chunks;     /* Number of row chunks */
+  cs_lnum_t               *s_chunk_index;  /* Start of each chunk in
+                                              s_col_id (size: n_chunks+1) */
+  cs_lnum_t               *s_row_id;       /* Row id matching each chunk
+                                              slot, -1 for padding
+                                              (size: n_chunks*chunk_size) */
+  cs_lnum_t               *s_col_id;       /* Column ids, column-major
+                                              inside each chunk */
+
 } cs_matrix_struct_dist_t;
 
 /* CSR matrix coefficients representation */
@@ -225,7 +256,7 @@ typedef struct _cs_matrix_coeff_csr_t {
 /* Distributed matrix coefficients representation */
 /*------------------------------------------------*/
 
-/* Used for native, MSR, and distributed matrices */
+/* Used for native, MSR, distributed, and SELL-C-sigma matrices */
 
 typedef struct _cs_matrix_coeff_dist_t {
 
@@ -257,6 +288,20 @@ typedef struct _cs_matrix_coeff_dist_t {
   cs_lnum_t        *d_idx;           /* Index for diagonal matrix coefficients
                                         in case of multiple block sizes */
 
+  cs_real_t        *_s_val;          /* E coefficients in SELL-C-sigma
+                                        layout (for CS_MATRIX_SELL) */
+
+  cs_real_t        *_st_val;         /* E coefficients by stencil direction,
+                                        for native matrices with a
+                                        structured stencil layout */
+
+  /* Optional single-precision copies of coefficients, used by
+     mixed-precision SpMV (vectors and accumulation remain in double) */
+
+  bool              mixed_precision; /* Maintain single-precision copies */
+  float            *_d_val_f;        /* D coefficients (single precision) */
+  float            *_e_val_f;        /* E coefficients (single precision) */
+
 } cs_matrix_coeff_dist_t;
 
 /* Matrix structure (representation-independent part) */
@@ -283,6 +328,8 @@ struct _cs_matrix_structure_t {
                                           numbering information */
 
   const cs_matrix_assembler_t  *assembler;   /* Associated matrix assembler */
+
+  unsigned long          generation;   /* Structure generation stamp */
 };
 
 /* Structure associated with Matrix (representation-independent part) */
@@ -325,6 +372,9 @@ struct _cs_matrix_t {
 
   const cs_matrix_assembler_t  *assembler;   /* Associated matrix assembler */
 
+  unsigned long          generation;   /* Generation stamp of mapped
+                                          structure */
+
   /* Pointer to shared arrays from coefficient assignment from
      "native" type. This should be removed in the future, but requires
      removing the dependency to the native structure in the multigrid
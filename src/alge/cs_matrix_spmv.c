@@ -45,6 +45,21 @@
 #include <mkl_spblas.h>
 #endif
 
+/* SIMD variants of SELL-C-sigma kernels (gathers require 32-bit ids) */
+
+#if !defined(HAVE_LONG_LNUM)
+#if defined(__AVX2__)
+#define _CS_SELL_AVX2
+#endif
+#if defined(__AVX512F__)
+#define _CS_SELL_AVX512
+#endif
+#endif
+
+#if defined(_CS_SELL_AVX2) || defined(_CS_SELL_AVX512)
+#include <immintrin.h>
+#endif
+
 /*----------------------------------------------------------------------------
  * Local headers
  *----------------------------------------------------------------------------*/
@@ -1442,6 +1457,264 @@ _mat_vec_p_l_native_vector(const cs_matrix_t  *matrix,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Set extra-diagonal coefficients of a native matrix by stencil direction,
+ * for a structure with a structured stencil layout.
+ *
+ * For each stencil direction d, the coefficient coupling row ii to
+ * row ii + shift[d] is stored at position ii of the upper array, and
+ * for non-symmetric matrices, the coefficient coupling row ii to
+ * row ii - shift[d] is stored at position ii of the lower array.
+ * Arrays are ordered by direction, with the lower array following the
+ * upper array for non-symmetric matrices.
+ *
+ * parameters:
+ *   ms <-- pointer to native matrix structure
+ *   mc <-> pointer to matrix coefficients
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_st_coeffs_native(const cs_matrix_struct_native_t  *ms,
+                      cs_matrix_coeff_dist_t           *mc)
+{
+  const bool symmetric = mc->symmetric;
+  const cs_real_t *restrict xa = mc->e_val;
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_lnum_t n_edges = ms->n_edges;
+  const cs_lnum_2_t *restrict edges = ms->edges;
+  const signed char *restrict edge_dir = ms->st_edge_dir;
+
+  const cs_lnum_t n_vals = (symmetric) ?   ms->st_n_dirs*n_rows
+                                         : 2*ms->st_n_dirs*n_rows;
+
+  BFT_REALLOC(mc->_st_val, n_vals, cs_real_t);
+  cs_real_t *restrict st_val = mc->_st_val;
+
+# pragma omp parallel for  if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+    st_val[ii] = 0.;
+
+  /* Each row and direction matches at most one edge */
+
+  if (symmetric) {
+#   pragma omp parallel for  if(n_edges > CS_THR_MIN)
+    for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+      int d = edge_dir[e_id];
+      if (d < 0)
+        continue;
+      cs_lnum_t ii = CS_MIN(edges[e_id][0], edges[e_id][1]);
+      st_val[d*n_rows + ii] = xa[e_id];
+    }
+  }
+  else {
+#   pragma omp parallel for  if(n_edges > CS_THR_MIN)
+    for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+      int d = edge_dir[e_id];
+      if (d < 0)
+        continue;
+      cs_lnum_t ii = edges[e_id][0];
+      cs_lnum_t jj = edges[e_id][1];
+      cs_real_t *restrict u_val = st_val + 2*d*n_rows;
+      cs_real_t *restrict l_val = u_val + n_rows;
+      if (ii < jj) {
+        u_val[ii] = xa[2*e_id];
+        l_val[jj] = xa[2*e_id + 1];
+      }
+      else {
+        u_val[jj] = xa[2*e_id + 1];
+        l_val[ii] = xa[2*e_id];
+      }
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local part of y = A.x for a range of rows of a native matrix
+ * with a structured stencil layout and symmetric coefficients.
+ *
+ * parameters:
+ *   ms       <-- pointer to native matrix structure
+ *   s_id     <-- start of row range
+ *   e_id     <-- past-the-end of row range
+ *   guard    <-- check that neighbor rows are in range if true
+ *   d_val    <-- diagonal coefficients, or NULL
+ *   st_val   <-- extra-diagonal coefficients by stencil direction
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_st_vec_p_l_sym(const cs_matrix_struct_native_t  *ms,
+                cs_lnum_t                         s_id,
+                cs_lnum_t                         e_id,
+                bool                              guard,
+                const cs_real_t                  *restrict d_val,
+                const cs_real_t                  *restrict st_val,
+                const cs_real_t                  *restrict x,
+                cs_real_t                        *restrict y)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
+  const int n_dirs = ms->st_n_dirs;
+  const cs_lnum_t *shift = ms->st_shift;
+
+# pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+  for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+    cs_real_t sii = (d_val != NULL) ? d_val[ii]*x[ii] : 0.;
+    for (int d = 0; d < n_dirs; d++) {
+      const cs_real_t *restrict u_val = st_val + d*n_rows;
+      const cs_lnum_t s = shift[d];
+      if (!guard || ii + s < n_rows)
+        sii += u_val[ii] * x[ii+s];
+      if (!guard || ii >= s)
+        sii += u_val[ii-s] * x[ii-s];
+    }
+    y[ii] = sii;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local part of y = A.x for a range of rows of a native matrix
+ * with a structured stencil layout and non-symmetric coefficients.
+ *
+ * parameters:
+ *   ms       <-- pointer to native matrix structure
+ *   s_id     <-- start of row range
+ *   e_id     <-- past-the-end of row range
+ *   guard    <-- check that neighbor rows are in range if true
+ *   d_val    <-- diagonal coefficients, or NULL
+ *   st_val   <-- extra-diagonal coefficients by stencil direction
+ *   x        <-- multipliying vector values
+ *   y        --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_st_vec_p_l(const cs_matrix_struct_native_t  *ms,
+            cs_lnum_t                         s_id,
+            cs_lnum_t                         e_id,
+            bool                              guard,
+            const cs_real_t                  *restrict d_val,
+            const cs_real_t                  *restrict st_val,
+            const cs_real_t                  *restrict x,
+            cs_real_t                        *restrict y)
+{
+  const cs_lnum_t n_rows = ms->n_rows;
+  const int n_dirs = ms->st_n_dirs;
+  const cs_lnum_t *shift = ms->st_shift;
+
+# pragma omp parallel for  if(e_id - s_id > CS_THR_MIN)
+  for (cs_lnum_t ii = s_id; ii < e_id; ii++) {
+    cs_real_t sii = (d_val != NULL) ? d_val[ii]*x[ii] : 0.;
+    for (int d = 0; d < n_dirs; d++) {
+      const cs_real_t *restrict u_val = st_val + 2*d*n_rows;
+      const cs_real_t *restrict l_val = u_val + n_rows;
+      const cs_lnum_t s = shift[d];
+      if (!guard || ii + s < n_rows)
+        sii += u_val[ii] * x[ii+s];
+      if (!guard || ii >= s)
+        sii += l_val[ii] * x[ii-s];
+    }
+    y[ii] = sii;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with native matrix, using coefficients
+ * stored by stencil direction for a structured stencil layout.
+ *
+ * Rows are handled independently, with no indirect addressing except
+ * for the (few) edges out of stencil, which are handled after the
+ * ghost values are synchronized. Coefficients by stencil direction are
+ * built on the first product following their assignment. If they are
+ * not available, the baseline native product is used.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_native_structured(const cs_matrix_t  *matrix,
+                               bool                exclude_diag,
+                               bool                sync,
+                               cs_real_t           x[restrict],
+                               cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_native_t  *ms = matrix->structure;
+  cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  if (mc->_st_val == NULL) {
+    if (   ms->st_n_dirs < 1 || mc->e_val == NULL
+        || mc->db_size > 1 || mc->eb_size > 1) {
+      _mat_vec_p_l_native(matrix, exclude_diag, sync, x, y);
+      return;
+    }
+    _set_st_coeffs_native(ms, mc);
+  }
+
+  const cs_lnum_t n_rows = ms->n_rows;
+  const cs_real_t *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+  const cs_real_t *restrict st_val = mc->_st_val;
+
+  /* Initialize ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+
+  /* Local part, with rows in [r_s, r_e[ having all stencil
+     neighbors in range (shifts are in increasing order) */
+
+  const cs_lnum_t s_max = ms->st_shift[ms->st_n_dirs - 1];
+  const cs_lnum_t r_s = CS_MIN(s_max, n_rows);
+  const cs_lnum_t r_e = CS_MAX(n_rows - s_max, r_s);
+
+  if (mc->symmetric) {
+    _st_vec_p_l_sym(ms, 0, r_s, true, d_val, st_val, x, y);
+    _st_vec_p_l_sym(ms, r_s, r_e, false, d_val, st_val, x, y);
+    _st_vec_p_l_sym(ms, r_e, n_rows, true, d_val, st_val, x, y);
+  }
+  else {
+    _st_vec_p_l(ms, 0, r_s, true, d_val, st_val, x, y);
+    _st_vec_p_l(ms, r_s, r_e, false, d_val, st_val, x, y);
+    _st_vec_p_l(ms, r_e, n_rows, true, d_val, st_val, x, y);
+  }
+
+  _zero_range(y, n_rows, ms->n_cols_ext);
+
+  /* Finalize ghost cell comunication if overlap used */
+
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* Edges out of stencil */
+
+  const cs_lnum_2_t *restrict face_cel_p = ms->edges;
+  const cs_lnum_t *restrict x_edge_id = ms->st_x_edge_id;
+  const cs_real_t  *restrict xa = mc->e_val;
+
+  if (mc->symmetric) {
+    for (cs_lnum_t i = 0; i < ms->st_n_x_edges; i++) {
+      cs_lnum_t face_id = x_edge_id[i];
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      y[ii] += xa[face_id] * x[jj];
+      y[jj] += xa[face_id] * x[ii];
+    }
+  }
+  else {
+    for (cs_lnum_t i = 0; i < ms->st_n_x_edges; i++) {
+      cs_lnum_t face_id = x_edge_id[i];
+      cs_lnum_t ii = face_cel_p[face_id][0];
+      cs_lnum_t jj = face_cel_p[face_id][1];
+      y[ii] += xa[2*face_id] * x[jj];
+      y[jj] += xa[2*face_id + 1] * x[ii];
+    }
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with CSR matrix.
  *
@@ -1554,9 +1827,137 @@ _mat_vec_p_l_csr_mkl(const cs_matrix_t  *matrix,
 
 #endif /* defined (HAVE_MKL) */
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using
+ * single-precision coefficients (mixed-precision variant).
+ *
+ * Vector values and accumulation remain in double precision.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_f(const cs_matrix_t  *matrix,
+                   bool                exclude_diag,
+                   const cs_real_t    *restrict x,
+                   cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+
+  const float  *restrict d_val_f = (exclude_diag) ? NULL : mc->_d_val_f;
+  const float  *restrict e_val_f = mc->_e_val_f;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+    const float *restrict m_row = e_val_f + e_row_index[ii];
+    cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+    cs_real_t sii = 0.0;
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+      sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
+
+    if (d_val_f != NULL)
+      y[ii] = sii + (cs_real_t)d_val_f[ii]*x[ii];
+    else
+      y[ii] = sii;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, using
+ * single-precision coefficients (mixed-precision variant), with
+ * the scheduling of the "omp_sched" variant.
+ *
+ * Vector values and accumulation remain in double precision.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_msr_f_omp_sched(const cs_matrix_t  *matrix,
+                             bool                exclude_diag,
+                             const cs_real_t    *restrict x,
+                             cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+
+  const float  *restrict d_val_f = (exclude_diag) ? NULL : mc->_d_val_f;
+  const float  *restrict e_val_f = mc->_e_val_f;
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+
+    cs_lnum_t n_s_rows = cs_align(n_rows * 0.9, _cs_cl);
+    if (n_s_rows > n_rows)
+      n_s_rows = n_rows;
+
+#   pragma omp for nowait
+    for (cs_lnum_t ii = 0; ii < n_s_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+      const float *restrict m_row = e_val_f + e_row_index[ii];
+      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
+
+      if (d_val_f != NULL)
+        y[ii] = sii + (cs_real_t)d_val_f[ii]*x[ii];
+      else
+        y[ii] = sii;
+
+    }
+
+#   pragma omp for schedule(dynamic, CS_THR_MIN)
+    for (cs_lnum_t ii = n_s_rows; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+      const float *restrict m_row = e_val_f + e_row_index[ii];
+      cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+      cs_real_t sii = 0.0;
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        sii += ((cs_real_t)m_row[jj]*x[col_id[jj]]);
+
+      if (d_val_f != NULL)
+        y[ii] = sii + (cs_real_t)d_val_f[ii]*x[ii];
+      else
+        y[ii] = sii;
+
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with MSR matrix.
  *
+ * Single-precision coefficients are used if available (mixed precision).
+ *
  * parameters:
  *   matrix       <-- pointer to matrix structure
  *   exclude_diag <-- exclude diagonal if true,
@@ -1587,6 +1988,13 @@ _mat_vec_p_l_msr(const cs_matrix_t  *matrix,
   if (hs != NULL)
     cs_halo_sync_wait(matrix->halo, x, hs);
 
+  /* Mixed-precision case */
+
+  if (mc->_e_val_f != NULL) {
+    _mat_vec_p_l_msr_f(matrix, exclude_diag, x, y);
+    return;
+  }
+
   /* Standard case */
 
   if (!exclude_diag && mc->d_val != NULL) {
@@ -1633,6 +2041,8 @@ _mat_vec_p_l_msr(const cs_matrix_t  *matrix,
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with MSR matrix.
  *
+ * Single-precision coefficients are used if available (mixed precision).
+ *
  * parameters:
  *   matrix       <-- pointer to matrix structure
  *   exclude_diag <-- exclude diagonal if true,
@@ -1663,6 +2073,13 @@ _mat_vec_p_l_msr_omp_sched(const cs_matrix_t  *matrix,
   if (hs != NULL)
     cs_halo_sync_wait(matrix->halo, x, hs);
 
+  /* Mixed-precision case */
+
+  if (mc->_e_val_f != NULL) {
+    _mat_vec_p_l_msr_f_omp_sched(matrix, exclude_diag, x, y);
+    return;
+  }
+
   /* Standard case */
 
   if (!exclude_diag && mc->d_val != NULL) {
@@ -2002,10 +2419,75 @@ _b_mat_vec_p_l_msr_6(const cs_matrix_t  *matrix,
 
 }
 
+/*----------------------------------------------------------------------------
+ * Local matrix.vector product y = A.x with MSR matrix, blocked version,
+ * using single-precision coefficients (mixed-precision variant).
+ *
+ * Vector values and accumulation remain in double precision.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true
+ *   x            <-- multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_msr_f(const cs_matrix_t  *matrix,
+                     bool                exclude_diag,
+                     const cs_real_t     x[restrict],
+                     cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  db_size = matrix->db_size;
+  const cs_lnum_t  db_size_2 = db_size*db_size;
+
+  const cs_lnum_t  *e_col_id = ms->e.col_id;
+  const cs_lnum_t  *e_row_index = ms->e.row_index;
+
+  const float  *restrict d_val_f = (exclude_diag) ? NULL : mc->_d_val_f;
+  const float  *restrict e_val_f = mc->_e_val_f;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+    const cs_lnum_t *restrict col_id = e_col_id + e_row_index[ii];
+    const float *restrict m_row = e_val_f + e_row_index[ii];
+    cs_lnum_t n_cols = e_row_index[ii+1] - e_row_index[ii];
+
+    cs_real_t *restrict _y = y + ii*db_size;
+
+    if (d_val_f != NULL) {
+      const float *restrict _d = d_val_f + ii*db_size_2;
+      const cs_real_t *restrict _x = x + ii*db_size;
+      for (cs_lnum_t kk = 0; kk < db_size; kk++) {
+        _y[kk] = 0.;
+        for (cs_lnum_t ll = 0; ll < db_size; ll++)
+          _y[kk] += (cs_real_t)_d[kk*db_size + ll] * _x[ll];
+      }
+    }
+    else {
+      for (cs_lnum_t kk = 0; kk < db_size; kk++)
+        _y[kk] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < n_cols; jj++) {
+      const cs_real_t a = m_row[jj];
+      for (cs_lnum_t kk = 0; kk < db_size; kk++)
+        _y[kk] += a*x[col_id[jj]*db_size + kk];
+    }
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Matrix.vector product y = A.x with MSR matrix, blocked version.
  *
- * This variant uses fixed block size variants for common cases.
+ * This variant uses fixed block size variants for common cases, and
+ * single-precision coefficients if available (mixed precision).
  *
  * parameters:
  *   matrix       <-- pointer to matrix structure
@@ -2022,7 +2504,19 @@ _b_mat_vec_p_l_msr(const cs_matrix_t  *matrix,
                    cs_real_t           x[restrict],
                    cs_real_t           y[restrict])
 {
-  if (matrix->db_size == 3)
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  /* Mixed-precision case */
+
+  if (mc->_e_val_f != NULL) {
+    cs_halo_state_t *hs
+      = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+    if (hs != NULL)
+      _pre_vector_multiply_sync_x_end(matrix, hs, x);
+    _b_mat_vec_p_l_msr_f(matrix, exclude_diag, x, y);
+  }
+
+  else if (matrix->db_size == 3)
     _b_mat_vec_p_l_msr_3(matrix, exclude_diag, sync, x, y);
 
   else if (matrix->db_size == 6)
@@ -2917,32 +3411,562 @@ _mat_vec_p_l_dist_mkl(const cs_matrix_t  *matrix,
 
 #endif /* defined (HAVE_MKL) */
 
-#if defined(HAVE_ACCEL)
-
 /*----------------------------------------------------------------------------
- * Select the sparse matrix-vector product function to be used on device by a
- * matrix or variant for a given fill type.
- *
- * Currently, possible variant functions are:
- *
- *   CS_MATRIX_NATIVE
- *     default
- *     cuda            (CUDA-accelerated)
- *
- *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
- *     default
- *     cuda            (CUDA-accelerated)
- *     cusparse        (with cuSPARSE)
- *
- *   CS_MATRIX_MSR
- *     default
- *     cuda            (CUDA-accelerated)
- *     cusparse        (with cuSPARSE)
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix.
  *
  * parameters:
- *   m_type      <--  Matrix type
- *   fill type   <--  matrix fill type to merge from
- *   spmv_type   <--  SpMV operation type (full or sub-matrix)
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell(const cs_matrix_t  *matrix,
+                  bool                exclude_diag,
+                  bool                sync,
+                  cs_real_t          *restrict x,
+                  cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  c_size = CS_MATRIX_SELL_CHUNK_SIZE;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_chunks = ms->s_n_chunks;
+
+  const cs_lnum_t  *s_chunk_index = ms->s_chunk_index;
+  const cs_lnum_t  *s_row_id = ms->s_row_id;
+  const cs_lnum_t  *s_col_id = ms->s_col_id;
+  const cs_real_t  *s_val = mc->_s_val;
+
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict c_row_id = s_row_id + c_id*c_size;
+    const cs_lnum_t *restrict c_col_id = s_col_id + s_chunk_index[c_id];
+    const cs_real_t *restrict c_val = s_val + s_chunk_index[c_id];
+    const cs_lnum_t c_width
+      = (s_chunk_index[c_id+1] - s_chunk_index[c_id]) / c_size;
+
+    cs_real_t s[CS_MATRIX_SELL_CHUNK_SIZE];
+
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++)
+      s[r_id] = 0.;
+
+    for (cs_lnum_t jj = 0; jj < c_width; jj++) {
+#     pragma omp simd
+      for (cs_lnum_t r_id = 0; r_id < c_size; r_id++)
+        s[r_id] += c_val[jj*c_size + r_id] * x[c_col_id[jj*c_size + r_id]];
+    }
+
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+      cs_lnum_t ii = c_row_id[r_id];
+      if (ii > -1) {
+        if (d_val != NULL)
+          y[ii] = s[r_id] + d_val[ii]*x[ii];
+        else
+          y[ii] = s[r_id];
+      }
+    }
+
+  }
+}
+
+#if defined(_CS_SELL_AVX2)
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix, using
+ * AVX2 gathers (2 vectors of 4 values per chunk).
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell_avx2(const cs_matrix_t  *matrix,
+                       bool                exclude_diag,
+                       bool                sync,
+                       cs_real_t          *restrict x,
+                       cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_chunks = ms->s_n_chunks;
+
+  const cs_lnum_t  *s_chunk_index = ms->s_chunk_index;
+  const cs_lnum_t  *s_row_id = ms->s_row_id;
+  const cs_lnum_t  *s_col_id = ms->s_col_id;
+  const cs_real_t  *s_val = mc->_s_val;
+
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(CS_MATRIX_SELL_CHUNK_SIZE == 8);
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict c_row_id = s_row_id + c_id*8;
+    const cs_lnum_t *restrict c_col_id = s_col_id + s_chunk_index[c_id];
+    const cs_real_t *restrict c_val = s_val + s_chunk_index[c_id];
+    const cs_lnum_t c_width = (s_chunk_index[c_id+1] - s_chunk_index[c_id]) / 8;
+
+    __m256d s0 = _mm256_setzero_pd();
+    __m256d s1 = _mm256_setzero_pd();
+
+    for (cs_lnum_t jj = 0; jj < c_width; jj++) {
+      __m128i c0 = _mm_loadu_si128((const __m128i *)(c_col_id + jj*8));
+      __m128i c1 = _mm_loadu_si128((const __m128i *)(c_col_id + jj*8 + 4));
+      __m256d x0 = _mm256_i32gather_pd(x, c0, 8);
+      __m256d x1 = _mm256_i32gather_pd(x, c1, 8);
+#if defined(__FMA__)
+      s0 = _mm256_fmadd_pd(_mm256_loadu_pd(c_val + jj*8), x0, s0);
+      s1 = _mm256_fmadd_pd(_mm256_loadu_pd(c_val + jj*8 + 4), x1, s1);
+#else
+      s0 = _mm256_add_pd(s0, _mm256_mul_pd(_mm256_loadu_pd(c_val + jj*8),
+                                           x0));
+      s1 = _mm256_add_pd(s1, _mm256_mul_pd(_mm256_loadu_pd(c_val + jj*8 + 4),
+                                           x1));
+#endif
+    }
+
+    cs_real_t s[8];
+    _mm256_storeu_pd(s, s0);
+    _mm256_storeu_pd(s + 4, s1);
+
+    for (cs_lnum_t r_id = 0; r_id < 8; r_id++) {
+      cs_lnum_t ii = c_row_id[r_id];
+      if (ii > -1) {
+        if (d_val != NULL)
+          y[ii] = s[r_id] + d_val[ii]*x[ii];
+        else
+          y[ii] = s[r_id];
+      }
+    }
+
+  }
+}
+
+#endif /* defined(_CS_SELL_AVX2) */
+
+#if defined(_CS_SELL_AVX512)
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix, using
+ * AVX-512 gathers and scatters (1 vector of 8 values per chunk).
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_mat_vec_p_l_sell_avx512(const cs_matrix_t  *matrix,
+                         bool                exclude_diag,
+                         bool                sync,
+                         cs_real_t          *restrict x,
+                         cs_real_t          *restrict y)
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_chunks = ms->s_n_chunks;
+
+  const cs_lnum_t  *s_chunk_index = ms->s_chunk_index;
+  const cs_lnum_t  *s_row_id = ms->s_row_id;
+  const cs_lnum_t  *s_col_id = ms->s_col_id;
+  const cs_real_t  *s_val = mc->_s_val;
+
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(CS_MATRIX_SELL_CHUNK_SIZE == 8);
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    cs_halo_sync_wait(matrix->halo, x, hs);
+
+  /* Only the last chunk may include padding rows */
+
+  const cs_lnum_t n_full_chunks = n_rows / 8;
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict c_row_id = s_row_id + c_id*8;
+    const cs_lnum_t *restrict c_col_id = s_col_id + s_chunk_index[c_id];
+    const cs_real_t *restrict c_val = s_val + s_chunk_index[c_id];
+    const cs_lnum_t c_width = (s_chunk_index[c_id+1] - s_chunk_index[c_id]) / 8;
+
+    __m512d s0 = _mm512_setzero_pd();
+
+    for (cs_lnum_t jj = 0; jj < c_width; jj++) {
+      __m256i c0 = _mm256_loadu_si256((const __m256i *)(c_col_id + jj*8));
+      __m512d x0 = _mm512_i32gather_pd(c0, x, 8);
+      s0 = _mm512_fmadd_pd(_mm512_loadu_pd(c_val + jj*8), x0, s0);
+    }
+
+    if (c_id < n_full_chunks) {
+      __m256i r0 = _mm256_loadu_si256((const __m256i *)c_row_id);
+      if (d_val != NULL) {
+        __m512d d0 = _mm512_i32gather_pd(r0, d_val, 8);
+        __m512d x0 = _mm512_i32gather_pd(r0, x, 8);
+        s0 = _mm512_fmadd_pd(d0, x0, s0);
+      }
+      _mm512_i32scatter_pd(y, r0, s0, 8);
+    }
+    else {
+      cs_real_t s[8];
+      _mm512_storeu_pd(s, s0);
+      for (cs_lnum_t r_id = 0; r_id < 8; r_id++) {
+        cs_lnum_t ii = c_row_id[r_id];
+        if (ii > -1) {
+          if (d_val != NULL)
+            y[ii] = s[r_id] + d_val[ii]*x[ii];
+          else
+            y[ii] = s[r_id];
+        }
+      }
+    }
+
+  }
+}
+
+#endif /* defined(_CS_SELL_AVX512) */
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix, blocked version.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell_generic(const cs_matrix_t  *matrix,
+                            bool                exclude_diag,
+                            bool                sync,
+                            cs_real_t           x[restrict],
+                            cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  c_size = CS_MATRIX_SELL_CHUNK_SIZE;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_chunks = ms->s_n_chunks;
+  const cs_lnum_t  db_size = matrix->db_size;
+  const cs_lnum_t  db_size_2 = db_size*db_size;
+
+  const cs_lnum_t  *s_chunk_index = ms->s_chunk_index;
+  const cs_lnum_t  *s_row_id = ms->s_row_id;
+  const cs_lnum_t  *s_col_id = ms->s_col_id;
+  const cs_real_t  *s_val = mc->_s_val;
+
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict c_row_id = s_row_id + c_id*c_size;
+    const cs_lnum_t *restrict c_col_id = s_col_id + s_chunk_index[c_id];
+    const cs_real_t *restrict c_val = s_val + s_chunk_index[c_id];
+    const cs_lnum_t c_width
+      = (s_chunk_index[c_id+1] - s_chunk_index[c_id]) / c_size;
+
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+      cs_lnum_t ii = c_row_id[r_id];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_b_ax(ii, db_size, db_size_2, d_val, x, y);
+      else {
+        for (cs_lnum_t kk = 0; kk < db_size; kk++)
+          y[ii*db_size + kk] = 0.;
+      }
+      for (cs_lnum_t jj = 0; jj < c_width; jj++) {
+        const cs_real_t a = c_val[jj*c_size + r_id];
+        const cs_lnum_t c_j = c_col_id[jj*c_size + r_id];
+        for (cs_lnum_t kk = 0; kk < db_size; kk++)
+          y[ii*db_size + kk] += a*x[c_j*db_size + kk];
+      }
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix, 3x3 blocked
+ * version.
+ *
+ * Extra-diagonal contributions are accumulated for all rows of a chunk
+ * at once, so that the inner loop on chunk rows may be vectorized.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell_3(const cs_matrix_t  *matrix,
+                      bool                exclude_diag,
+                      bool                sync,
+                      cs_real_t           x[restrict],
+                      cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  c_size = CS_MATRIX_SELL_CHUNK_SIZE;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_chunks = ms->s_n_chunks;
+
+  const cs_lnum_t  *s_chunk_index = ms->s_chunk_index;
+  const cs_lnum_t  *s_row_id = ms->s_row_id;
+  const cs_lnum_t  *s_col_id = ms->s_col_id;
+  const cs_real_t  *s_val = mc->_s_val;
+
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(matrix->db_size == 3);
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict c_row_id = s_row_id + c_id*c_size;
+    const cs_lnum_t *restrict c_col_id = s_col_id + s_chunk_index[c_id];
+    const cs_real_t *restrict c_val = s_val + s_chunk_index[c_id];
+    const cs_lnum_t c_width
+      = (s_chunk_index[c_id+1] - s_chunk_index[c_id]) / c_size;
+
+    cs_real_t s[3][CS_MATRIX_SELL_CHUNK_SIZE];
+
+    for (cs_lnum_t kk = 0; kk < 3; kk++) {
+      for (cs_lnum_t r_id = 0; r_id < c_size; r_id++)
+        s[kk][r_id] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < c_width; jj++) {
+#     pragma omp simd
+      for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+        const cs_real_t a = c_val[jj*c_size + r_id];
+        const cs_lnum_t c_j = c_col_id[jj*c_size + r_id];
+        s[0][r_id] += a*x[c_j*3];
+        s[1][r_id] += a*x[c_j*3 + 1];
+        s[2][r_id] += a*x[c_j*3 + 2];
+      }
+    }
+
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+      cs_lnum_t ii = c_row_id[r_id];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_3_3_ax(ii, d_val, x, y);
+      else {
+        for (cs_lnum_t kk = 0; kk < 3; kk++)
+          y[ii*3 + kk] = 0.;
+      }
+      for (cs_lnum_t kk = 0; kk < 3; kk++)
+        y[ii*3 + kk] += s[kk][r_id];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix, 6x6 blocked
+ * version.
+ *
+ * Extra-diagonal contributions are accumulated for all rows of a chunk
+ * at once, so that the inner loop on chunk rows may be vectorized.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell_6(const cs_matrix_t  *matrix,
+                      bool                exclude_diag,
+                      bool                sync,
+                      cs_real_t           x[restrict],
+                      cs_real_t           y[restrict])
+{
+  const cs_matrix_struct_dist_t  *ms = matrix->structure;
+  const cs_matrix_coeff_dist_t  *mc = matrix->coeffs;
+
+  const cs_lnum_t  c_size = CS_MATRIX_SELL_CHUNK_SIZE;
+  const cs_lnum_t  n_rows = ms->n_rows;
+  const cs_lnum_t  n_chunks = ms->s_n_chunks;
+
+  const cs_lnum_t  *s_chunk_index = ms->s_chunk_index;
+  const cs_lnum_t  *s_row_id = ms->s_row_id;
+  const cs_lnum_t  *s_col_id = ms->s_col_id;
+  const cs_real_t  *s_val = mc->_s_val;
+
+  const cs_real_t  *restrict d_val = (exclude_diag) ? NULL : mc->d_val;
+
+  assert(matrix->db_size == 6);
+
+  /* Ghost cell communication */
+
+  cs_halo_state_t *hs
+    = (sync) ? _pre_vector_multiply_sync_x_start(matrix, x) : NULL;
+  if (hs != NULL)
+    _pre_vector_multiply_sync_x_end(matrix, hs, x);
+
+# pragma omp parallel for  if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t c_id = 0; c_id < n_chunks; c_id++) {
+
+    const cs_lnum_t *restrict c_row_id = s_row_id + c_id*c_size;
+    const cs_lnum_t *restrict c_col_id = s_col_id + s_chunk_index[c_id];
+    const cs_real_t *restrict c_val = s_val + s_chunk_index[c_id];
+    const cs_lnum_t c_width
+      = (s_chunk_index[c_id+1] - s_chunk_index[c_id]) / c_size;
+
+    cs_real_t s[6][CS_MATRIX_SELL_CHUNK_SIZE];
+
+    for (cs_lnum_t kk = 0; kk < 6; kk++) {
+      for (cs_lnum_t r_id = 0; r_id < c_size; r_id++)
+        s[kk][r_id] = 0.;
+    }
+
+    for (cs_lnum_t jj = 0; jj < c_width; jj++) {
+#     pragma omp simd
+      for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+        const cs_real_t a = c_val[jj*c_size + r_id];
+        const cs_lnum_t c_j = c_col_id[jj*c_size + r_id];
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          s[kk][r_id] += a*x[c_j*6 + kk];
+      }
+    }
+
+    for (cs_lnum_t r_id = 0; r_id < c_size; r_id++) {
+      cs_lnum_t ii = c_row_id[r_id];
+      if (ii < 0)
+        continue;
+      if (d_val != NULL)
+        _dense_6_6_ax(ii, d_val, x, y);
+      else {
+        for (cs_lnum_t kk = 0; kk < 6; kk++)
+          y[ii*6 + kk] = 0.;
+      }
+      for (cs_lnum_t kk = 0; kk < 6; kk++)
+        y[ii*6 + kk] += s[kk][r_id];
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Matrix.vector product y = A.x with SELL-C-sigma matrix, blocked version.
+ *
+ * This variant uses fixed block size variants for common cases.
+ *
+ * parameters:
+ *   matrix       <-- pointer to matrix structure
+ *   exclude_diag <-- exclude diagonal if true,
+ *   sync         <-- synchronize ghost cells if true
+ *   x            <-> multipliying vector values
+ *   y            --> resulting vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_b_mat_vec_p_l_sell(const cs_matrix_t  *matrix,
+                    bool                exclude_diag,
+                    bool                sync,
+                    cs_real_t           x[restrict],
+                    cs_real_t           y[restrict])
+{
+  if (matrix->db_size == 3)
+    _b_mat_vec_p_l_sell_3(matrix, exclude_diag, sync, x, y);
+
+  else if (matrix->db_size == 6)
+    _b_mat_vec_p_l_sell_6(matrix, exclude_diag, sync, x, y);
+
+  else
+    _b_mat_vec_p_l_sell_generic(matrix, exclude_diag, sync, x, y);
+}
+
+#if defined(HAVE_ACCEL)
+
+/*----------------------------------------------------------------------------
+ * Select the sparse matrix-vector product function to be used on device by a
+ * matrix or variant for a given fill type.
+ *
+ * Currently, possible variant functions are:
+ *
+ *   CS_MATRIX_NATIVE
+ *     default
+ *     cuda            (CUDA-accelerated)
+ *
+ *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     default
+ *     cuda            (CUDA-accelerated)
+ *     cusparse        (with cuSPARSE)
+ *
+ *   CS_MATRIX_MSR
+ *     default
+ *     cuda            (CUDA-accelerated)
+ *     cusparse        (with cuSPARSE)
+ *
+ * parameters:
+ *   m_type      <--  Matrix type
+ *   fill type   <--  matrix fill type to merge from
+ *   spmv_type   <--  SpMV operation type (full or sub-matrix)
  *                    (all types if CS_MATRIX_SPMV_N_TYPES)
  *   numbering   <--  mesh numbering structure, or NULL
  *   func_name   <--  function type name, or NULL for default
@@ -3072,6 +4096,8 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m)
  *     omp             (for OpenMP with compatible numbering)
  *     omp_atomic      (for OpenMP with atomic add)
  *     vector          (For vector machine with compatible numbering)
+ *     structured      (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM,
+ *                      with a structured stencil layout)
  *     cuda            (CUDA-accelerated)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
@@ -3092,6 +4118,13 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m)
  *     omp_sched       (Improved OpenMP scheduling, for CS_MATRIX_SCALAR*)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL
+ *     default         (uses best SIMD variant available for CS_MATRIX_SCALAR*)
+ *     baseline
+ *     avx2            (with AVX2, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     avx512          (with AVX-512, for CS_MATRIX_SCALAR or
+ *                      CS_MATRIX_SCALAR_SYM)
+ *
  * parameters:
  *   m_type      <--  Matrix type
  *   fill type   <--  matrix fill type to merge from
@@ -3256,6 +4289,18 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
       }
     }
 
+    else if (!strcmp(func_name, "structured")) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_native_structured;
+        _spmv[1] = _mat_vec_p_l_native_structured;
+        break;
+      default:
+        break;
+      }
+    }
+
     else if (!strcmp(func_name, "cuda")) {
 #if defined(HAVE_CUDA)
       switch(fill_type) {
@@ -3499,6 +4544,72 @@ cs_matrix_spmv_set_func(cs_matrix_type_t             m_type,
 
     break;
 
+  /* SELL-C-sigma
+     ------------ */
+
+  case CS_MATRIX_SELL:
+
+    if (standard > 0) {
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_sell;
+        _spmv[1] = _mat_vec_p_l_sell;
+        if (standard > 1) {
+#if defined(_CS_SELL_AVX512)
+          _spmv[0] = _mat_vec_p_l_sell_avx512;
+          _spmv[1] = _mat_vec_p_l_sell_avx512;
+#elif defined(_CS_SELL_AVX2)
+          _spmv[0] = _mat_vec_p_l_sell_avx2;
+          _spmv[1] = _mat_vec_p_l_sell_avx2;
+#endif
+        }
+        break;
+      case CS_MATRIX_BLOCK_D:
+      case CS_MATRIX_BLOCK_D_66:
+      case CS_MATRIX_BLOCK_D_SYM:
+        _spmv[0] = _b_mat_vec_p_l_sell;
+        _spmv[1] = _b_mat_vec_p_l_sell;
+        break;
+      default:
+        break;
+      }
+    }
+
+    else if (!strcmp(func_name, "avx2")) {
+#if defined(_CS_SELL_AVX2)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_sell_avx2;
+        _spmv[1] = _mat_vec_p_l_sell_avx2;
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    else if (!strcmp(func_name, "avx512")) {
+#if defined(_CS_SELL_AVX512)
+      switch(fill_type) {
+      case CS_MATRIX_SCALAR:
+      case CS_MATRIX_SCALAR_SYM:
+        _spmv[0] = _mat_vec_p_l_sell_avx512;
+        _spmv[1] = _mat_vec_p_l_sell_avx512;
+        break;
+      default:
+        break;
+      }
+#else
+      retcode = 2;
+#endif
+    }
+
+    break;
+
   default:
     break;
   }
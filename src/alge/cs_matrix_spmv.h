@@ -80,6 +80,8 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m);
  *     omp             (for OpenMP with compatible numbering)
  *     omp_atomic      (for OpenMP with atomic add)
  *     vector          (For vector machine with compatible numbering)
+ *     structured      (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM,
+ *                      with a structured stencil layout)
  *     cuda            (CUDA-accelerated)
  *
  *   CS_MATRIX_CSR     (for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
@@ -100,6 +102,13 @@ cs_matrix_spmv_set_defaults(cs_matrix_t  *m);
  *     omp_sched       (Improved OpenMP scheduling, for CS_MATRIX_SCALAR*)
  *     mkl             (with MKL, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
  *
+ *   CS_MATRIX_SELL
+ *     default         (uses best SIMD variant available for CS_MATRIX_SCALAR*)
+ *     baseline
+ *     avx2            (with AVX2, for CS_MATRIX_SCALAR or CS_MATRIX_SCALAR_SYM)
+ *     avx512          (with AVX-512, for CS_MATRIX_SCALAR or
+ *                      CS_MATRIX_SCALAR_SYM)
+ *
  * parameters:
  *   m_type      <--  Matrix type
  *   fill type   <--  matrix fill type to merge from
@@ -161,6 +161,8 @@ typedef struct _cs_multigrid_info_t {
 
   unsigned             n_calls[2];          /* Number of times grids built
                                                (0) or solved (1) */
+  unsigned             n_reuse;             /* Number of grid builds reusing
+                                               the previous coarse grids */
 
   unsigned long long   n_levels_tot;        /* Total accumulated number of
                                                grid levels built */
@@ -279,6 +281,16 @@ struct _cs_multigrid_t {
   double     p0p1_relax;         /* p0/p1 relaxation_parameter */
   double     k_cycle_threshold;  /* threshold for k cycle */
 
+  bool       mixed_precision;    /* use single-precision coefficients for
+                                    coarse level matrices */
+
+  int        setup_reuse_max;    /* maximum number of successive setups
+                                    reusing the coarse grid hierarchy
+                                    (0: full rebuild at each setup) */
+  double     setup_reuse_ratio;  /* force full rebuild when the number of
+                                    cycles exceeds this multiple of the
+                                    number obtained after the last build */
+
   /* Setting for use as a preconditioner */
 
   double     pc_precision;       /* preconditioner precision */
@@ -329,6 +341,26 @@ struct _cs_multigrid_t {
 
   cs_multigrid_setup_data_t  *setup_data;   /* setup data */
 
+  /* Coarse grid hierarchy kept between solves for setup reuse */
+
+  unsigned                    n_reuse_levels;   /* number of kept grids */
+  cs_grid_t                 **reuse_grids;      /* kept coarse grids */
+  cs_lnum_t                   reuse_n_rows;     /* fine matrix rows */
+  cs_lnum_t                   reuse_n_cols;     /* fine matrix columns */
+  const cs_lnum_t            *reuse_row_index;  /* fine MSR row index */
+  const cs_lnum_t            *reuse_col_id;     /* fine MSR column ids */
+  unsigned long               reuse_generation; /* fine matrix structure
+                                                   generation stamp */
+  int                         n_setup_reuse;    /* current number of
+                                                   successive reuses */
+  unsigned                    n_cycles_ref;     /* number of cycles after
+                                                   last full build */
+  unsigned                    n_pc_apply;       /* number of preconditioner
+                                                   applications (outer
+                                                   iterations) since setup */
+  bool                        reuse_rebuild;    /* force full rebuild at
+                                                   next setup */
+
   cs_time_plot_t             *cycle_plot;       /* plotting of cycles */
   int                         plot_time_stamp;  /* plotting time stamp;
                                                    if < 0, use wall clock */
@@ -410,6 +442,7 @@ _multigrid_info_init(cs_multigrid_info_t *info)
 
   for (i = 0; i < 2; i++)
     info->n_calls[i] = 0;
+  info->n_reuse = 0;
 
   info->n_levels_tot = 0;
 
@@ -475,6 +508,17 @@ _multigrid_setup_log(const cs_multigrid_t *mg)
                 mg->n_levels_max, (unsigned long long)(mg->n_g_rows_min),
                 mg->p0p1_relax, mg->info.n_max_cycles);
 
+  if (mg->mixed_precision)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse matrix coefficients:        single precision\n"));
+
+  if (mg->setup_reuse_max > 0)
+    cs_log_printf(CS_LOG_SETUP,
+                  _("  Coarse grids setup reuse:\n"
+                    "    Maximum successive reuses:       %d\n"
+                    "    Cycles ratio for rebuild:        %g\n"),
+                  mg->setup_reuse_max, mg->setup_reuse_ratio);
+
 #if defined(HAVE_MPI)
   if (cs_glob_n_ranks > 1)
     cs_log_printf(CS_LOG_SETUP,
@@ -575,6 +619,11 @@ _multigrid_performance_log(const cs_multigrid_t *mg)
                 _(cs_multigrid_type_name[mg->type]),
                 _(cs_grid_coarsening_type_name[mg->coarsening_type]));
 
+  if (mg->info.n_reuse > 0)
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  _("    Setups reusing coarse grids: %u of %u\n"),
+                  mg->info.n_reuse, mg->info.n_calls[0]);
+
   if (   mg->info.type[0] != CS_SLES_N_IT_TYPES
       && mg->info.type[0] < CS_SLES_N_SMOOTHER_TYPES) {
 
@@ -1195,9 +1244,24 @@ _multigrid_pc_setup(void               *context,
 {
   CS_UNUSED(accel);
 
+  cs_multigrid_t  *mg = context;
+
+  /* Setup reuse policy: when used as a preconditioner, each solve is a
+     single cycle, so compare the number of outer (Krylov) iterations
+     of the previous resolution, i.e. the number of preconditioner
+     applications since the last setup, to that after the last build */
+
+  if (mg->setup_reuse_max > 0 && mg->n_pc_apply > 0) {
+    if (mg->n_setup_reuse == 0)
+      mg->n_cycles_ref = mg->n_pc_apply;
+    else if (  mg->n_pc_apply
+             > mg->setup_reuse_ratio * CS_MAX(mg->n_cycles_ref, 1))
+      mg->reuse_rebuild = true;
+  }
+  mg->n_pc_apply = 0;
+
   cs_multigrid_setup(context, name, a, verbosity);
 
-  cs_multigrid_t  *mg = context;
   cs_multigrid_setup_data_t *mgd = mg->setup_data;
 
   BFT_REALLOC(mgd->pc_name, strlen(name) + 1, char);
@@ -2028,6 +2092,202 @@ _multigrid_setup_sles(cs_multigrid_t  *mg,
   cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
 }
 
+/*----------------------------------------------------------------------------
+ * Destroy coarse grids kept for setup reuse, if present.
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid solver info and context
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_reuse_free(cs_multigrid_t  *mg)
+{
+  for (int i = mg->n_reuse_levels - 1; i > -1; i--)
+    cs_grid_destroy(mg->reuse_grids + i);
+  BFT_FREE(mg->reuse_grids);
+
+  mg->n_reuse_levels = 0;
+  mg->reuse_row_index = NULL;
+  mg->reuse_col_id = NULL;
+  mg->reuse_generation = 0;
+}
+
+/*----------------------------------------------------------------------------
+ * Keep coarse grids of current hierarchy for reuse by the next setup,
+ * if this is allowed by the reuse settings and policy.
+ *
+ * Kept grids are removed from the current hierarchy.
+ *
+ * parameters:
+ *   mg <-> pointer to multigrid solver info and context
+ *----------------------------------------------------------------------------*/
+
+static void
+_multigrid_reuse_keep(cs_multigrid_t  *mg)
+{
+  cs_multigrid_setup_data_t *mgd = mg->setup_data;
+
+  if (   mg->setup_reuse_max < 1
+      || mg->reuse_rebuild
+      || mg->n_setup_reuse >= mg->setup_reuse_max
+      || mg->subtype != CS_MULTIGRID_MAIN
+      || mgd->n_levels < 2
+      || mg->reuse_grids != NULL)
+    return;
+
+  for (int i = 0; i < 3; i++) {
+    if (mg->lv_mg[i] != NULL)
+      return;
+  }
+
+  /* Fine matrix structure must be checked at next setup */
+
+  const cs_matrix_t *a = cs_grid_get_matrix(mgd->grid_hierarchy[0]);
+  cs_matrix_type_t a_type = cs_matrix_get_type(a);
+
+  if (a_type != CS_MATRIX_MSR && a_type != CS_MATRIX_SELL)
+    return;
+
+  mg->reuse_n_rows = cs_matrix_get_n_rows(a);
+  mg->reuse_n_cols = cs_matrix_get_n_columns(a);
+  cs_matrix_get_msr_arrays(a,
+                           &(mg->reuse_row_index),
+                           &(mg->reuse_col_id),
+                           NULL,
+                           NULL);
+  mg->reuse_generation = cs_matrix_get_structure_generation(a);
+
+  mg->n_reuse_levels = mgd->n_levels - 1;
+  BFT_MALLOC(mg->reuse_grids, mg->n_reuse_levels, cs_grid_t *);
+
+  for (unsigned i = 1; i < mgd->n_levels; i++) {
+    mg->reuse_grids[i-1] = mgd->grid_hierarchy[i];
+    mgd->grid_hierarchy[i] = NULL;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild coarse levels of a grid hierarchy from grids kept from the
+ * previous setup, updating only coarse matrix coefficients.
+ *
+ * If some kept grids cannot be updated, the hierarchy is truncated
+ * to the last updated level, and the remaining kept grids destroyed.
+ *
+ * parameters:
+ *   mg        <-> pointer to multigrid solver info and context
+ *   g         <-> finest grid on input, coarsest reused grid on output
+ *   verbosity <-- associated verbosity
+ *
+ * returns:
+ *   true if all kept levels were reused, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_multigrid_reuse_hierarchy(cs_multigrid_t   *mg,
+                           cs_grid_t       **g,
+                           int               verbosity)
+{
+  cs_grid_t *f = *g;
+
+  /* Check reuse policy and that fine matrix structure is unchanged */
+
+  int reuse = 1;
+
+  if (mg->reuse_rebuild || mg->n_setup_reuse >= mg->setup_reuse_max)
+    reuse = 0;
+  else {
+    const cs_matrix_t *a = cs_grid_get_matrix(f);
+    cs_matrix_type_t a_type = cs_matrix_get_type(a);
+    if (a_type != CS_MATRIX_MSR && a_type != CS_MATRIX_SELL)
+      reuse = 0;
+    else {
+      const cs_lnum_t *row_index, *col_id;
+      cs_matrix_get_msr_arrays(a, &row_index, &col_id, NULL, NULL);
+      if (   cs_matrix_get_structure_generation(a) != mg->reuse_generation
+          || cs_matrix_get_n_rows(a) != mg->reuse_n_rows
+          || cs_matrix_get_n_columns(a) != mg->reuse_n_cols
+          || row_index != mg->reuse_row_index
+          || col_id != mg->reuse_col_id)
+        reuse = 0;
+    }
+  }
+
+#if defined(HAVE_MPI)
+  if (mg->caller_n_ranks > 1) {
+    int _reuse = reuse;
+    MPI_Allreduce(&_reuse, &reuse, 1, MPI_INT, MPI_MIN, mg->caller_comm);
+  }
+#endif
+
+  unsigned n_reused = 0;
+
+  if (reuse) {
+
+    cs_timer_t t0 = cs_timer_time();
+
+    for (n_reused = 0; n_reused < mg->n_reuse_levels; n_reused++) {
+
+      cs_grid_t *c = mg->reuse_grids[n_reused];
+
+      if (cs_grid_update_from_parent(f, c) == false)
+        break;
+
+      mg->reuse_grids[n_reused] = NULL;
+      _multigrid_add_level(mg, c);
+
+      int grid_lv, n_ranks;
+      cs_lnum_t n_rows, n_cols_ext, n_entries;
+
+      cs_grid_get_info(c,
+                       &grid_lv,
+                       NULL,
+                       NULL,
+                       NULL,
+                       &n_ranks,
+                       &n_rows,
+                       &n_cols_ext,
+                       &n_entries,
+                       NULL);
+
+      cs_multigrid_level_info_t *mg_lv_info = mg->lv_info + grid_lv;
+      mg_lv_info->n_ranks[0] = n_ranks;
+      mg_lv_info->n_elts[0][0] = n_rows;
+      mg_lv_info->n_elts[1][0] = n_cols_ext;
+      mg_lv_info->n_elts[2][0] = n_entries;
+
+      cs_timer_t t1 = cs_timer_time();
+      cs_timer_counter_add_diff(&(mg_lv_info->t_tot[0]), &t0, &t1);
+      t0 = t1;
+
+      f = c;
+
+    }
+
+  }
+
+  bool complete = (reuse && n_reused == mg->n_reuse_levels);
+
+  if (verbosity > 1)
+    bft_printf(_("   reused %u of %u coarse grid levels\n"),
+               n_reused, mg->n_reuse_levels);
+
+  _multigrid_reuse_free(mg);
+
+  if (n_reused > 0) {
+    mg->n_setup_reuse += 1;
+    mg->info.n_reuse += 1;
+  }
+  else {
+    mg->n_setup_reuse = 0;
+    mg->n_cycles_ref = 0;
+  }
+  mg->reuse_rebuild = false;
+
+  *g = f;
+
+  return complete;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Setup multigrid sparse linear equation solver.
@@ -2089,6 +2349,31 @@ _setup_hierarchy(void             *context,
 
   bool add_grid = true;
 
+  /* Reuse coarse grids from previous setup if possible, so as to only
+     update coarse matrix coefficients; coarsening then only continues
+     if not all levels could be reused. */
+
+  if (mg->reuse_grids != NULL) {
+    add_grid = ! _multigrid_reuse_hierarchy(mg, &g, verbosity);
+    if (g != f)
+      cs_grid_get_info(g,
+                       NULL,
+                       NULL,
+                       NULL,
+                       NULL,
+                       &n_coarse_ranks,
+                       &n_rows,
+                       &n_cols_ext,
+                       &n_entries,
+                       &n_g_rows);
+    t1 = cs_timer_time();
+  }
+  else {
+    mg->n_setup_reuse = 0;
+    mg->n_cycles_ref = 0;
+    mg->reuse_rebuild = false;
+  }
+
   while (add_grid) {
 
     n_g_rows_prev = n_g_rows;
@@ -2153,6 +2438,9 @@ _setup_hierarchy(void             *context,
 
     if (add_grid) {
 
+      if (mg->mixed_precision)
+        cs_grid_set_matrix_mixed_precision(g, true);
+
       _multigrid_add_level(mg, g); /* Assign to hierarchy */
 
       /* Print coarse mesh stats */
@@ -3795,6 +4083,10 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->p0p1_relax = 0.;
   mg->k_cycle_threshold = 0;
+  mg->mixed_precision = false;
+
+  mg->setup_reuse_max = 0;
+  mg->setup_reuse_ratio = 1.5;
 
   _multigrid_info_init(&(mg->info));
   for (int i = 0; i < 3; i++)
@@ -3826,6 +4118,18 @@ cs_multigrid_create(cs_multigrid_type_t  mg_type)
 
   mg->setup_data = NULL;
 
+  mg->n_reuse_levels = 0;
+  mg->reuse_grids = NULL;
+  mg->reuse_n_rows = 0;
+  mg->reuse_n_cols = 0;
+  mg->reuse_row_index = NULL;
+  mg->reuse_col_id = NULL;
+  mg->reuse_generation = 0;
+  mg->n_setup_reuse = 0;
+  mg->n_cycles_ref = 0;
+  mg->n_pc_apply = 0;
+  mg->reuse_rebuild = false;
+
   BFT_MALLOC(mg->lv_info, mg->n_levels_max, cs_multigrid_level_info_t);
 
   for (ii = 0; ii < mg->n_levels_max; ii++)
@@ -3883,6 +4187,8 @@ cs_multigrid_destroy(void  **context)
   if (mg == NULL)
     return;
 
+  _multigrid_reuse_free(mg);
+
   BFT_FREE(mg->lv_info);
 
   if (mg->post_row_num != NULL) {
@@ -4012,6 +4318,8 @@ cs_multigrid_set_coarsening_options(cs_multigrid_t  *mg,
   mg->post_row_max = postprocess;
 
   mg->p0p1_relax = p0p1_relax;
+
+  _multigrid_reuse_free(mg);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -4089,6 +4397,7 @@ cs_multigrid_set_solver_options(cs_multigrid_t     *mg,
     case CS_SLES_JACOBI:
     case CS_SLES_P_GAUSS_SEIDEL:
     case CS_SLES_P_SYM_GAUSS_SEIDEL:
+    case CS_SLES_CHEBYSHEV:
       info->poly_degree[i] = -1;
       break;
     default:
@@ -4118,6 +4427,71 @@ cs_multigrid_set_max_cycles(cs_multigrid_t     *mg,
   info->n_max_cycles = n_max_cycles;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether coarse level matrices of a multigrid should use
+ *        single-precision coefficients.
+ *
+ * With this option, smoothers and coarse solvers on coarse levels use
+ * single-precision copies of matrix coefficients (see
+ * \ref cs_matrix_set_mixed_precision), while vectors and accumulations
+ * remain in double precision. The fine level uses the setting of the
+ * matrix passed to the solver.
+ *
+ * \param[in, out]  mg     pointer to multigrid info and context
+ * \param[in]       mixed  true to use single-precision coefficients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_mixed_precision(cs_multigrid_t  *mg,
+                                 bool             mixed)
+{
+  if (mg == NULL)
+    return;
+
+  mg->mixed_precision = mixed;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid setup reuse options.
+ *
+ * When active, the coarse grid hierarchy (aggregation and coarse matrix
+ * structures) is kept between solves, and the next setup only recomputes
+ * coarse matrix coefficients (Galerkin products), as long as the fine
+ * matrix structure is unchanged. This applies to coarse levels built by
+ * aggregation of MSR matrices without P0/P1 relaxation (such as with the
+ * default K-cycle settings); other levels are rebuilt.
+ *
+ * A full rebuild is forced after \p n_max_reuse successive reuses, or when
+ * the number of cycles for a solve exceeds \p rebuild_ratio times that
+ * obtained after the last full rebuild (or the solve does not converge).
+ * When multigrid is used as a preconditioner, the number of outer solver
+ * iterations (i.e. preconditioner applications) is compared instead.
+ *
+ * \param[in, out]  mg             pointer to multigrid info and context
+ * \param[in]       n_max_reuse    maximum number of successive setups
+ *                                 reusing coarse grids (0 to deactivate)
+ * \param[in]       rebuild_ratio  cycles ratio triggering a full rebuild
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_setup_reuse(cs_multigrid_t  *mg,
+                             int              n_max_reuse,
+                             double           rebuild_ratio)
+{
+  if (mg == NULL)
+    return;
+
+  mg->setup_reuse_max = n_max_reuse;
+  mg->setup_reuse_ratio = rebuild_ratio;
+
+  if (n_max_reuse < 1)
+    _multigrid_reuse_free(mg);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return solver type used on fine mesh.
@@ -4195,6 +4569,11 @@ cs_multigrid_setup_conv_diff(void               *context,
   if (mg->setup_data != NULL)
     cs_multigrid_free(mg);
 
+  /* Coarse grids may be reused only with pure Galerkin coarsening */
+
+  if (conv_diff)
+    _multigrid_reuse_free(mg);
+
   /* Initialization */
 
   cs_timer_t t0 = cs_timer_time();
@@ -4405,6 +4784,24 @@ cs_multigrid_solve(void                *context,
     mg_info->n_cycles[1] = n_cycles;
   }
 
+  /* Setup reuse policy: force a full rebuild at the next setup
+     if convergence degrades relative to that after the last build
+     (in preconditioner mode, the number of outer iterations is
+     checked at the next setup, see _multigrid_pc_setup) */
+
+  if (mg->setup_reuse_max > 0) {
+    if (mg_info->is_pc) {
+      mg->n_pc_apply += 1;
+      if (cvg < CS_SLES_MAX_ITERATION)
+        mg->reuse_rebuild = true;
+    }
+    else if (mg->n_setup_reuse == 0)
+      mg->n_cycles_ref = n_cycles;
+    else if (   cvg < CS_SLES_ITERATING
+             || n_cycles > mg->setup_reuse_ratio * CS_MAX(mg->n_cycles_ref, 1))
+      mg->reuse_rebuild = true;
+  }
+
   /* Update number of resolutions and timing data */
 
   mg_info->n_calls[1] += 1;
@@ -4464,6 +4861,10 @@ cs_multigrid_free(void  *context)
     }
     BFT_FREE(mgd->sles_hierarchy);
 
+    /* Keep coarse grids for next setup if reuse is active */
+
+    _multigrid_reuse_keep(mg);
+
     /* Destroy grid hierarchy */
 
     for (int i = mgd->n_levels - 1; i > -1; i--)
@@ -243,6 +243,53 @@ void
 cs_multigrid_set_max_cycles(cs_multigrid_t     *mg,
                             int                 n_max_cycles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether coarse level matrices of a multigrid should use
+ *        single-precision coefficients.
+ *
+ * With this option, smoothers and coarse solvers on coarse levels use
+ * single-precision copies of matrix coefficients (see
+ * \ref cs_matrix_set_mixed_precision), while vectors and accumulations
+ * remain in double precision. The fine level uses the setting of the
+ * matrix passed to the solver.
+ *
+ * \param[in, out]  mg     pointer to multigrid info and context
+ * \param[in]       mixed  true to use single-precision coefficients
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_mixed_precision(cs_multigrid_t  *mg,
+                                 bool             mixed);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set multigrid setup reuse options.
+ *
+ * When active, the coarse grid hierarchy (aggregation and coarse matrix
+ * structures) is kept between solves, and the next setup only recomputes
+ * coarse matrix coefficients (Galerkin products), as long as the fine
+ * matrix structure is unchanged. This applies to coarse levels built by
+ * aggregation of MSR matrices without P0/P1 relaxation (such as with the
+ * default K-cycle settings); other levels are rebuilt.
+ *
+ * A full rebuild is forced after \p n_max_reuse successive reuses, or when
+ * the number of cycles for a solve exceeds \p rebuild_ratio times that
+ * obtained after the last full rebuild (or the solve does not converge).
+ *
+ * \param[in, out]  mg             pointer to multigrid info and context
+ * \param[in]       n_max_reuse    maximum number of successive setups
+ *                                 reusing coarse grids (0 to deactivate)
+ * \param[in]       rebuild_ratio  cycles ratio triggering a full rebuild
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_multigrid_set_setup_reuse(cs_multigrid_t  *mg,
+                             int              n_max_reuse,
+                             double           rebuild_ratio);
+
 /*----------------------------------------------------------------------------
  * Return solver type used on fine mesh.
  *
@@ -101,6 +101,11 @@ static int _thread_debug = 0;
 
 static cs_lnum_t _pcg_sr_threshold = 512;
 
+/* Number of power iterations used to estimate the largest eigenvalue
+   for Chebyshev smoothing */
+
+static int _chebyshev_n_power_iter = 10;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -1017,6 +1022,243 @@ _block_jacobi(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+/*----------------------------------------------------------------------------
+ * Apply (possibly block) diagonal inverse: y <- scale.D^-1.x
+ *
+ * parameters:
+ *   db_size  <-- diagonal block size
+ *   n_blocks <-- number of diagonal blocks
+ *   ad_inv   <-- inverse (or LU factorization) of diagonal blocks
+ *   scale    <-- scaling factor
+ *   x        <-- input vector
+ *   y        --> output vector
+ *----------------------------------------------------------------------------*/
+
+static void
+_diag_inv_apply(cs_lnum_t                   db_size,
+                cs_lnum_t                   n_blocks,
+                const cs_real_t  *restrict  ad_inv,
+                cs_real_t                   scale,
+                const cs_real_t  *restrict  x,
+                cs_real_t        *restrict  y)
+{
+  if (db_size == 1) {
+#   pragma omp parallel for if(n_blocks > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_blocks; ii++)
+      y[ii] = scale * ad_inv[ii] * x[ii];
+  }
+  else {
+    const cs_lnum_t db_size_2 = db_size * db_size;
+    const cs_real_t zero[DB_SIZE_MAX] = {0};
+
+#   pragma omp parallel for if(n_blocks > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_blocks; ii++) {
+      cs_real_t *_y = y + db_size*ii;
+      _fw_and_bw_lu(ad_inv + db_size_2*ii, db_size, _y, zero, x + db_size*ii);
+      for (cs_lnum_t kk = 0; kk < db_size; kk++)
+        _y[kk] *= scale;
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate spectral bounds of D^-1.A for the Chebyshev smoother.
+ *
+ * The largest eigenvalue is estimated using a few power iterations
+ * starting from a deterministic pseudo-random vector; the bounds used
+ * for smoothing are then [0.1, 1.1] times that estimate, so as to target
+ * the upper part of the spectrum, left to the coarser grid corrections.
+ *
+ * parameters:
+ *   c               <-> pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *----------------------------------------------------------------------------*/
+
+static void
+_chebyshev_setup_bounds(cs_sles_it_t       *c,
+                        const cs_matrix_t  *a,
+                        cs_lnum_t           diag_block_size)
+{
+  cs_sles_it_setup_t *sd = c->setup_data;
+
+  /* Reuse bounds from shared context if available */
+
+  if (c->shared != NULL) {
+    const cs_sles_it_setup_t *s_sd = c->shared->setup_data;
+    if (   c->shared->type == CS_SLES_CHEBYSHEV
+        && s_sd != NULL && s_sd->eig_max > 0) {
+      sd->eig_min = s_sd->eig_min;
+      sd->eig_max = s_sd->eig_max;
+      return;
+    }
+  }
+
+  const cs_lnum_t n_rows = sd->n_rows;
+  const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+  const cs_lnum_t n_blocks = n_rows / diag_block_size;
+  const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+  cs_real_t *vk, *wk;
+  BFT_MALLOC(vk, wa_size*2, cs_real_t);
+  wk = vk + wa_size;
+
+  /* Initial vector: deterministic hash-based values in [0.5, 1.5[, so as
+     to have components on the whole spectrum. */
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+    uint32_t h = (uint32_t)ii * 2654435761u;
+    h ^= h >> 15;
+    vk[ii] = 0.5 + (double)(h % 65536) / 65536.;
+  }
+
+  double v_norm = sqrt(_dot_product_xx(c, vk));
+  double eig_max = 0;
+
+  for (int k = 0; k < _chebyshev_n_power_iter && v_norm > 0; k++) {
+
+    /* vk <- D^-1.A.vk / ||vk||, so ||vk|| converges to the estimate */
+
+    cs_matrix_vector_multiply(a, vk, wk);
+    _diag_inv_apply(diag_block_size, n_blocks, sd->ad_inv, 1./v_norm, wk, vk);
+
+    v_norm = sqrt(_dot_product_xx(c, vk));
+    eig_max = v_norm;
+
+  }
+
+  BFT_FREE(vk);
+
+  if (eig_max <= 0)  /* Degenerate case: Jacobi-like scaling */
+    eig_max = 1.;
+
+  sd->eig_min = 0.1 * eig_max;
+  sd->eig_max = 1.1 * eig_max;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Jacobi-preconditioned Chebyshev
+ * polynomial smoothing.
+ *
+ * Spectral bounds of D^-1.A are determined at setup; no global reduction
+ * is required here, and each iteration costs one matrix.vector product.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_chebyshev(cs_sles_it_t              *c,
+           const cs_matrix_t         *a,
+           cs_lnum_t                  diag_block_size,
+           cs_sles_it_convergence_t  *convergence,
+           const cs_real_t           *rhs,
+           cs_real_t                 *restrict vx,
+           size_t                     aux_size,
+           void                      *aux_vectors)
+{
+  cs_real_t *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict dk, *restrict zk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+  const cs_lnum_t n_blocks = c->setup_data->n_rows / diag_block_size;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 3;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    dk = _aux_vectors + wa_size;
+    zk = _aux_vectors + wa_size*2;
+  }
+
+  const double theta = 0.5 * (c->setup_data->eig_max + c->setup_data->eig_min);
+  const double delta = 0.5 * (c->setup_data->eig_max - c->setup_data->eig_min);
+  const double sigma = theta / delta;
+
+  double rho = 1. / sigma;
+
+  /* Initialize residual and first correction */
+
+  cs_matrix_vector_multiply(a, vx, rk);
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+    rk[ii] = rhs[ii] - rk[ii];
+
+  _diag_inv_apply(diag_block_size, n_blocks, ad_inv, 1./theta, rk, dk);
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 1; n_iter <= convergence->n_iterations_max; n_iter++) {
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      vx[ii] += dk[ii];
+
+    if (n_iter == convergence->n_iterations_max)
+      break;
+
+    /* Update residual: rk <- rk - A.dk */
+
+    cs_matrix_vector_multiply(a, dk, zk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      rk[ii] -= zk[ii];
+
+    /* Update correction: dk <- rho_n.rho.dk + 2.rho_n/delta.D^-1.rk */
+
+    const double rho_n = 1. / (2.*sigma - rho);
+    const double c_d = rho_n * rho;
+
+    _diag_inv_apply(diag_block_size, n_blocks, ad_inv, 2.*rho_n/delta, rk, zk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      dk[ii] = c_d*dk[ii] + zk[ii];
+
+    rho = rho_n;
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  convergence->n_iterations = CS_MIN(n_iter, convergence->n_iterations_max);
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
@@ -1243,6 +1485,77 @@ _p_gauss_seidel_msr(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Process-local Gauss-Seidel, with
+ * single-precision matrix coefficients (scalar case).
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_gauss_seidel_msr_f(cs_sles_it_t              *c,
+                      const cs_matrix_t         *a,
+                      cs_sles_it_convergence_t  *convergence,
+                      const cs_real_t           *rhs,
+                      cs_real_t                 *restrict vx)
+{
+  unsigned n_iter = 0;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const float  *a_x_val;
+
+  cs_matrix_get_msr_arrays_f(a, &a_row_index, &a_col_id, NULL, &a_x_val);
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 0; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN && !_thread_debug)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const float *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      cs_real_t vx0 = rhs[ii];
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        vx0 -= ((cs_real_t)m_row[jj]*vx[col_id[jj]]);
+
+      vx0 *= ad_inv[ii];
+      vx[ii] = vx0;
+
+    }
+
+  }
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local symmetric Gauss-Seidel.
  *
@@ -1277,12 +1590,13 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  cs_matrix_type_t a_type = cs_matrix_get_type(a);
+  if (a_type != CS_MATRIX_MSR && a_type != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Symmetric Gauss-Seidel Jacobi hybrid solver only supported with a\n"
-         "matrix using %s storage."),
-       _("MSR"));
+         "matrix using %s or %s storage."),
+       _("MSR"), _("SELL"));
 
   unsigned n_iter = 0;
 
@@ -1427,6 +1741,113 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
   return CS_SLES_MAX_ITERATION;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using Process-local symmetric Gauss-Seidel, with
+ * single-precision matrix coefficients (scalar case).
+ *
+ * On entry, vx is considered initialized.
+ *
+ * If single-precision coefficients are not available, the
+ * double-precision variant is used.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- linear equation matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (unused here)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_p_sym_gauss_seidel_msr_f(cs_sles_it_t              *c,
+                          const cs_matrix_t         *a,
+                          cs_lnum_t                  diag_block_size,
+                          cs_sles_it_convergence_t  *convergence,
+                          const cs_real_t           *rhs,
+                          cs_real_t                 *restrict vx,
+                          size_t                     aux_size,
+                          void                      *aux_vectors)
+{
+  const cs_lnum_t  *a_row_index, *a_col_id;
+  const float  *a_x_val;
+
+  cs_matrix_get_msr_arrays_f(a, &a_row_index, &a_col_id, NULL, &a_x_val);
+
+  if (a_x_val == NULL || diag_block_size != 1)
+    return _p_sym_gauss_seidel_msr(c, a, diag_block_size, convergence,
+                                   rhs, vx, aux_size, aux_vectors);
+
+  unsigned n_iter = 0;
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_halo_t *halo = cs_matrix_get_halo(a);
+  const cs_real_t  *restrict ad_inv = c->setup_data->ad_inv;
+
+  /* Current iteration */
+  /*-------------------*/
+
+  for (n_iter = 0; n_iter < convergence->n_iterations_max; n_iter++) {
+
+    /* Synchronize ghost cells first */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk: forward step */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN && !_thread_debug)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const float *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      cs_real_t vx0 = rhs[ii];
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        vx0 -= ((cs_real_t)m_row[jj]*vx[col_id[jj]]);
+
+      vx[ii] = vx0 * ad_inv[ii];
+
+    }
+
+    /* Synchronize ghost cells again */
+
+    if (halo != NULL)
+      cs_matrix_pre_vector_multiply_sync(a, vx);
+
+    /* Compute Vx <- Vx - (A-diag).Rk and residue: backward step */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN && !_thread_debug)
+    for (cs_lnum_t ii = n_rows - 1; ii > - 1; ii--) {
+
+      const cs_lnum_t *restrict col_id = a_col_id + a_row_index[ii];
+      const float *restrict m_row = a_x_val + a_row_index[ii];
+      const cs_lnum_t n_cols = a_row_index[ii+1] - a_row_index[ii];
+
+      cs_real_t vx0 = rhs[ii];
+
+      for (cs_lnum_t jj = 0; jj < n_cols; jj++)
+        vx0 -= ((cs_real_t)m_row[jj]*vx[col_id[jj]]);
+
+      vx0 *= ad_inv[ii];
+      vx[ii] = vx0;
+
+    }
+
+  }
+
+  convergence->n_iterations = n_iter;
+
+  return CS_SLES_MAX_ITERATION;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Truncated forward Gauss-Seidel.
  *
@@ -1703,12 +2124,13 @@ _p_gauss_seidel(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  cs_matrix_type_t a_type = cs_matrix_get_type(a);
+  if (a_type != CS_MATRIX_MSR && a_type != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Gauss-Seidel Jacobi hybrid solver only supported with a\n"
-         "matrix using %s storage."),
-       "MSR");
+         "matrix using %s or %s storage."),
+       "MSR", "SELL");
 
   /* Allocate or map work arrays */
   /*-----------------------------*/
@@ -1730,6 +2152,25 @@ _p_gauss_seidel(cs_sles_it_t              *c,
                                       rhs,
                                       vx);
 
+  else if (   diag_block_size == 1
+           && cs_matrix_get_mixed_precision(a)) {
+    const float *a_x_val_f;
+    cs_matrix_get_msr_arrays_f(a, NULL, NULL, NULL, &a_x_val_f);
+    if (a_x_val_f != NULL)
+      cvg = _p_gauss_seidel_msr_f(c,
+                                  a,
+                                  convergence,
+                                  rhs,
+                                  vx);
+    else
+      cvg = _p_gauss_seidel_msr(c,
+                                a,
+                                diag_block_size,
+                                convergence,
+                                rhs,
+                                vx);
+  }
+
   else
     cvg = _p_gauss_seidel_msr(c,
                               a,
@@ -1789,6 +2230,7 @@ cs_multigrid_smoother_create(cs_sles_it_type_t    smoother_type,
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
   case CS_SLES_TS_F_GAUSS_SEIDEL:
   case CS_SLES_TS_B_GAUSS_SEIDEL:
+  case CS_SLES_CHEBYSHEV:
     break;
 
   case CS_SLES_PCG:
@@ -1874,13 +2316,19 @@ cs_multigrid_smoother_setup(void               *context,
     cs_matrix_log_info(a, verbosity);
   }
 
+  /* Gauss-Seidel variants only require the MSR arrays, also available
+     with SELL storage */
+
+  cs_matrix_type_t a_type = cs_matrix_get_type(a);
+  bool msr_arrays = (a_type == CS_MATRIX_MSR || a_type == CS_MATRIX_SELL);
+
   if (c->type == CS_SLES_JACOBI)
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
 
   else if (   c->type == CS_SLES_P_GAUSS_SEIDEL
            || c->type == CS_SLES_P_SYM_GAUSS_SEIDEL) {
     /* Force to Jacobi type in case matrix type is not adapted */
-    if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+    if (msr_arrays == false)
       c->type = CS_SLES_JACOBI;
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
   }
@@ -1888,13 +2336,21 @@ cs_multigrid_smoother_setup(void               *context,
   else if (   c->type == CS_SLES_TS_F_GAUSS_SEIDEL
            || c->type == CS_SLES_TS_B_GAUSS_SEIDEL) {
     /* Force to closest Jacobi type in case matrix type is not adapted */
-    if (cs_matrix_get_type(a) != CS_MATRIX_MSR) {
+    if (msr_arrays == false) {
       c->type = CS_SLES_JACOBI;
       c->n_max_iter = 2;
     }
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
   }
 
+  else if (c->type == CS_SLES_CHEBYSHEV) {
+    cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, true);
+    _chebyshev_setup_bounds(c, a, diag_block_size);
+    if (verbosity > 1)
+      bft_printf(_("  Chebyshev smoother spectral bounds: [%g, %g]\n"),
+                 c->setup_data->eig_min, c->setup_data->eig_max);
+  }
+
   else
     cs_sles_it_setup_priv(c, name, a, verbosity, diag_block_size, false);
 
@@ -1947,7 +2403,10 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _p_gauss_seidel;
     break;
   case CS_SLES_P_SYM_GAUSS_SEIDEL:
-    c->solve = _p_sym_gauss_seidel_msr;
+    if (diag_block_size == 1 && cs_matrix_get_mixed_precision(a))
+      c->solve = _p_sym_gauss_seidel_msr_f;
+    else
+      c->solve = _p_sym_gauss_seidel_msr;
     break;
 
   case CS_SLES_TS_F_GAUSS_SEIDEL:
@@ -1957,6 +2416,10 @@ cs_multigrid_smoother_setup(void               *context,
     c->solve = _ts_b_gauss_seidel_msr;
     break;
 
+  case CS_SLES_CHEBYSHEV:
+    c->solve = _chebyshev;
+    break;
+
   default:
     bft_error
       (__FILE__, __LINE__, 0,
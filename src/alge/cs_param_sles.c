@@ -53,6 +53,7 @@
 #include <bft_mem.h>
 #include <bft_printf.h>
 
+#include "cs_field.h"
 #include "cs_fp_exception.h"
 #include "cs_log.h"
 #include "cs_multigrid.h"
@@ -1372,6 +1373,52 @@ _get_poly_degree(const cs_param_sles_t     *slesp)
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Check if the in-house ILU(0) preconditioner may be associated to
+ *        a given iterative solver.
+ *        It is restricted to Krylov solvers and to scalar systems (when the
+ *        associated field is known).
+ *
+ * \param[in]  slesp   pointer to a \ref cs_param_sles_t structure
+ * \param[in]  itsol   pointer to iterative solver context
+ *
+ * \return true if the ILU(0) preconditioner may be used, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+static bool
+_ilu0_is_applicable(const cs_param_sles_t  *slesp,
+                    cs_sles_it_t           *itsol)
+{
+  switch (cs_sles_it_get_type(itsol)) {
+
+  case CS_SLES_PCG:
+  case CS_SLES_FCG:
+  case CS_SLES_IPCG:
+  case CS_SLES_BICGSTAB:
+  case CS_SLES_BICGSTAB2:
+  case CS_SLES_GCR:
+  case CS_SLES_GMRES:
+  case CS_SLES_PCR3:
+  case CS_SLES_PIPELINED_PCG:
+  case CS_SLES_PIPELINED_GMRES:
+    break;
+
+  default:
+    return false;
+
+  }
+
+  if (slesp->field_id > -1) {
+    const cs_field_t  *f = cs_field_by_id(slesp->field_id);
+    if (f->dim != 1)
+      return false;
+  }
+
+  return true;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set parameters for initializing SLES structures used for the
@@ -1584,6 +1631,7 @@ _set_saturne_sles(bool                 use_field_id,
     switch (itsol_type) {
 
     case CS_SLES_PCG:
+    case CS_SLES_PIPELINED_PCG:
       if (slesp->solver != CS_PARAM_ITSOL_CG)
         errno = 0;
       break;
@@ -1617,6 +1665,7 @@ _set_saturne_sles(bool                 use_field_id,
       break;
 
     case CS_SLES_GMRES:
+    case CS_SLES_PIPELINED_GMRES:
       if (slesp->solver != CS_PARAM_ITSOL_GMRES)
         errno = 6;
       break;
@@ -1663,6 +1712,8 @@ _set_saturne_sles(bool                 use_field_id,
     case CS_SLES_BICGSTAB2:
     case CS_SLES_GMRES:
     case CS_SLES_PCR3:
+    case CS_SLES_PIPELINED_PCG:
+    case CS_SLES_PIPELINED_GMRES:
       cs_base_warn(__FILE__, __LINE__);
       bft_printf("--> A flexible Krylov method should be used.\n");
       break;
@@ -1744,6 +1795,20 @@ _set_saturne_sles(bool                 use_field_id,
 
     }
 
+    else if ((slesp->precond == CS_PARAM_PRECOND_ILU0       ||
+              slesp->precond == CS_PARAM_PRECOND_BJACOB_ILU0 ||
+              slesp->precond == CS_PARAM_PRECOND_ICC0) &&
+             _ilu0_is_applicable(slesp, itsol)) {
+
+      /* In-house version is block-Jacobi in parallel; IC(0) and ILU(0)
+         are equivalent for symmetric matrices. Otherwise (non-Krylov
+         solvers or block systems), no preconditioner is added */
+
+      pc = cs_sles_pc_ilu0_create();
+      cs_sles_it_transfer_pc(itsol, &pc);
+
+    }
+
   } /* preconditioner is not defined */
 
   /* In case of high verbosity, additional output are generated */
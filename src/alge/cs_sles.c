@@ -49,6 +49,7 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "cs_array.h"
 #include "cs_base.h"
 #include "cs_blas.h"
 #include "cs_field.h"
@@ -279,6 +280,10 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Maximum number of vectors for initial guess projection */
+
+#define CS_SLES_PROJ_N_MAX_VECS 32
+
 /*=============================================================================
  * Local Structure Definitions
  *============================================================================*/
@@ -298,6 +303,37 @@ typedef struct {
 
 } cs_sles_post_t;
 
+/* Projection of the initial guess on previous solutions */
+/*-------------------------------------------------------*/
+
+typedef struct {
+
+  int                       n_max_vecs;    /* maximum number of stored
+                                              solution vectors */
+  int                       n_vecs;        /* current number of stored
+                                              solution vectors */
+
+  cs_lnum_t                 n_vals;        /* number of values per vector */
+  cs_lnum_t                 n_vals_ext;    /* number of values per vector,
+                                              including halo */
+
+  cs_real_t                *x;             /* previous solutions (size:
+                                              n_max_vecs*n_vals_ext) */
+  cs_real_t                *ax;            /* matching A.x values, orthonormal
+                                              (size: n_max_vecs*n_vals) */
+  cs_real_t                *x_in;          /* caller initial guess */
+  cs_real_t                *w;             /* work array */
+
+  double                    a_sum[2];      /* sums of matrix diagonal values
+                                              and their squares, to detect
+                                              coefficient changes */
+
+  unsigned long long        n_proj;        /* number of projections */
+  double                    res_ratio_sum; /* sum of residual reduction ratios
+                                              obtained by projection */
+
+} cs_sles_proj_t;
+
 /* Basic per linear system options and logging */
 /*---------------------------------------------*/
 
@@ -337,6 +373,9 @@ struct _cs_sles_t {
 
   cs_sles_post_t           *post_info;     /* postprocessing info */
 
+  cs_sles_proj_t           *proj_info;     /* initial guess projection
+                                              info, or NULL */
+
 };
 
 /*============================================================================
@@ -427,6 +466,7 @@ _sles_create(int          f_id,
   sles->allow_no_op = false;
 
   sles->post_info = NULL;
+  sles->proj_info = NULL;
 
   return sles;
 }
@@ -592,6 +632,7 @@ _save_system_info(cs_sles_t  *s)
   memcpy(s_old, s, sizeof(cs_sles_t));
 
   s_old->_name = NULL; /* still points to new name */
+  s_old->proj_info = NULL; /* projection basis kept by new system */
   s->context = NULL;   /* old context now only available through s_old */
 
   _cs_sles_systems[2][i] = s_old;
@@ -890,6 +931,347 @@ _post_function(void                  *sles_p,
   BFT_FREE(sp->row_residual);
 }
 
+/*----------------------------------------------------------------------------
+ * Compute local dot products of a vector with a set of vectors:
+ *   s[k] = v_k.y
+ *
+ * parameters:
+ *   n_vecs <-- number of vectors in set
+ *   n_vals <-- number of values per vector
+ *   stride <-- stride between vectors in set
+ *   v      <-- set of vectors
+ *   y      <-- vector
+ *   s      --> dot products
+ *----------------------------------------------------------------------------*/
+
+static void
+_multi_dot(int               n_vecs,
+           cs_lnum_t         n_vals,
+           cs_lnum_t         stride,
+           const cs_real_t   v[],
+           const cs_real_t   y[],
+           double            s[])
+{
+  for (int k = 0; k < n_vecs; k++)
+    s[k] = cs_dot(n_vals, v + k*stride, y);
+}
+
+/*----------------------------------------------------------------------------
+ * Ensure projection arrays are allocated and match the matrix size.
+ *
+ * If the system size changed, the stored basis is discarded.
+ *
+ * parameters:
+ *   p <-> pointer to projection info
+ *   a <-- matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_proj_ensure_alloc(cs_sles_proj_t     *p,
+                   const cs_matrix_t  *a)
+{
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_vals = cs_matrix_get_n_rows(a) * db_size;
+  const cs_lnum_t n_vals_ext = cs_matrix_get_n_columns(a) * db_size;
+
+  if (n_vals == p->n_vals && n_vals_ext == p->n_vals_ext && p->x != NULL)
+    return;
+
+  p->n_vals = n_vals;
+  p->n_vals_ext = n_vals_ext;
+  p->n_vecs = 0;
+
+  BFT_REALLOC(p->x, (size_t)(p->n_max_vecs)*n_vals_ext, cs_real_t);
+  BFT_REALLOC(p->ax, (size_t)(p->n_max_vecs)*n_vals, cs_real_t);
+  BFT_REALLOC(p->x_in, n_vals_ext, cs_real_t);
+  BFT_REALLOC(p->w, n_vals_ext, cs_real_t);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute (local) sums of a matrix's diagonal values and of their squares.
+ *
+ * Finite volume matrix diagonals include contributions of the matching
+ * extra-diagonal terms, so these sums are used to detect changes in the
+ * matrix coefficients.
+ *
+ * parameters:
+ *   a     <-- matrix
+ *   a_sum --> sums of diagonal values and of their squares
+ *----------------------------------------------------------------------------*/
+
+static void
+_proj_matrix_sums(const cs_matrix_t  *a,
+                  double              a_sum[2])
+{
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+  const cs_lnum_t n_d_vals = cs_matrix_get_n_rows(a) * db_size*db_size;
+  const cs_real_t *d = cs_matrix_get_diagonal(a);
+
+  double s0 = 0, s1 = 0;
+
+# pragma omp parallel for reduction(+:s0, s1) if(n_d_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_d_vals; ii++) {
+    s0 += d[ii];
+    s1 += d[ii]*d[ii];
+  }
+
+  a_sum[0] = s0;
+  a_sum[1] = s1;
+}
+
+/*----------------------------------------------------------------------------
+ * Orthonormalize the latest projection basis vector.
+ *
+ * The A.x vector at position k_new is orthonormalized against the previous
+ * ones (classical Gram-Schmidt applied twice, so as to group reductions),
+ * and the same combination is applied to the matching solution vector.
+ *
+ * parameters:
+ *   p     <-> pointer to projection info
+ *   k_new <-- position of vector in basis
+ *
+ * returns:
+ *   true if the vector was added, false if it was (almost) linearly
+ *   dependent on the current basis
+ *----------------------------------------------------------------------------*/
+
+static bool
+_proj_orthonormalize(cs_sles_proj_t  *p,
+                     int              k_new)
+{
+  const cs_lnum_t n_vals = p->n_vals;
+  const cs_lnum_t n_vals_ext = p->n_vals_ext;
+
+  cs_real_t *x_new = p->x + k_new*n_vals_ext;
+  cs_real_t *ax_new = p->ax + k_new*n_vals;
+
+  double c[CS_SLES_PROJ_N_MAX_VECS + 1];
+
+  double nrm0 = cs_dot_xx(n_vals, ax_new);
+  cs_parall_sum(1, CS_DOUBLE, &nrm0);
+
+  for (int pass = 0; pass < 2 && k_new > 0; pass++) {
+
+    _multi_dot(k_new, n_vals, n_vals, p->ax, ax_new, c);
+    cs_parall_sum(k_new, CS_DOUBLE, c);
+
+    for (int k = 0; k < k_new; k++) {
+      cs_axpy(n_vals, -c[k], p->ax + k*n_vals, ax_new);
+      cs_axpy(n_vals, -c[k], p->x + k*n_vals_ext, x_new);
+    }
+
+  }
+
+  double nrm = cs_dot_xx(n_vals, ax_new);
+  cs_parall_sum(1, CS_DOUBLE, &nrm);
+
+  if (nrm <= 1e-20*nrm0 || nrm <= 0.)
+    return false;
+
+  const double scale = 1./sqrt(nrm);
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++) {
+    x_new[ii] *= scale;
+    ax_new[ii] *= scale;
+  }
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Rebuild the projection basis for a new matrix.
+ *
+ * The A.x vectors are recomputed for the stored solution vectors,
+ * and the basis orthonormalized again.
+ *
+ * parameters:
+ *   p <-> pointer to projection info
+ *   a <-- matrix
+ *----------------------------------------------------------------------------*/
+
+static void
+_proj_rebuild(cs_sles_proj_t     *p,
+              const cs_matrix_t  *a)
+{
+  const cs_lnum_t n_vals = p->n_vals;
+  const cs_lnum_t n_vals_ext = p->n_vals_ext;
+
+  const int n_vecs = p->n_vecs;
+  p->n_vecs = 0;
+
+  for (int k = 0; k < n_vecs; k++) {
+
+    const int k_new = p->n_vecs;
+    cs_real_t *x_new = p->x + k_new*n_vals_ext;
+
+    if (k_new < k)
+      cs_array_copy_real(n_vals, 1, p->x + k*n_vals_ext, x_new);
+
+    cs_matrix_vector_multiply(a, x_new, p->w);
+    cs_array_copy_real(n_vals, 1, p->w, p->ax + k_new*n_vals);
+
+    if (_proj_orthonormalize(p, k_new))
+      p->n_vecs += 1;
+
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Improve the initial guess by projection on the space spanned by
+ * previous solutions.
+ *
+ * The correction minimizes the residual norm on this space. Since the
+ * A.x_k vectors are stored as an orthonormal set, this only requires a
+ * matrix-vector product and one reduction for all dot products.
+ *
+ * If the matrix coefficients changed since the basis was built, the A.x_k
+ * vectors are first recomputed (requiring one matrix-vector product
+ * per basis vector).
+ *
+ * parameters:
+ *   p   <-> pointer to projection info
+ *   a   <-- matrix
+ *   rhs <-- right hand side
+ *   vx  <-> system solution (initial guess on input)
+ *----------------------------------------------------------------------------*/
+
+static void
+_proj_initial_guess(cs_sles_proj_t     *p,
+                    const cs_matrix_t  *a,
+                    const cs_real_t    *rhs,
+                    cs_real_t          *vx)
+{
+  _proj_ensure_alloc(p, a);
+
+  const cs_lnum_t n_vals = p->n_vals;
+
+  cs_array_copy_real(n_vals, 1, vx, p->x_in);
+
+  double a_sum[2];
+  _proj_matrix_sums(a, a_sum);
+
+  if (p->n_vecs < 1) {
+    cs_parall_sum(2, CS_DOUBLE, a_sum);
+    p->a_sum[0] = a_sum[0];
+    p->a_sum[1] = a_sum[1];
+    return;
+  }
+
+  /* Initial residual r = b - A.x */
+
+  cs_real_t *r = p->w;
+
+  cs_matrix_vector_multiply(a, vx, r);
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+    r[ii] = rhs[ii] - r[ii];
+
+  /* c_k = (A.x_k).r (and r.r, matrix sums as last values) */
+
+  double c[CS_SLES_PROJ_N_MAX_VECS + 3];
+
+  _multi_dot(p->n_vecs, n_vals, n_vals, p->ax, r, c);
+  c[p->n_vecs] = cs_dot_xx(n_vals, r);
+  c[p->n_vecs + 1] = a_sum[0];
+  c[p->n_vecs + 2] = a_sum[1];
+
+  cs_parall_sum(p->n_vecs + 3, CS_DOUBLE, c);
+
+  /* Matrix changed: rebuild basis (r is overwritten) */
+
+  bool changed = false;
+  for (int i = 0; i < 2; i++) {
+    a_sum[i] = c[p->n_vecs + 1 + i];
+    if (  CS_ABS(a_sum[i] - p->a_sum[i])
+        > 1e-12*(CS_ABS(a_sum[i]) + CS_ABS(p->a_sum[i])))
+      changed = true;
+  }
+
+  if (changed) {
+
+    p->a_sum[0] = a_sum[0];
+    p->a_sum[1] = a_sum[1];
+
+    _proj_rebuild(p, a);
+
+    if (p->n_vecs < 1)
+      return;
+
+    cs_matrix_vector_multiply(a, vx, r);
+
+#   pragma omp parallel for if(n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+      r[ii] = rhs[ii] - r[ii];
+
+    _multi_dot(p->n_vecs, n_vals, n_vals, p->ax, r, c);
+    c[p->n_vecs] = cs_dot_xx(n_vals, r);
+
+    cs_parall_sum(p->n_vecs + 1, CS_DOUBLE, c);
+
+  }
+
+  /* x <- x + sum_k c_k x_k */
+
+  double r2_proj = c[p->n_vecs];
+
+  for (int k = 0; k < p->n_vecs; k++) {
+    cs_axpy(n_vals, c[k], p->x + k*p->n_vals_ext, vx);
+    r2_proj -= c[k]*c[k];
+  }
+
+  /* Logging of the (estimated) residual reduction */
+
+  if (c[p->n_vecs] > 0) {
+    p->n_proj += 1;
+    p->res_ratio_sum += sqrt(CS_MAX(r2_proj, 0.) / c[p->n_vecs]);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Add the latest solution increment to the projection basis.
+ *
+ * The new A.x vector is orthonormalized against the previous ones, and
+ * the same combination is applied to the solution vector.
+ * When the basis is full, it is restarted from the latest solution.
+ *
+ * parameters:
+ *   p  <-> pointer to projection info
+ *   a  <-- matrix
+ *   vx <-- system solution
+ *----------------------------------------------------------------------------*/
+
+static void
+_proj_update(cs_sles_proj_t     *p,
+             const cs_matrix_t  *a,
+             const cs_real_t    *vx)
+{
+  const cs_lnum_t n_vals = p->n_vals;
+  const cs_lnum_t n_vals_ext = p->n_vals_ext;
+
+  if (p->n_vecs >= p->n_max_vecs)
+    p->n_vecs = 0;
+
+  const int k_new = p->n_vecs;
+  cs_real_t *x_new = p->x + k_new*n_vals_ext;
+  cs_real_t *ax_new = p->ax + k_new*n_vals;
+
+  /* Increment computed by the projection and the solver */
+
+# pragma omp parallel for if(n_vals > CS_THR_MIN)
+  for (cs_lnum_t ii = 0; ii < n_vals; ii++)
+    x_new[ii] = vx[ii] - p->x_in[ii];
+
+  cs_matrix_vector_multiply(a, x_new, p->w);
+  cs_array_copy_real(n_vals, 1, p->w, ax_new);
+
+  /* Ignore vectors (almost) linearly dependent on the current basis */
+
+  if (_proj_orthonormalize(p, k_new))
+    p->n_vecs += 1;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -970,6 +1352,7 @@ cs_sles_finalize(void)
           BFT_FREE(sles->post_info->row_residual);
           BFT_FREE(sles->post_info);
         }
+        cs_sles_set_solution_projection(sles, 0);
         BFT_FREE(sles->_name);
         BFT_FREE(_cs_sles_systems[i][j]);
       }
@@ -1132,6 +1515,11 @@ cs_sles_log(cs_log_t  log_type)
               (log_type,
                _("  Residual postprocessing writer id: %d\n"),
                sles->post_info->writer_id);
+          if (sles->proj_info != NULL)
+            cs_log_printf
+              (log_type,
+               _("  Initial guess projection on previous solutions: %d\n"),
+               sles->proj_info->n_max_vecs);
           break;
 
         case CS_LOG_PERFORMANCE:
@@ -1140,6 +1528,14 @@ cs_sles_log(cs_log_t  log_type)
               (log_type,
                _("\n"
                  "  Number of immediate solve exits: %d\n"), sles->n_no_op);
+          if (sles->proj_info != NULL && sles->proj_info->n_proj > 0)
+            cs_log_printf
+              (log_type,
+               _("\n"
+                 "  Initial guess projections:        %llu\n"
+                 "  Mean residual reduction factor:   %12.5e\n"),
+               sles->proj_info->n_proj,
+               sles->proj_info->res_ratio_sum / sles->proj_info->n_proj);
           break;
 
         default:
@@ -1490,6 +1886,101 @@ cs_sles_get_post_output(cs_sles_t  *sles)
   return retval;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate the projection of the initial guess on the
+ *        space spanned by previous solutions of a given system.
+ *
+ * Solution increments of the last \p n_max_vecs solves are stored, and the
+ * initial guess of each new solve is corrected by the combination of these
+ * vectors minimizing the residual. This is useful for systems solved
+ * repeatedly with a matrix which changes little, such as the pressure
+ * correction in unsteady computations. When the basis is full, it is
+ * restarted from the latest solution.
+ *
+ * This requires one additional matrix-vector product per solve (two when
+ * the basis is updated) and storing 2 vectors per basis element.
+ * When the matrix coefficients change (as detected through its diagonal),
+ * the stored basis is updated for the new matrix, requiring one
+ * matrix-vector product per basis element.
+ *
+ * \param[in, out]  sles        pointer to solver object
+ * \param[in]       n_max_vecs  maximum number of stored vectors
+ *                              (0 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solution_projection(cs_sles_t  *sles,
+                                int         n_max_vecs)
+{
+  if (sles == NULL)
+    return;
+
+  cs_sles_proj_t *p = sles->proj_info;
+
+  if (n_max_vecs < 1) {
+    if (p != NULL) {
+      BFT_FREE(p->x);
+      BFT_FREE(p->ax);
+      BFT_FREE(p->x_in);
+      BFT_FREE(p->w);
+      BFT_FREE(sles->proj_info);
+    }
+    return;
+  }
+
+  if (n_max_vecs > CS_SLES_PROJ_N_MAX_VECS)
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: at most %d vectors may be used for the projection\n"
+                "of the initial guess (%d requested)."),
+              __func__, CS_SLES_PROJ_N_MAX_VECS, n_max_vecs);
+
+  if (p == NULL) {
+    BFT_MALLOC(p, 1, cs_sles_proj_t);
+    p->n_vals = 0;
+    p->n_vals_ext = 0;
+    p->x = NULL;
+    p->ax = NULL;
+    p->x_in = NULL;
+    p->w = NULL;
+    p->a_sum[0] = 0;
+    p->a_sum[1] = 0;
+    p->n_proj = 0;
+    p->res_ratio_sum = 0;
+    sles->proj_info = p;
+  }
+
+  /* Reset basis (arrays are resized at next solve) */
+
+  p->n_max_vecs = n_max_vecs;
+  p->n_vecs = 0;
+  BFT_FREE(p->x);
+  BFT_FREE(p->ax);
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the maximum number of previous solutions used for the
+ *        projection of the initial guess of a given system.
+ *
+ * \param[in]  sles  pointer to solver object
+ *
+ * \return  maximum number of stored vectors, or 0 if inactive
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_get_solution_projection(const cs_sles_t  *sles)
+{
+  int retval = 0;
+
+  if (sles->proj_info != NULL)
+    retval = sles->proj_info->n_max_vecs;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return type name of solver context.
@@ -1749,6 +2240,18 @@ cs_sles_solve(cs_sles_t           *sles,
     }
   }
 
+  /* Improve the initial guess using previous solutions if requested */
+
+  bool use_proj = (do_solve && sles->proj_info != NULL) ? true : false;
+
+#if defined(HAVE_ACCEL)
+  if (cs_matrix_get_alloc_mode(a) > CS_ALLOC_HOST)
+    use_proj = false;
+#endif
+
+  if (use_proj)
+    _proj_initial_guess(sles->proj_info, a, rhs, vx);
+
   while (do_solve) {
 
     state = sles->solve_func(sles->context,
@@ -1775,6 +2278,9 @@ cs_sles_solve(cs_sles_t           *sles,
 
   }
 
+  if (use_proj && state >= CS_SLES_MAX_ITERATION)
+    _proj_update(sles->proj_info, a, vx);
+
   /* Prepare postprocessing if needed */
 
   if (sles->post_info != NULL) {
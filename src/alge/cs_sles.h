@@ -531,6 +531,48 @@ cs_sles_set_post_output(cs_sles_t  *sles,
 int
 cs_sles_get_post_output(cs_sles_t  *sles);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate or deactivate the projection of the initial guess on the
+ *        space spanned by previous solutions of a given system.
+ *
+ * Solution increments of the last \p n_max_vecs solves are stored, and the
+ * initial guess of each new solve is corrected by the combination of these
+ * vectors minimizing the residual. This is useful for systems solved
+ * repeatedly with a matrix which changes little, such as the pressure
+ * correction in unsteady computations. When the basis is full, it is
+ * restarted from the latest solution.
+ *
+ * This requires one additional matrix-vector product per solve (two when
+ * the basis is updated) and storing 2 vectors per basis element.
+ * When the matrix coefficients change (as detected through its diagonal),
+ * the stored basis is updated for the new matrix, requiring one
+ * matrix-vector product per basis element.
+ *
+ * \param[in, out]  sles        pointer to solver object
+ * \param[in]       n_max_vecs  maximum number of stored vectors
+ *                              (0 to deactivate)
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_sles_set_solution_projection(cs_sles_t  *sles,
+                                int         n_max_vecs);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Return the maximum number of previous solutions used for the
+ *        projection of the initial guess of a given system.
+ *
+ * \param[in]  sles  pointer to solver object
+ *
+ * \return  maximum number of stored vectors, or 0 if inactive
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_sles_get_solution_projection(const cs_sles_t  *sles);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Return type name of solver context.
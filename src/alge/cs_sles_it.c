@@ -114,6 +114,21 @@ BEGIN_C_DECLS
  * Local Structure Definitions
  *============================================================================*/
 
+/* Global sum of several values, possibly non-blocking, so as to overlap
+   the associated reduction with local work (used by pipelined solvers) */
+
+typedef struct {
+
+  int          n;         /* Number of values */
+  double      *s;         /* Local values on start, global sums on end */
+  double      *_sum;      /* Reduction buffer (size: n) */
+
+#if defined(HAVE_MPI)
+  MPI_Request  request;   /* Associated MPI request */
+#endif
+
+} _global_sum_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
@@ -142,10 +157,13 @@ const char *cs_sles_it_type_name[]
      N_("Gauss-Seidel"),
      N_("Symmetric Gauss-Seidel"),
      N_("3-layer conjugate residual"),
+     N_("Pipelined Conjugate Gradient"),
+     N_("Pipelined GMRES"),
      N_("User-defined iterative solver"),
      N_("None"), /* Smoothers beyond this */
      N_("Truncated forward Gauss-Seidel"),
      N_("Truncated backwards Gauss-Seidel"),
+     N_("Chebyshev"),
 };
 
 /*=============================================================================
@@ -156,6 +174,42 @@ const char *cs_sles_it_type_name[]
  * Private function definitions
  *============================================================================*/
 
+/*----------------------------------------------------------------------------
+ * Check if a preconditioner is a fixed linear operator.
+ *
+ * Only built-in preconditioners known to be linear are recognized;
+ * multigrid or other preconditioners based on (possibly nonlinear)
+ * inner solvers are considered variable.
+ *
+ * parameters:
+ *   pc <-- pointer to preconditioner object, or NULL
+ *
+ * returns:
+ *   true if the preconditioner is known to be a fixed linear operator
+ *----------------------------------------------------------------------------*/
+
+static bool
+_pc_is_linear(cs_sles_pc_t  *pc)
+{
+  if (pc == NULL)
+    return true;
+
+  const char *linear_types[] = {"none",
+                                "jacobi",
+                                "polynomial_degree_1",
+                                "polynomial_degree_2",
+                                "ilu0"};
+
+  const char *pc_type = cs_sles_pc_get_type(pc);
+
+  for (int i = 0; i < 5; i++) {
+    if (strcmp(pc_type, linear_types[i]) == 0)
+      return true;
+  }
+
+  return false;
+}
+
 /*----------------------------------------------------------------------------
  * Convergence test.
  *
@@ -304,6 +358,70 @@ _dot_products_vr_vw_vq_rr(const cs_sles_it_t  *c,
   *s4 = s[3];
 }
 
+/*----------------------------------------------------------------------------
+ * Start summing values over all ranks.
+ *
+ * When MPI-3 is available, the reduction is non-blocking, and its
+ * result is only available after the matching call to _global_sum_end;
+ * otherwise, it is completed here.
+ *
+ * parameters:
+ *   c      <-- pointer to solver context info
+ *   gs     <-> global sum structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_global_sum_start(const cs_sles_it_t  *c,
+                  _global_sum_t       *gs)
+{
+#if defined(HAVE_MPI)
+
+  gs->request = MPI_REQUEST_NULL;
+
+  if (c->comm != MPI_COMM_NULL) {
+
+#if (MPI_VERSION >= 3)
+    MPI_Iallreduce(gs->s, gs->_sum, gs->n, MPI_DOUBLE, MPI_SUM, c->comm,
+                   &(gs->request));
+#else
+    MPI_Allreduce(gs->s, gs->_sum, gs->n, MPI_DOUBLE, MPI_SUM, c->comm);
+    memcpy(gs->s, gs->_sum, gs->n*sizeof(double));
+#endif
+
+  }
+
+#else
+
+  CS_UNUSED(c);
+  CS_UNUSED(gs);
+
+#endif /* defined(HAVE_MPI) */
+}
+
+/*----------------------------------------------------------------------------
+ * Complete summing values over all ranks.
+ *
+ * parameters:
+ *   gs     <-> global sum structure
+ *----------------------------------------------------------------------------*/
+
+static void
+_global_sum_end(_global_sum_t  *gs)
+{
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+
+  if (gs->request != MPI_REQUEST_NULL) {
+    MPI_Wait(&(gs->request), MPI_STATUS_IGNORE);
+    memcpy(gs->s, gs->_sum, gs->n*sizeof(double));
+  }
+
+#else
+
+  CS_UNUSED(gs);
+
+#endif
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using preconditioned conjugate gradient.
  *
@@ -3036,6 +3154,520 @@ _gmres(cs_sles_it_t              *c,
   return cvg;
 }
 
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned conjugate gradient.
+ *
+ * This is the variant from Ghysels and Vanroose ("Hiding global
+ * synchronization latency in the preconditioned Conjugate Gradient
+ * algorithm", Parallel Computing, 2014): all dot products of an iteration
+ * are grouped in a single reduction, which is overlapped with the
+ * preconditioning and matrix.vector product (so also with the associated
+ * halo exchange). This requires additional work vectors and vector
+ * updates, so is only interesting when global reductions are costly.
+ * Convergence detected on the recursively updated residual is confirmed
+ * by restarting from the true residual.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_pipelined_conjugate_gradient(cs_sles_it_t              *c,
+                              const cs_matrix_t         *a,
+                              cs_lnum_t                  diag_block_size,
+                              cs_sles_it_convergence_t  *convergence,
+                              const cs_real_t           *rhs,
+                              cs_real_t                 *restrict vx,
+                              size_t                     aux_size,
+                              void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  alpha = 0., beta = 0., gamma_m1 = 0., residue;
+  double  s[3], _sum[3];
+  cs_real_t  *_aux_vectors;
+  cs_real_t  *restrict rk, *restrict uk, *restrict wk, *restrict mk;
+  cs_real_t  *restrict nk, *restrict zk, *restrict qk, *restrict sk;
+  cs_real_t  *restrict pk;
+
+  unsigned n_iter = 0;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+    const size_t n_wa = 9;
+    const size_t wa_size = CS_SIMD_SIZE(n_cols);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < (wa_size * n_wa))
+      BFT_MALLOC(_aux_vectors, wa_size * n_wa, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    rk = _aux_vectors;
+    uk = _aux_vectors + wa_size;
+    wk = _aux_vectors + wa_size*2;
+    mk = _aux_vectors + wa_size*3;
+    nk = _aux_vectors + wa_size*4;
+    zk = _aux_vectors + wa_size*5;
+    qk = _aux_vectors + wa_size*6;
+    sk = _aux_vectors + wa_size*7;
+    pk = _aux_vectors + wa_size*8;
+  }
+
+  _global_sum_t gs;
+  gs.n = 3;
+  gs.s = s;
+  gs._sum = _sum;
+
+  /* Restart indicator, and residual computed from the solution
+     rather than updated recursively */
+
+  bool restart = true;
+  bool true_residual = false;
+
+  /* Current Iteration */
+  /*-------------------*/
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Initialize (or restart) iterative calculation */
+
+    if (restart) {
+
+      cs_matrix_vector_multiply(a, vx, rk);  /* rk = A.x */
+
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+        rk[ii] = rhs[ii] - rk[ii];
+        zk[ii] = 0.;
+        qk[ii] = 0.;
+        sk[ii] = 0.;
+        pk[ii] = 0.;
+      }
+
+      c->setup_data->pc_apply(c->setup_data->pc_context, rk, uk);
+
+      cs_matrix_vector_multiply(a, uk, wk);  /* wk = A.uk */
+
+      restart = false;
+      true_residual = true;
+
+    }
+
+    /* Start reduction of r.r, gamma = r.u and delta = u.w */
+
+    cs_dot_xx_xy_yz(n_rows, rk, uk, wk, s, s+1, s+2);
+
+    _global_sum_start(c, &gs);
+
+    /* Preconditioning and matrix.vector product while reduction
+       is in progress */
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, wk, mk);
+
+    cs_matrix_vector_multiply(a, mk, nk);  /* nk = A.mk */
+
+    _global_sum_end(&gs);
+
+    residue = sqrt(s[0]);
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = residue;
+
+    /* Convergence test for end of previous iteration; as the recursively
+       updated residual may drift from the true one, convergence is
+       confirmed by restarting from the true residual */
+
+    cvg = _convergence_test(c, n_iter, residue, convergence);
+
+    if (cvg == CS_SLES_CONVERGED && true_residual == false) {
+      cvg = CS_SLES_ITERATING;
+      restart = true;
+      continue;
+    }
+
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    /* Descent parameters */
+
+    const double gamma = s[1];
+    double ro_1 = s[2];
+
+    if (true_residual == false) {
+      beta = (CS_ABS(gamma_m1) > DBL_MIN) ? gamma / gamma_m1 : 0.;
+      ro_1 -= beta * gamma / alpha;
+    }
+    else
+      beta = 0.;
+
+    if (_breakdown(c, convergence, "delta", ro_1, _epzero,
+                   residue, n_iter, &cvg))
+      break;
+
+    alpha = gamma / ro_1;
+    gamma_m1 = gamma;
+    true_residual = false;
+
+    n_iter += 1;
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++) {
+      zk[ii] = nk[ii] + beta*zk[ii];
+      qk[ii] = mk[ii] + beta*qk[ii];
+      sk[ii] = wk[ii] + beta*sk[ii];
+      pk[ii] = uk[ii] + beta*pk[ii];
+      vx[ii] += alpha*pk[ii];
+      rk[ii] -= alpha*sk[ii];
+      uk[ii] -= alpha*qk[ii];
+      wk[ii] -= alpha*zk[ii];
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
+/*----------------------------------------------------------------------------
+ * Solution of A.vx = Rhs using pipelined preconditioned GMRES.
+ *
+ * This is a p(1)-GMRES variant (Ghysels, Ashby, Meerbergen and Vanroose,
+ * "Hiding global communication latency in the GMRES algorithm on massively
+ * parallel machines", SIAM J. Sci. Comput., 2013) using classical
+ * Gram-Schmidt: the dot products of the new (non-orthogonalized) basis
+ * vector with the previous ones and its norm are grouped in a single
+ * reduction, which is overlapped with the preconditioning and
+ * matrix.vector product applied to that vector. The next basis vector
+ * and its image are then deduced by linearity.
+ *
+ * The residual norm is estimated from the Hessenberg least-squares
+ * problem, so that no additional reduction is needed for the convergence
+ * test, except at restarts.
+ *
+ * On entry, vx is considered initialized.
+ *
+ * parameters:
+ *   c               <-- pointer to solver context info
+ *   a               <-- matrix
+ *   diag_block_size <-- diagonal block size (unused here)
+ *   convergence     <-- convergence information structure
+ *   rhs             <-- right hand side
+ *   vx              <-> system solution
+ *   aux_size        <-- number of elements in aux_vectors (in bytes)
+ *   aux_vectors     --- optional working area (allocation otherwise)
+ *
+ * returns:
+ *   convergence state
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_convergence_state_t
+_pipelined_gmres(cs_sles_it_t              *c,
+                 const cs_matrix_t         *a,
+                 cs_lnum_t                  diag_block_size,
+                 cs_sles_it_convergence_t  *convergence,
+                 const cs_real_t           *rhs,
+                 cs_real_t                 *restrict vx,
+                 size_t                     aux_size,
+                 void                      *aux_vectors)
+{
+  cs_sles_convergence_state_t cvg = CS_SLES_ITERATING;
+  double  beta, residue;
+  cs_real_t  *_aux_vectors;
+  cs_real_t *restrict _krylov_vectors, *restrict _z_vectors;
+  cs_real_t *restrict _h_matrix, *restrict _givens_coeff, *restrict _beta;
+  cs_real_t *restrict dk, *restrict gk, *restrict qk, *restrict fk;
+  double  *_dots;
+
+  cs_lnum_t krylov_size_max = c->restart_interval;
+  unsigned n_iter = 0;
+
+  /* Relative threshold on the squared norm of the new basis vector
+     under which it is recomputed explicitly rather than deduced from
+     the grouped dot products (cancellation) */
+
+  const double pythagoras_eps = 1.e-8;
+
+  /* Allocate or map work arrays */
+  /*-----------------------------*/
+
+  assert(c->setup_data != NULL);
+
+  const cs_lnum_t n_rows = c->setup_data->n_rows;
+
+  int krylov_size = sqrt(n_rows*diag_block_size)*1.5 + 1;
+  if (krylov_size > krylov_size_max)
+    krylov_size = krylov_size_max;
+
+#if defined(HAVE_MPI)
+  if (c->comm != MPI_COMM_NULL) {
+    int _krylov_size = krylov_size;
+    MPI_Allreduce(&_krylov_size,
+                  &krylov_size,
+                  1,
+                  MPI_INT,
+                  MPI_MIN,
+                  c->comm);
+  }
+#endif
+
+  if (krylov_size < 2)
+    krylov_size = 2;
+
+  double  epsi = 1.e-15;
+  int scaltest = 0;
+
+  {
+    const cs_lnum_t n_cols = cs_matrix_get_n_columns(a) * diag_block_size;
+
+    size_t _aux_r_size;
+    size_t  n_wa = 4;
+    size_t  wa_size = n_cols < krylov_size? krylov_size : n_cols;
+
+    wa_size = CS_SIMD_SIZE(wa_size);
+    _aux_r_size =   wa_size*n_wa
+                  + (krylov_size-1)*(2*n_rows + krylov_size) + 3*krylov_size
+                  + 2*(krylov_size+1);
+
+    if (aux_vectors == NULL || aux_size/sizeof(cs_real_t) < _aux_r_size)
+      BFT_MALLOC(_aux_vectors, _aux_r_size, cs_real_t);
+    else
+      _aux_vectors = aux_vectors;
+
+    dk = _aux_vectors;
+    gk = _aux_vectors + wa_size;
+    qk = _aux_vectors + 2*wa_size;
+    fk = _aux_vectors + 3*wa_size;
+    _krylov_vectors = _aux_vectors + n_wa*wa_size;
+    _z_vectors = _krylov_vectors + (krylov_size - 1)*n_rows;
+    _h_matrix = _z_vectors + (krylov_size - 1)*n_rows;
+    _givens_coeff = _h_matrix + (krylov_size - 1)*krylov_size;
+    _beta = _givens_coeff + 2*krylov_size;
+    _dots = _beta + krylov_size;
+  }
+
+  _global_sum_t gs;
+  gs.s = _dots;
+  gs._sum = _dots + krylov_size + 1;
+
+  cvg = CS_SLES_ITERATING;
+
+  while (cvg == CS_SLES_ITERATING) {
+
+    /* Compute  rk <- rhs - A*vx (r0 = b-A*x0) */
+
+    cs_matrix_vector_multiply(a, vx, dk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+      dk[ii] = rhs[ii] - dk[ii];
+
+    /* beta = ||r0||; the residual is checked at each restart so
+       as not to rely only on its estimation */
+
+    beta = sqrt(_dot_product_xx(c, dk));
+
+    if (n_iter == 0)
+      c->setup_data->initial_residue = beta;
+
+    cvg = _convergence_test(c, n_iter, beta, convergence);
+    if (cvg != CS_SLES_ITERATING)
+      break;
+
+    for (cs_lnum_t ii = 0; ii < krylov_size*(krylov_size - 1); ii++)
+      _h_matrix[ii] = 0.;
+
+    _beta[0] = beta;
+    for (cs_lnum_t ii = 1; ii < krylov_size; ii++)
+      _beta[ii] = 0.;
+
+    /* v0 = r0/beta, z0 = A.M^-1.v0 */
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+      _krylov_vectors[jj] = dk[jj]/beta;
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, _krylov_vectors, gk);
+
+    cs_matrix_vector_multiply(a, gk, _z_vectors);
+
+    /* Lap */
+
+    int l_iter = 0;
+
+    for (cs_lnum_t ii = 0; ii < krylov_size - 1; ii++) {
+
+      const cs_real_t *restrict zk = _z_vectors + ii*n_rows;
+      const bool last = (ii == krylov_size - 2);
+
+      /* Start reduction of h(j,i) = <zi,vj> (j <= i) and <zi,zi> */
+
+      for (cs_lnum_t jj = 0; jj < ii + 1; jj++)
+        _dots[jj] = cs_dot(n_rows, zk, _krylov_vectors + jj*n_rows);
+      _dots[ii+1] = cs_dot_xx(n_rows, zk);
+
+      gs.n = ii + 2;
+      _global_sum_start(c, &gs);
+
+      /* Compute qk <- A.M^-1.zi while reduction is in progress */
+
+      if (!last) {
+        c->setup_data->pc_apply(c->setup_data->pc_context, zk, gk);
+        cs_matrix_vector_multiply(a, gk, qk);
+      }
+
+      _global_sum_end(&gs);
+
+      /* h(i+1,i)^2 = <zi,zi> - sum_j h(j,i)^2 */
+
+      cs_real_t *restrict h_i = _h_matrix + ii*krylov_size;
+
+      double h_sum = 0.;
+      for (cs_lnum_t jj = 0; jj < ii + 1; jj++) {
+        h_i[jj] = _dots[jj];
+        h_sum += _dots[jj]*_dots[jj];
+      }
+
+      double h_n2 = _dots[ii+1] - h_sum;
+      double h_n = 0.;
+
+      cs_real_t *restrict vk_n = _krylov_vectors + (ii+1)*n_rows;
+      cs_real_t *restrict zk_n = _z_vectors + (ii+1)*n_rows;
+
+      if (h_n2 > pythagoras_eps*_dots[ii+1])
+        h_n = sqrt(h_n2);
+
+      if (h_n > epsi) {
+
+        /* v(i+1) = (zi - sum_j h(j,i).vj) / h(i+1,i), and by linearity,
+           z(i+1) = (qk - sum_j h(j,i).zj) / h(i+1,i) */
+
+        if (!last) {
+          const double d_h_n = 1. / h_n;
+#         pragma omp parallel for if(n_rows > CS_THR_MIN)
+          for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
+            cs_real_t v = zk[jj], z = qk[jj];
+            for (cs_lnum_t kk = 0; kk < ii + 1; kk++) {
+              v -= h_i[kk] * _krylov_vectors[kk*n_rows + jj];
+              z -= h_i[kk] * _z_vectors[kk*n_rows + jj];
+            }
+            vk_n[jj] = v * d_h_n;
+            zk_n[jj] = z * d_h_n;
+          }
+        }
+
+      }
+      else {
+
+        /* Cancellation or breakdown: orthogonalize and normalize
+           explicitly (blocking reduction) */
+
+#       pragma omp parallel for if(n_rows > CS_THR_MIN)
+        for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
+          cs_real_t v = zk[jj];
+          for (cs_lnum_t kk = 0; kk < ii + 1; kk++)
+            v -= h_i[kk] * _krylov_vectors[kk*n_rows + jj];
+          fk[jj] = v;
+        }
+
+        h_n = sqrt(_dot_product_xx(c, fk));
+
+        if (h_n < epsi)
+          scaltest = 1;
+
+        else if (!last) {
+#         pragma omp parallel for if(n_rows > CS_THR_MIN)
+          for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+            vk_n[jj] = fk[jj] / h_n;
+
+          c->setup_data->pc_apply(c->setup_data->pc_context, vk_n, gk);
+          cs_matrix_vector_multiply(a, gk, zk_n);
+        }
+
+      }
+
+      h_i[ii+1] = h_n;
+
+      /* Update triangular factorization and residual estimation */
+
+      _givens_rot_update(_h_matrix,
+                         krylov_size,
+                         _beta,
+                         _givens_coeff,
+                         ii,
+                         ii + 1);
+
+      residue = CS_ABS(_beta[ii+1]);
+
+      n_iter++;
+      l_iter++;
+
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+
+      if (cvg != CS_SLES_ITERATING || last || scaltest == 1)
+        break;
+
+    }
+
+    /* Update solution: vx <- vx + M^-1.V.y */
+
+    _solve_diag_sup_halo(_h_matrix, l_iter, krylov_size, _beta, gk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t jj = 0; jj < n_rows; jj++) {
+      fk[jj] = 0.0;
+      for (cs_lnum_t kk = 0; kk < l_iter; kk++)
+        fk[jj] += _krylov_vectors[kk*n_rows + jj] * gk[kk];
+    }
+
+    c->setup_data->pc_apply(c->setup_data->pc_context, fk, dk);
+
+#   pragma omp parallel for if(n_rows > CS_THR_MIN)
+    for (cs_lnum_t jj = 0; jj < n_rows; jj++)
+      vx[jj] += dk[jj];
+
+    /* Restart; in case of (lucky) breakdown, a restart would not
+       bring any progress */
+
+    if (cvg == CS_SLES_ITERATING && scaltest == 1) {
+      cs_matrix_vector_multiply(a, vx, dk);
+#     pragma omp parallel for if(n_rows > CS_THR_MIN)
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        dk[ii] = rhs[ii] - dk[ii];
+      residue = sqrt(_dot_product_xx(c, dk));
+      cvg = _convergence_test(c, n_iter, residue, convergence);
+      if (cvg == CS_SLES_ITERATING)
+        _breakdown(c, convergence, "h(i+1,i)", 0., epsi,
+                   residue, n_iter, &cvg);
+    }
+
+  }
+
+  if (_aux_vectors != aux_vectors)
+    BFT_FREE(_aux_vectors);
+
+  return cvg;
+}
+
 /*----------------------------------------------------------------------------
  * Solution of A.vx = Rhs using Process-local Gauss-Seidel.
  *
@@ -3396,12 +4028,13 @@ _p_sym_gauss_seidel_msr(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  cs_matrix_type_t a_type = cs_matrix_get_type(a);
+  if (a_type != CS_MATRIX_MSR && a_type != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Symmetric Gauss-Seidel Jacobi hybrid solver only supported with a\n"
-         "matrix using %s storage."),
-       "MSR");
+         "matrix using %s or %s storage."),
+       "MSR", "SELL");
 
   unsigned n_iter = 0;
 
@@ -3628,12 +4261,13 @@ _p_gauss_seidel(cs_sles_it_t              *c,
 
   /* Check matrix storage type */
 
-  if (cs_matrix_get_type(a) != CS_MATRIX_MSR)
+  cs_matrix_type_t a_type = cs_matrix_get_type(a);
+  if (a_type != CS_MATRIX_MSR && a_type != CS_MATRIX_SELL)
     bft_error
       (__FILE__, __LINE__, 0,
        _("Gauss-Seidel Jacobi hybrid solver only supported with a\n"
-         "matrix using %s storage."),
-       "MSR");
+         "matrix using %s or %s storage."),
+       "MSR", "SELL");
 
   /* Allocate or map work arrays */
   /*-----------------------------*/
@@ -3966,6 +4600,8 @@ cs_sles_it_create(cs_sles_it_type_t   solver_type,
   case CS_SLES_BICGSTAB:
   case CS_SLES_BICGSTAB2:
   case CS_SLES_PCR3:
+  case CS_SLES_PIPELINED_PCG:
+  case CS_SLES_PIPELINED_GMRES:
     c->fallback_cvg = CS_SLES_BREAKDOWN;
     break;
   default:
@@ -4045,7 +4681,8 @@ cs_sles_it_copy(const void  *context)
     }
 
     /* If useful, copy the restart interval */
-    if (c->type == CS_SLES_GMRES || c->type == CS_SLES_GCR)
+    if (   c->type == CS_SLES_GMRES || c->type == CS_SLES_GCR
+        || c->type == CS_SLES_PIPELINED_GMRES)
       d->restart_interval = c->restart_interval;
 
 #if defined(HAVE_MPI)
@@ -4081,7 +4718,8 @@ cs_sles_it_log(const void  *context,
       cs_log_printf(log_type,
                     _("  Preconditioning:                   %s\n"),
                     _(cs_sles_pc_get_type_name(c->pc)));
-    if (c->type == CS_SLES_GMRES || c->type == CS_SLES_GCR)
+    if (   c->type == CS_SLES_GMRES || c->type == CS_SLES_GCR
+        || c->type == CS_SLES_PIPELINED_GMRES)
       cs_log_printf(log_type,
                     "  Restart interval:                  %d\n",
                     c->restart_interval);
@@ -4211,12 +4849,32 @@ cs_sles_it_setup(void               *context,
       || (   c->type >= CS_SLES_P_GAUSS_SEIDEL
           && c->type <= CS_SLES_P_SYM_GAUSS_SEIDEL)) {
     /* Force to Jacobi in case matrix type is not adapted */
-    if (cs_matrix_get_type(a) != CS_MATRIX_MSR) {
+    cs_matrix_type_t a_type = cs_matrix_get_type(a);
+    if (a_type != CS_MATRIX_MSR && a_type != CS_MATRIX_SELL) {
       c->type = CS_SLES_JACOBI;
     }
     block_nn_inverse = true;
   }
 
+  /* Pipelined variants deduce preconditioned vectors by linearity, so
+     switch to flexible variants when the preconditioner is variable */
+
+  if (   (   c->type == CS_SLES_PIPELINED_PCG
+          || c->type == CS_SLES_PIPELINED_GMRES)
+      && _pc_is_linear(c->pc) == false) {
+    cs_sles_it_type_t f_type = (c->type == CS_SLES_PIPELINED_PCG) ?
+      CS_SLES_FCG : CS_SLES_GCR;
+    cs_base_warn(__FILE__, __LINE__);
+    bft_printf(_("Linear system \"%s\":\n"
+                 "  the %s solver requires a linear preconditioner,\n"
+                 "  but %s preconditioning is used;\n"
+                 "  %s is used instead.\n"),
+               name, _(cs_sles_it_type_name[c->type]),
+               cs_sles_pc_get_type_name(c->pc),
+               _(cs_sles_it_type_name[f_type]));
+    c->type = f_type;
+  }
+
   switch (c->type) {
 
   case CS_SLES_PCR3:
@@ -4316,6 +4974,15 @@ cs_sles_it_setup(void               *context,
     c->solve = _gmres;
     break;
 
+  case CS_SLES_PIPELINED_PCG:
+    c->solve = _pipelined_conjugate_gradient;
+    break;
+
+  case CS_SLES_PIPELINED_GMRES:
+    assert(c->restart_interval > 1);
+    c->solve = _pipelined_gmres;
+    break;
+
   case CS_SLES_P_GAUSS_SEIDEL:
     c->solve = _p_gauss_seidel;
     break;
@@ -4921,9 +5588,9 @@ cs_sles_it_set_breakdown_threshold(double         threshold)
  * \brief Define convergence level under which the fallback to another
  *        solver may be used if applicable.
  *
- * Currently, this mechanism is only by default used for BiCGstab and
- * 3-layer conjugate residual solvers with scalar matrices, which may
- * fall back to a preconditioned GMRES solver. For those solvers, the
+ * Currently, this mechanism is only by default used for BiCGstab,
+ * 3-layer conjugate residual and pipelined solvers with scalar matrices,
+ * which may fall back to a preconditioned GMRES solver. For those solvers, the
  * default threshold is \ref CS_SLES_BREAKDOWN, meaning that divergence
  * (but not breakdown) will lead to the use of the fallback mechanism.
  *
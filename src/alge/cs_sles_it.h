@@ -68,6 +68,14 @@ typedef enum {
   CS_SLES_P_GAUSS_SEIDEL,      /*!< Process-local Gauss-Seidel */
   CS_SLES_P_SYM_GAUSS_SEIDEL,  /*!< Process-local symmetric Gauss-Seidel */
   CS_SLES_PCR3,                /*!< 3-layer conjugate residual */
+  CS_SLES_PIPELINED_PCG,       /*!< Pipelined preconditioned conjugate
+                                    gradient (global reductions overlapped
+                                    with preconditioning and SpMV; replaced
+                                    by FCG with a variable preconditioner) */
+  CS_SLES_PIPELINED_GMRES,     /*!< Pipelined preconditioned GMRES
+                                    (one overlapped global reduction
+                                    per iteration; replaced by GCR with
+                                    a variable preconditioner) */
   CS_SLES_USER_DEFINED,        /*!< User-defined iterative solver */
 
   CS_SLES_N_IT_TYPES,          /*!< Number of resolution algorithms
@@ -75,6 +83,8 @@ typedef enum {
 
   CS_SLES_TS_F_GAUSS_SEIDEL,   /*!< Truncated forward Gauss-Seidel smoother */
   CS_SLES_TS_B_GAUSS_SEIDEL,   /*!< Truncated backward Gauss-Seidel smoother */
+  CS_SLES_CHEBYSHEV,           /*!< Jacobi-preconditioned Chebyshev
+                                    polynomial smoother */
 
   CS_SLES_N_SMOOTHER_TYPES     /*!< Number of resolution algorithms
                                     including smoother only */
@@ -480,10 +490,10 @@ cs_sles_it_set_breakdown_threshold(double         threshold);
  * \brief Define convergence level under which the fallback to another
  *        solver may be used if applicable.
  *
- * Currently, this mechanism is only by default used for BiCGstab and
- * 3-layer conjugate residual solvers with scalar matrices, which may
- * fall back to a preconditioned GMRES solver. For those solvers, the
- * default threshold is \ref CS_SLES_BREAKDOWN, meaning that divergence
+ * Currently, this mechanism is only by default used for BiCGstab,
+ * 3-layer conjugate residual and pipelined solvers with scalar matrices,
+ * which may fall back to a preconditioned GMRES solver. For those solvers,
+ * the default threshold is \ref CS_SLES_BREAKDOWN, meaning that divergence
  * (but not breakdown) will lead to the use of the fallback mechanism.
  *
  * \param[in, out]  context    pointer to iterative solver info and context
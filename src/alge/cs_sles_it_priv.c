@@ -240,6 +240,8 @@ cs_sles_it_setup_priv(cs_sles_it_t       *c,
     sd->_ad_inv = NULL;
     sd->pc_context = NULL;
     sd->pc_apply = NULL;
+    sd->eig_min = 0;
+    sd->eig_max = 0;
   }
 
   sd->n_rows = cs_matrix_get_n_rows(a) * diag_block_size;
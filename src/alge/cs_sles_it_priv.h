@@ -139,6 +139,10 @@ typedef struct _cs_sles_it_setup_t {
   void                *pc_context;       /* preconditioner context */
   cs_sles_pc_apply_t  *pc_apply;         /* preconditioner apply */
 
+  double               eig_min;          /* estimated spectral bounds of
+                                            D^-1.A (Chebyshev smoother) */
+  double               eig_max;
+
 } cs_sles_it_setup_t;
 
 /* Solver additional data */
@@ -47,6 +47,7 @@
 
 #include "bft_mem.h"
 #include "bft_error.h"
+#include "bft_printf.h"
 
 #include "cs_base.h"
 #include "cs_blas.h"
@@ -211,6 +212,7 @@ BEGIN_C_DECLS
   - Jacobi
   - polynomial of degree 1
   - polynomial of degree 2
+  - incomplete LU factorization without fill-in (ILU(0))
 
   Polynomial preconditioning is explained here:
   \a D being the diagonal part of matrix \a A and \a X its extra-diagonal
@@ -235,6 +237,16 @@ BEGIN_C_DECLS
   for additional parameter setting functions, only degrees 1
   and 2 are provided here.
 
+  The ILU(0) preconditioner factors the rank-local part of the matrix,
+  so it is a block-Jacobi preconditioner in parallel, with ILU(0) in each
+  block. For symmetric matrices, it is equivalent to an incomplete
+  Cholesky (IC(0)) factorization. Forward and backward substitutions are
+  multithreaded using level scheduling, so their parallel efficiency
+  depends on the mesh numbering (the number of levels grows with the
+  bandwidth of the matrix). This preconditioner is significantly more
+  costly to apply than the polynomial ones, but may greatly reduce the
+  number of iterations for stiff, convection-dominated problems.
+
 */
 
 /*! \cond DOXYGEN_SHOULD_SKIP_THIS */
@@ -274,10 +286,47 @@ struct _cs_sles_pc_t {
 
 };
 
+/* Structure for incomplete LU factorization (ILU(0)) preconditioner */
+/*-------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t            n_rows;            /* Number of associated rows */
+
+  cs_lnum_t           *l_index;           /* Lower part row index */
+  cs_lnum_t           *l_col_id;          /* Lower part column ids */
+  cs_real_t           *l_val;             /* Lower part values
+                                             (unit diagonal implied) */
+
+  cs_lnum_t           *u_index;           /* Upper part row index */
+  cs_lnum_t           *u_col_id;          /* Upper part column ids */
+  cs_real_t           *u_val;             /* Upper part values
+                                             (excluding diagonal) */
+
+  cs_real_t           *ad_inv;            /* Inverse of upper part
+                                             diagonal */
+
+  int                  n_l_levels;        /* Number of levels for
+                                             forward substitution */
+  int                  n_u_levels;        /* Number of levels for
+                                             backward substitution */
+
+  cs_lnum_t           *l_level_index;     /* Forward levels index */
+  cs_lnum_t           *u_level_index;     /* Backward levels index */
+  cs_lnum_t           *l_level_rows;      /* Rows, by forward level */
+  cs_lnum_t           *u_level_rows;      /* Rows, by backward level */
+
+} cs_sles_pc_ilu_t;
+
 /*============================================================================
  *  Global variables
  *============================================================================*/
 
+/* Relative threshold (to the row norm) below which ILU(0) pivots
+   are replaced */
+
+static const cs_real_t _ilu_pivot_eps = 1.e-10;
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -679,6 +728,540 @@ _sles_pc_poly_destroy (void  **context)
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Sort the column ids of a matrix row, and apply the sort to the
+ * associated values (insertion sort, as rows are short).
+ *
+ * parameters:
+ *   n       <-- number of row elements
+ *   col_id  <-> row column ids
+ *   val     <-> row values
+ *----------------------------------------------------------------------------*/
+
+static void
+_sort_row(cs_lnum_t   n,
+          cs_lnum_t   col_id[],
+          cs_real_t   val[])
+{
+  for (cs_lnum_t i = 1; i < n; i++) {
+    cs_lnum_t c = col_id[i];
+    cs_real_t v = val[i];
+    cs_lnum_t j = i;
+    while (j > 0 && col_id[j-1] > c) {
+      col_id[j] = col_id[j-1];
+      val[j] = val[j-1];
+      j--;
+    }
+    col_id[j] = c;
+    val[j] = v;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Build level schedule for a triangular solve.
+ *
+ * Each row's level is one more than the maximum level of the rows it
+ * depends on, so that all rows of a given level may be handled in
+ * parallel once previous levels are done.
+ *
+ * parameters:
+ *   n_rows       <-- number of rows
+ *   forward      <-- true for lower (forward) solve, false for upper
+ *   index        <-- triangular part row index
+ *   col_id       <-- triangular part column ids
+ *   n_levels     --> number of levels
+ *   level_index  --> level index (size: n_levels + 1)
+ *   level_rows   --> rows ordered by level (size: n_rows)
+ *----------------------------------------------------------------------------*/
+
+static void
+_ilu_level_schedule(cs_lnum_t          n_rows,
+                    bool               forward,
+                    const cs_lnum_t    index[],
+                    const cs_lnum_t    col_id[],
+                    int               *n_levels,
+                    cs_lnum_t        **level_index,
+                    cs_lnum_t        **level_rows)
+{
+  int *level;
+  BFT_MALLOC(level, n_rows, int);
+
+  int _n_levels = 0;
+
+  for (cs_lnum_t k = 0; k < n_rows; k++) {
+    const cs_lnum_t i = (forward) ? k : n_rows - 1 - k;
+    int l = 0;
+    for (cs_lnum_t j = index[i]; j < index[i+1]; j++) {
+      if (level[col_id[j]] >= l)
+        l = level[col_id[j]] + 1;
+    }
+    level[i] = l;
+    if (l >= _n_levels)
+      _n_levels = l + 1;
+  }
+
+  cs_lnum_t *_level_index, *_level_rows;
+  BFT_MALLOC(_level_index, _n_levels + 1, cs_lnum_t);
+  BFT_MALLOC(_level_rows, n_rows, cs_lnum_t);
+
+  for (int l = 0; l < _n_levels + 1; l++)
+    _level_index[l] = 0;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++)
+    _level_index[level[i] + 1] += 1;
+
+  for (int l = 0; l < _n_levels; l++)
+    _level_index[l+1] += _level_index[l];
+
+  /* Rows are added in increasing order within each level, to keep
+     memory accesses as local as possible */
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    int l = level[i];
+    _level_rows[_level_index[l]] = i;
+    _level_index[l] += 1;
+  }
+
+  for (int l = _n_levels; l > 0; l--)
+    _level_index[l] = _level_index[l-1];
+  _level_index[0] = 0;
+
+  BFT_FREE(level);
+
+  *n_levels = _n_levels;
+  *level_index = _level_index;
+  *level_rows = _level_rows;
+}
+
+/*----------------------------------------------------------------------------
+ * Create an ILU(0) preconditioner structure.
+ *
+ * returns:
+ *   pointer to newly created preconditioner object.
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_ilu_t *
+_sles_pc_ilu_create(void)
+{
+  cs_sles_pc_ilu_t *pc;
+
+  BFT_MALLOC(pc, 1, cs_sles_pc_ilu_t);
+
+  pc->n_rows = 0;
+
+  pc->l_index = NULL;
+  pc->l_col_id = NULL;
+  pc->l_val = NULL;
+
+  pc->u_index = NULL;
+  pc->u_col_id = NULL;
+  pc->u_val = NULL;
+
+  pc->ad_inv = NULL;
+
+  pc->n_l_levels = 0;
+  pc->n_u_levels = 0;
+  pc->l_level_index = NULL;
+  pc->u_level_index = NULL;
+  pc->l_level_rows = NULL;
+  pc->u_level_rows = NULL;
+
+  return pc;
+}
+
+/*----------------------------------------------------------------------------
+ * Function returning the type name of ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context   <-- pointer to preconditioner context
+ *   logging   <-- if true, logging description; if false, canonical name
+ *----------------------------------------------------------------------------*/
+
+static const char *
+_sles_pc_ilu_get_type(const void  *context,
+                      bool         logging)
+{
+  CS_UNUSED(context);
+
+  if (logging == false) {
+    static const char t[] = "ilu0";
+    return t;
+  }
+  else {
+    static const char t[] = N_("ILU(0), block Jacobi");
+    return _(t);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Function for freeing of an ILU(0) preconditioner's context data.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_free(void  *context)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  c->n_rows = 0;
+
+  BFT_FREE(c->l_index);
+  BFT_FREE(c->l_col_id);
+  BFT_FREE(c->l_val);
+
+  BFT_FREE(c->u_index);
+  BFT_FREE(c->u_col_id);
+  BFT_FREE(c->u_val);
+
+  BFT_FREE(c->ad_inv);
+
+  c->n_l_levels = 0;
+  c->n_u_levels = 0;
+  BFT_FREE(c->l_level_index);
+  BFT_FREE(c->u_level_index);
+  BFT_FREE(c->l_level_rows);
+  BFT_FREE(c->u_level_rows);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for setup of an ILU(0) preconditioner context.
+ *
+ * Only the rank-local part of the matrix is factored (i.e. couplings
+ * with halo values are ignored), leading to a block-Jacobi type
+ * preconditioner in parallel.
+ *
+ * parameters:
+ *   context   <-> pointer to preconditioner context
+ *   name      <-- pointer to name of associated linear system
+ *   a         <-- matrix
+ *   accel     <-- use accelerator version ?
+ *   verbosity <-- associated verbosity
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_setup(void               *context,
+                   const char         *name,
+                   const cs_matrix_t  *a,
+                   bool                accel,
+                   int                 verbosity)
+{
+  CS_UNUSED(accel);
+
+  cs_sles_pc_ilu_t  *c = context;
+
+  _sles_pc_ilu_free(c);
+
+  /* Block matrices are not handled; no preconditioning is applied
+     in this case (empty level schedules lead to an identity operator) */
+
+  const cs_lnum_t db_size = cs_matrix_get_diag_block_size(a);
+
+  if (db_size != 1) {
+    c->n_rows = cs_matrix_get_n_rows(a) * db_size;
+    if (verbosity > 0)
+      bft_printf(_("  ILU(0) preconditioner for \"%s\":\n"
+                   "    block matrices are not handled;"
+                   " no preconditioning is applied.\n"),
+                 name);
+    return;
+  }
+
+  /* Access matrix arrays */
+
+  const cs_lnum_t n_rows = cs_matrix_get_n_rows(a);
+  const cs_lnum_t *row_index = NULL, *col_id = NULL;
+  const cs_real_t *d_val = NULL, *x_val = NULL;
+
+  cs_matrix_type_t m_type = cs_matrix_get_type(a);
+
+  if (m_type == CS_MATRIX_MSR || m_type == CS_MATRIX_SELL)
+    cs_matrix_get_msr_arrays(a, &row_index, &col_id, &d_val, &x_val);
+  else if (m_type == CS_MATRIX_CSR)
+    cs_matrix_get_csr_arrays(a, &row_index, &col_id, &x_val);
+  else
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: ILU(0) preconditioner for system \"%s\"\n"
+                "is not available for matrix type: %s."),
+              __func__, name, cs_matrix_get_type_name(a));
+
+  c->n_rows = n_rows;
+
+  /* Split local part of matrix in strictly lower and upper parts */
+
+  BFT_MALLOC(c->l_index, n_rows+1, cs_lnum_t);
+  BFT_MALLOC(c->u_index, n_rows+1, cs_lnum_t);
+  BFT_MALLOC(c->ad_inv, n_rows, cs_real_t);
+
+  c->l_index[0] = 0;
+  c->u_index[0] = 0;
+
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_lnum_t n_l = 0, n_u = 0;
+    if (x_val != NULL) {
+      for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+        if (col_id[j] < i)
+          n_l++;
+        else if (col_id[j] > i && col_id[j] < n_rows)
+          n_u++;
+      }
+    }
+    c->l_index[i+1] = c->l_index[i] + n_l;
+    c->u_index[i+1] = c->u_index[i] + n_u;
+  }
+
+  BFT_MALLOC(c->l_col_id, c->l_index[n_rows], cs_lnum_t);
+  BFT_MALLOC(c->l_val, c->l_index[n_rows], cs_real_t);
+  BFT_MALLOC(c->u_col_id, c->u_index[n_rows], cs_lnum_t);
+  BFT_MALLOC(c->u_val, c->u_index[n_rows], cs_real_t);
+
+  cs_real_t *restrict ad = c->ad_inv;
+
+# pragma omp parallel for if(n_rows > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_rows; i++) {
+    cs_lnum_t l_id = c->l_index[i], u_id = c->u_index[i];
+    ad[i] = (d_val != NULL) ? d_val[i] : 0.;
+    if (x_val != NULL) {
+      for (cs_lnum_t j = row_index[i]; j < row_index[i+1]; j++) {
+        cs_lnum_t k = col_id[j];
+        if (k < i) {
+          c->l_col_id[l_id] = k;
+          c->l_val[l_id++] = x_val[j];
+        }
+        else if (k == i)
+          ad[i] += x_val[j];
+        else if (k < n_rows) {
+          c->u_col_id[u_id] = k;
+          c->u_val[u_id++] = x_val[j];
+        }
+      }
+    }
+    _sort_row(c->l_index[i+1] - c->l_index[i],
+              c->l_col_id + c->l_index[i],
+              c->l_val + c->l_index[i]);
+    _sort_row(c->u_index[i+1] - c->u_index[i],
+              c->u_col_id + c->u_index[i],
+              c->u_val + c->u_index[i]);
+  }
+
+  /* Build level schedules for triangular solves */
+
+  _ilu_level_schedule(n_rows, true, c->l_index, c->l_col_id,
+                      &(c->n_l_levels), &(c->l_level_index),
+                      &(c->l_level_rows));
+
+  _ilu_level_schedule(n_rows, false, c->u_index, c->u_col_id,
+                      &(c->n_u_levels), &(c->u_level_index),
+                      &(c->u_level_rows));
+
+  /* Incomplete factorization (IKJ variant, no fill-in).
+     Row i only depends on rows of its lower part, which belong to
+     previous levels of the forward schedule, so rows of a given
+     level may be factored in parallel. */
+
+  const cs_lnum_t *restrict l_index = c->l_index;
+  const cs_lnum_t *restrict l_col_id = c->l_col_id;
+  const cs_lnum_t *restrict u_index = c->u_index;
+  const cs_lnum_t *restrict u_col_id = c->u_col_id;
+  cs_real_t *restrict l_val = c->l_val;
+  cs_real_t *restrict u_val = c->u_val;
+
+  /* Row column ids being sorted, entries of row i matching those of
+     the upper part of row k are found by merging, so no (thread-private)
+     work array is needed */
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+    for (int l = 0; l < c->n_l_levels; l++) {
+
+#     pragma omp for
+      for (cs_lnum_t ii = c->l_level_index[l];
+           ii < c->l_level_index[l+1];
+           ii++) {
+
+        const cs_lnum_t i = c->l_level_rows[ii];
+        const cs_lnum_t l_e_id = l_index[i+1], u_e_id = u_index[i+1];
+
+        cs_real_t d = ad[i];
+
+        /* Norm of original row (only modified when row i is factored),
+           used to scale replacement of (near) zero pivots */
+
+        cs_real_t r_norm = CS_ABS(d);
+        for (cs_lnum_t j = l_index[i]; j < l_e_id; j++)
+          r_norm += CS_ABS(l_val[j]);
+        for (cs_lnum_t j = u_index[i]; j < u_e_id; j++)
+          r_norm += CS_ABS(u_val[j]);
+
+        for (cs_lnum_t j = l_index[i]; j < l_e_id; j++) {
+          const cs_lnum_t k = l_col_id[j];
+          const cs_real_t l_ik = l_val[j] * ad[k];  /* ad[k] already
+                                                       inverted */
+          l_val[j] = l_ik;
+
+          /* Columns of upper part of row k are > k, so matching lower
+             part entries of row i are after j */
+
+          cs_lnum_t jl = j + 1, ju = u_index[i];
+
+          for (cs_lnum_t jj = u_index[k]; jj < u_index[k+1]; jj++) {
+            const cs_lnum_t kk = u_col_id[jj];
+            if (kk < i) {
+              while (jl < l_e_id && l_col_id[jl] < kk)
+                jl++;
+              if (jl < l_e_id && l_col_id[jl] == kk)
+                l_val[jl] -= l_ik * u_val[jj];
+            }
+            else if (kk == i)
+              d -= l_ik * u_val[jj];
+            else {
+              while (ju < u_e_id && u_col_id[ju] < kk)
+                ju++;
+              if (ju < u_e_id && u_col_id[ju] == kk)
+                u_val[ju] -= l_ik * u_val[jj];
+            }
+          }
+        }
+
+        /* Replace (unlikely) zero or tiny pivots by a value of the same
+           sign scaled by the row norm; an empty row leads to identity */
+
+        const cs_real_t d_min = _ilu_pivot_eps * r_norm;
+
+        if (CS_ABS(d) <= d_min) {
+          if (d_min > 0)
+            d = (d < 0) ? -d_min : d_min;
+          else
+            d = 1.;
+        }
+
+        ad[i] = 1. / d;
+
+      }
+
+    }
+  }
+
+  if (verbosity > 1)
+    bft_printf(_("  ILU(0) preconditioner for \"%s\":\n"
+                 "    rows: %ld; forward levels: %d; backward levels: %d\n"),
+               name, (long)n_rows, c->n_l_levels, c->n_u_levels);
+}
+
+/*----------------------------------------------------------------------------
+ * Function for application of an ILU(0) preconditioner.
+ *
+ * Forward and backward substitutions are parallelized using the
+ * level schedules built at setup.
+ *
+ * In cases where it is desired that the preconditioner modify a vector
+ * "in place", x_in should be set to NULL, and x_out contain the vector to
+ * be modified (\f$x_{out} \leftarrow M^{-1}x_{out})\f$).
+ *
+ * parameters:
+ *   context       <-> pointer to preconditioner context
+ *   x_in          <-- input vector
+ *   x_out         <-> input/output vector
+ *
+ * returns:
+ *   preconditioner application status
+ *----------------------------------------------------------------------------*/
+
+static cs_sles_pc_state_t
+_sles_pc_ilu_apply(void                *context,
+                   const cs_real_t     *x_in,
+                   cs_real_t           *x_out)
+{
+  cs_sles_pc_ilu_t  *c = context;
+
+  const cs_lnum_t n_rows = c->n_rows;
+
+  const cs_lnum_t *restrict l_index = c->l_index;
+  const cs_lnum_t *restrict l_col_id = c->l_col_id;
+  const cs_real_t *restrict l_val = c->l_val;
+  const cs_lnum_t *restrict u_index = c->u_index;
+  const cs_lnum_t *restrict u_col_id = c->u_col_id;
+  const cs_real_t *restrict u_val = c->u_val;
+  const cs_real_t *restrict ad_inv = c->ad_inv;
+
+# pragma omp parallel if(n_rows > CS_THR_MIN)
+  {
+    if (x_in != NULL) {
+#     pragma omp for
+      for (cs_lnum_t ii = 0; ii < n_rows; ii++)
+        x_out[ii] = x_in[ii];
+    }
+
+    /* Forward substitution (unit lower triangular part) */
+
+    for (int l = 0; l < c->n_l_levels; l++) {
+#     pragma omp for
+      for (cs_lnum_t ii = c->l_level_index[l];
+           ii < c->l_level_index[l+1];
+           ii++) {
+        const cs_lnum_t i = c->l_level_rows[ii];
+        cs_real_t s = x_out[i];
+        for (cs_lnum_t j = l_index[i]; j < l_index[i+1]; j++)
+          s -= l_val[j] * x_out[l_col_id[j]];
+        x_out[i] = s;
+      }
+    }
+
+    /* Backward substitution (upper triangular part) */
+
+    for (int l = 0; l < c->n_u_levels; l++) {
+#     pragma omp for
+      for (cs_lnum_t ii = c->u_level_index[l];
+           ii < c->u_level_index[l+1];
+           ii++) {
+        const cs_lnum_t i = c->u_level_rows[ii];
+        cs_real_t s = x_out[i];
+        for (cs_lnum_t j = u_index[i]; j < u_index[i+1]; j++)
+          s -= u_val[j] * x_out[u_col_id[j]];
+        x_out[i] = s * ad_inv[i];
+      }
+    }
+  }
+
+  return CS_SLES_PC_CONVERGED;
+}
+
+/*----------------------------------------------------------------------------
+ * Function for creation of an ILU(0) preconditioner context based on the
+ * copy of another.
+ *
+ * parameters:
+ *   context  <-- context to clone
+ *
+ * returns:
+ *   pointer to newly created context
+ *----------------------------------------------------------------------------*/
+
+static void *
+_sles_pc_ilu_clone(const void  *context)
+{
+  CS_UNUSED(context);
+
+  return _sles_pc_ilu_create();
+}
+
+/*----------------------------------------------------------------------------
+ * Function pointer for destruction of an ILU(0) preconditioner context.
+ *
+ * parameters:
+ *   context <-> pointer to preconditioner context
+ *----------------------------------------------------------------------------*/
+
+static void
+_sles_pc_ilu_destroy (void  **context)
+{
+  if (context != NULL) {
+    _sles_pc_ilu_free(*context);
+    BFT_FREE(*context);
+  }
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1140,6 +1723,39 @@ cs_sles_pc_poly_2_create(void)
   return pc;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) preconditioner.
+ *
+ * The rank-local part of the matrix is factored, so this is a block-Jacobi
+ * preconditioner with ILU(0) in each block when running in parallel.
+ * For symmetric matrices, this is equivalent to IC(0).
+ *
+ * Only scalar matrices with MSR, SELL or CSR storage are handled; for
+ * block matrices, no preconditioning is applied.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void)
+{
+  cs_sles_pc_ilu_t *pcp = _sles_pc_ilu_create();
+
+  cs_sles_pc_t *pc = cs_sles_pc_define(pcp,
+                                       _sles_pc_ilu_get_type,
+                                       _sles_pc_ilu_setup,
+                                       NULL,
+                                       _sles_pc_ilu_apply,
+                                       _sles_pc_ilu_free,
+                                       NULL,
+                                       _sles_pc_ilu_clone,
+                                       _sles_pc_ilu_destroy);
+
+  return pc;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -508,6 +508,24 @@ cs_sles_pc_poly_1_create(void);
 cs_sles_pc_t *
 cs_sles_pc_poly_2_create(void);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Create an ILU(0) preconditioner.
+ *
+ * The rank-local part of the matrix is factored, so this is a block-Jacobi
+ * preconditioner with ILU(0) in each block when running in parallel.
+ * For symmetric matrices, this is equivalent to IC(0).
+ *
+ * Only scalar matrices with MSR, SELL or CSR storage are handled; for
+ * block matrices, no preconditioning is applied.
+ *
+ * \return  pointer to newly created preconditioner object.
+ */
+/*----------------------------------------------------------------------------*/
+
+cs_sles_pc_t *
+cs_sles_pc_ilu0_create(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
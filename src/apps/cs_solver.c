@@ -76,6 +76,7 @@
 #include "cs_gui_particles.h"
 #include "cs_gui_radiative_transfer.h"
 #include "cs_gui_util.h"
+#include "cs_halo.h"
 #include "cs_io.h"
 #include "cs_join.h"
 #include "cs_lagr.h"
@@ -87,6 +88,7 @@
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_cartesian.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quality.h"
@@ -619,6 +621,7 @@ _run(void)
 
   cs_cell_to_vertex_free();
   cs_mesh_adjacencies_finalize();
+  cs_mesh_cartesian_stencil_free();
 
   cs_boundary_zone_finalize();
   cs_volume_zone_finalize();
@@ -633,6 +636,7 @@ _run(void)
   /* CPU times and memory management finalization */
 
   cs_all_to_all_log_finalize();
+  cs_halo_log_finalize();
   cs_io_log_finalize();
 
   cs_timer_stats_finalize();
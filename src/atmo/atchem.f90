@@ -80,6 +80,14 @@ module atchem
   !> maximal time step for chemistry resolution
   double precision dtchemmax
 
+  !> iadaptchemistry: fixed sub-steps of dtchemmax (=0) or per-cell adaptive
+  !> sub-steps bounded by dtchemmax (=1) for chemistry resolution
+  integer, save :: iadaptchemistry
+  !> relative tolerance for adaptive chemistry sub-steps
+  double precision, save :: rtolchem
+  !> absolute tolerance for adaptive chemistry sub-steps
+  double precision, save :: atolchem
+
   !> number of time steps for the concentration profiles file
   integer, save         ::  nbchim
   !> number of altitudes for the concentration profiles file
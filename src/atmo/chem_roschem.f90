@@ -37,10 +37,12 @@
 !> \param[in]     dlstep        time step
 !> \param[in]     dlrki         kinetic rates for first iteration
 !> \param[in]     dlrkf         kinetic rates for second iteration
+!> \param[out]    dlerr         scaled local error estimate (based on the
+!>                              embedded first order solution)
 !______________________________________________________________________________
 
 subroutine chem_roschem (dlconc,zcsourc,zcsourcf,conv_factor,                 &
-                         dlstep,dlrki,dlrkf)
+                         dlstep,dlrki,dlrkf,dlerr)
 
 !===============================================================================
 ! Module files
@@ -57,6 +59,7 @@ double precision zcsourc(nespg),zcsourcf(nespg)
 double precision conv_factor(nespg)
 double precision dlstep
 double precision dlrki(nrg),dlrkf(nrg)
+double precision dlerr
 
 
 ! Local variables
@@ -146,11 +149,18 @@ call cs_solvlin (1,dlmat,dlmatlu,dlk2,dlb2)
 
 !------------------------------------------------------------------------
 !*    6. Outputs - Compute DLconc - Advance the time
+!        The difference with the first order solution (dlconcbis)
+!        provides the local error estimate
+
+dlerr = 0.d0
 
 do ji = 1, nespg
   dlconc(ji) = dlconc(ji) + 1.5d0 * dlstep * dlk1(ji)         &
              + 0.5d0 * dlstep * dlk2(ji)
 
+  dlerr = max(dlerr, 0.5d0*dlstep*abs(dlk1(ji) + dlk2(ji))    &
+                     / (atolchem + rtolchem*abs(dlconc(ji))))
+
   if (dlconc(ji) .lt. 0.0d0) then
     dlconc(ji) = 0.d0
   endif
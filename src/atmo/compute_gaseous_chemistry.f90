@@ -26,6 +26,10 @@
 
 !> \file compute_gaseous_chemistry.f90
 !> \brief Calls the rosenbrock resolution for atmospheric chemistry
+!>
+!> Cells are handled by blocks, whose species values are gathered in
+!> contiguous work arrays; blocks are distributed over threads (except
+!> for user-defined schemes, whose thread-safety is not guaranteed).
 !
 !-------------------------------------------------------------------------------
 
@@ -70,18 +74,10 @@ double precision dt(ncelet)
 
 ! Local Variables
 
-integer iel,ii
-double precision rom
+integer ii, iblk, nblk, s_id, nc
 
-!  Variables used for Rosenbrock resolution
-double precision  dlconc(nespg)
-double precision  source(nespg)
-double precision  dchema(nespg)
-double precision  conv_factor(nespg) ! conversion factors for reaction rates
-double precision rk(nrg)
-double precision dtc
-integer ncycle
-double precision dtrest
+! Number of cells per block
+integer, parameter :: nblkcel = 64
 
 double precision, dimension(:), pointer :: crom
 type(pmapper_double_r1), dimension(:), allocatable :: cvar_espg, cvara_espg
@@ -99,99 +95,233 @@ do ii = 1, nespg
   call field_get_val_prev_s(ivarfl(isca(isca_chem(ii))), cvara_espg(ii)%p)
 enddo
 
-do iel = 1, ncel
+nblk = (ncel + nblkcel - 1) / nblkcel
+
+!$omp parallel do private(s_id, nc) schedule(dynamic) &
+!$omp&            if(ichemistry.lt.4 .and. nblk.gt.1)
+do iblk = 1, nblk
+
+  s_id = (iblk-1)*nblkcel + 1
+  nc = min(iblk*nblkcel, ncel) - s_id + 1
+
+  call chem_solve_block(s_id, nc, dt, crom, cvar_espg, cvara_espg)
+
+enddo
+
+deallocate(cvar_espg, cvara_espg)
+
+! Clipping
+do ii = 1, nespg
+  call clpsca(isca_chem(ii))
+enddo
+
+!--------
+! FORMATS
+!--------
+!----
+! END
+!----
+
+return
+end subroutine compute_gaseous_chemistry
+
+!===============================================================================
+
+!> chem_solve_block
+!> \brief Rosenbrock resolution of atmospheric chemistry for a block of cells
+!------------------------------------------------------------------------------
+
+!------------------------------------------------------------------------------
+! Arguments
+!------------------------------------------------------------------------------
+!   mode          name          role
+!------------------------------------------------------------------------------
+!> \param[in]     s_id          first cell of block
+!> \param[in]     nc            number of cells in block
+!> \param[in]     dt            time step (per cell)
+!> \param[in]     crom          density
+!> \param[in]     cvar_espg     species values at current time step
+!> \param[in]     cvara_espg    species values at previous time step
+!______________________________________________________________________________
+
+subroutine chem_solve_block(s_id, nc, dt, crom, cvar_espg, cvara_espg)
+
+!===============================================================================
+! Module files
+!===============================================================================
+
+use optcal
+use pointe
+use mesh
+use field
+use atchem
+
+implicit none
 
-  ! time step
-  dtc = dt(iel)
+! Arguments
+
+integer s_id, nc
+double precision dt(ncelet), crom(ncelet)
+type(pmapper_double_r1) :: cvar_espg(nespg), cvara_espg(nespg)
+
+! Local Variables
+
+integer iel, ic, ii, ncycle, nrej
+double precision dtc, dtrest, dtsub, tsub, dlerr
 
-  ! density
-  rom = crom(iel)
+!  Block work arrays (species and reactions contiguous for each cell)
+double precision  dlconc(nespg,nc)
+double precision  source(nespg,nc)
+double precision  conv_factor(nespg,nc)
+double precision  rk(nrg,nc)
+double precision  dchema(nespg)
+double precision  dlconc0(nespg)
 
-  ! Filling working array rk
-  do ii = 1, nrg
-    rk(ii) = reacnum((ii-1)*ncel+iel)
+! Maximum number of rejected adaptive sub-steps in a row
+integer, parameter :: nrejmax = 20
+
+!===============================================================================
+
+! Gather block values (looping on cells inside loop on species)
+
+do ii = 1, nrg
+  do ic = 1, nc
+    rk(ii,ic) = reacnum((ii-1)*ncel + s_id + ic - 1)
   enddo
+enddo
 
-  do ii = 1, nespg
-    conv_factor(chempoint(ii)) = rom*navo*(1.0d-9)/dmmk(ii)
-    source(ii) = 0.0d0
+do ii = 1, nespg
+  do ic = 1, nc
+    iel = s_id + ic - 1
+    conv_factor(chempoint(ii),ic) = crom(iel)*navo*(1.0d-9)/dmmk(ii)
+    source(chempoint(ii),ic) = 0.0d0
   enddo
+enddo
 
-  if ((isepchemistry.eq.1).or.(ntcabs.lt.ntinit)) then
-    ! -----------------------------
-    ! -- splitted Rosenbrock solver
-    ! -----------------------------
+if ((isepchemistry.eq.1).or.(ntcabs.lt.ntinit)) then
+  ! -----------------------------
+  ! -- splitted Rosenbrock solver
+  ! -----------------------------
 
-    ! Filling working array dlconc with values at current time step
-    do ii = 1, nespg
-      dlconc(chempoint(ii)) = cvar_espg(ii)%p(iel)
+  ! Filling working array dlconc with values at current time step
+  do ii = 1, nespg
+    do ic = 1, nc
+      dlconc(chempoint(ii),ic) = cvar_espg(ii)%p(s_id+ic-1)
     enddo
+  enddo
 
-  else
-    ! -----------------------------
-    ! -- semi-coupled Rosenbrock solver
-    ! -----------------------------
+else
+  ! -----------------------------
+  ! -- semi-coupled Rosenbrock solver
+  ! -----------------------------
 
-    ! Filling working array dlconc with values at previous time step
-    do ii = 1, nespg
-      dlconc(chempoint(ii)) = cvara_espg(ii)%p(iel)
+  ! Filling working array dlconc with values at previous time step
+  do ii = 1, nespg
+    do ic = 1, nc
+      dlconc(chempoint(ii),ic) = cvara_espg(ii)%p(s_id+ic-1)
     enddo
+  enddo
+
+  ! Computation of C(Xn), and explicit contribution from dynamics as a
+  ! source term: (X*-Xn)/dt(dynamics) - C(Xn). See usatch.f90
+  ! The first nespg user scalars are supposed to be chemical species
+  do ic = 1, nc
 
-    ! Computation of C(Xn)
     if (ichemistry.eq.1) then
-      call fexchem_1 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
+      call fexchem_1 (nespg,nrg,dlconc(:,ic),rk(:,ic),source(:,ic),     &
+                      conv_factor(:,ic),dchema)
     else if (ichemistry.eq.2) then
-      call fexchem_2 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
+      call fexchem_2 (nespg,nrg,dlconc(:,ic),rk(:,ic),source(:,ic),     &
+                      conv_factor(:,ic),dchema)
     else if (ichemistry.eq.3) then
-      call fexchem_3 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
+      call fexchem_3 (nespg,nrg,dlconc(:,ic),rk(:,ic),source(:,ic),     &
+                      conv_factor(:,ic),dchema)
     else if (ichemistry.eq.4) then
-      call fexchem_4 (nespg,nrg,dlconc,rk,source,conv_factor,dchema)
+      call fexchem_4 (nespg,nrg,dlconc(:,ic),rk(:,ic),source(:,ic),     &
+                      conv_factor(:,ic),dchema)
     endif
 
-    ! Explicit contribution from dynamics as a source term:
-    ! (X*-Xn)/dt(dynamics) - C(Xn). See usatch.f90
-    ! The first nespg user scalars are supposed to be chemical species
+    iel = s_id + ic - 1
     do ii = 1, nespg
-      source(chempoint(ii)) = (cvar_espg(ii)%p(iel)-cvara_espg(ii)%p(iel))/dtc  &
-                            - dchema(chempoint(ii))
+      source(chempoint(ii),ic) = (cvar_espg(ii)%p(iel)-cvara_espg(ii)%p(iel))  &
+                                / dt(iel) - dchema(chempoint(ii))
     enddo
 
-  endif ! End test isepchemistry
+  enddo
+
+endif ! End test isepchemistry
 
-  ! Rosenbrock resoluion
+! Rosenbrock resolution
+
+do ic = 1, nc
+
+  dtc = dt(s_id+ic-1)
+
+  if (iadaptchemistry.eq.0) then
+
+    ! The maximum time step used for chemistry resolution is dtchemmax
+    if (dtc.le.dtchemmax) then
+      call chem_roschem (dlconc(:,ic),source(:,ic),source(:,ic),            &
+                         conv_factor(:,ic),dtc,rk(:,ic),rk(:,ic),dlerr)
+    else
+      ncycle = int(dtc/dtchemmax)
+      dtrest = mod(dtc,dtchemmax)
+      do ii = 1, ncycle
+        call chem_roschem (dlconc(:,ic),source(:,ic),source(:,ic),          &
+                           conv_factor(:,ic),dtchemmax,rk(:,ic),rk(:,ic),   &
+                           dlerr)
+      enddo
+      call chem_roschem (dlconc(:,ic),source(:,ic),source(:,ic),            &
+                         conv_factor(:,ic),dtrest,rk(:,ic),rk(:,ic),dlerr)
+    endif
 
-  ! The maximum time step used for chemistry resolution is dtchemmax
-  if (dtc.le.dtchemmax) then
-    call chem_roschem (dlconc,source,source,conv_factor,dtc,rk,rk)
   else
-    ncycle = int(dtc/dtchemmax)
-    dtrest = mod(dtc,dtchemmax)
-    do ii = 1, ncycle
-      call chem_roschem (dlconc,source,source,conv_factor,dtchemmax,rk,rk)
+
+    ! Adaptive sub-steps, bounded by dtchemmax, rejected when the local
+    ! error estimate exceeds the tolerance (accepted anyway after nrejmax
+    ! successive rejections)
+    tsub = 0.d0
+    dtsub = min(dtc, dtchemmax)
+    nrej = 0
+
+    do while (tsub.lt.dtc)
+
+      dtsub = min(dtsub, dtc - tsub)
+
+      do ii = 1, nespg
+        dlconc0(ii) = dlconc(ii,ic)
+      enddo
+
+      call chem_roschem (dlconc(:,ic),source(:,ic),source(:,ic),            &
+                         conv_factor(:,ic),dtsub,rk(:,ic),rk(:,ic),dlerr)
+
+      if (dlerr.le.1.d0 .or. nrej.ge.nrejmax) then
+        tsub = tsub + dtsub
+        nrej = 0
+      else
+        do ii = 1, nespg
+          dlconc(ii,ic) = dlconc0(ii)
+        enddo
+        nrej = nrej + 1
+      endif
+
+      ! Second order scheme: error scales as dtsub**2
+      dtsub = dtsub * min(5.d0, max(0.2d0, 0.9d0/sqrt(max(dlerr, 1.d-10))))
+      dtsub = min(dtsub, dtchemmax)
+
     enddo
-    call chem_roschem (dlconc,source,source,conv_factor,dtrest,rk,rk)
-  endif
 
-  ! Update of values at current time step
-  do ii = 1, nespg
-    cvar_espg(ii)%p(iel) = dlconc(chempoint(ii))
-  enddo
+  endif
 
 enddo
 
-deallocate(cvar_espg, cvara_espg)
+! Update of values at current time step
 
-! Clipping
 do ii = 1, nespg
-  call clpsca(isca_chem(ii))
+  do ic = 1, nc
+    cvar_espg(ii)%p(s_id+ic-1) = dlconc(chempoint(ii),ic)
+  enddo
 enddo
 
-!--------
-! FORMATS
-!--------
-!----
-! END
-!----
-
 return
-end subroutine compute_gaseous_chemistry
+end subroutine chem_solve_block
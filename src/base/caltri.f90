@@ -1034,11 +1034,18 @@ if (iisuit.eq.1) then
     call les_balance_write_restart
   endif
 
+  ! Mark checkpoint as done (with asynchronous checkpoint writes, files
+  ! are completed before the next restart file is opened)
   call stusui
 
   ! Remove all unnecessary previous dumps of checkpoint files
   call restart_clean_multiwriters_history
 
+  ! Complete writes of the final checkpoint
+  if (ntcabs.eq.ntmabs) then
+    call restart_checkpoint_wait
+  endif
+
   call timer_stats_stop(restart_stats_id)
 
 endif ! iisuit = 1
@@ -973,9 +973,10 @@ _alltoall_caller_exchange_s(cs_all_to_all_t           *d,
   if (_dest_data == NULL && dc->recv_size*elt_size > 0)
     BFT_MALLOC(_dest_data, dc->recv_size*elt_size, unsigned char);
 
-  /* Data buffer for MPI exchange (may merge data and metadata) */
+  /* Data buffer for MPI exchange (may merge data and metadata,
+     or include padding for alignment) */
   if (   dc->dest_id_datatype == CS_LNUM_TYPE || d->recv_id != NULL
-      || reverse)
+      || reverse || dc->comp_size != elt_size)
     BFT_MALLOC(_recv_data, dc->recv_size*dc->comp_size, unsigned char);
   else
     _recv_data = _dest_data;
@@ -1911,9 +1912,10 @@ _hybrid_pex_exchange_s(cs_all_to_all_t  *d,
   if (_dest_data == NULL && hc->recv_size*elt_size > 0)
     BFT_MALLOC(_dest_data, hc->recv_size*elt_size, unsigned char);
 
-  /* Data buffer for MPI exchange (may merge data and metadata) */
+  /* Data buffer for MPI exchange (may merge data and metadata,
+     or include padding for alignment) */
   if (   hc->dest_id_datatype == CS_LNUM_TYPE || d->recv_id != NULL
-      || reverse)
+      || reverse || hc->comp_size != elt_size)
     BFT_MALLOC(_recv_data, hc->recv_size*hc->comp_size, unsigned char);
   else
     _recv_data = _dest_data;
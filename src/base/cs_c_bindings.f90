@@ -601,6 +601,16 @@ module cs_c_bindings
 
     !---------------------------------------------------------------------------
 
+    !> \brief Wait for completion of asynchronous checkpoint writes.
+
+    subroutine restart_checkpoint_wait() &
+        bind(C, name='cs_restart_checkpoint_wait')
+        use, intrinsic :: iso_c_binding
+        implicit none
+    end subroutine restart_checkpoint_wait
+
+    !---------------------------------------------------------------------------
+
     ! Interface to C function returning number of SYRTHES couplingsg.
 
     function cs_syr_coupling_n_couplings() result(n_couplings) &
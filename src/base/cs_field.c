@@ -2158,6 +2158,13 @@ cs_field_set_values(cs_field_t  *f,
  * For fields with only one time value, or values not allocated yet,
  * this is a no-op.
  *
+ * For fields owning their values with more than one previous time value,
+ * the previous value arrays are handled as a ring: older values are
+ * shifted by rotating array pointers, and only the current values are
+ * copied, to the array freed by the oldest values. Pointers to previous
+ * values (f->vals[i] for i > 0, and f->val_pre) should thus not be kept
+ * across calls to this function.
+ *
  * \param[in, out]  f  pointer to field structure
  */
 /*----------------------------------------------------------------------------*/
@@ -2170,47 +2177,27 @@ cs_field_current_to_previous(cs_field_t  *f)
   if (f->n_time_vals > 1) {
 
     const cs_lnum_t *n_elts = cs_mesh_location_get_n_elts(f->location_id);
-    const cs_lnum_t _n_elts = n_elts[2];
+    const cs_lnum_t _n_vals = n_elts[2]*f->dim;
 
-#   pragma omp parallel if (_n_elts > CS_THR_MIN)
-    {
-      const int dim = f->dim;
-
-      if (f->is_owner) {
-        if (dim == 1) {
-          for (int kk = f->n_time_vals - 1; kk > 0; kk--) {
-#           pragma omp for
-            for (cs_lnum_t ii = 0; ii < _n_elts; ii++)
-              f->vals[kk][ii] = f->vals[kk-1][ii];
-          }
-        }
-        else {
-          for (int kk = f->n_time_vals - 1; kk > 0; kk--) {
-#           pragma omp for
-            for (cs_lnum_t ii = 0; ii < _n_elts; ii++) {
-              for (cs_lnum_t jj = 0; jj < dim; jj++)
-                f->vals[kk][ii*dim + jj] = f->vals[kk-1][ii*dim + jj];
-            }
-          }
-        }
-      }
-      else {
-        if (dim == 1) {
-#         pragma omp for
-          for (cs_lnum_t ii = 0; ii < _n_elts; ii++)
-            f->val_pre[ii] = f->val[ii];
-        }
-        else {
-#         pragma omp for
-          for (cs_lnum_t ii = 0; ii < _n_elts; ii++) {
-            for (cs_lnum_t jj = 0; jj < dim; jj++)
-              f->val_pre[ii*dim + jj] = f->val[ii*dim + jj];
-          }
-        }
-      }
+    /* Rotate previous values (oldest values array is recycled) */
 
+    if (f->is_owner && f->n_time_vals > 2) {
+      cs_real_t *oldest = f->vals[f->n_time_vals - 1];
+      for (int kk = f->n_time_vals - 1; kk > 1; kk--)
+        f->vals[kk] = f->vals[kk-1];
+      f->vals[1] = oldest;
+      f->val_pre = oldest;
     }
 
+    /* Copy current to previous values */
+
+    const cs_real_t *restrict val = f->val;
+    cs_real_t *restrict val_pre = f->val_pre;
+
+#   pragma omp parallel for if (_n_vals > CS_THR_MIN)
+    for (cs_lnum_t ii = 0; ii < _n_vals; ii++)
+      val_pre[ii] = val[ii];
+
   }
 }
 
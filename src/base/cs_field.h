@@ -362,6 +362,10 @@ cs_field_set_values(cs_field_t  *f,
  * For fields with only one time value, or values not allocated yet,
  * this is a no-op.
  *
+ * For fields owning their values with more than one previous time value,
+ * older values are shifted by rotating array pointers, so pointers to
+ * previous values should not be kept across calls to this function.
+ *
  * parameters:
  *   f <-> pointer to field structure
  *----------------------------------------------------------------------------*/
@@ -350,6 +350,90 @@ _local_extrema_scalar(const cs_real_t *restrict pvar,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Get gradient computation options for a scalar field.
+ *
+ * parameters:
+ *   f              <-- pointer to field
+ *   eqp_default    <-- default calculation options, used if the field
+ *                      (or its parent) has none
+ *   gradient_type  --> gradient type
+ *   halo_type      --> halo type
+ *   w_stride       --> stride for weighting coefficient
+ *   c_weight       --> weighted gradient coefficient variable, or NULL
+ *   cpl            --> associated internal coupling, or NULL
+ *
+ * returns:
+ *   pointer to calculation options used
+ *----------------------------------------------------------------------------*/
+
+static const cs_equation_param_t *
+_field_gradient_scalar_options(const cs_field_t            *f,
+                               const cs_equation_param_t   *eqp_default,
+                               cs_gradient_type_t          *gradient_type,
+                               cs_halo_type_t              *halo_type,
+                               int                         *w_stride,
+                               cs_real_t                  **c_weight,
+                               cs_internal_coupling_t     **cpl)
+{
+  *halo_type = CS_HALO_STANDARD;
+  *gradient_type = CS_GRADIENT_GREEN_ITER;
+
+  /* Does the field have a parent (variable) ?
+     Field is its own parent if not parent is specified */
+
+  const cs_field_t *parent_f = f;
+
+  const int f_parent_id
+    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
+  if (f_parent_id > -1)
+    parent_f = cs_field_by_id(f_parent_id);
+
+  int imrgra = cs_glob_space_disc->imrgra;
+
+  /* Get the calculation option from the field */
+  const cs_equation_param_t
+    *eqp = cs_field_get_equation_param_const(parent_f);
+
+  if (eqp != NULL)
+    imrgra = eqp->imrgra;
+  else
+    eqp = eqp_default;
+
+  cs_gradient_type_by_imrgra(imrgra,
+                             gradient_type,
+                             halo_type);
+
+  *w_stride = 1;
+  *c_weight = NULL;
+  *cpl = NULL;
+
+  if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
+
+    if (eqp->iwgrec == 1) {
+      /* Weighted gradient coefficients */
+      int key_id = cs_field_key_id("gradient_weighting_id");
+      int diff_id = cs_field_get_key_int(parent_f, key_id);
+      if (diff_id > -1) {
+        cs_field_t *f_weight = cs_field_by_id(diff_id);
+        *c_weight = f_weight->val;
+        *w_stride = f_weight->dim;
+      }
+    }
+
+    /* Internal coupling structure */
+    int key_id = cs_field_key_id_try("coupling_entity");
+    if (key_id > -1) {
+      int coupl_id = cs_field_get_key_int(parent_f, key_id);
+      if (coupl_id > -1)
+        *cpl = cs_internal_coupling_by_id(coupl_id);
+    }
+
+  }
+
+  return eqp;
+}
+
 /*============================================================================
  * Fortran wrapper function definitions
  *============================================================================*/
@@ -517,58 +601,20 @@ cs_field_gradient_scalar(const cs_field_t          *f,
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
-  /* Does the field have a parent (variable) ?
-     Field is its own parent if not parent is specified */
-
-  const cs_field_t *parent_f = f;
-
-  const int f_parent_id
-    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
-  if (f_parent_id > -1)
-    parent_f = cs_field_by_id(f_parent_id);
-
-  int imrgra = cs_glob_space_disc->imrgra;
-  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
-
-  /* Get the calculation option from the field */
-  const cs_equation_param_t
-    *eqp = cs_field_get_equation_param_const(parent_f);
-
-  if (eqp != NULL)
-    imrgra = eqp->imrgra;
-  else
-    eqp = &eqp_default;
-
-  cs_gradient_type_by_imrgra(imrgra,
-                             &gradient_type,
-                             &halo_type);
-
   int w_stride = 1;
   cs_real_t *c_weight = NULL;
   cs_internal_coupling_t  *cpl = NULL;
 
-  if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
-
-    if (eqp->iwgrec == 1) {
-      /* Weighted gradient coefficients */
-      int key_id = cs_field_key_id("gradient_weighting_id");
-      int diff_id = cs_field_get_key_int(parent_f, key_id);
-      if (diff_id > -1) {
-        cs_field_t *f_weight = cs_field_by_id(diff_id);
-        c_weight = f_weight->val;
-        w_stride = f_weight->dim;
-      }
-    }
-
-    /* Internal coupling structure */
-    int key_id = cs_field_key_id_try("coupling_entity");
-    if (key_id > -1) {
-      int coupl_id = cs_field_get_key_int(parent_f, key_id);
-      if (coupl_id > -1)
-        cpl = cs_internal_coupling_by_id(coupl_id);
-    }
+  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
 
-  }
+  const cs_equation_param_t *eqp
+    = _field_gradient_scalar_options(f,
+                                     &eqp_default,
+                                     &gradient_type,
+                                     &halo_type,
+                                     &w_stride,
+                                     &c_weight,
+                                     &cpl);
 
   if (f->n_time_vals < 2 && use_previous_t)
     bft_error(__FILE__, __LINE__, 0,
@@ -604,6 +650,153 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                      grad);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute cell gradients of several scalar fields.
+ *
+ * Fields sharing the gradient options of the first field which does not
+ * use weighted gradients or internal coupling are handled together by
+ * \ref cs_gradient_scalar_multi, so that mesh traversals and halo exchanges
+ * are shared; others are handled one by one.
+ *
+ * \param[in]       n_fields        number of fields
+ * \param[in]       f               pointers to fields
+ * \param[in]       use_previous_t  should we use values from the previous
+ *                                  time step ?
+ * \param[in]       inc             if 0, solve on increment; 1 otherwise
+ * \param[out]      grad            gradient for each field
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                  n_fields,
+                               const cs_field_t    *f[],
+                               bool                 use_previous_t,
+                               int                  inc,
+                               cs_real_3_t         *grad[])
+{
+  int n_batch = 0;
+  const char **b_name = NULL;
+  const cs_real_t **b_coeff_a = NULL, **b_coeff_b = NULL;
+  cs_real_t **b_var = NULL;
+  cs_real_3_t **b_grad = NULL;
+
+  BFT_MALLOC(b_name, n_fields, const char *);
+  BFT_MALLOC(b_coeff_a, n_fields, const cs_real_t *);
+  BFT_MALLOC(b_coeff_b, n_fields, const cs_real_t *);
+  BFT_MALLOC(b_var, n_fields, cs_real_t *);
+  BFT_MALLOC(b_grad, n_fields, cs_real_3_t *);
+
+  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
+
+  cs_halo_type_t b_halo_type = CS_HALO_STANDARD;
+  cs_gradient_type_t b_gradient_type = CS_GRADIENT_GREEN_ITER;
+  const cs_equation_param_t *b_eqp = NULL;
+
+  for (int i = 0; i < n_fields; i++) {
+
+    cs_halo_type_t halo_type = CS_HALO_STANDARD;
+    cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
+
+    int w_stride = 1;
+    cs_real_t *c_weight = NULL;
+    cs_internal_coupling_t  *cpl = NULL;
+
+    const cs_equation_param_t *eqp
+      = _field_gradient_scalar_options(f[i],
+                                       &eqp_default,
+                                       &gradient_type,
+                                       &halo_type,
+                                       &w_stride,
+                                       &c_weight,
+                                       &cpl);
+
+    bool batch = (c_weight == NULL && cpl == NULL) ? true : false;
+
+    if (batch && b_eqp == NULL) {
+      b_halo_type = halo_type;
+      b_gradient_type = gradient_type;
+      b_eqp = eqp;
+    }
+    else if (batch) {
+      if (   gradient_type != b_gradient_type
+          || halo_type != b_halo_type
+          || eqp->nswrgr != b_eqp->nswrgr
+          || eqp->verbosity != b_eqp->verbosity
+          || eqp->imligr != b_eqp->imligr
+          || eqp->epsrgr < b_eqp->epsrgr || eqp->epsrgr > b_eqp->epsrgr
+          || eqp->climgr < b_eqp->climgr || eqp->climgr > b_eqp->climgr)
+        batch = false;
+    }
+
+    if (batch == false) {
+      cs_field_gradient_scalar(f[i], use_previous_t, inc, grad[i]);
+      continue;
+    }
+
+    if (f[i]->n_time_vals < 2 && use_previous_t)
+      bft_error(__FILE__, __LINE__, 0,
+                _("%s: field %s does not maintain previous time step values\n"
+                  "so \"use_previous_t\" can not be handled."),
+                __func__, f[i]->name);
+
+    b_name[n_batch] = f[i]->name;
+    b_var[n_batch] = (use_previous_t) ? f[i]->val_pre : f[i]->val;
+    b_coeff_a[n_batch] = NULL;
+    b_coeff_b[n_batch] = NULL;
+    if (f[i]->bc_coeffs != NULL) {
+      b_coeff_a[n_batch] = f[i]->bc_coeffs->a;
+      b_coeff_b[n_batch] = f[i]->bc_coeffs->b;
+    }
+    b_grad[n_batch] = grad[i];
+    n_batch++;
+
+  }
+
+  if (n_batch == 1)
+    cs_gradient_scalar(b_name[0],
+                       b_gradient_type,
+                       b_halo_type,
+                       inc,
+                       b_eqp->nswrgr,
+                       0, /* hyd_p_flag */
+                       1, /* w_stride */
+                       b_eqp->verbosity,
+                       b_eqp->imligr,
+                       b_eqp->epsrgr,
+                       b_eqp->climgr,
+                       NULL, /* f_ext */
+                       b_coeff_a[0],
+                       b_coeff_b[0],
+                       b_var[0],
+                       NULL, /* c_weight */
+                       NULL, /* internal coupling */
+                       b_grad[0]);
+
+  else if (n_batch > 1)
+    cs_gradient_scalar_multi("scalars (batched)",
+                             n_batch,
+                             b_name,
+                             b_gradient_type,
+                             b_halo_type,
+                             inc,
+                             b_eqp->nswrgr,
+                             b_eqp->verbosity,
+                             b_eqp->imligr,
+                             b_eqp->epsrgr,
+                             b_eqp->climgr,
+                             b_coeff_a,
+                             b_coeff_b,
+                             b_var,
+                             b_grad);
+
+  BFT_FREE(b_name);
+  BFT_FREE(b_coeff_a);
+  BFT_FREE(b_coeff_b);
+  BFT_FREE(b_var);
+  BFT_FREE(b_grad);
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Compute cell gradient of scalar field or component of vector or
@@ -913,58 +1106,20 @@ cs_field_gradient_boundary_iprime_scalar(const cs_field_t  *f,
   cs_halo_type_t halo_type = CS_HALO_STANDARD;
   cs_gradient_type_t gradient_type = CS_GRADIENT_GREEN_ITER;
 
-  /* Does the field have a parent (variable) ?
-     Field is its own parent if not parent is specified */
-
-  const cs_field_t *parent_f = f;
-
-  const int f_parent_id
-    = cs_field_get_key_int(f, cs_field_key_id("parent_field_id"));
-  if (f_parent_id > -1)
-    parent_f = cs_field_by_id(f_parent_id);
-
-  int imrgra = cs_glob_space_disc->imrgra;
-  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
-
-  /* Get the calculation option from the field */
-  const cs_equation_param_t
-    *eqp = cs_field_get_equation_param_const(parent_f);
-
-  if (eqp != NULL)
-    imrgra = eqp->imrgra;
-  else
-    eqp = &eqp_default;
-
-  cs_gradient_type_by_imrgra(imrgra,
-                             &gradient_type,
-                             &halo_type);
-
   int w_stride = 1;
   cs_real_t *c_weight = NULL;
   cs_internal_coupling_t  *cpl = NULL;
 
-  if (parent_f->type & CS_FIELD_VARIABLE && eqp->idiff > 0) {
-
-    if (eqp->iwgrec == 1) {
-      /* Weighted gradient coefficients */
-      int key_id = cs_field_key_id("gradient_weighting_id");
-      int diff_id = cs_field_get_key_int(parent_f, key_id);
-      if (diff_id > -1) {
-        cs_field_t *f_weight = cs_field_by_id(diff_id);
-        c_weight = f_weight->val;
-        w_stride = f_weight->dim;
-      }
-    }
-
-    /* Internal coupling structure */
-    int key_id = cs_field_key_id_try("coupling_entity");
-    if (key_id > -1) {
-      int coupl_id = cs_field_get_key_int(parent_f, key_id);
-      if (coupl_id > -1)
-        cpl = cs_internal_coupling_by_id(coupl_id);
-    }
+  cs_var_cal_opt_t eqp_default = cs_parameters_var_cal_opt_default();
 
-  }
+  const cs_equation_param_t *eqp
+    = _field_gradient_scalar_options(f,
+                                     &eqp_default,
+                                     &gradient_type,
+                                     &halo_type,
+                                     &w_stride,
+                                     &c_weight,
+                                     &cpl);
 
   if (f->n_time_vals < 2 && use_previous_t)
     bft_error(__FILE__, __LINE__, 0,
@@ -79,6 +79,29 @@ cs_field_gradient_scalar(const cs_field_t          *f,
                          int                        inc,
                          cs_real_3_t      *restrict grad);
 
+/*----------------------------------------------------------------------------
+ * Compute cell gradients of several scalar fields.
+ *
+ * Fields sharing the gradient options of the first field which does not
+ * use weighted gradients or internal coupling are handled together, so
+ * that mesh traversals and halo exchanges are shared; others are handled
+ * one by one.
+ *
+ * parameters:
+ *   n_fields       <-- number of fields
+ *   f              <-- pointers to fields
+ *   use_previous_t <-- should we use values from the previous time step ?
+ *   inc            <-- if 0, solve on increment; 1 otherwise
+ *   grad           --> gradient for each field
+ *----------------------------------------------------------------------------*/
+
+void
+cs_field_gradient_scalar_multi(int                  n_fields,
+                               const cs_field_t    *f[],
+                               bool                 use_previous_t,
+                               int                  inc,
+                               cs_real_3_t         *grad[]);
+
 /*----------------------------------------------------------------------------
  * Compute cell gradient of scalar field or component of vector or
  * tensor field.
@@ -69,6 +69,15 @@
 #include <dirent.h>
 #endif
 
+/* Asynchronous writes require POSIX threads */
+
+#if defined(_POSIX_THREADS)
+# if (_POSIX_THREADS > 0)
+#  define _CS_FILE_ASYNC_WRITE 1
+#  include <pthread.h>
+# endif
+#endif
+
 #if defined(WIN32) || defined(_WIN32)
 #include <io.h>
 #endif
@@ -183,6 +192,15 @@ BEGIN_C_DECLS
  * Type definitions
  *============================================================================*/
 
+/* File handle shared with the asynchronous writer thread */
+
+typedef struct {
+
+  FILE              *sh;           /* Serial file handle */
+  char              *name;         /* Copy of file name */
+
+} _async_file_t;
+
 /* File descriptor */
 
 struct _cs_file_t {
@@ -195,6 +213,8 @@ struct _cs_file_t {
   bool               swap_endian;  /* Swap big-endian and little-endian ? */
 
   FILE              *sh;           /* Serial file handle */
+  _async_file_t     *async;        /* Handle for asynchronous writes,
+                                      or NULL */
 
 #if defined(HAVE_ZLIB)
   gzFile             gzh;          /* Zlib (serial) file handle */
@@ -253,6 +273,36 @@ struct _cs_file_serializer_t {
 
 #endif /* defined(HAVE_MPI) */
 
+#if defined(_CS_FILE_ASYNC_WRITE)
+
+/* Operation queued for the asynchronous writer thread */
+
+typedef enum {
+
+  _ASYNC_WRITE,                    /* write data */
+  _ASYNC_SEEK,                     /* set file position */
+  _ASYNC_CLOSE                     /* close file and free handle */
+
+} _async_op_type_t;
+
+typedef struct _async_op_t {
+
+  _async_op_type_t     type;       /* Operation type */
+  _async_file_t       *af;         /* Associated file handle */
+
+  cs_file_off_t        offset;     /* Position for seek */
+  int                  whence;     /* stdio seek origin */
+
+  size_t               size;       /* Size of each item of data in bytes */
+  size_t               ni;         /* Number of items to write */
+  unsigned char       *data;       /* Copy of data to write */
+
+  struct _async_op_t  *next;       /* Next queued operation */
+
+} _async_op_t;
+
+#endif /* defined(_CS_FILE_ASYNC_WRITE) */
+
 /* Offset type for zlib */
 
 #if defined(HAVE_ZLIB)
@@ -297,6 +347,34 @@ static cs_file_mpi_positioning_t
 static cs_file_access_t _default_access_r = CS_FILE_DEFAULT;
 static cs_file_access_t _default_access_w = CS_FILE_DEFAULT;
 
+static bool _default_async_w = false;
+
+/* Maximum size of data staged for asynchronous writes before writes
+   become blocking (default: 1 GiB) */
+
+static size_t _async_w_max_size = 1073741824;
+
+/* Asynchronous writer thread and queue */
+
+#if defined(_CS_FILE_ASYNC_WRITE)
+
+static bool             _async_thread_active = false;
+static bool             _async_stop = false;
+static pthread_t        _async_thread;
+static pthread_mutex_t  _async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t   _async_queued = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t   _async_done = PTHREAD_COND_INITIALIZER;
+
+static _async_op_t     *_async_head = NULL;
+static _async_op_t     *_async_tail = NULL;
+static _async_op_t     *_async_completed = NULL;
+static size_t           _async_n_pending = 0;
+static size_t           _async_pending_size = 0;
+static bool             _async_error_set = false;
+static char             _async_error[512];
+
+#endif /* defined(_CS_FILE_ASYNC_WRITE) */
+
 /* Communicator and hints used for file operations */
 
 #if defined(HAVE_MPI)
@@ -563,6 +641,297 @@ _swap_endian(void        *dest,
     memcpy(dest, src, ni);
 }
 
+#if defined(_CS_FILE_ASYNC_WRITE)
+
+/*----------------------------------------------------------------------------
+ * Record the first error encountered by the asynchronous writer thread.
+ *
+ * The associated mutex must be held by the caller.
+ *
+ * parameters:
+ *   af      <-- associated file handle
+ *   err_num <-- error number, or 0 if unknown
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_set_error(const _async_file_t  *af,
+                 int                   err_num)
+{
+  if (_async_error_set)
+    return;
+
+  snprintf(_async_error, 511, "Error writing file \"%s\":\n\n  %s",
+           af->name, (err_num != 0) ? strerror(err_num) : "");
+  _async_error[511] = '\0';
+
+  _async_error_set = true;
+}
+
+/*----------------------------------------------------------------------------
+ * Free operations completed by the asynchronous writer thread.
+ *
+ * The associated mutex must be held by the caller, which must be the
+ * main thread, as the writer thread does not call BFT memory management
+ * functions.
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_free_completed(void)
+{
+  while (_async_completed != NULL) {
+    _async_op_t *op = _async_completed;
+    _async_completed = op->next;
+    if (op->type == _ASYNC_CLOSE) {
+      BFT_FREE(op->af->name);
+      BFT_FREE(op->af);
+    }
+    BFT_FREE(op->data);
+    BFT_FREE(op);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Execute an operation queued for the asynchronous writer thread.
+ *
+ * parameters:
+ *   op <-> pointer to operation
+ *
+ * returns:
+ *   0 in case of success, error number in case of failure
+ *----------------------------------------------------------------------------*/
+
+static int
+_async_execute(_async_op_t  *op)
+{
+  int retval = 0;
+  _async_file_t *af = op->af;
+
+  switch(op->type) {
+
+  case _ASYNC_WRITE:
+    if (fwrite(op->data, op->size, op->ni, af->sh) != op->ni)
+      retval = (ferror(af->sh) != 0) ? errno : EIO;
+    break;
+
+  case _ASYNC_SEEK:
+#if (SIZEOF_LONG < 8) && defined(HAVE_FSEEKO) && (_FILE_OFFSET_BITS == 64)
+    retval = fseeko(af->sh, (off_t)(op->offset), op->whence);
+#else
+    retval = fseek(af->sh, (long)(op->offset), op->whence);
+#endif
+    if (retval != 0)
+      retval = errno;
+    break;
+
+  case _ASYNC_CLOSE:
+    if (fclose(af->sh) != 0)
+      retval = errno;
+    af->sh = NULL;
+    break;
+
+  }
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Main function of the asynchronous writer thread.
+ *
+ * Operations are executed in the order in which they were queued, so that
+ * seek and write sequences for a given file are preserved. This function
+ * does not call any MPI or BFT memory management function, so as to remain
+ * compatible with MPI_THREAD_FUNNELED and the (non thread-safe) memory
+ * instrumentation; completed operations are handed back to the main
+ * thread, which frees them.
+ *
+ * parameters:
+ *   arg <-- unused
+ *
+ * returns:
+ *   NULL
+ *----------------------------------------------------------------------------*/
+
+static void *
+_async_writer(void  *arg)
+{
+  CS_UNUSED(arg);
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (true) {
+
+    while (_async_head == NULL && _async_stop == false)
+      pthread_cond_wait(&_async_queued, &_async_mutex);
+
+    if (_async_head == NULL)
+      break;
+
+    _async_op_t *op = _async_head;
+    _async_head = op->next;
+    if (_async_head == NULL)
+      _async_tail = NULL;
+
+    pthread_mutex_unlock(&_async_mutex);
+
+    int err_num = _async_execute(op);
+
+    pthread_mutex_lock(&_async_mutex);
+
+    if (err_num != 0)
+      _async_set_error(op->af, err_num);
+
+    _async_n_pending -= 1;
+    _async_pending_size -= op->size * op->ni;
+
+    op->next = _async_completed;
+    _async_completed = op;
+
+    pthread_cond_broadcast(&_async_done);
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  return NULL;
+}
+
+/*----------------------------------------------------------------------------
+ * Queue an operation for the asynchronous writer thread.
+ *
+ * Data to write is copied, so the caller's buffer may be reused or freed
+ * as soon as this function returns. If the size of data already staged
+ * would exceed the allowed maximum, this function first waits for
+ * pending writes to free enough space. The writer thread is started on
+ * first use.
+ *
+ * parameters:
+ *   af     <-- associated file handle
+ *   type   <-- operation type
+ *   buf    <-- pointer to data to write, or NULL
+ *   size   <-- size of each item of data in bytes
+ *   ni     <-- number of items to write
+ *   offset <-- position for seek
+ *   whence <-- stdio seek origin
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_push(_async_file_t     *af,
+            _async_op_type_t   type,
+            const void        *buf,
+            size_t             size,
+            size_t             ni,
+            cs_file_off_t      offset,
+            int                whence)
+{
+  size_t data_size = (type == _ASYNC_WRITE) ? size*ni : 0;
+
+  /* Reserve staging space, waiting for pending writes if needed
+     (a single write larger than the maximum is allowed once all
+     others are complete) */
+
+  pthread_mutex_lock(&_async_mutex);
+
+  _async_free_completed();
+
+  while (   _async_pending_size > 0
+         && _async_pending_size + data_size > _async_w_max_size) {
+    pthread_cond_wait(&_async_done, &_async_mutex);
+    _async_free_completed();
+  }
+
+  _async_n_pending += 1;
+  _async_pending_size += data_size;
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  /* Copy data outside of lock, so as not to block the writer thread */
+
+  _async_op_t *op;
+  BFT_MALLOC(op, 1, _async_op_t);
+
+  op->type = type;
+  op->af = af;
+  op->offset = offset;
+  op->whence = whence;
+  op->size = (type == _ASYNC_WRITE) ? size : 0;
+  op->ni = (type == _ASYNC_WRITE) ? ni : 0;
+  op->data = NULL;
+  op->next = NULL;
+
+  if (data_size > 0) {
+    BFT_MALLOC(op->data, data_size, unsigned char);
+    memcpy(op->data, buf, data_size);
+  }
+
+  pthread_mutex_lock(&_async_mutex);
+
+  if (_async_thread_active == false) {
+    _async_stop = false;
+    int err_num = pthread_create(&_async_thread, NULL, _async_writer, NULL);
+    if (err_num != 0)
+      bft_error(__FILE__, __LINE__, err_num,
+                _("Error creating asynchronous file writer thread."));
+    _async_thread_active = true;
+  }
+
+  if (_async_tail != NULL)
+    _async_tail->next = op;
+  else
+    _async_head = op;
+  _async_tail = op;
+
+  pthread_cond_signal(&_async_queued);
+
+  pthread_mutex_unlock(&_async_mutex);
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of all queued asynchronous operations, and stop
+ * the writer thread if requested.
+ *
+ * Errors encountered by the writer thread are reported here.
+ *
+ * parameters:
+ *   stop <-- if true, stop the writer thread once the queue is empty
+ *----------------------------------------------------------------------------*/
+
+static void
+_async_wait(bool  stop)
+{
+  char err_msg[512];
+  bool err_set = false;
+
+  pthread_mutex_lock(&_async_mutex);
+
+  while (_async_n_pending > 0)
+    pthread_cond_wait(&_async_done, &_async_mutex);
+
+  _async_free_completed();
+
+  bool join = false;
+  if (stop && _async_thread_active) {
+    _async_stop = true;
+    _async_thread_active = false;
+    pthread_cond_signal(&_async_queued);
+    join = true;
+  }
+
+  if (_async_error_set) {
+    memcpy(err_msg, _async_error, 512);
+    _async_error_set = false;
+    err_set = true;
+  }
+
+  pthread_mutex_unlock(&_async_mutex);
+
+  if (join)
+    pthread_join(_async_thread, NULL);
+
+  if (err_set)
+    bft_error(__FILE__, __LINE__, 0, "%s", err_msg);
+}
+
+#endif /* defined(_CS_FILE_ASYNC_WRITE) */
+
 /*----------------------------------------------------------------------------
  * Open a file using standard C IO.
  *
@@ -643,6 +1012,20 @@ _file_open(cs_file_t  *f)
     retval = errno;
   }
 
+#if defined(_CS_FILE_ASYNC_WRITE)
+
+  /* Writes may be handed to the writer thread; the handle is freed
+     once the matching close operation is complete */
+
+  else if (_default_async_w && f->mode == CS_FILE_MODE_WRITE) {
+    BFT_MALLOC(f->async, 1, _async_file_t);
+    BFT_MALLOC(f->async->name, strlen(f->name) + 1, char);
+    strcpy(f->async->name, f->name);
+    f->async->sh = f->sh;
+  }
+
+#endif
+
   return retval;
 }
 
@@ -661,6 +1044,15 @@ _file_close(cs_file_t  *f)
 {
   int retval = 0;
 
+#if defined(_CS_FILE_ASYNC_WRITE)
+  if (f->async != NULL) {
+    _async_push(f->async, _ASYNC_CLOSE, NULL, 0, 0, 0, 0);
+    f->async = NULL;
+    f->sh = NULL;
+    return retval;
+  }
+#endif
+
   if (f->sh != NULL)
     retval = fclose(f->sh);
 
@@ -797,6 +1189,14 @@ _file_write(cs_file_t   *f,
 
   assert(f->sh != NULL);
 
+#if defined(_CS_FILE_ASYNC_WRITE)
+  if (f->async != NULL) {
+    if (ni != 0)
+      _async_push(f->async, _ASYNC_WRITE, buf, size, ni, 0, 0);
+    return ni;
+  }
+#endif
+
   if (ni != 0)
     retval = fwrite(buf, size, ni, f->sh);
 
@@ -855,6 +1255,18 @@ _file_seek(cs_file_t       *f,
 
   assert(f != NULL);
 
+#if defined(_CS_FILE_ASYNC_WRITE)
+  if (f->async != NULL) {
+    if (whence != CS_FILE_SEEK_END) {
+      _async_push(f->async, _ASYNC_SEEK, NULL, 0, 0, offset, _whence);
+      return retval;
+    }
+    /* End of file depends on pending writes; complete them first,
+       after which the stream may be used directly */
+    _async_wait(false);
+  }
+#endif
+
   if (f->sh != NULL) {
 
 #if (SIZEOF_LONG < 8)
@@ -2435,6 +2847,7 @@ cs_file_open(const char        *name,
   BFT_MALLOC(f, 1, cs_file_t);
 
   f->sh = NULL;
+  f->async = NULL;
 
 #if defined(HAVE_ZLIB)
   f->gzh = NULL;
@@ -3360,6 +3773,9 @@ cs_file_write_block_buffer(cs_file_t  *f,
 /*!
  * \brief Update the file pointer according to whence.
  *
+ * When positioning relative to the end of a file written asynchronously,
+ * pending writes are completed first.
+ *
  * \param[in, out]  f       cs_file_t descriptor
  * \param[in]       offset  add to position specified to whence to obtain
  *                          new position, measured in characters from the
@@ -3395,6 +3811,11 @@ cs_file_seek(cs_file_t       *f,
 
   case CS_FILE_SEEK_END:
 
+#if defined(_CS_FILE_ASYNC_WRITE)
+    if (f->async != NULL)
+      _async_wait(false);
+#endif
+
     if (f->sh != NULL)
       f->offset = cs_file_tell(f) + offset;
 
@@ -3466,7 +3887,8 @@ cs_file_tell(cs_file_t  *f)
 {
   cs_file_off_t retval = f->offset;
 
-  if (f->method == CS_FILE_STDIO_SERIAL && f->rank == 0 && f->sh != NULL)
+  if (   f->method == CS_FILE_STDIO_SERIAL && f->rank == 0 && f->sh != NULL
+      && f->async == NULL)
     retval = _file_tell(f);
 
 #if defined(HAVE_MPI)
@@ -3627,6 +4049,13 @@ cs_file_free_defaults(void)
   _default_access_r = CS_FILE_DEFAULT;
   _default_access_w = CS_FILE_DEFAULT;
 
+  /* Complete pending asynchronous writes and stop writer thread */
+
+#if defined(_CS_FILE_ASYNC_WRITE)
+  _async_wait(true);
+#endif
+  _default_async_w = false;
+
   /* Communicator and hints used for file operations */
 
 #if defined(HAVE_MPI)
@@ -4021,6 +4450,99 @@ cs_file_set_mpi_io_positioning(cs_file_mpi_positioning_t  positioning)
   _mpi_io_positioning = positioning;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Indicate whether files opened for writing use asynchronous writes.
+ *
+ * For details, see \ref cs_file_set_default_async_write.
+ *
+ * \return  true if asynchronous writes are active and available
+ */
+/*----------------------------------------------------------------------------*/
+
+bool
+cs_file_get_default_async_write(void)
+{
+  return _default_async_w;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether files opened for writing use asynchronous writes.
+ *
+ * When active, files subsequently opened in \ref CS_FILE_MODE_WRITE mode
+ * using serial standard C IO hand their writes to a background writer
+ * thread: data is copied to a staging buffer and queued, so the calling
+ * code may proceed as soon as the data has been gathered on the writing
+ * rank. Files using MPI-IO are not affected, as MPI is not initialized
+ * for multiple threads; \ref cs_file_defaults_info logs whether
+ * asynchronous writes are disabled for this reason.
+ *
+ * This setting has no effect on files already open; it is ignored if
+ * POSIX threads are not available.
+ *
+ * \param[in]  async  true to queue writes to a background thread
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_async_write(bool  async)
+{
+#if defined(_CS_FILE_ASYNC_WRITE)
+  _default_async_w = async;
+#else
+  CS_UNUSED(async);
+  _default_async_w = false;
+#endif
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the maximum size of data staged for asynchronous writes.
+ *
+ * When this size would be exceeded, writes wait for pending writes to
+ * complete, so that memory used for staging remains bounded.
+ * A single write larger than this size is staged only once all previous
+ * writes are complete.
+ *
+ * \param[in]  max_size  maximum staged data size, in bytes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write_max_size(size_t  max_size)
+{
+  _async_w_max_size = max_size;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Wait for completion of pending asynchronous writes.
+ *
+ * Once this function returns, all files closed with asynchronous writes
+ * active are complete. Errors encountered by the writer thread are
+ * reported here (and are fatal).
+ *
+ * \return  size (in bytes) of data which was pending when called
+ */
+/*----------------------------------------------------------------------------*/
+
+size_t
+cs_file_async_write_wait(void)
+{
+  size_t retval = 0;
+
+#if defined(_CS_FILE_ASYNC_WRITE)
+  pthread_mutex_lock(&_async_mutex);
+  retval = _async_pending_size;
+  pthread_mutex_unlock(&_async_mutex);
+
+  _async_wait(false);
+#endif
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Print information on default options for file access.
@@ -4094,6 +4616,18 @@ cs_file_defaults_info(void)
 
   }
 
+  /* Asynchronous writes are only handled for standard C IO */
+
+  if (_default_async_w) {
+    cs_file_access_t method;
+    cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, NULL);
+    const char *async_status = (method > CS_FILE_STDIO_PARALLEL) ?
+      N_("disabled (not available with MPI-IO)") : N_("active");
+    for (log_id = 0; log_id < 2; log_id++)
+      cs_log_printf(logs[log_id],
+                    _("  I/O asynchronous writes: %s\n"), _(async_status));
+  }
+
   if (cs_glob_n_ranks > 1) {
     int block_rank_step;
     cs_file_get_default_comm(&block_rank_step, NULL, NULL);
@@ -4554,6 +5088,9 @@ cs_file_listdir(const char  *path)
  * Note also that for some special files, such as files in the Linux /proc
  * directory, this may return 0.
  *
+ * Pending asynchronous writes are completed first, so that the size of
+ * a file written asynchronously is up to date.
+ *
  * \param[in]  path  file path.
  *
  * \return size of file.
@@ -4565,6 +5102,13 @@ cs_file_size(const char  *path)
 {
   cs_file_off_t retval = 0;
 
+  /* Complete pending asynchronous writes, which may concern this file */
+
+#if defined(_CS_FILE_ASYNC_WRITE)
+  if (_async_thread_active)
+    _async_wait(false);
+#endif
+
 #if defined(HAVE_SYS_STAT_H)
 
   struct stat s;
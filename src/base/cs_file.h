@@ -426,6 +426,9 @@ cs_file_write_block_buffer(cs_file_t  *f,
 /*----------------------------------------------------------------------------
  * Update the file pointer according to whence.
  *
+ * When positioning relative to the end of a file written asynchronously,
+ * pending writes are completed first.
+ *
  * parameters:
  *   f      <-> cs_file_t descriptor.
  *   offset <-- add to position specified to whence to obtain new position,
@@ -672,6 +675,68 @@ cs_file_get_mpi_io_positioning(void);
 void
 cs_file_set_mpi_io_positioning(cs_file_mpi_positioning_t  positioning);
 
+/*----------------------------------------------------------------------------
+ * Indicate whether files opened for writing use asynchronous writes.
+ *
+ * For details, see cs_file_set_default_async_write().
+ *
+ * returns:
+ *   true if asynchronous writes are active and available
+ *----------------------------------------------------------------------------*/
+
+bool
+cs_file_get_default_async_write(void);
+
+/*----------------------------------------------------------------------------
+ * Set whether files opened for writing use asynchronous writes.
+ *
+ * When active, files subsequently opened in CS_FILE_MODE_WRITE mode
+ * using serial standard C IO hand their writes to a background writer
+ * thread: data is copied to a staging buffer and queued, so the calling
+ * code may proceed as soon as the data has been gathered on the writing
+ * rank. Files using MPI-IO are not affected, as MPI is not initialized
+ * for multiple threads; cs_file_defaults_info() logs whether asynchronous
+ * writes are disabled for this reason.
+ *
+ * This setting has no effect on files already open; it is ignored if
+ * POSIX threads are not available.
+ *
+ * parameters:
+ *   async <-- true to queue writes to a background thread
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_default_async_write(bool  async);
+
+/*----------------------------------------------------------------------------
+ * Set the maximum size of data staged for asynchronous writes.
+ *
+ * When this size would be exceeded, writes wait for pending writes to
+ * complete, so that memory used for staging remains bounded.
+ * A single write larger than this size is staged only once all previous
+ * writes are complete.
+ *
+ * parameters:
+ *   max_size <-- maximum staged data size, in bytes
+ *----------------------------------------------------------------------------*/
+
+void
+cs_file_set_async_write_max_size(size_t  max_size);
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of pending asynchronous writes.
+ *
+ * Once this function returns, all files closed with asynchronous writes
+ * active are complete. Errors encountered by the writer thread are
+ * reported here (and are fatal).
+ *
+ * returns:
+ *   size (in bytes) of data which was pending when called
+ *----------------------------------------------------------------------------*/
+
+size_t
+cs_file_async_write_wait(void);
+
 /*----------------------------------------------------------------------------
  * Print information on default options for file access.
  *----------------------------------------------------------------------------*/
@@ -837,6 +902,9 @@ cs_file_listdir(const char *path);
  * Note that for some special files, such as files in the Linux /proc
  * directory, this may return 0.
  *
+ * Pending asynchronous writes are completed first, so that the size of
+ * a file written asynchronously is up to date.
+ *
  * parameters
  *   path <-- file path.
  *
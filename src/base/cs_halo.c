@@ -44,7 +44,9 @@
 
 #include "cs_base.h"
 #include "cs_base_accel.h"
+#include "cs_log.h"
 #include "cs_order.h"
+#include "cs_timer.h"
 
 #include "cs_interface.h"
 #include "cs_rank_neighbors.h"
@@ -84,6 +86,17 @@ BEGIN_C_DECLS
  * some publications report better performance with RMA for large data,
  * and better performance with P2P for small data, so in uses such
  * as multigrid solvers, either may be preferred for different levels.
+ *
+ * The shared memory mode places the send buffer of each rank in an MPI-3
+ * shared window on the associated node, so ranks on the same node simply
+ * copy their halo section from the neighbor's buffer, using small
+ * messages on the node communicator to signal that a buffer is ready
+ * (with the matching shift in that buffer) or has been read. Only
+ * inter-node exchanges use point-to-point messages for data.
+ * The shared buffer is sized when the first halo is completed, and is
+ * only used with the default halo state (so only one such exchange may
+ * be in progress at a given time); exchanges which do not fit use the
+ * regular point-to-point path.
 */
 
 /*=============================================================================
@@ -94,6 +107,20 @@ BEGIN_C_DECLS
   #include <mpi-ext.h>
 #endif
 
+/* Maximum element size (in bytes) for which the node-shared send buffer
+   is sized (allows exchanging 3x3 tensor or block values) */
+
+#define _CS_HALO_SHM_MAX_ELT_SIZE  (9*sizeof(cs_real_t))
+
+/* Number of halo communication modes */
+
+#define _CS_HALO_N_COMM_MODES  (CS_HALO_COMM_NEIGHBOR + 1)
+
+/* Tags for node-local synchronization messages */
+
+#define _CS_HALO_SHM_READY_TAG  1
+#define _CS_HALO_SHM_DONE_TAG   2
+
 #if defined(MPIX_CUDA_AWARE_SUPPORT) && MPIX_CUDA_AWARE_SUPPORT
   #define _CS_MPI_DEVICE_SUPPORT 1
 #else
@@ -106,6 +133,41 @@ BEGIN_C_DECLS
  * Local type definitions
  *============================================================================*/
 
+#if defined(HAVE_MPI)
+
+/* Communication plan for a given halo, datatype and stride */
+
+typedef struct _cs_halo_plan_t {
+
+  const cs_halo_t  *halo;         /* Associated halo */
+
+  int             comm_mode;      /* Associated communication mode */
+  cs_halo_type_t  sync_mode;      /* Standard or extended */
+  cs_datatype_t   data_type;      /* Datatype */
+  int             stride;         /* Number of values per location */
+
+  int             n_c_domains;    /* Halo's number of communicating domains
+                                     when plan was built */
+  int            *c_domain_rank;  /* Copy of halo's communicating ranks */
+  cs_lnum_t      *index;          /* Copy of halo's index */
+  cs_lnum_t      *send_index;     /* Copy of halo's send index */
+
+  void           *send_buffer;    /* Send buffer bound to requests */
+  void           *recv_buffer;    /* Receive buffer bound to requests */
+
+  int             n_requests;     /* Number of persistent requests */
+  MPI_Request    *request;        /* Persistent requests */
+
+  int            *counts;         /* Send counts and displacements, then
+                                     receive counts and displacements
+                                     for neighborhood collective */
+
+  struct _cs_halo_plan_t  *next;  /* Next cached plan */
+
+} cs_halo_plan_t;
+
+#endif
+
 /* Structure to maintain halo exchange state */
 
 struct _cs_halo_state_t {
@@ -142,6 +204,14 @@ struct _cs_halo_state_t {
 
   MPI_Win       win;              /* MPI-3 RMA window */
 
+  cs_halo_plan_t  *plan;          /* Plan for current exchange, or NULL */
+
+  bool          shm_send;         /* Send buffer is node-shared */
+  int           n_shm_requests;   /* Number of node-local "ready" requests */
+  MPI_Request  *shm_request;      /* Array of node-local "ready" requests */
+  cs_lnum_t    *shm_info;         /* Shared buffer shift and use flag sent
+                                     to, then received from node neighbors */
+
 #endif
 
 };
@@ -169,6 +239,40 @@ static cs_halo_state_t *_halo_state = NULL;
 /* Halo communications mode */
 static int _halo_comm_mode = CS_HALO_COMM_P2P;
 
+#if defined(HAVE_MPI)
+
+/* Cached halo communication plans */
+static cs_halo_plan_t *_halo_plans = NULL;
+
+#endif
+
+/* Halo communication timers and exchange counts, per mode */
+static cs_timer_counter_t _halo_comm_timer[_CS_HALO_N_COMM_MODES];
+static unsigned long long _halo_comm_calls[_CS_HALO_N_COMM_MODES];
+
+static const char *_halo_comm_mode_name[]
+  = {N_("point-to-point"),
+     N_("one-sided get"),
+     N_("node shared memory"),
+     N_("persistent point-to-point"),
+     N_("neighborhood collective")};
+
+#if defined(HAVE_MPI)
+#if (MPI_VERSION >= 3)
+
+/* Node-local communicator and shared send buffers (shared memory mode) */
+static MPI_Comm         _shm_comm = MPI_COMM_NULL;
+static MPI_Win          _shm_win = MPI_WIN_NULL;
+static int              _shm_n_ranks = 0;
+static int              _shm_rank_id = -1;
+static int             *_shm_glob_rank = NULL;  /* Main rank of node ranks */
+static void            *_shm_buffer = NULL;
+static unsigned char  **_shm_base = NULL;  /* Buffer of each node rank */
+static size_t          *_shm_size = NULL;  /* Buffer size of each node rank */
+
+#endif
+#endif
+
 /*============================================================================
  * Private function definitions
  *============================================================================*/
@@ -229,12 +333,22 @@ _update_requests(const cs_halo_t  *halo,
   if (halo == NULL)
     return;
 
-  int n_requests = halo->n_c_domains*2;
+  /* With node-shared buffers, "ready" and "done" messages may be
+     needed in addition to regular messages (with separate "ready"
+     receive requests) */
+
+  int n_requests = CS_MAX(halo->n_c_domains*2, 1);
+  if (_halo_comm_mode == CS_HALO_COMM_SHM)
+    n_requests = halo->n_c_domains*3;
 
   if (n_requests > hs->request_size) {
     hs->request_size = n_requests;
     BFT_REALLOC(hs->request, hs->request_size, MPI_Request);
     BFT_REALLOC(hs->status, hs->request_size,  MPI_Status);
+    if (_halo_comm_mode == CS_HALO_COMM_SHM) {
+      BFT_REALLOC(hs->shm_request, hs->request_size, MPI_Request);
+      BFT_REALLOC(hs->shm_info, hs->request_size*2, cs_lnum_t);
+    }
   }
 
 }
@@ -291,6 +405,187 @@ _exchange_send_shift(cs_halo_t  *halo)
   BFT_FREE(status);
 }
 
+#if (MPI_VERSION >= 3)
+
+/*----------------------------------------------------------------------------
+ * Create node-local communicator and shared send buffer window.
+ *
+ * This operation is collective on the main communicator.
+ *
+ * parameters:
+ *   size <-- size of local send buffer, in bytes
+ *---------------------------------------------------------------------------*/
+
+static void
+_shm_window_create(size_t  size)
+{
+  MPI_Comm_split_type(cs_glob_mpi_comm, MPI_COMM_TYPE_SHARED, 0,
+                      MPI_INFO_NULL, &_shm_comm);
+  MPI_Comm_size(_shm_comm, &_shm_n_ranks);
+  MPI_Comm_rank(_shm_comm, &_shm_rank_id);
+
+  /* Main communicator rank of each node rank; as the split key is
+     identical for all ranks, these are ordered. */
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  BFT_MALLOC(_shm_glob_rank, _shm_n_ranks, int);
+  MPI_Allgather(&local_rank, 1, MPI_INT, _shm_glob_rank, 1, MPI_INT,
+                _shm_comm);
+
+  /* Allow each rank's buffer to be placed in its own NUMA domain */
+
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+
+  MPI_Win_allocate_shared((MPI_Aint)size,
+                          1,   /* displacement unit */
+                          info,
+                          _shm_comm,
+                          &_shm_buffer,
+                          &_shm_win);
+
+  MPI_Info_free(&info);
+
+  /* Passive target epoch remains open for the window's lifetime;
+     synchronization uses MPI_Win_sync and node-local messages. */
+
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, _shm_win);
+
+  BFT_MALLOC(_shm_base, _shm_n_ranks, unsigned char *);
+  BFT_MALLOC(_shm_size, _shm_n_ranks, size_t);
+
+  for (int i = 0; i < _shm_n_ranks; i++) {
+    MPI_Aint r_size = 0;
+    int r_disp_unit = 1;
+    void *r_base = NULL;
+    MPI_Win_shared_query(_shm_win, i, &r_size, &r_disp_unit, &r_base);
+    _shm_base[i] = r_base;
+    _shm_size[i] = r_size;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy node-local communicator and shared send buffer window.
+ *
+ * This operation is collective on the main communicator.
+ *---------------------------------------------------------------------------*/
+
+static void
+_shm_window_destroy(void)
+{
+  if (_shm_win == MPI_WIN_NULL)
+    return;
+
+  MPI_Win_unlock_all(_shm_win);
+  MPI_Win_free(&_shm_win);
+  MPI_Comm_free(&_shm_comm);
+
+  _shm_n_ranks = 0;
+  _shm_rank_id = -1;
+  _shm_buffer = NULL;
+
+  BFT_FREE(_shm_glob_rank);
+  BFT_FREE(_shm_base);
+  BFT_FREE(_shm_size);
+}
+
+/*----------------------------------------------------------------------------
+ * Return rank in node communicator of a distant rank.
+ *
+ * parameters:
+ *   rank <-- rank in main communicator
+ *
+ * returns:
+ *   rank in node communicator, or -1 if not on the same node (or local)
+ *---------------------------------------------------------------------------*/
+
+static inline int
+_shm_rank(int  rank)
+{
+  int start_id = 0, end_id = _shm_n_ranks;
+
+  while (start_id < end_id) {
+    int mid_id = (start_id + end_id) / 2;
+    if (_shm_glob_rank[mid_id] < rank)
+      start_id = mid_id + 1;
+    else
+      end_id = mid_id;
+  }
+
+  int retval = -1;
+  if (   start_id < _shm_n_ranks && _shm_glob_rank[start_id] == rank
+      && start_id != _shm_rank_id)
+    retval = start_id;
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Copy halo values from node-shared send buffers of node neighbors
+ * once they are ready, and notify them that the copy is done.
+ *
+ * Node neighbors whose data did not fit in their shared buffer send it
+ * using regular messages, whose receive is posted here.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *   val  <-> pointer to variable value array
+ *   hs   <-> pointer to halo state
+ *---------------------------------------------------------------------------*/
+
+static void
+_shm_sync_copy(const cs_halo_t  *halo,
+               void             *val,
+               cs_halo_state_t  *hs)
+{
+  cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+  unsigned char *restrict _val_dest
+    = (unsigned char *)val + (size_t)(halo->n_local_elts)*elt_size;
+
+  const cs_lnum_t *recv_info = hs->shm_info + 2*halo->n_c_domains;
+
+  MPI_Waitall(hs->n_shm_requests, hs->shm_request, MPI_STATUSES_IGNORE);
+  MPI_Win_sync(_shm_win);
+
+  for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+    int shm_rank = _shm_rank(halo->c_domain_rank[rank_id]);
+    cs_lnum_t length = (  halo->index[2*rank_id + end_shift]
+                        - halo->index[2*rank_id]);
+
+    if (shm_rank < 0 || length < 1)
+      continue;
+
+    unsigned char *dest = _val_dest + halo->index[2*rank_id]*elt_size;
+
+    /* Shift in neighbor's shared buffer and shared buffer use flag */
+
+    if (recv_info[2*rank_id + 1]) {
+      memcpy(dest,
+             _shm_base[shm_rank] + recv_info[2*rank_id]*elt_size,
+             length*elt_size);
+      MPI_Isend(NULL, 0, MPI_BYTE, shm_rank, _CS_HALO_SHM_DONE_TAG,
+                _shm_comm, &(hs->request[hs->n_requests++]));
+    }
+    else
+      MPI_Irecv(dest,
+                length*hs->stride,
+                cs_datatype_to_mpi[hs->data_type],
+                halo->c_domain_rank[rank_id],
+                halo->c_domain_rank[rank_id],
+                cs_glob_mpi_comm,
+                &(hs->request[hs->n_requests++]));
+
+  }
+
+  hs->n_shm_requests = 0;
+}
+
+#endif /* (MPI_VERSION >= 3) */
+
 #endif /* HAVE_MPI */
 
 /*----------------------------------------------------------------------------
@@ -402,84 +697,577 @@ _halo_sync_start_one_sided(const cs_halo_t  *halo,
                     0,                      /* program assertion */
                     hs->win);
     }
-    else {
-      MPI_Win_fence(0, hs->win);
+    else {
+      MPI_Win_fence(0, hs->win);
+    }
+
+    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
+
+      int  length = (  halo->index[2*rank_id + end_shift]
+                     - halo->index[2*rank_id]) * stride;
+
+      if (halo->c_domain_rank[rank_id] != local_rank) {
+
+        if (length > 0) {
+          cs_lnum_t start = halo->index[2*rank_id]*elt_size;
+          unsigned char *dest = _val_dest + start;
+          MPI_Aint displacement = halo->c_domain_s_shift[rank_id]*elt_size;
+
+          MPI_Get(dest,
+                  length,                        /* origin count */
+                  mpi_datatype,                  /* origin datatype */
+                  halo->c_domain_rank[rank_id],  /* target rank */
+                  displacement,                  /* target displacement */
+                  length,                        /* target count */
+                  mpi_datatype,                  /* target datatype */
+                  hs->win);
+        }
+
+      }
+      else
+        hs->local_rank_id = rank_id;
+    }
+
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Finalize update of ghost values in case of parallelism
+ *        for one-sided communication.
+ *
+ * The cs_halo_sync_pack function should have been called before this function,
+ * using the same hs argument.
+ *
+ * \param[in]       halo        pointer to halo structure
+ * \param[in]       val         pointer to variable value array
+ * \param[in, out]  hs          pointer to halo state, NULL for global state
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_halo_sync_complete_one_sided(const cs_halo_t  *halo,
+                              void             *val,
+                              cs_halo_state_t  *hs)
+{
+  /* Use active target synchronization */
+
+  /* Access Epoch */
+  if (halo->c_domain_group != MPI_GROUP_NULL) {
+    MPI_Win_complete(hs->win);
+
+    /* Complete RMA exposure epoch */
+    MPI_Win_wait(hs->win);
+  }
+  else {
+    MPI_Win_fence(0, hs->win);
+  }
+
+  /* Copy local values in case of periodicity */
+
+  if (hs->local_rank_id > -1) {
+    size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+    _sync_local(halo, hs->local_rank_id, hs->sync_mode, elt_size,
+                hs->var_location, hs->send_buffer_cur, val);
+  }
+}
+
+#endif /* (MPI_VERSION >= 3) */
+#endif /* defined(HAVE_MPI) */
+
+#if defined(HAVE_MPI)
+
+/*----------------------------------------------------------------------------
+ * Build neighborhood graph communicator for a halo.
+ *
+ * This operation is collective on the main communicator.
+ *
+ * parameters:
+ *   halo <-> halo structure to update
+ *---------------------------------------------------------------------------*/
+
+static void
+_create_neighbor_comm(cs_halo_t  *halo)
+{
+#if (MPI_VERSION >= 3)
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  /* Halos are symmetric, so sources and destinations are identical;
+     the local rank (periodicity) is handled separately. */
+
+  int n_neighbors = 0;
+  int *neighbors = NULL, *weights = NULL;
+  BFT_MALLOC(neighbors, halo->n_c_domains + 1, int);
+  BFT_MALLOC(weights, halo->n_c_domains + 1, int);
+
+  for (int i = 0; i < halo->n_c_domains; i++) {
+    if (halo->c_domain_rank[i] != local_rank) {
+      neighbors[n_neighbors] = halo->c_domain_rank[i];
+      weights[n_neighbors] = 1;
+      n_neighbors++;
+    }
+  }
+
+  /* Uniform weights are used rather than MPI_UNWEIGHTED, which some
+     MPI libraries define as an invalid pointer */
+
+  MPI_Dist_graph_create_adjacent(cs_glob_mpi_comm,
+                                 n_neighbors, neighbors, weights,
+                                 n_neighbors, neighbors, weights,
+                                 MPI_INFO_NULL,
+                                 0,   /* no reorder */
+                                 &(halo->c_domain_comm));
+
+  BFT_FREE(weights);
+  BFT_FREE(neighbors);
+
+#else
+
+  CS_UNUSED(halo);
+
+#endif
+}
+
+/*----------------------------------------------------------------------------
+ * Destroy a halo communication plan.
+ *
+ * parameters:
+ *   plan <-> pointer to plan to destroy
+ *---------------------------------------------------------------------------*/
+
+static void
+_plan_destroy(cs_halo_plan_t  **plan)
+{
+  cs_halo_plan_t *p = *plan;
+
+  for (int i = 0; i < p->n_requests; i++)
+    MPI_Request_free(p->request + i);
+
+  BFT_FREE(p->request);
+  BFT_FREE(p->counts);
+
+  BFT_FREE(p->send_buffer);
+  BFT_FREE(p->recv_buffer);
+
+  BFT_FREE(p->c_domain_rank);
+  BFT_FREE(p->index);
+  BFT_FREE(p->send_index);
+
+  BFT_FREE(*plan);
+}
+
+/*----------------------------------------------------------------------------
+ * Check if a halo communication plan is still consistent with its halo.
+ *
+ * Some halos (such as those of coarse multigrid levels) may be modified
+ * after use, so this is checked before each use.
+ *
+ * parameters:
+ *   plan <-- pointer to plan
+ *   halo <-- pointer to associated halo
+ *
+ * returns:
+ *   true if plan matches current halo, false otherwise
+ *---------------------------------------------------------------------------*/
+
+static bool
+_plan_is_current(const cs_halo_plan_t  *plan,
+                 const cs_halo_t       *halo)
+{
+  const int n = halo->n_c_domains;
+
+  if (n != plan->n_c_domains)
+    return false;
+
+  if (   memcmp(plan->c_domain_rank, halo->c_domain_rank, n*sizeof(int))
+      || memcmp(plan->index, halo->index, (2*n+1)*sizeof(cs_lnum_t))
+      || memcmp(plan->send_index, halo->send_index,
+                (2*n+1)*sizeof(cs_lnum_t)))
+    return false;
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Create a halo communication plan.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   comm_mode <-- CS_HALO_COMM_P2P_PERSISTENT or CS_HALO_COMM_NEIGHBOR
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   data_type <-- data type
+ *   stride    <-- number of (interlaced) values by entity
+ *
+ * returns:
+ *   pointer to new plan
+ *---------------------------------------------------------------------------*/
+
+static cs_halo_plan_t *
+_plan_create(const cs_halo_t  *halo,
+             int               comm_mode,
+             cs_halo_type_t    sync_mode,
+             cs_datatype_t     data_type,
+             int               stride)
+{
+  cs_halo_plan_t *p;
+  BFT_MALLOC(p, 1, cs_halo_plan_t);
+
+  const int n = halo->n_c_domains;
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+  const cs_lnum_t end_shift = (sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  const size_t elt_size = cs_datatype_size[data_type] * stride;
+
+  p->halo = halo;
+  p->comm_mode = comm_mode;
+  p->sync_mode = sync_mode;
+  p->data_type = data_type;
+  p->stride = stride;
+
+  p->n_c_domains = n;
+  BFT_MALLOC(p->c_domain_rank, n, int);
+  BFT_MALLOC(p->index, 2*n+1, cs_lnum_t);
+  BFT_MALLOC(p->send_index, 2*n+1, cs_lnum_t);
+  memcpy(p->c_domain_rank, halo->c_domain_rank, n*sizeof(int));
+  memcpy(p->index, halo->index, (2*n+1)*sizeof(cs_lnum_t));
+  memcpy(p->send_index, halo->send_index, (2*n+1)*sizeof(cs_lnum_t));
+
+  p->send_buffer = NULL;
+  p->recv_buffer = NULL;
+  p->n_requests = 0;
+  p->request = NULL;
+  p->counts = NULL;
+
+  p->next = NULL;
+
+  MPI_Datatype mpi_datatype = cs_datatype_to_mpi[data_type];
+
+  /* Neighborhood collective: only counts and displacements are needed,
+     in order of graph neighbors */
+
+  if (comm_mode == CS_HALO_COMM_NEIGHBOR) {
+
+    BFT_MALLOC(p->counts, n*4, int);
+
+    int *send_count = p->counts, *send_displ = p->counts + n;
+    int *recv_count = p->counts + 2*n, *recv_displ = p->counts + 3*n;
+
+    int j = 0;
+    for (int i = 0; i < n; i++) {
+      if (halo->c_domain_rank[i] == local_rank)
+        continue;
+      send_displ[j] = halo->send_index[2*i]*stride;
+      send_count[j] = (  halo->send_index[2*i + end_shift]
+                       - halo->send_index[2*i])*stride;
+      recv_displ[j] = halo->index[2*i]*stride;
+      recv_count[j] = (  halo->index[2*i + end_shift]
+                       - halo->index[2*i])*stride;
+      j++;
+    }
+
+    return p;
+  }
+
+  /* Persistent requests: buffers are bound to the plan */
+
+  size_t n_send_elts = halo->n_send_elts[sync_mode];
+  size_t n_recv_elts = halo->n_elts[sync_mode];
+
+  BFT_MALLOC(p->send_buffer, n_send_elts*elt_size, unsigned char);
+  BFT_MALLOC(p->recv_buffer, n_recv_elts*elt_size, unsigned char);
+  BFT_MALLOC(p->request, n*2, MPI_Request);
+
+  unsigned char *send_buffer = p->send_buffer;
+  unsigned char *recv_buffer = p->recv_buffer;
+
+  for (int i = 0; i < n; i++) {
+    cs_lnum_t length = halo->index[2*i + end_shift] - halo->index[2*i];
+    if (halo->c_domain_rank[i] != local_rank && length > 0)
+      MPI_Recv_init(recv_buffer + halo->index[2*i]*elt_size,
+                    length*stride,
+                    mpi_datatype,
+                    halo->c_domain_rank[i],
+                    halo->c_domain_rank[i],
+                    cs_glob_mpi_comm,
+                    p->request + p->n_requests++);
+  }
+
+  for (int i = 0; i < n; i++) {
+    cs_lnum_t length = (  halo->send_index[2*i + end_shift]
+                        - halo->send_index[2*i]);
+    if (halo->c_domain_rank[i] != local_rank && length > 0)
+      MPI_Send_init(send_buffer + halo->send_index[2*i]*elt_size,
+                    length*stride,
+                    mpi_datatype,
+                    halo->c_domain_rank[i],
+                    local_rank,
+                    cs_glob_mpi_comm,
+                    p->request + p->n_requests++);
+  }
+
+  return p;
+}
+
+/*----------------------------------------------------------------------------
+ * Return communication plan matching a given halo exchange, building it
+ * if not already available.
+ *
+ * parameters:
+ *   halo      <-- pointer to halo structure
+ *   sync_mode <-- synchronization mode (standard or extended)
+ *   data_type <-- data type
+ *   stride    <-- number of (interlaced) values by entity
+ *
+ * returns:
+ *   pointer to matching plan
+ *---------------------------------------------------------------------------*/
+
+static cs_halo_plan_t *
+_plan_get(const cs_halo_t  *halo,
+          cs_halo_type_t    sync_mode,
+          cs_datatype_t     data_type,
+          int               stride)
+{
+  /* Neighborhood collectives require the halo's graph communicator */
+
+  int comm_mode = _halo_comm_mode;
+  if (halo->c_domain_comm == MPI_COMM_NULL)
+    comm_mode = CS_HALO_COMM_P2P_PERSISTENT;
+
+  cs_halo_plan_t *p_prev = NULL;
+  cs_halo_plan_t *p = _halo_plans;
+
+  while (p != NULL) {
+    if (   p->halo == halo && p->comm_mode == comm_mode
+        && p->sync_mode == sync_mode && p->data_type == data_type
+        && p->stride == stride)
+      break;
+    p_prev = p;
+    p = p->next;
+  }
+
+  /* Discard plan if halo was modified since it was built */
+
+  if (p != NULL && _plan_is_current(p, halo) == false) {
+    if (p_prev != NULL)
+      p_prev->next = p->next;
+    else
+      _halo_plans = p->next;
+    _plan_destroy(&p);
+  }
+
+  if (p == NULL) {
+    p = _plan_create(halo, comm_mode, sync_mode, data_type, stride);
+    p->next = _halo_plans;
+    _halo_plans = p;
+  }
+
+  return p;
+}
+
+/*----------------------------------------------------------------------------
+ * Launch halo exchange using a communication plan.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *   val  <-> pointer to variable value array
+ *   hs   <-> pointer to halo state
+ *---------------------------------------------------------------------------*/
+
+static void
+_plan_sync_start(const cs_halo_t  *halo,
+                 void             *val,
+                 cs_halo_state_t  *hs)
+{
+  cs_halo_plan_t *p = hs->plan;
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+
+  for (int i = 0; i < halo->n_c_domains; i++) {
+    if (halo->c_domain_rank[i] == local_rank)
+      hs->local_rank_id = i;
+  }
+
+#if (MPI_VERSION >= 3)
+
+  if (p->comm_mode == CS_HALO_COMM_NEIGHBOR) {
+
+    const int n = p->n_c_domains;
+    size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+    MPI_Datatype mpi_datatype = cs_datatype_to_mpi[hs->data_type];
+
+    unsigned char *_val_dest
+      = (unsigned char *)val + (size_t)(halo->n_local_elts)*elt_size;
+
+    /* Values are received directly in the halo section */
+
+    MPI_Ineighbor_alltoallv(hs->send_buffer_cur,
+                            p->counts, p->counts + n, mpi_datatype,
+                            _val_dest,
+                            p->counts + 2*n, p->counts + 3*n, mpi_datatype,
+                            halo->c_domain_comm,
+                            hs->request);
+    hs->n_requests = 1;
+
+    return;
+  }
+
+#endif
+
+  if (p->n_requests > 0)
+    MPI_Startall(p->n_requests, p->request);
+
+  CS_UNUSED(val);
+}
+
+/*----------------------------------------------------------------------------
+ * Wait for completion of halo exchange using a communication plan.
+ *
+ * parameters:
+ *   halo <-- pointer to halo structure
+ *   val  <-> pointer to variable value array
+ *   hs   <-> pointer to halo state
+ *---------------------------------------------------------------------------*/
+
+static void
+_plan_sync_wait(const cs_halo_t  *halo,
+                void             *val,
+                cs_halo_state_t  *hs)
+{
+  cs_halo_plan_t *p = hs->plan;
+
+  if (p->comm_mode == CS_HALO_COMM_NEIGHBOR) {
+    if (hs->n_requests > 0)
+      MPI_Waitall(hs->n_requests, hs->request, hs->status);
+    return;
+  }
+
+  if (p->n_requests > 0)
+    MPI_Waitall(p->n_requests, p->request, MPI_STATUSES_IGNORE);
+
+  /* Copy from bound receive buffer to halo section */
+
+  const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+  const cs_lnum_t end_shift = (hs->sync_mode == CS_HALO_EXTENDED) ? 2 : 1;
+  const size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
+
+  unsigned char *_val_dest
+    = (unsigned char *)val + (size_t)(halo->n_local_elts)*elt_size;
+  const unsigned char *recv_buffer = p->recv_buffer;
+
+  for (int i = 0; i < halo->n_c_domains; i++) {
+    if (halo->c_domain_rank[i] != local_rank) {
+      size_t start = halo->index[2*i]*elt_size;
+      size_t n_bytes = (  halo->index[2*i + end_shift]
+                        - halo->index[2*i])*elt_size;
+      memcpy(_val_dest + start, recv_buffer + start, n_bytes);
+    }
+  }
+}
+
+#endif /* defined(HAVE_MPI) */
+
+/*----------------------------------------------------------------------------
+ * Add elapsed time since a given start to the current communication
+ * mode's timer.
+ *
+ * parameters:
+ *   t0         <-- start time
+ *   count_call <-- if true, count an exchange
+ *---------------------------------------------------------------------------*/
+
+static inline void
+_comm_timer_add(const cs_timer_t  *t0,
+                bool               count_call)
+{
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(_halo_comm_timer + _halo_comm_mode, t0, &t1);
+  if (count_call)
+    _halo_comm_calls[_halo_comm_mode] += 1;
+}
+
+/*----------------------------------------------------------------------------
+ * Ready halo for use.
+ *
+ * parameters:
+ *   halo           <-> pointer to halo structure
+ *   neighbor_graph <-- build neighborhood graph communicator if required
+ *                      by communication mode (the halo's construction
+ *                      must then be collective on the main communicator)
+ *---------------------------------------------------------------------------*/
+
+static void
+_halo_create_complete(cs_halo_t  *halo,
+                      bool        neighbor_graph)
+{
+#if defined(HAVE_MPI)
+
+  /* Make buffer available on device if relevant */
+  cs_sync_h2d(halo->send_index);
+  cs_sync_h2d(halo->send_list);
+
+  /* Create group for one-sided communication */
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
+    const int local_rank = CS_MAX(cs_glob_rank_id, 0);
+    int n_group_ranks = 0;
+    int *group_ranks = NULL;
+    BFT_MALLOC(group_ranks, halo->n_c_domains + 1, int);
+    for (int i = 0; i < halo->n_c_domains; i++) {
+      if (halo->c_domain_rank[i] < local_rank)
+        group_ranks[n_group_ranks++] = halo->c_domain_rank[i];
+    }
+    group_ranks[n_group_ranks++] = local_rank;
+    for (int i = 0; i < halo->n_c_domains; i++) {
+      if (halo->c_domain_rank[i] > local_rank)
+        group_ranks[n_group_ranks++] = halo->c_domain_rank[i];
     }
 
-    for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
-
-      int  length = (  halo->index[2*rank_id + end_shift]
-                     - halo->index[2*rank_id]) * stride;
-
-      if (halo->c_domain_rank[rank_id] != local_rank) {
-
-        if (length > 0) {
-          cs_lnum_t start = halo->index[2*rank_id]*elt_size;
-          unsigned char *dest = _val_dest + start;
-          MPI_Aint displacement = halo->c_domain_s_shift[rank_id]*elt_size;
+    if (_order_int_test(group_ranks, n_group_ranks)) {
 
-          MPI_Get(dest,
-                  length,                        /* origin count */
-                  mpi_datatype,                  /* origin datatype */
-                  halo->c_domain_rank[rank_id],  /* target rank */
-                  displacement,                  /* target displacement */
-                  length,                        /* target count */
-                  mpi_datatype,                  /* target datatype */
-                  hs->win);
-        }
+      MPI_Group glob_group;
+      MPI_Comm_group(cs_glob_mpi_comm, &glob_group);
+      MPI_Group_incl(glob_group,
+                     n_group_ranks,
+                     group_ranks,
+                     &(halo->c_domain_group));
+      MPI_Group_free(&glob_group);
 
-      }
-      else
-        hs->local_rank_id = rank_id;
     }
 
+    BFT_FREE(group_ranks);
   }
-}
 
-/*----------------------------------------------------------------------------*/
-/*!
- * \brief Finalize update of ghost values in case of parallelism
- *        for one-sided communication.
- *
- * The cs_halo_sync_pack function should have been called before this function,
- * using the same hs argument.
- *
- * \param[in]       halo        pointer to halo structure
- * \param[in]       val         pointer to variable value array
- * \param[in, out]  hs          pointer to halo state, NULL for global state
- */
-/*----------------------------------------------------------------------------*/
+  /* Exchange shifts for one-sided communication */
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET)
+    _exchange_send_shift(halo);
 
-static void
-_halo_sync_complete_one_sided(const cs_halo_t  *halo,
-                              void             *val,
-                              cs_halo_state_t  *hs)
-{
-  /* Use active target synchronization */
+#if (MPI_VERSION >= 3)
 
-  /* Access Epoch */
-  if (halo->c_domain_group != MPI_GROUP_NULL) {
-    MPI_Win_complete(hs->win);
+  /* Node-shared send buffers are sized and allocated (collectively)
+     with the first completed halo */
+  else if (   _halo_comm_mode == CS_HALO_COMM_SHM
+           && _shm_win == MPI_WIN_NULL
+           && cs_glob_mpi_comm != MPI_COMM_NULL)
+    _shm_window_create(  halo->n_send_elts[CS_HALO_EXTENDED]
+                       * _CS_HALO_SHM_MAX_ELT_SIZE);
 
-    /* Complete RMA exposure epoch */
-    MPI_Win_wait(hs->win);
-  }
-  else {
-    MPI_Win_fence(0, hs->win);
-  }
+#endif
 
-  /* Copy local values in case of periodicity */
+  /* Build neighborhood graph communicator */
+  if (   _halo_comm_mode == CS_HALO_COMM_NEIGHBOR && neighbor_graph
+      && cs_glob_mpi_comm != MPI_COMM_NULL)
+    _create_neighbor_comm(halo);
 
-  if (hs->local_rank_id > -1) {
-    size_t elt_size = cs_datatype_size[hs->data_type] * hs->stride;
-    _sync_local(halo, hs->local_rank_id, hs->sync_mode, elt_size,
-                hs->var_location, hs->send_buffer_cur, val);
-  }
-}
+#else
+
+  CS_UNUSED(neighbor_graph);
 
-#endif /* (MPI_VERSION >= 3) */
 #endif /* defined(HAVE_MPI) */
 
+  if (_halo_state == NULL)
+    _halo_state = cs_halo_state_create();
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -616,6 +1404,7 @@ cs_halo_create(const cs_interface_set_t  *ifs)
 #if defined(HAVE_MPI)
   halo->c_domain_group = MPI_GROUP_NULL;
   halo->c_domain_s_shift = NULL;
+  halo->c_domain_comm = MPI_COMM_NULL;
 #endif
 
   _n_halos += 1;
@@ -633,6 +1422,10 @@ cs_halo_create(const cs_interface_set_t  *ifs)
  * cs_halo_create_from_rank_neighbors so does not need to be called again
  * using these functions.
  *
+ * In \ref CS_HALO_COMM_NEIGHBOR mode, this function builds the halo's
+ * neighborhood graph communicator, and is thus collective on the main
+ * communicator.
+ *
  * \param[in]  halo  pointer to halo structure
  */
 /*----------------------------------------------------------------------------*/
@@ -640,51 +1433,7 @@ cs_halo_create(const cs_interface_set_t  *ifs)
 void
 cs_halo_create_complete(cs_halo_t  *halo)
 {
-#if defined(HAVE_MPI)
-
-  /* Make buffer available on device if relevant */
-  cs_sync_h2d(halo->send_index);
-  cs_sync_h2d(halo->send_list);
-
-  /* Create group for one-sided communication */
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
-    const int local_rank = CS_MAX(cs_glob_rank_id, 0);
-    int n_group_ranks = 0;
-    int *group_ranks = NULL;
-    BFT_MALLOC(group_ranks, halo->n_c_domains + 1, int);
-    for (int i = 0; i < halo->n_c_domains; i++) {
-      if (halo->c_domain_rank[i] < local_rank)
-        group_ranks[n_group_ranks++] = halo->c_domain_rank[i];
-    }
-    group_ranks[n_group_ranks++] = local_rank;
-    for (int i = 0; i < halo->n_c_domains; i++) {
-      if (halo->c_domain_rank[i] > local_rank)
-        group_ranks[n_group_ranks++] = halo->c_domain_rank[i];
-    }
-
-    if (_order_int_test(group_ranks, n_group_ranks)) {
-
-      MPI_Group glob_group;
-      MPI_Comm_group(cs_glob_mpi_comm, &glob_group);
-      MPI_Group_incl(glob_group,
-                     n_group_ranks,
-                     group_ranks,
-                     &(halo->c_domain_group));
-      MPI_Group_free(&glob_group);
-
-    }
-
-    BFT_FREE(group_ranks);
-  }
-
-  /* Exchange shifts for one-sided communication */
-  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET)
-    _exchange_send_shift(halo);
-
-#endif /* defined(HAVE_MPI) */
-
-  if (_halo_state == NULL)
-    _halo_state = cs_halo_state_create();
+  _halo_create_complete(halo, true);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -750,11 +1499,12 @@ cs_halo_create_from_ref(const cs_halo_t  *ref)
 #if defined(HAVE_MPI)
   halo->c_domain_group = MPI_GROUP_NULL;
   halo->c_domain_s_shift = NULL;
+  halo->c_domain_comm = MPI_COMM_NULL;
 #endif
 
   _n_halos += 1;
 
-  cs_halo_create_complete(halo);
+  _halo_create_complete(halo, false);
 
   return halo;
 }
@@ -810,6 +1560,7 @@ cs_halo_create_from_rank_neighbors(const cs_rank_neighbors_t  *rn,
 #if defined(HAVE_MPI)
   halo->c_domain_group = MPI_GROUP_NULL;
   halo->c_domain_s_shift = NULL;
+  halo->c_domain_comm = MPI_COMM_NULL;
 #endif
 
   halo->n_local_elts = n_local_elts;
@@ -1027,6 +1778,27 @@ cs_halo_destroy(cs_halo_t  **halo)
     MPI_Group_free(&(_halo->c_domain_group));
 
   BFT_FREE(_halo->c_domain_s_shift);
+
+  /* Remove associated communication plans */
+
+  cs_halo_plan_t *p_prev = NULL;
+  cs_halo_plan_t *p = _halo_plans;
+  while (p != NULL) {
+    cs_halo_plan_t *p_next = p->next;
+    if (p->halo == _halo) {
+      if (p_prev != NULL)
+        p_prev->next = p_next;
+      else
+        _halo_plans = p_next;
+      _plan_destroy(&p);
+    }
+    else
+      p_prev = p;
+    p = p_next;
+  }
+
+  if (_halo->c_domain_comm != MPI_COMM_NULL)
+    MPI_Comm_free(&(_halo->c_domain_comm));
 #endif
 
   BFT_FREE(_halo->c_domain_rank);
@@ -1042,10 +1814,16 @@ cs_halo_destroy(cs_halo_t  **halo)
 
   _n_halos -= 1;
 
-  /* Delete default state if no halo remains */
+  /* Delete default state and node-shared buffers if no halo remains */
 
-  if (_n_halos == 0)
+  if (_n_halos == 0) {
     cs_halo_state_destroy(&_halo_state);
+#if defined(HAVE_MPI)
+#if (MPI_VERSION >= 3)
+    _shm_window_destroy();
+#endif
+#endif
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1079,7 +1857,12 @@ cs_halo_state_create(void)
     .request_size = 0,
     .request = NULL,
     .status = NULL,
-    .win = MPI_WIN_NULL
+    .win = MPI_WIN_NULL,
+    .plan = NULL,
+    .shm_send = false,
+    .n_shm_requests = 0,
+    .shm_request = NULL,
+    .shm_info = NULL
 
 #endif
   };
@@ -1119,6 +1902,8 @@ cs_halo_state_destroy(cs_halo_state_t  **halo_state)
 #if defined(HAVE_MPI)
     BFT_FREE(hs->request);
     BFT_FREE(hs->status);
+    BFT_FREE(hs->shm_request);
+    BFT_FREE(hs->shm_info);
 #endif
 
     BFT_FREE(*halo_state);
@@ -1322,6 +2107,10 @@ cs_halo_renumber_ghost_cells(cs_halo_t        *halo,
  * and buffer will be used. If provided explicitely,
  * the buffer must be of sufficient size.
  *
+ * In \ref CS_HALO_COMM_SHM mode, with the default state, the node-shared
+ * send buffer is used instead of the provided buffer when large enough,
+ * so the returned pointer should always be used for packing.
+ *
  * \param[in]       halo        pointer to halo structure
  * \param[in]       sync_mode   synchronization mode (standard or extended)
  * \param[in]       data_type   data type
@@ -1348,6 +2137,37 @@ cs_halo_sync_pack_init_state(const cs_halo_t  *halo,
 
   cs_halo_state_t  *_hs = (hs != NULL) ? hs : _halo_state;
 
+#if defined(HAVE_MPI)
+
+  _hs->shm_send = false;
+  _hs->plan = NULL;
+
+  /* Persistent requests are bound to the plan's send buffer */
+
+  if (   _halo_comm_mode >= CS_HALO_COMM_P2P_PERSISTENT
+      && _hs == _halo_state && cs_glob_mpi_comm != MPI_COMM_NULL) {
+    _hs->plan = _plan_get(halo, sync_mode, data_type, stride);
+    if (_hs->plan->send_buffer != NULL)
+      _send_buffer = _hs->plan->send_buffer;
+  }
+
+#if (MPI_VERSION >= 3)
+
+  /* The node-shared send buffer is used instead of any other buffer
+     when possible, as node neighbors expect data there. */
+
+  if (   _halo_comm_mode == CS_HALO_COMM_SHM
+      && _shm_win != MPI_WIN_NULL && _hs == _halo_state) {
+    size_t elt_size = cs_datatype_size[data_type] * stride;
+    if (halo->n_send_elts[sync_mode]*elt_size <= _shm_size[_shm_rank_id]) {
+      _hs->shm_send = true;
+      _send_buffer = _shm_buffer;
+    }
+  }
+
+#endif
+#endif
+
   if (_send_buffer == NULL) {
     size_t send_buffer_size = cs_halo_pack_size(halo, data_type, stride);
 
@@ -1617,9 +2437,21 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
   cs_halo_state_t  *_hs = (hs != NULL) ? hs : _halo_state;
 
+  cs_timer_t t0 = cs_timer_time();
+
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_start_one_sided(halo, val, _hs);
+    _comm_timer_add(&t0, false);
+    return;
+  }
+#endif
+
+#if defined(HAVE_MPI)
+  if (_hs->plan != NULL) {
+    _update_requests(halo, _hs);
+    _plan_sync_start(halo, val, _hs);
+    _comm_timer_add(&t0, false);
     return;
   }
 #endif
@@ -1668,7 +2500,26 @@ cs_halo_sync_start(const cs_halo_t  *halo,
   int request_count = 0;
   const int local_rank = CS_MAX(cs_glob_rank_id, 0);
 
-  /* Receive data from distant ranks */
+  /* With node-shared buffers, node neighbors exchange a "ready" message
+     containing the shift of the matching data in the sender's buffer, and
+     whether that buffer is used (otherwise, data is sent normally) */
+
+  bool use_shm = false;
+  cs_lnum_t *send_info = NULL, *recv_info = NULL;
+
+  _hs->n_shm_requests = 0;
+
+#if (MPI_VERSION >= 3)
+  if (   _halo_comm_mode == CS_HALO_COMM_SHM
+      && _shm_win != MPI_WIN_NULL && _hs == _halo_state) {
+    use_shm = true;
+    send_info = _hs->shm_info;
+    recv_info = _hs->shm_info + 2*halo->n_c_domains;
+  }
+#endif
+
+  /* Receive data from distant ranks
+     (or "ready" message from node neighbors) */
 
   for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
 
@@ -1677,6 +2528,22 @@ cs_halo_sync_start(const cs_halo_t  *halo,
 
     if (halo->c_domain_rank[rank_id] != local_rank) {
 
+#if (MPI_VERSION >= 3)
+      if (use_shm && length > 0) {
+        int shm_rank = _shm_rank(halo->c_domain_rank[rank_id]);
+        if (shm_rank > -1) {
+          MPI_Irecv(recv_info + 2*rank_id,
+                    2,
+                    CS_MPI_LNUM,
+                    shm_rank,
+                    _CS_HALO_SHM_READY_TAG,
+                    _shm_comm,
+                    &(_hs->shm_request[_hs->n_shm_requests++]));
+          continue;
+        }
+      }
+#endif
+
       if (length > 0) {
         size_t start = (size_t)(halo->index[2*rank_id]);
         unsigned char *dest = _val_dest + start*elt_size;
@@ -1700,6 +2567,15 @@ cs_halo_sync_start(const cs_halo_t  *halo,
   if (_halo_use_barrier)
     MPI_Barrier(cs_glob_mpi_comm);
 
+#if (MPI_VERSION >= 3)
+
+  /* Make packed node-shared buffer visible to node neighbors */
+
+  if (_hs->shm_send)
+    MPI_Win_sync(_shm_win);
+
+#endif
+
   /* Send data to distant ranks */
 
   for (int rank_id = 0; rank_id < halo->n_c_domains; rank_id++) {
@@ -1708,6 +2584,29 @@ cs_halo_sync_start(const cs_halo_t  *halo,
     cs_lnum_t length = (  halo->send_index[2*rank_id + end_shift]
                         - halo->send_index[2*rank_id]);
 
+#if (MPI_VERSION >= 3)
+
+    /* For node neighbors, signal that the buffer is ready,
+       and expect a signal when it has been read */
+
+    if (use_shm && length > 0) {
+      int shm_rank = _shm_rank(halo->c_domain_rank[rank_id]);
+      if (shm_rank > -1) {
+        send_info[2*rank_id] = halo->send_index[2*rank_id];
+        send_info[2*rank_id + 1] = (_hs->shm_send) ? 1 : 0;
+        MPI_Isend(send_info + 2*rank_id, 2, CS_MPI_LNUM, shm_rank,
+                  _CS_HALO_SHM_READY_TAG, _shm_comm,
+                  &(_hs->request[request_count++]));
+        if (_hs->shm_send) {
+          MPI_Irecv(NULL, 0, MPI_BYTE, shm_rank, _CS_HALO_SHM_DONE_TAG,
+                    _shm_comm, &(_hs->request[request_count++]));
+          continue;
+        }
+      }
+    }
+
+#endif
+
     if (halo->c_domain_rank[rank_id] != local_rank && length > 0)
       MPI_Isend(buffer + start,
                 length*stride,
@@ -1722,6 +2621,8 @@ cs_halo_sync_start(const cs_halo_t  *halo,
   _hs->n_requests = request_count;
 
 #endif /* defined(HAVE_MPI) */
+
+  _comm_timer_add(&t0, false);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1752,19 +2653,47 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
 
   cs_halo_state_t  *_hs = (hs != NULL) ? hs : _halo_state;
 
+  cs_timer_t t0 = cs_timer_time();
+
 #if (MPI_VERSION >= 3)
-  if (_halo_comm_mode > CS_HALO_COMM_P2P) {
+  if (_halo_comm_mode == CS_HALO_COMM_RMA_GET) {
     _halo_sync_complete_one_sided(halo, val, _hs);
+    _comm_timer_add(&t0, true);
     return;
   }
 #endif
 
 #if defined(HAVE_MPI)
 
-  /* Wait for all exchanges */
+  if (_hs->plan != NULL)
+    _plan_sync_wait(halo, val, _hs);
+
+  else {
+
+#if (MPI_VERSION >= 3)
+
+    /* Copy from node-shared buffers of node neighbors */
+
+    if (_hs->n_shm_requests > 0)
+      _shm_sync_copy(halo, val, _hs);
 
-  if (_hs->n_requests > 0)
-    MPI_Waitall(_hs->n_requests, _hs->request, _hs->status);
+#endif
+
+    /* Wait for all exchanges */
+
+    if (_hs->n_requests > 0)
+      MPI_Waitall(_hs->n_requests, _hs->request, _hs->status);
+
+  }
+
+#if (MPI_VERSION >= 3)
+
+  /* Node neighbors are done reading; order with following buffer updates */
+
+  if (_hs->shm_send)
+    MPI_Win_sync(_shm_win);
+
+#endif
 
 #endif /* defined(HAVE_MPI) */
 
@@ -1806,6 +2735,12 @@ cs_halo_sync_wait(const cs_halo_t  *halo,
   _hs->send_buffer_cur = NULL;
   _hs->n_requests = 0;
   _hs->local_rank_id  = -1;
+#if defined(HAVE_MPI)
+  _hs->shm_send = false;
+  _hs->plan = NULL;
+#endif
+
+  _comm_timer_add(&t0, true);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -1989,6 +2924,17 @@ cs_halo_get_comm_mode(void)
 /*!
  * \brief Set default communication mode for halo exchange.
  *
+ * Switching to or from the \ref CS_HALO_COMM_SHM mode is only possible
+ * before any halo is built, as the node-shared send buffers are allocated
+ * (collectively) when the first halo (usually the main mesh halo) is
+ * completed. If shared memory windows are not available, or an accelerator
+ * device is used, that mode falls back to \ref CS_HALO_COMM_P2P.
+ *
+ * The \ref CS_HALO_COMM_P2P_PERSISTENT and \ref CS_HALO_COMM_NEIGHBOR
+ * modes are also host-only. As the neighborhood graph communicator is
+ * built when a halo is completed, halos completed before the latter mode
+ * is set (or built from a reference halo) use persistent requests.
+ *
  * \param[in]  mode  allocation mode to set
  */
 /*----------------------------------------------------------------------------*/
@@ -1996,8 +2942,31 @@ cs_halo_get_comm_mode(void)
 void
 cs_halo_set_comm_mode(cs_halo_comm_mode_t  mode)
 {
-  if (mode >= CS_HALO_COMM_P2P && mode <= CS_HALO_COMM_RMA_GET)
-    _halo_comm_mode = mode;
+  if (mode < CS_HALO_COMM_P2P || mode > CS_HALO_COMM_NEIGHBOR)
+    return;
+
+#if defined(HAVE_MPI) && (MPI_VERSION >= 3)
+  /* Node-shared buffers and plan buffers are host-only */
+  if (mode >= CS_HALO_COMM_SHM && cs_get_device_id() > -1)
+    mode = CS_HALO_COMM_P2P;
+#else
+  if (mode == CS_HALO_COMM_SHM)
+    mode = CS_HALO_COMM_P2P;
+  else if (mode == CS_HALO_COMM_NEIGHBOR)
+    mode = CS_HALO_COMM_P2P_PERSISTENT;
+#endif
+
+  if (   _n_halos > 0 && (int)mode != _halo_comm_mode
+      && (   mode == CS_HALO_COMM_SHM
+          || _halo_comm_mode == CS_HALO_COMM_SHM))
+    bft_error
+      (__FILE__, __LINE__, 0,
+       "%s:\n"
+       "  Switching to or from the shared memory halo exchange mode\n"
+       "  is only possible before any halo is built.",
+       __func__);
+
+  _halo_comm_mode = mode;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2061,6 +3030,15 @@ cs_halo_dump(const cs_halo_t  *halo,
   for (int i = 0; i < halo->n_c_domains; i++)
     bft_printf("%5d", halo->c_domain_rank[i]);
 
+#if defined(HAVE_MPI)
+  for (const cs_halo_plan_t *p = _halo_plans; p != NULL; p = p->next) {
+    if (p->halo == halo)
+      bft_printf("\n  plan: %s, sync_mode %d, datatype %s, stride %d",
+                 _halo_comm_mode_name[p->comm_mode], (int)p->sync_mode,
+                 cs_datatype_name[p->data_type], p->stride);
+  }
+#endif
+
   for (int halo_id = 0; halo_id < 2; halo_id++) {
 
     cs_lnum_t  n_elts[2];
@@ -2159,6 +3137,72 @@ cs_halo_dump(const cs_halo_t  *halo,
   bft_printf_flush();
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log performance information relative to halo exchanges,
+ *        for each communication mode used.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_log_finalize(void)
+{
+  const int n_modes = _CS_HALO_N_COMM_MODES;
+
+  double wtimes[_CS_HALO_N_COMM_MODES];
+  double wtimes_mean[_CS_HALO_N_COMM_MODES];
+  double wtimes_max[_CS_HALO_N_COMM_MODES];
+  double wtimes_min[_CS_HALO_N_COMM_MODES];
+  unsigned long long calls[_CS_HALO_N_COMM_MODES];
+
+  for (int i = 0; i < n_modes; i++) {
+    wtimes[i] = (_halo_comm_timer[i]).nsec*1e-9;
+    wtimes_mean[i] = wtimes[i];
+    wtimes_max[i] = wtimes[i];
+    wtimes_min[i] = wtimes[i];
+    calls[i] = _halo_comm_calls[i];
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    MPI_Allreduce(wtimes, wtimes_mean, n_modes, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(wtimes, wtimes_max, n_modes, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(wtimes, wtimes_min, n_modes, MPI_DOUBLE, MPI_MIN,
+                  cs_glob_mpi_comm);
+    MPI_Allreduce(_halo_comm_calls, calls, n_modes, MPI_UNSIGNED_LONG_LONG,
+                  MPI_MAX, cs_glob_mpi_comm);
+  }
+#endif
+
+  unsigned long long n_calls_tot = 0;
+  for (int i = 0; i < n_modes; i++) {
+    wtimes_mean[i] /= cs_glob_n_ranks;
+    n_calls_tot += calls[i];
+  }
+
+  if (n_calls_tot == 0)
+    return;
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\nHalo exchanges (start and wait):\n\n"
+                  "                                 mean        minimum"
+                  "      maximum     calls\n"));
+
+  for (int i = 0; i < n_modes; i++) {
+    if (calls[i] == 0)
+      continue;
+    cs_log_printf(CS_LOG_PERFORMANCE,
+                  "  %-26s %12.5f s %12.5f %12.5f s   %llu\n",
+                  _(_halo_comm_mode_name[i]),
+                  wtimes_mean[i], wtimes_min[i], wtimes_max[i], calls[i]);
+  }
+
+  cs_log_printf(CS_LOG_PERFORMANCE, "\n");
+  cs_log_separator(CS_LOG_PERFORMANCE);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -66,8 +66,18 @@ typedef enum {
 typedef enum {
 
   CS_HALO_COMM_P2P,      /*!< non-blocking point-to-point communication */
-  CS_HALO_COMM_RMA_GET   /*!< MPI-3 one-sided with get semantics and
+  CS_HALO_COMM_RMA_GET,  /*!< MPI-3 one-sided with get semantics and
                            active target synchronization */
+  CS_HALO_COMM_SHM,      /*!< MPI-3 shared memory window for send buffers
+                           of ranks on the same node, point-to-point
+                           communication between nodes */
+  CS_HALO_COMM_P2P_PERSISTENT,  /*!< persistent point-to-point requests,
+                                  using a plan cached for each halo,
+                                  datatype and stride */
+  CS_HALO_COMM_NEIGHBOR  /*!< MPI-3 non-blocking neighborhood collective
+                           on a graph communicator built with the halo
+                           (persistent requests for halos built from
+                           a reference halo) */
 
 } cs_halo_comm_mode_t;
 
@@ -163,6 +173,10 @@ typedef struct {
   MPI_Group   c_domain_group;    /* Group of connected domains */
   cs_lnum_t  *c_domain_s_shift;  /* Target buffer shift for distant
                                     ranks using one-sided get */
+
+  MPI_Comm    c_domain_comm;     /* Neighborhood graph communicator
+                                    of connected domains, or
+                                    MPI_COMM_NULL */
 #endif
 
 } cs_halo_t;
@@ -642,6 +656,17 @@ cs_halo_get_comm_mode(void);
 /*!
  * \brief Set default communication mode for halo exchange.
  *
+ * Switching to or from the \ref CS_HALO_COMM_SHM mode is only possible
+ * before any halo is built, as the node-shared send buffers are allocated
+ * (collectively) when the first halo (usually the main mesh halo) is
+ * completed. If shared memory windows are not available, or an accelerator
+ * device is used, that mode falls back to \ref CS_HALO_COMM_P2P.
+ *
+ * The \ref CS_HALO_COMM_P2P_PERSISTENT and \ref CS_HALO_COMM_NEIGHBOR
+ * modes are also host-only. As the neighborhood graph communicator is
+ * built when a halo is completed, halos completed before the latter mode
+ * is set (or built from a reference halo) use persistent requests.
+ *
  * \param[in]  mode  allocation mode to set
  */
 /*----------------------------------------------------------------------------*/
@@ -684,6 +709,16 @@ void
 cs_halo_dump(const cs_halo_t  *halo,
              int               print_level);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Log performance information relative to halo exchanges,
+ *        for each communication mode used.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_halo_log_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -31,6 +31,7 @@
  *----------------------------------------------------------------------------*/
 
 #include <assert.h>
+#include <float.h>
 #include <math.h>
 #include <stdarg.h>
 #include <stdlib.h>
@@ -44,7 +45,9 @@
 #include "bft_error.h"
 #include "bft_mem.h"
 #include "bft_printf.h"
+#include "cs_file.h"
 #include "cs_log.h"
+#include "cs_parall.h"
 #include "cs_timer.h"
 
 #include "cs_property.h"
@@ -118,6 +121,44 @@ typedef struct {
 
 } cs_thermal_table_t;
 
+/* Tabulated property (bicubic interpolation on a uniform grid
+   over the thermodynamic plane, in library units) */
+
+typedef struct {
+
+  int          n[2];                 /* number of nodes on each plane axis */
+  cs_real_t    x_min[2];             /* lower bounds on each plane axis */
+  cs_real_t    dx[2];                /* node spacing on each plane axis */
+  cs_real_t    max_err;              /* estimated max. relative error */
+
+  cs_real_t   *val;                  /* node values, with a layer of
+                                        linearly extrapolated ghost nodes
+                                        (size: (n[0]+2)*(n[1]+2)) */
+  char        *valid;                /* interval flags (1 if interpolation
+                                        meets the tolerance, 0 otherwise),
+                                        or NULL if all are valid
+                                        (size: (n[0]-1)*(n[1]-1)) */
+
+  cs_gnum_t    n_evals;              /* number of tabulated evaluations */
+  cs_gnum_t    n_direct;             /* number of direct library evaluations
+                                        (out of range or invalid) */
+
+} cs_phys_prop_table_t;
+
+/* Tabulation settings */
+
+typedef struct {
+
+  cs_real_t    bounds[2][2];         /* bounds on each plane axis
+                                        (user units) */
+  cs_real_t    tolerance;            /* target max. relative error */
+  char        *cache_path;           /* directory for cached tables,
+                                        or NULL */
+
+  cs_phys_prop_table_t  *tables[CS_PHYS_PROP_SPEED_OF_SOUND + 1];
+
+} cs_phys_prop_tabulation_t;
+
 /*----------------------------------------------------------------------------
  * Function pointer types
  *----------------------------------------------------------------------------*/
@@ -156,6 +197,22 @@ cs_thermal_table_t *cs_glob_thermal_table = NULL;
 static cs_timer_counter_t   _physprop_lib_t_tot;   /* Total time in physical
                                                       property library calls */
 
+static cs_phys_prop_tabulation_t  *_tabulation = NULL;
+
+static const char *_phys_prop_name[] = {N_("pressure"),
+                                        N_("temperature"),
+                                        N_("enthalpy"),
+                                        N_("entropy"),
+                                        N_("isobaric heat capacity"),
+                                        N_("isochoric heat capacity"),
+                                        N_("specific volume"),
+                                        N_("density"),
+                                        N_("internal energy"),
+                                        N_("quality"),
+                                        N_("thermal conductivity"),
+                                        N_("dynamic viscosity"),
+                                        N_("speed of sound")};
+
 #if defined(HAVE_DLOPEN) && defined(HAVE_EOS)
 
 static void                     *_cs_eos_dl_lib = NULL;
@@ -199,6 +256,720 @@ _thermal_table_create(void)
   return tt;
 }
 
+/*----------------------------------------------------------------------------
+ * Compute a physical property with the thermal table's library.
+ *
+ * Values are assumed to be already converted to library units.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_lib_compute(cs_phys_prop_type_t   property,
+                       cs_lnum_t             n_vals,
+                       const cs_real_t       var1[],
+                       const cs_real_t       var2[],
+                       cs_real_t             val[])
+{
+  cs_timer_t t0 = cs_timer_time();
+
+  if (cs_glob_thermal_table->type == 1) {
+    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#if defined(HAVE_EOS) /* always a plugin */
+  else if (cs_glob_thermal_table->type == 2) {
+    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
+                      property,
+                      n_vals,
+                      var1,
+                      var2,
+                      val);
+  }
+#endif
+#if defined(HAVE_COOLPROP)
+  else if (cs_glob_thermal_table->type == 3) {
+    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
+                           _cs_coolprop_backend,
+                           cs_glob_thermal_table->thermo_plane,
+                           property,
+                           n_vals,
+                           var1,
+                           var2,
+                           val);
+  }
+#endif
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_add_diff(&_physprop_lib_t_tot, &t0, &t1);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a physical property with the thermal table's library for a
+ * set of points known on all ranks.
+ *
+ * Each rank evaluates a contiguous block of points, and results are then
+ * gathered on all ranks. This is a collective operation.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis
+ *   var2     <-- values on second plane axis
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_lib_compute_shared(cs_phys_prop_type_t   property,
+                              cs_lnum_t             n_vals,
+                              const cs_real_t       var1[],
+                              const cs_real_t       var2[],
+                              cs_real_t             val[])
+{
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    const int n_ranks = cs_glob_n_ranks;
+    const int rank_id = cs_glob_rank_id;
+
+    int *count, *shift;
+    BFT_MALLOC(count, n_ranks, int);
+    BFT_MALLOC(shift, n_ranks, int);
+
+    for (int i = 0; i < n_ranks; i++) {
+      shift[i] = ((cs_gnum_t)n_vals * i) / n_ranks;
+      count[i] = ((cs_gnum_t)n_vals * (i+1)) / n_ranks - shift[i];
+    }
+
+    if (count[rank_id] > 0)
+      _phys_prop_lib_compute(property,
+                             count[rank_id],
+                             var1 + shift[rank_id],
+                             var2 + shift[rank_id],
+                             val + shift[rank_id]);
+
+    MPI_Allgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL,
+                   val, count, shift, CS_MPI_REAL, cs_glob_mpi_comm);
+
+    BFT_FREE(shift);
+    BFT_FREE(count);
+
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  _phys_prop_lib_compute(property, n_vals, var1, var2, val);
+}
+
+/*----------------------------------------------------------------------------
+ * Compute Catmull-Rom cubic interpolation weights.
+ *
+ * parameters:
+ *   t <-- local coordinate in interval, in [0, 1]
+ *   w --> weights of nodes i-1, i, i+1, i+2
+ *----------------------------------------------------------------------------*/
+
+static inline void
+_cubic_weights(cs_real_t  t,
+               cs_real_t  w[4])
+{
+  const cs_real_t t2 = t*t, t3 = t2*t;
+
+  w[0] = 0.5*(-t3 + 2.*t2 - t);
+  w[1] = 0.5*(3.*t3 - 5.*t2 + 2.);
+  w[2] = 0.5*(-3.*t3 + 4.*t2 + t);
+  w[3] = 0.5*(t3 - t2);
+}
+
+/*----------------------------------------------------------------------------
+ * Evaluate a tabulated property by bicubic interpolation.
+ *
+ * parameters:
+ *   t    <-- pointer to property table
+ *   var1 <-- value on first plane axis
+ *   var2 <-- value on second plane axis
+ *
+ * returns:
+ *   interpolated value, or NAN if outside the table's range or in an
+ *   interval where the interpolation does not meet the tolerance
+ *----------------------------------------------------------------------------*/
+
+static inline cs_real_t
+_table_eval(const cs_phys_prop_table_t  *t,
+            cs_real_t                    var1,
+            cs_real_t                    var2)
+{
+  const cs_real_t u0 = (var1 - t->x_min[0]) / t->dx[0];
+  const cs_real_t u1 = (var2 - t->x_min[1]) / t->dx[1];
+
+  if (   !(u0 >= 0. && u0 <= t->n[0] - 1)
+      || !(u1 >= 0. && u1 <= t->n[1] - 1))
+    return NAN;
+
+  const int i0 = CS_MIN((int)u0, t->n[0] - 2);
+  const int i1 = CS_MIN((int)u1, t->n[1] - 2);
+
+  if (t->valid != NULL && t->valid[i0*(t->n[1] - 1) + i1] == 0)
+    return NAN;
+
+  cs_real_t w0[4], w1[4];
+  _cubic_weights(u0 - i0, w0);
+  _cubic_weights(u1 - i1, w1);
+
+  /* With the ghost layer, node (i0-1, i1-1) is stored at (i0, i1) */
+
+  const cs_lnum_t stride = t->n[1] + 2;
+  const cs_real_t *v = t->val + (cs_lnum_t)i0*stride + i1;
+
+  cs_real_t r = 0.;
+  for (int a = 0; a < 4; a++) {
+    const cs_real_t *_v = v + a*stride;
+    r += w0[a] * (w1[0]*_v[0] + w1[1]*_v[1] + w1[2]*_v[2] + w1[3]*_v[3]);
+  }
+
+  return r;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute node values of a property table with the library.
+ *
+ * parameters:
+ *   property <-- tabulated property
+ *   t        <-> pointer to property table (grid defined)
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_fill(cs_phys_prop_type_t    property,
+            cs_phys_prop_table_t  *t)
+{
+  const int n0 = t->n[0], n1 = t->n[1];
+  const cs_lnum_t n_nodes = (cs_lnum_t)n0*n1;
+  const cs_lnum_t stride = n1 + 2;
+
+  cs_real_t *x, *y, *f;
+  BFT_MALLOC(x, n_nodes, cs_real_t);
+  BFT_MALLOC(y, n_nodes, cs_real_t);
+  BFT_MALLOC(f, n_nodes, cs_real_t);
+
+  for (int i = 0; i < n0; i++) {
+    for (int j = 0; j < n1; j++) {
+      x[i*n1 + j] = t->x_min[0] + i*t->dx[0];
+      y[i*n1 + j] = t->x_min[1] + j*t->dx[1];
+    }
+  }
+
+  _phys_prop_lib_compute_shared(property, n_nodes, x, y, f);
+
+  BFT_REALLOC(t->val, (size_t)(n0+2)*stride, cs_real_t);
+
+  for (int i = 0; i < n0; i++) {
+    for (int j = 0; j < n1; j++)
+      t->val[(i+1)*stride + j+1] = f[i*n1 + j];
+  }
+
+  /* Linearly extrapolated ghost nodes (rows, then columns with corners) */
+
+  for (int j = 1; j < n1 + 1; j++) {
+    t->val[j] = 2.*t->val[stride + j] - t->val[2*stride + j];
+    t->val[(n0+1)*stride + j] = 2.*t->val[n0*stride + j]
+                                 - t->val[(n0-1)*stride + j];
+  }
+  for (int i = 0; i < n0 + 2; i++) {
+    cs_real_t *v = t->val + i*stride;
+    v[0] = 2.*v[1] - v[2];
+    v[n1+1] = 2.*v[n1] - v[n1-1];
+  }
+
+  BFT_FREE(f);
+  BFT_FREE(y);
+  BFT_FREE(x);
+}
+
+/*----------------------------------------------------------------------------
+ * Estimate the interpolation error of a property table along a plane axis.
+ *
+ * The library is evaluated at midpoints between nodes along the given
+ * axis; the error is relative to the local value, with an absolute floor
+ * based on the table's largest value.
+ *
+ * If the valid array is given, intervals adjacent to a midpoint where the
+ * error exceeds the tolerance are flagged as invalid (0).
+ *
+ * parameters:
+ *   property  <-- tabulated property
+ *   t         <-- pointer to property table
+ *   axis      <-- plane axis (0 or 1)
+ *   tolerance <-- target max. relative error
+ *   valid     <-> interval validity flags, or NULL
+ *
+ * returns:
+ *   estimated max. relative error
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_table_error(cs_phys_prop_type_t          property,
+             const cs_phys_prop_table_t  *t,
+             int                          axis,
+             cs_real_t                    tolerance,
+             char                         valid[])
+{
+  const int m0 = (axis == 0) ? t->n[0] - 1 : t->n[0];
+  const int m1 = (axis == 1) ? t->n[1] - 1 : t->n[1];
+  const cs_lnum_t n_pts = (cs_lnum_t)m0*m1;
+
+  cs_real_t *x, *y, *f;
+  BFT_MALLOC(x, n_pts, cs_real_t);
+  BFT_MALLOC(y, n_pts, cs_real_t);
+  BFT_MALLOC(f, n_pts, cs_real_t);
+
+  const cs_real_t s0 = (axis == 0) ? 0.5 : 0.;
+  const cs_real_t s1 = (axis == 1) ? 0.5 : 0.;
+
+  for (int i = 0; i < m0; i++) {
+    for (int j = 0; j < m1; j++) {
+      x[i*m1 + j] = t->x_min[0] + (i + s0)*t->dx[0];
+      y[i*m1 + j] = t->x_min[1] + (j + s1)*t->dx[1];
+    }
+  }
+
+  _phys_prop_lib_compute_shared(property, n_pts, x, y, f);
+
+  cs_real_t f_max = 0.;
+  const cs_lnum_t n_vals = (cs_lnum_t)(t->n[0]+2)*(t->n[1]+2);
+  for (cs_lnum_t k = 0; k < n_vals; k++) {
+    if (isfinite(t->val[k]))
+      f_max = CS_MAX(f_max, CS_ABS(t->val[k]));
+  }
+
+  const cs_real_t f_floor = 1e-10*f_max + DBL_MIN;
+
+  const int n_i1 = t->n[1] - 1;
+
+  cs_real_t err = 0.;
+  for (cs_lnum_t k = 0; k < n_pts; k++) {
+    if (isfinite(f[k])) {
+      cs_real_t r = _table_eval(t, x[k], y[k]);
+      if (isfinite(r)) {
+        cs_real_t e = CS_ABS(r - f[k]) / (CS_ABS(f[k]) + f_floor);
+        err = CS_MAX(err, e);
+
+        /* Midpoint (i + s0, j + s1) is on the edge shared by intervals
+           (i, j) and (i, j-1) along axis 0, (i, j) and (i-1, j) otherwise */
+
+        if (valid != NULL && e > tolerance) {
+          const int i = k / m1, j = k % m1;
+          const int di = (axis == 1) ? 1 : 0, dj = (axis == 0) ? 1 : 0;
+          if (i < t->n[0] - 1 && j < n_i1)
+            valid[i*n_i1 + j] = 0;
+          if (i - di >= 0 && j - dj >= 0)
+            valid[(i-di)*n_i1 + j-dj] = 0;
+        }
+      }
+    }
+  }
+
+  BFT_FREE(f);
+  BFT_FREE(y);
+  BFT_FREE(x);
+
+  return err;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the cache file name and header for a property table.
+ *
+ * parameters:
+ *   property    <-- tabulated property
+ *   file_name   --> file name (size: 512)
+ *   header      --> header string identifying the table (size: 512)
+ *
+ * returns:
+ *   true if a cache path is defined, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_table_cache_id(cs_phys_prop_type_t   property,
+                char                  file_name[512],
+                char                  header[512])
+{
+  const cs_thermal_table_t *tt = cs_glob_thermal_table;
+  const cs_phys_prop_tabulation_t *tb = _tabulation;
+
+  if (tb->cache_path == NULL)
+    return false;
+
+  const char *method = (tt->method != NULL) ? tt->method : "";
+
+  char name[128];
+  snprintf(name, 127, "%s_%s_%d_%d",
+           tt->material, method, (int)tt->thermo_plane, (int)property);
+  name[127] = '\0';
+
+  /* Keep only portable characters in file name */
+
+  for (char *c = name; *c != '\0'; c++) {
+    if (!(   (*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z')
+          || (*c >= '0' && *c <= '9') || *c == '-'))
+      *c = '_';
+  }
+
+  snprintf(file_name, 511, "%s%cphys_prop_%s.bin",
+           tb->cache_path, DIR_SEPARATOR, name);
+  file_name[511] = '\0';
+
+  memset(header, 0, 512);
+  snprintf(header, 511,
+           "code_saturne physical property table 1.1\n"
+           "%s\n%s\n%d %d %d %d\n%.17g %.17g %.17g %.17g\n%.17g\n",
+           tt->material, method, tt->type, (int)tt->thermo_plane,
+           (int)property, tt->temp_scale,
+           tb->bounds[0][0], tb->bounds[0][1],
+           tb->bounds[1][0], tb->bounds[1][1],
+           tb->tolerance);
+
+  return true;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a property table from its cache file, if present and matching.
+ *
+ * parameters:
+ *   property <-- tabulated property
+ *   t        <-> pointer to property table (grid bounds defined)
+ *
+ * returns:
+ *   true if the table was read, false otherwise
+ *----------------------------------------------------------------------------*/
+
+static bool
+_table_read(cs_phys_prop_type_t    property,
+            cs_phys_prop_table_t  *t)
+{
+  char file_name[512], header[512], f_header[512];
+
+  if (_table_cache_id(property, file_name, header) == false)
+    return false;
+
+  FILE *f = fopen(file_name, "rb");
+  if (f == NULL)
+    return false;
+
+  bool retval = false;
+  int n[2];
+
+  if (   fread(f_header, 1, 512, f) == 512
+      && memcmp(header, f_header, 512) == 0
+      && fread(n, sizeof(int), 2, f) == 2
+      && n[0] > 1 && n[1] > 1
+      && fread(&(t->max_err), sizeof(cs_real_t), 1, f) == 1) {
+
+    size_t n_vals = (size_t)(n[0]+2)*(n[1]+2);
+    size_t n_intervals = (size_t)(n[0]-1)*(n[1]-1);
+    int has_valid = 0;
+    BFT_REALLOC(t->val, n_vals, cs_real_t);
+
+    if (   fread(t->val, sizeof(cs_real_t), n_vals, f) == n_vals
+        && fread(&has_valid, sizeof(int), 1, f) == 1) {
+      t->n[0] = n[0];
+      t->n[1] = n[1];
+      retval = true;
+      if (has_valid) {
+        BFT_MALLOC(t->valid, n_intervals, char);
+        if (fread(t->valid, 1, n_intervals, f) != n_intervals) {
+          BFT_FREE(t->valid);
+          retval = false;
+        }
+      }
+    }
+
+  }
+
+  fclose(f);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------
+ * Write a property table to its cache file.
+ *
+ * The file is first written under a temporary name and then renamed,
+ * so that concurrent runs never read a partially written table.
+ *
+ * parameters:
+ *   property <-- tabulated property
+ *   t        <-- pointer to property table
+ *----------------------------------------------------------------------------*/
+
+static void
+_table_write(cs_phys_prop_type_t          property,
+             const cs_phys_prop_table_t  *t)
+{
+  char file_name[512], header[512], tmp_name[520];
+
+  if (cs_glob_rank_id > 0)
+    return;
+
+  if (_table_cache_id(property, file_name, header) == false)
+    return;
+
+  if (cs_file_mkdir_default(_tabulation->cache_path) != 0) {
+    bft_printf(_("\n  Warning: unable to create directory \"%s\"\n"
+                 "           for physical property tables.\n"),
+               _tabulation->cache_path);
+    return;
+  }
+
+  snprintf(tmp_name, 519, "%s.tmp", file_name);
+  tmp_name[519] = '\0';
+
+  FILE *f = fopen(tmp_name, "wb");
+  bool ok = (f != NULL);
+
+  if (ok) {
+    size_t n_vals = (size_t)(t->n[0]+2)*(t->n[1]+2);
+    size_t n_intervals = (size_t)(t->n[0]-1)*(t->n[1]-1);
+    int has_valid = (t->valid != NULL) ? 1 : 0;
+    ok =    fwrite(header, 1, 512, f) == 512
+         && fwrite(t->n, sizeof(int), 2, f) == 2
+         && fwrite(&(t->max_err), sizeof(cs_real_t), 1, f) == 1
+         && fwrite(t->val, sizeof(cs_real_t), n_vals, f) == n_vals
+         && fwrite(&has_valid, sizeof(int), 1, f) == 1;
+    if (ok && has_valid)
+      ok = (fwrite(t->valid, 1, n_intervals, f) == n_intervals);
+    if (fclose(f) != 0)
+      ok = false;
+    if (ok)
+      ok = (rename(tmp_name, file_name) == 0);
+    else
+      remove(tmp_name);
+  }
+
+  if (!ok)
+    bft_printf(_("\n  Warning: unable to write physical property table\n"
+                 "           \"%s\".\n"), file_name);
+}
+
+/*----------------------------------------------------------------------------
+ * Build (or read from cache) the table for a given property.
+ *
+ * Starting from a coarse grid, the number of intervals along each plane
+ * axis is doubled while the estimated interpolation error along that
+ * axis exceeds the tolerance. If the tolerance is not reached with the
+ * finest grid, intervals where the estimated error exceeds it are
+ * flagged so that values in those intervals are computed directly.
+ *
+ * Library evaluations are shared among ranks, so this is a collective
+ * operation.
+ *
+ * parameters:
+ *   property <-- tabulated property
+ *
+ * returns:
+ *   pointer to property table
+ *----------------------------------------------------------------------------*/
+
+static cs_phys_prop_table_t *
+_table_build(cs_phys_prop_type_t  property)
+{
+  const int n_init = 17, n_max = 1025;
+
+  const cs_phys_prop_tabulation_t *tb = _tabulation;
+
+  cs_phys_prop_table_t *t;
+  BFT_MALLOC(t, 1, cs_phys_prop_table_t);
+
+  t->val = NULL;
+  t->valid = NULL;
+  t->max_err = 0.;
+  t->n_evals = 0;
+  t->n_direct = 0;
+
+  /* Bounds in library units */
+
+  cs_real_t x_max[2];
+  for (int i = 0; i < 2; i++) {
+    t->x_min[i] = tb->bounds[i][0];
+    x_max[i] = tb->bounds[i][1];
+  }
+  if (cs_glob_thermal_table->temp_scale == 2) {
+    t->x_min[1] += 273.15;
+    x_max[1] += 273.15;
+  }
+
+  cs_timer_t t0 = cs_timer_time();
+
+  /* Use cached table only if all ranks could read it */
+
+  int read_ok = (_table_read(property, t)) ? 1 : 0;
+  cs_parall_min(1, CS_INT_TYPE, &read_ok);
+
+  bool from_cache = (read_ok) ? true : false;
+
+  if (from_cache) {
+    for (int i = 0; i < 2; i++)
+      t->dx[i] = (x_max[i] - t->x_min[i]) / (t->n[i] - 1);
+  }
+  else {
+
+    int n[2] = {n_init, n_init};
+
+    BFT_FREE(t->valid);
+
+    while (true) {
+
+      for (int i = 0; i < 2; i++) {
+        t->n[i] = n[i];
+        t->dx[i] = (x_max[i] - t->x_min[i]) / (n[i] - 1);
+      }
+
+      _table_fill(property, t);
+
+      cs_real_t err[2] = {_table_error(property, t, 0, tb->tolerance, NULL),
+                          _table_error(property, t, 1, tb->tolerance, NULL)};
+
+      t->max_err = CS_MAX(err[0], err[1]);
+
+      bool refine = false;
+      for (int i = 0; i < 2; i++) {
+        if (err[i] > tb->tolerance && 2*n[i] - 1 <= n_max) {
+          n[i] = 2*n[i] - 1;
+          refine = true;
+        }
+      }
+
+      if (refine == false)
+        break;
+
+    }
+
+    /* Tolerance not reached: flag intervals requiring direct evaluation */
+
+    if (t->max_err > tb->tolerance) {
+      const size_t n_intervals = (size_t)(t->n[0]-1)*(t->n[1]-1);
+      char *valid;
+      BFT_MALLOC(valid, n_intervals, char);
+      memset(valid, 1, n_intervals);
+      for (int i = 0; i < 2; i++)
+        _table_error(property, t, i, tb->tolerance, valid);
+      t->valid = valid;
+    }
+
+    _table_write(property, t);
+
+  }
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt = cs_timer_diff(&t0, &t1);
+
+  cs_log_printf(CS_LOG_DEFAULT,
+                _("\n"
+                  "  Tabulated %s (%s): %d x %d nodes,\n"
+                  "    estimated max. relative error: %10.3e, "
+                  "%.3f s\n"),
+                _(_phys_prop_name[property]),
+                (from_cache) ? _("read from cache") : _("computed"),
+                t->n[0], t->n[1], t->max_err, dt.nsec*1e-9);
+
+  if (t->valid != NULL) {
+    const cs_lnum_t n_intervals = (cs_lnum_t)(t->n[0]-1)*(t->n[1]-1);
+    cs_lnum_t n_invalid = 0;
+    for (cs_lnum_t k = 0; k < n_intervals; k++) {
+      if (t->valid[k] == 0)
+        n_invalid++;
+    }
+    cs_log_printf(CS_LOG_DEFAULT,
+                  _("    (target tolerance %10.3e not reached "
+                    "with the finest grid;\n"
+                    "     direct evaluation in %llu of %llu intervals)\n"),
+                  tb->tolerance, (unsigned long long)n_invalid,
+                  (unsigned long long)n_intervals);
+  }
+
+  return t;
+}
+
+/*----------------------------------------------------------------------------
+ * Compute a physical property using tabulation.
+ *
+ * Values outside the table's range or for which the interpolation is not
+ * valid are computed directly with the library.
+ *
+ * parameters:
+ *   property <-- property queried
+ *   n_vals   <-- number of values
+ *   var1     <-- values on first plane axis (library units)
+ *   var2     <-- values on second plane axis (library units)
+ *   val      --> resulting property values
+ *----------------------------------------------------------------------------*/
+
+static void
+_phys_prop_tabulated_compute(cs_phys_prop_type_t   property,
+                             cs_lnum_t             n_vals,
+                             const cs_real_t       var1[],
+                             const cs_real_t       var2[],
+                             cs_real_t             val[])
+{
+  cs_phys_prop_table_t *t = _tabulation->tables[property];
+
+  assert(t != NULL);
+
+# pragma omp parallel for if (n_vals > CS_THR_MIN)
+  for (cs_lnum_t i = 0; i < n_vals; i++)
+    val[i] = _table_eval(t, var1[i], var2[i]);
+
+  /* Direct computation where interpolation is not available */
+
+  cs_lnum_t n_direct = 0;
+  for (cs_lnum_t i = 0; i < n_vals; i++) {
+    if (!isfinite(val[i]))
+      n_direct++;
+  }
+
+  if (n_direct > 0) {
+
+    cs_lnum_t *d_ids;
+    cs_real_t *d_var;
+    BFT_MALLOC(d_ids, n_direct, cs_lnum_t);
+    BFT_MALLOC(d_var, 3*n_direct, cs_real_t);
+
+    cs_lnum_t j = 0;
+    for (cs_lnum_t i = 0; i < n_vals; i++) {
+      if (!isfinite(val[i])) {
+        d_ids[j] = i;
+        d_var[j] = var1[i];
+        d_var[n_direct + j] = var2[i];
+        j++;
+      }
+    }
+
+    _phys_prop_lib_compute(property,
+                           n_direct,
+                           d_var,
+                           d_var + n_direct,
+                           d_var + 2*n_direct);
+
+    for (j = 0; j < n_direct; j++)
+      val[d_ids[j]] = d_var[2*n_direct + j];
+
+    BFT_FREE(d_var);
+    BFT_FREE(d_ids);
+  }
+
+  t->n_evals += n_vals - n_direct;
+  t->n_direct += n_direct;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Get xdef of a property on a given zone.
@@ -433,6 +1204,25 @@ cs_thermal_table_finalize(void)
     BFT_FREE(cs_glob_thermal_table->method);
     BFT_FREE(cs_glob_thermal_table);
   }
+
+  if (_tabulation != NULL) {
+    for (int i = 0; i < CS_PHYS_PROP_SPEED_OF_SOUND + 1; i++) {
+      cs_phys_prop_table_t *t = _tabulation->tables[i];
+      if (t == NULL)
+        continue;
+      cs_log_printf(CS_LOG_PERFORMANCE,
+                    _("  Tabulated %s: %llu interpolated, "
+                      "%llu direct evaluations\n"),
+                    _(_phys_prop_name[i]),
+                    (unsigned long long)(t->n_evals),
+                    (unsigned long long)(t->n_direct));
+      BFT_FREE(t->val);
+      BFT_FREE(t->valid);
+      BFT_FREE(_tabulation->tables[i]);
+    }
+    BFT_FREE(_tabulation->cache_path);
+    BFT_FREE(_tabulation);
+  }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -490,6 +1280,76 @@ cs_physical_properties_set_coolprop_backend(const char  *backend)
 #endif
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate tabulation of physical properties.
+ *
+ * Properties computed by the thermal table's library (freesteam, EOS or
+ * CoolProp) are then evaluated by bicubic interpolation in tables over
+ * the thermodynamic plane. Each property's table is built on first use,
+ * refining a uniform grid along each plane axis until the estimated
+ * interpolation error is below the given tolerance, or a maximum size is
+ * reached, in which case values in intervals where the estimated error
+ * exceeds the tolerance are computed directly by the library. Values
+ * outside the given bounds are also computed directly.
+ *
+ * If a cache path is given, tables are read from that directory when
+ * present and matching the current settings, and written to it otherwise,
+ * so that they may be reused by subsequent runs.
+ *
+ * Bounds are given in the same units as values passed to
+ * \ref cs_phys_prop_compute.
+ *
+ * \param[in]  var1_bounds  lower and upper bounds on first plane axis
+ * \param[in]  var2_bounds  lower and upper bounds on second plane axis
+ * \param[in]  tolerance    target max. relative interpolation error
+ * \param[in]  cache_path   directory for cached tables, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_physical_properties_set_tabulation(const cs_real_t   var1_bounds[2],
+                                      const cs_real_t   var2_bounds[2],
+                                      cs_real_t         tolerance,
+                                      const char       *cache_path)
+{
+  if (   !(var1_bounds[1] > var1_bounds[0])
+      || !(var2_bounds[1] > var2_bounds[0]))
+    bft_error(__FILE__, __LINE__, 0,
+              _("%s: invalid bounds [%g, %g] x [%g, %g]."),
+              __func__, var1_bounds[0], var1_bounds[1],
+              var2_bounds[0], var2_bounds[1]);
+
+  if (_tabulation == NULL) {
+    BFT_MALLOC(_tabulation, 1, cs_phys_prop_tabulation_t);
+    _tabulation->cache_path = NULL;
+    for (int i = 0; i < CS_PHYS_PROP_SPEED_OF_SOUND + 1; i++)
+      _tabulation->tables[i] = NULL;
+  }
+
+  /* Tables built with previous settings are discarded */
+
+  for (int i = 0; i < CS_PHYS_PROP_SPEED_OF_SOUND + 1; i++) {
+    if (_tabulation->tables[i] != NULL) {
+      BFT_FREE(_tabulation->tables[i]->val);
+      BFT_FREE(_tabulation->tables[i]->valid);
+      BFT_FREE(_tabulation->tables[i]);
+    }
+  }
+
+  for (int i = 0; i < 2; i++) {
+    _tabulation->bounds[0][i] = var1_bounds[i];
+    _tabulation->bounds[1][i] = var2_bounds[i];
+  }
+  _tabulation->tolerance = tolerance;
+
+  BFT_FREE(_tabulation->cache_path);
+  if (cache_path != NULL) {
+    BFT_MALLOC(_tabulation->cache_path, strlen(cache_path) + 1, char);
+    strcpy(_tabulation->cache_path, cache_path);
+  }
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute a physical property.
@@ -499,6 +1359,11 @@ cs_physical_properties_set_coolprop_backend(const char  *backend)
  * access with stride 1, and access to constant variables stored as a
  * single-valued array with a stride of 0.
  *
+ * When tabulation is active (see \ref cs_physical_properties_set_tabulation),
+ * the first call for a given property builds its table, sharing library
+ * evaluations among ranks, so that call must be made on all ranks
+ * (possibly with no values).
+ *
  * \param[in]   property      property queried
  * \param[in]   n_vals        number of values
  * \param[in]   var1_stride   stride between successive values of var1
@@ -523,6 +1388,12 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
   cs_real_t        *_var1_c = NULL, *_var2_c = NULL;
   const cs_real_t  *var1_c = var1, *var2_c = var2;
 
+  /* With tabulation, tables are built (collectively) on first use */
+
+  if (   _tabulation != NULL && cs_glob_thermal_table->type > 0
+      && _tabulation->tables[property] == NULL)
+    _tabulation->tables[property] = _table_build(property);
+
   if (n_vals < 1)
     return;
 
@@ -559,43 +1430,20 @@ cs_phys_prop_compute(cs_phys_prop_type_t          property,
     }
   }
 
-  cs_timer_t t0 = cs_timer_time();
-
-  /* Compute proper */
+  /* Compute property */
 
-  if (cs_glob_thermal_table->type == 1) {
-    cs_phys_prop_freesteam(cs_glob_thermal_table->thermo_plane,
-                           property,
-                           _n_vals,
-                           var1_c,
-                           var2_c,
-                           val);
-  }
-#if defined(HAVE_EOS) /* always a plugin */
-  else if (cs_glob_thermal_table->type == 2) {
-    _cs_phys_prop_eos(cs_glob_thermal_table->thermo_plane,
-                      property,
-                      _n_vals,
-                      var1_c,
-                      var2_c,
-                      val);
-  }
-#endif
-#if defined(HAVE_COOLPROP)
-  else if (cs_glob_thermal_table->type == 3) {
-    _cs_phys_prop_coolprop(cs_glob_thermal_table->material,
-                           _cs_coolprop_backend,
-                           cs_glob_thermal_table->thermo_plane,
-                           property,
+  if (_tabulation != NULL && cs_glob_thermal_table->type > 0)
+    _phys_prop_tabulated_compute(property,
+                                 _n_vals,
+                                 var1_c,
+                                 var2_c,
+                                 val);
+  else
+    _phys_prop_lib_compute(property,
                            _n_vals,
                            var1_c,
                            var2_c,
                            val);
-  }
-#endif
-
-  cs_timer_t t1 = cs_timer_time();
-  cs_timer_counter_add_diff(&_physprop_lib_t_tot, &t0, &t1);
 
   BFT_FREE(_var1_c);
   BFT_FREE(_var2_c);
@@ -119,6 +119,39 @@ cs_thermal_table_finalize(void);
 void
 cs_physical_properties_set_coolprop_backend(const char  *backend);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Activate tabulation of physical properties.
+ *
+ * Properties computed by the thermal table's library (freesteam, EOS or
+ * CoolProp) are then evaluated by bicubic interpolation in tables over
+ * the thermodynamic plane. Each property's table is built on first use,
+ * refining a uniform grid along each plane axis until the estimated
+ * interpolation error is below the given tolerance, or a maximum size is
+ * reached, in which case values in intervals where the estimated error
+ * exceeds the tolerance are computed directly by the library. Values
+ * outside the given bounds are also computed directly.
+ *
+ * If a cache path is given, tables are read from that directory when
+ * present and matching the current settings, and written to it otherwise,
+ * so that they may be reused by subsequent runs.
+ *
+ * Bounds are given in the same units as values passed to
+ * \ref cs_phys_prop_compute.
+ *
+ * \param[in]  var1_bounds  lower and upper bounds on first plane axis
+ * \param[in]  var2_bounds  lower and upper bounds on second plane axis
+ * \param[in]  tolerance    target max. relative interpolation error
+ * \param[in]  cache_path   directory for cached tables, or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_physical_properties_set_tabulation(const cs_real_t   var1_bounds[2],
+                                      const cs_real_t   var2_bounds[2],
+                                      cs_real_t         tolerance,
+                                      const char       *cache_path);
+
 /*----------------------------------------------------------------------------
  * Compute a physical property.
  *
@@ -127,6 +160,11 @@ cs_physical_properties_set_coolprop_backend(const char  *backend);
  * access with stride 1, and access to constant variables stored as a
  * single-valued array with a stride of 0.
  *
+ * When tabulation is active (see cs_physical_properties_set_tabulation()),
+ * the first call for a given property builds its table, sharing library
+ * evaluations among ranks, so that call must be made on all ranks
+ * (possibly with no values).
+ *
  * parameters:
  *   property     <-- property queried
  *   n_vals       <-- number of values
@@ -52,11 +52,14 @@
 #include "bft_error.h"
 #include "bft_printf.h"
 
+#include "fvm_io_num.h"
 #include "fvm_nodal.h"
 #include "fvm_nodal_extract.h"
 #include "fvm_point_location.h"
 
+#include "cs_all_to_all.h"
 #include "cs_base.h"
+#include "cs_block_dist.h"
 #include "cs_boundary_conditions.h"
 #include "cs_boundary_zone.h"
 #include "cs_coupling.h"
@@ -65,6 +68,7 @@
 #include "cs_field_pointer.h"
 #include "cs_field_default.h"
 #include "cs_field_operator.h"
+#include "cs_file.h"
 #include "cs_geom.h"
 #include "cs_halo.h"
 #include "cs_io.h"
@@ -99,6 +103,17 @@ BEGIN_C_DECLS
  * Local Macro Definitions
  *============================================================================*/
 
+/* Binary scan point files start with this string, padded with '\0'
+   characters to _SCAN_BIN_HEADER_SIZE bytes. Each scan then consists of
+   its number of points (8-byte unsigned integer), followed by the
+   coordinates of all points (3 8-byte floating-point values per point)
+   and their red, green, and blue components (3 bytes per point).
+   A scan with zero points marks the end of the file; values are
+   big-endian. */
+
+#define _SCAN_BIN_MAGIC        "code_saturne scan points 1.0"
+#define _SCAN_BIN_HEADER_SIZE  32
+
 /*=============================================================================
  * Local Type Definitions
  *============================================================================*/
@@ -282,6 +297,277 @@ _solid_plane_from_points(const cs_mesh_t   *m,
   BFT_FREE(d);
 }
 
+/*----------------------------------------------------------------------------
+ * Check whether a scan points file uses the binary format.
+ *
+ * The file header is read on the first rank only.
+ *
+ * parameters:
+ *   file_name <-- name of scan points file
+ *
+ * returns:
+ *   true if the file starts with the binary scan points header
+ *----------------------------------------------------------------------------*/
+
+static bool
+_is_binary_scan_file(const char  *file_name)
+{
+  int retval = 0;
+
+  if (cs_glob_rank_id < 1) {
+    char header[_SCAN_BIN_HEADER_SIZE];
+    FILE *file = fopen(file_name, "rb");
+    if (file == NULL)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not open file."));
+    if (fread(header, 1, _SCAN_BIN_HEADER_SIZE, file)
+        == _SCAN_BIN_HEADER_SIZE) {
+      if (strncmp(header, _SCAN_BIN_MAGIC, _SCAN_BIN_HEADER_SIZE) == 0)
+        retval = 1;
+    }
+    fclose(file);
+  }
+
+  cs_parall_bcast(0, 1, CS_INT_TYPE, &retval);
+
+  return (retval > 0) ? true : false;
+}
+
+/*----------------------------------------------------------------------------
+ * Read a given number of points from a text scan points file.
+ *
+ * Each point is described by its coordinates, followed by an intensity
+ * (ignored here) and its red, green, and blue components.
+ *
+ * parameters:
+ *   file     <-- pointer to text file
+ *   n_points <-- number of points to read
+ *   coords   --> untransformed point coordinates (interlaced)
+ *   colors   --> red, green, blue components of points (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_scan_points_text(FILE           *file,
+                       cs_lnum_t       n_points,
+                       cs_real_t       coords[],
+                       unsigned char   colors[])
+{
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    int num, red, green, blue;
+
+    if (fscanf(file, "%lf %lf %lf %d %d %d %d\n",
+               coords + 3*i, coords + 3*i + 1, coords + 3*i + 2,
+               &num, &red, &green, &blue) != 7)
+      bft_error
+        (__FILE__,__LINE__, 0,
+         _("Porosity from scan: Error while reading dataset. Line %ld\n"),
+         (long)i);
+
+    colors[3*i + 0] = CS_MIN(CS_MAX(red, 0), 255);
+    colors[3*i + 1] = CS_MIN(CS_MAX(green, 0), 255);
+    colors[3*i + 2] = CS_MIN(CS_MAX(blue, 0), 255);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Read the number of points of the next scan in a binary scan points file.
+ *
+ * parameters:
+ *   f <-- pointer to binary file
+ *
+ * returns:
+ *   global number of points of the next scan (0 at end of file)
+ *----------------------------------------------------------------------------*/
+
+static cs_gnum_t
+_read_scan_size_binary(cs_file_t  *f)
+{
+  uint64_t n_g_points = 0;
+
+  cs_file_read_global(f, &n_g_points, sizeof(uint64_t), 1);
+
+  return (cs_gnum_t)n_g_points;
+}
+
+/*----------------------------------------------------------------------------
+ * Read the points of a scan from a binary scan points file.
+ *
+ * Each rank reads a contiguous block of the scan's points.
+ *
+ * parameters:
+ *   f            <-- pointer to binary file
+ *   n_g_points   <-- global number of points of this scan
+ *   n_points     --> local number of points read
+ *   point_coords --> untransformed point coordinates
+ *   colors       --> red, green, blue components of points (interlaced)
+ *----------------------------------------------------------------------------*/
+
+static void
+_read_scan_points_binary(cs_file_t        *f,
+                         cs_gnum_t         n_g_points,
+                         cs_lnum_t        *n_points,
+                         cs_real_3_t     **point_coords,
+                         unsigned char   **colors)
+{
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        cs_glob_n_ranks,
+                                                        1,
+                                                        0,
+                                                        n_g_points);
+
+  cs_lnum_t _n_points = bi.gnum_range[1] - bi.gnum_range[0];
+
+  cs_real_3_t *_point_coords;
+  unsigned char *_colors;
+  BFT_MALLOC(_point_coords, _n_points, cs_real_3_t);
+  BFT_MALLOC(_colors, 3*_n_points, unsigned char);
+
+  cs_file_read_block(f, _point_coords, sizeof(double), 3,
+                     bi.gnum_range[0], bi.gnum_range[1]);
+  cs_file_read_block(f, _colors, 1, 3,
+                     bi.gnum_range[0], bi.gnum_range[1]);
+
+  *n_points = _n_points;
+  *point_coords = _point_coords;
+  *colors = _colors;
+}
+
+/*----------------------------------------------------------------------------
+ * Apply the transformation matrix to scan points and compute their
+ * local bounding box.
+ *
+ * parameters:
+ *   n_points     <-- local number of points
+ *   point_coords <-> point coordinates
+ *   min_vec      --> bounding box minimum coordinates
+ *   max_vec      --> bounding box maximum coordinates
+ *----------------------------------------------------------------------------*/
+
+static void
+_transform_scan_points(cs_lnum_t     n_points,
+                       cs_real_3_t   point_coords[],
+                       cs_real_t     min_vec[3],
+                       cs_real_t     max_vec[3])
+{
+  const cs_real_34_t *t_m
+    = (const cs_real_34_t *)_porosity_from_scan_opt.transformation_matrix;
+
+  for (cs_lnum_t i = 0; i < n_points; i++) {
+    cs_real_t xyz[4] = {point_coords[i][0],
+                        point_coords[i][1],
+                        point_coords[i][2],
+                        1.};
+
+    /* Translation and rotation */
+    for (int j = 0; j < 3; j++) {
+      point_coords[i][j] = 0.;
+      for (int k = 0; k < 4; k++)
+        point_coords[i][j] += (*t_m)[j][k] * xyz[k];
+
+      /* Compute bounding box*/
+      min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
+      max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Redistribute scan points over ranks based on a space-filling curve,
+ * so that each rank handles a compact, balanced subset of points.
+ *
+ * A global number based on the points' position along the curve is
+ * also assigned to each point.
+ *
+ * parameters:
+ *   n_points     <-> local number of points
+ *   point_coords <-> point coordinates
+ *   colors       <-> red, green, blue components of points (interlaced)
+ *   point_gnum   --> global point numbers
+ *----------------------------------------------------------------------------*/
+
+static void
+_redistribute_scan_points(cs_lnum_t        *n_points,
+                          cs_real_3_t     **point_coords,
+                          unsigned char   **colors,
+                          cs_gnum_t       **point_gnum)
+{
+  cs_lnum_t _n_points = *n_points;
+  cs_gnum_t *_point_gnum = NULL;
+
+#if defined(HAVE_MPI)
+
+  if (cs_glob_n_ranks > 1) {
+
+    fvm_io_num_t *pts_io_num
+      = fvm_io_num_create_from_sfc((const cs_coord_t *)(*point_coords),
+                                   3,
+                                   _n_points,
+                                   FVM_IO_NUM_SFC_MORTON_BOX);
+
+    cs_block_dist_info_t bi
+      = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                    cs_glob_n_ranks,
+                                    1,
+                                    0,
+                                    fvm_io_num_get_global_count(pts_io_num));
+
+    const cs_gnum_t *g_num = fvm_io_num_get_global_num(pts_io_num);
+
+    cs_all_to_all_t *d
+      = cs_all_to_all_create_from_block(_n_points,
+                                        0, /* flags */
+                                        g_num,
+                                        bi,
+                                        cs_glob_mpi_comm);
+
+    cs_real_3_t *_point_coords
+      = cs_all_to_all_copy_array(d,
+                                 CS_REAL_TYPE,
+                                 3,
+                                 false, /* reverse */
+                                 *point_coords,
+                                 NULL);
+
+    unsigned char *_colors
+      = cs_all_to_all_copy_array(d,
+                                 CS_CHAR,
+                                 3,
+                                 false, /* reverse */
+                                 *colors,
+                                 NULL);
+
+    _point_gnum
+      = cs_all_to_all_copy_array(d,
+                                 CS_GNUM_TYPE,
+                                 1,
+                                 false, /* reverse */
+                                 g_num,
+                                 NULL);
+
+    *n_points = cs_all_to_all_n_elts_dest(d);
+
+    cs_all_to_all_destroy(&d);
+    pts_io_num = fvm_io_num_destroy(pts_io_num);
+
+    BFT_FREE(*point_coords);
+    BFT_FREE(*colors);
+
+    *point_coords = _point_coords;
+    *colors = _colors;
+    *point_gnum = _point_gnum;
+
+    return;
+  }
+
+#endif /* defined(HAVE_MPI) */
+
+  BFT_MALLOC(_point_gnum, _n_points, cs_gnum_t);
+  for (cs_lnum_t i = 0; i < _n_points; i++)
+    _point_gnum[i] = i + 1;
+
+  *point_gnum = _point_gnum;
+}
+
 /*----------------------------------------------------------------------------
  * Prepare computation of porosity from scan points file.
  *
@@ -323,22 +609,43 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
              _porosity_from_scan_opt.transformation_matrix[2][2],
              _porosity_from_scan_opt.transformation_matrix[2][3]);
 
-  FILE *file = fopen(_porosity_from_scan_opt.file_name, "rt");
-  if (file == NULL)
-    bft_error(__FILE__,__LINE__, 0,
-              _("Porosity from scan: Could not open file."));
+  const bool binary = _is_binary_scan_file(_porosity_from_scan_opt.file_name);
+
+  FILE *file = NULL;
+  cs_file_t *bin_file = NULL;
 
-  long int n_read_points = 0;
-  long int n_points = 0;
+  cs_gnum_t n_read_points = 0;
   cs_real_t min_vec_tot[3] = {HUGE_VAL, HUGE_VAL, HUGE_VAL};
   cs_real_t max_vec_tot[3] = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
 
-  if (fscanf(file, "%ld\n", &n_read_points) != 1)
-    bft_error(__FILE__,__LINE__, 0,
-              _("Porosity from scan: Could not read the number of lines."));
+  /* Binary files are read in parallel by blocks, text files
+     by the first rank only */
+
+  if (binary) {
+    bin_file = cs_file_open_default(_porosity_from_scan_opt.file_name,
+                                    CS_FILE_MODE_READ);
+    cs_file_set_big_endian(bin_file);
+    cs_file_seek(bin_file, _SCAN_BIN_HEADER_SIZE, CS_FILE_SEEK_SET);
+    n_read_points = _read_scan_size_binary(bin_file);
+  }
+  else if (cs_glob_rank_id < 1) {
+    file = fopen(_porosity_from_scan_opt.file_name, "rt");
+    if (file == NULL)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not open file."));
+
+    long int n_points = 0;
+    if (fscanf(file, "%ld\n", &n_points) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not read the number of lines."));
+    n_read_points = n_points;
+  }
 
-  bft_printf(_("  Porosity from scan: %ld points to be read.\n\n"),
-             n_read_points);
+  if (binary == false)
+    cs_parall_bcast(0, 1, CS_GNUM_TYPE, &n_read_points);
+
+  bft_printf(_("  Porosity from scan: %llu points to be read.\n\n"),
+             (unsigned long long)n_read_points);
 
   /* Pointer to field */
   cs_field_t *f_nb_scan = cs_field_by_name_try("nb_scan_points");
@@ -361,77 +668,51 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     (cs_real_t *)cs_field_by_name("cell_scan_points_cog")->val;
 
   for (int n_scan = 0; n_read_points > 0; n_scan++) {
-    n_points = n_read_points;
-    cs_real_3_t *point_coords;
-    float *colors;
-    BFT_MALLOC(point_coords, n_points, cs_real_3_t);
-    BFT_MALLOC(colors, 3*n_points, float);
+    cs_lnum_t n_points = 0;
+    cs_real_3_t *point_coords = NULL;
+    unsigned char *rgb = NULL;
 
     cs_real_3_t min_vec = { HUGE_VAL,  HUGE_VAL,  HUGE_VAL};
     cs_real_3_t max_vec = {-HUGE_VAL, -HUGE_VAL, -HUGE_VAL};
 
-    /* Read points */
-    for (int i = 0; i < n_points; i++ ) {
-      int num, green, red, blue;
-      cs_real_4_t xyz;
-      for (int j = 0; j < 3; j++)
-        point_coords[i][j] = 0.;
-
-      if (fscanf(file, "%lf", &(xyz[0])) != 1)
-        bft_error
-          (__FILE__,__LINE__, 0,
-           _("Porosity from scan: Error while reading dataset. Line %d\n"), i);
-      if (fscanf(file, "%lf", &(xyz[1])) != 1)
-        bft_error
-          (__FILE__,__LINE__, 0,
-           _("Porosity from scan: Error while reading dataset."));
-      if (fscanf(file, "%lf", &(xyz[2])) != 1)
-        bft_error(__FILE__,__LINE__, 0,
-                  _("Porosity from scan: Error while reading dataset."));
-
-      /* Translation and rotation */
-      xyz[3] = 1.;
-      for (int j = 0; j < 3; j++) {
-        for (int k = 0; k < 4; k++)
-          point_coords[i][j]
-            += _porosity_from_scan_opt.transformation_matrix[j][k] * xyz[k];
-
-        /* Compute bounding box*/
-        min_vec[j] = CS_MIN(min_vec[j], point_coords[i][j]);
-        max_vec[j] = CS_MAX(max_vec[j], point_coords[i][j]);
+    /* Read points and size of next scan */
+    if (binary) {
+      _read_scan_points_binary(bin_file,
+                               n_read_points,
+                               &n_points,
+                               &point_coords,
+                               &rgb);
+      n_read_points = _read_scan_size_binary(bin_file);
+    }
+    else {
+      if (cs_glob_rank_id < 1) {
+        n_points = n_read_points;
+        BFT_MALLOC(point_coords, n_points, cs_real_3_t);
+        BFT_MALLOC(rgb, 3*n_points, unsigned char);
+
+        _read_scan_points_text(file,
+                               n_points,
+                               (cs_real_t *)point_coords,
+                               rgb);
+
+        /* Check EOF was correctly reached */
+        if (fgets(line, sizeof(line), file) != NULL)
+          n_read_points = strtol(line, NULL, 10);
+        else
+          n_read_points = 0;
       }
+      cs_parall_bcast(0, 1, CS_GNUM_TYPE, &n_read_points);
+    }
 
-      /* Intensities */
-      if (fscanf(file, "%d", &num) != 1)
-        bft_error(__FILE__,__LINE__, 0,
-                  _("Porosity from scan: Error while reading dataset."));
-
-      /* Red */
-      if (fscanf(file, "%d", &red) != 1)
-        bft_error(__FILE__,__LINE__, 0,
-                  _("Porosity from scan: Error while reading dataset."));
-      /* Green */
-      if (fscanf(file, "%d", &green) != 1)
-        bft_error(__FILE__,__LINE__, 0,
-                  _("Porosity from scan: Error while reading dataset."));
-      /* Blue */
-      if (fscanf(file, "%d\n", &blue) != 1)
-        bft_error(__FILE__,__LINE__, 0,
-                  _("Porosity from scan: Error while reading dataset."));
+    /* Translation and rotation */
+    _transform_scan_points(n_points, point_coords, min_vec, max_vec);
 
-      /* When colors are written as int, Paraview interprets them in [0, 255]
-       * when they are written as float, Paraview interprets them in [0., 1.]
-       * */
-      colors[3*i + 0] = red/255.;
-      colors[3*i + 1] = green/255.;
-      colors[3*i + 2] = blue/255.;
-    }
+    cs_parall_min(3, CS_REAL_TYPE, min_vec);
+    cs_parall_max(3, CS_REAL_TYPE, max_vec);
 
-    /* Check EOF was correctly reached */
-    if (fgets(line, sizeof(line), file) != NULL)
-      n_read_points = strtol(line, NULL, 10);
-    else
-      n_read_points = 0;
+    /* Distribute points by spatial locality */
+    cs_gnum_t *point_gnum = NULL;
+    _redistribute_scan_points(&n_points, &point_coords, &rgb, &point_gnum);
 
     /* Bounding box*/
     bft_printf(_("  Bounding box [%f, %f, %f], [%f, %f, %f].\n\n"),
@@ -446,8 +727,8 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
 
     if (n_read_points > 0)
       bft_printf
-        (_("  Porosity from scan: %ld additional points to be read.\n\n"),
-         n_read_points);
+        (_("  Porosity from scan: %llu additional points to be read.\n\n"),
+         (unsigned long long)n_read_points);
 
     /* FVM meshes for writers */
     if (_porosity_from_scan_opt.postprocess_points) {
@@ -471,23 +752,20 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
       /* Build FVM mesh from scanned points */
       fvm_nodal_t *pts_mesh = fvm_nodal_create(fvm_name, 3);
 
-      /* Only the first rank writes points for now */
-      cs_gnum_t *vtx_gnum = NULL;
-
-      if (cs_glob_rank_id < 1) {
-        /* Update the points set structure */
+      /* Update the points set structure */
+      if (n_points > 0) {
         fvm_nodal_define_vertex_list(pts_mesh, n_points, NULL);
         fvm_nodal_set_shared_vertices(pts_mesh, (cs_coord_t *)point_coords);
-
-        BFT_MALLOC(vtx_gnum, n_points, cs_gnum_t);
-        for (cs_lnum_t i = 0; i < n_points; i++)
-          vtx_gnum[i] = i + 1;
-
       }
-      fvm_nodal_init_io_num(pts_mesh, vtx_gnum, 0);
+      fvm_nodal_init_io_num(pts_mesh, point_gnum, 0);
 
-      /* Free if allocated */
-      BFT_FREE(vtx_gnum);
+      /* When colors are written as int, Paraview interprets them in [0, 255]
+       * when they are written as float, Paraview interprets them in [0., 1.]
+       * */
+      float *colors;
+      BFT_MALLOC(colors, 3*n_points, float);
+      for (cs_lnum_t i = 0; i < 3*n_points; i++)
+        colors[i] = rgb[i]/255.;
 
       /* Create default writer */
       fvm_writer_t *writer
@@ -519,6 +797,7 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
       /* Free and destroy */
       fvm_writer_finalize(writer);
       pts_mesh = fvm_nodal_destroy(pts_mesh);
+      BFT_FREE(colors);
       BFT_FREE(fvm_name);
     }
 
@@ -539,19 +818,16 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     _locator = ple_locator_create();
 #endif
 
-    cs_lnum_t _n_points = (cs_glob_rank_id < 1) ? n_points : 0;
-    cs_real_t *_point_coords = (cs_glob_rank_id < 1) ? (cs_real_t *)point_coords : NULL;
-
     ple_locator_set_mesh(_locator,
                          location_mesh,
                          options,
                          0., /* tolerance_base */
                          0.1, /* tolerance */
                          3, /* dim */
-                         _n_points,
+                         n_points,
                          NULL,
                          NULL, /* point_tag */
-                         _point_coords,
+                         (const cs_real_t *)point_coords,
                          NULL, /* distance */
                          cs_coupling_mesh_extents,
                          cs_coupling_point_in_mesh_p);
@@ -602,7 +878,8 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
     /* Free memory */
     _locator = ple_locator_destroy(_locator);
     BFT_FREE(point_coords);
-    BFT_FREE(colors);
+    BFT_FREE(point_gnum);
+    BFT_FREE(rgb);
 
   } // End loop on multiple scans
 
@@ -611,9 +888,14 @@ _prepare_porosity_from_scan(const cs_mesh_t             *m,
              min_vec_tot[0], min_vec_tot[1], min_vec_tot[2],
              max_vec_tot[0], max_vec_tot[1], max_vec_tot[2]);
 
-  if (fclose(file) != 0)
-    bft_error(__FILE__,__LINE__, 0,
-              _("Porosity from scan: Could not close the file."));
+  if (bin_file != NULL)
+    bin_file = cs_file_free(bin_file);
+
+  if (file != NULL) {
+    if (fclose(file) != 0)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not close the file."));
+  }
 
   /* Nodal mesh is not needed anymore */
   location_mesh = fvm_nodal_destroy(location_mesh);
@@ -807,6 +1089,125 @@ cs_porosity_from_scan_add_source(const cs_real_t  source[3],
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Convert a text scan points file to the binary format.
+ *
+ * The text file is read by chunks and written on the fly by the first rank,
+ * so the whole point cloud is never loaded in memory. Binary files are
+ * detected automatically when set with
+ * \ref cs_porosity_from_scan_set_file_name, and read by all ranks in
+ * parallel.
+ *
+ * Coordinates are stored untransformed, so the transformation matrix
+ * is still applied when reading the binary file.
+ *
+ * This function is collective, so must be called on all ranks.
+ *
+ * \param[in] text_name    name of the input text file
+ * \param[in] binary_name  name of the output binary file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_porosity_from_scan_convert_to_binary(const char  *text_name,
+                                        const char  *binary_name)
+{
+  if (cs_glob_rank_id < 1) {
+
+    const cs_lnum_t chunk_size = 1048576;
+
+    FILE *file = fopen(text_name, "rt");
+    if (file == NULL)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not open file \"%s\"."),
+                text_name);
+
+#if defined(HAVE_MPI)
+    cs_file_t *f = cs_file_open(binary_name,
+                                CS_FILE_MODE_WRITE,
+                                CS_FILE_STDIO_SERIAL,
+                                MPI_INFO_NULL,
+                                MPI_COMM_NULL,
+                                MPI_COMM_NULL);
+#else
+    cs_file_t *f = cs_file_open(binary_name,
+                                CS_FILE_MODE_WRITE,
+                                CS_FILE_STDIO_SERIAL);
+#endif
+
+    cs_file_set_big_endian(f);
+
+    char header[_SCAN_BIN_HEADER_SIZE];
+    memset(header, 0, _SCAN_BIN_HEADER_SIZE);
+    strncpy(header, _SCAN_BIN_MAGIC, _SCAN_BIN_HEADER_SIZE - 1);
+    cs_file_write_global(f, header, 1, _SCAN_BIN_HEADER_SIZE);
+
+    long int n_read_points = 0;
+    if (fscanf(file, "%ld\n", &n_read_points) != 1)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not read the number of lines."));
+
+    cs_real_t *coords;
+    unsigned char *colors;
+    BFT_MALLOC(coords, 3*chunk_size, cs_real_t);
+    BFT_MALLOC(colors, 3*chunk_size, unsigned char);
+
+    while (n_read_points > 0) {
+
+      uint64_t n_points = n_read_points;
+      cs_file_write_global(f, &n_points, sizeof(uint64_t), 1);
+
+      /* Coordinates and colors sections of this scan */
+      cs_file_off_t coords_offset = cs_file_tell(f);
+      cs_file_off_t colors_offset = coords_offset + n_points*3*sizeof(double);
+
+      for (uint64_t s_id = 0; s_id < n_points; s_id += chunk_size) {
+        cs_lnum_t n_chunk = CS_MIN((uint64_t)chunk_size, n_points - s_id);
+
+        _read_scan_points_text(file, n_chunk, coords, colors);
+
+        cs_file_seek(f,
+                     coords_offset + s_id*3*sizeof(double),
+                     CS_FILE_SEEK_SET);
+        cs_file_write_global(f, coords, sizeof(double), 3*n_chunk);
+
+        cs_file_seek(f, colors_offset + s_id*3, CS_FILE_SEEK_SET);
+        cs_file_write_global(f, colors, 1, 3*n_chunk);
+      }
+
+      cs_file_seek(f, colors_offset + n_points*3, CS_FILE_SEEK_SET);
+
+      char line[512];
+      if (fgets(line, sizeof(line), file) != NULL)
+        n_read_points = strtol(line, NULL, 10);
+      else
+        n_read_points = 0;
+
+      bft_printf(_("  Porosity from scan: %llu points converted.\n"),
+                 (unsigned long long)n_points);
+    }
+
+    /* End marker */
+    uint64_t n_points = 0;
+    cs_file_write_global(f, &n_points, sizeof(uint64_t), 1);
+
+    BFT_FREE(coords);
+    BFT_FREE(colors);
+
+    f = cs_file_free(f);
+
+    if (fclose(file) != 0)
+      bft_error(__FILE__,__LINE__, 0,
+                _("Porosity from scan: Could not close the file."));
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Barrier(cs_glob_mpi_comm);
+#endif
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Computes the porosity which is equal to one from
@@ -135,6 +135,30 @@ void
 cs_porosity_from_scan_add_source(const cs_real_t  source[3],
                                  bool             transform);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Convert a text scan points file to the binary format.
+ *
+ * The text file is read by chunks and written on the fly by the first rank,
+ * so the whole point cloud is never loaded in memory. Binary files are
+ * detected automatically when set with
+ * \ref cs_porosity_from_scan_set_file_name, and read by all ranks in
+ * parallel.
+ *
+ * Coordinates are stored untransformed, so the transformation matrix
+ * is still applied when reading the binary file.
+ *
+ * This function is collective, so must be called on all ranks.
+ *
+ * \param[in] text_name    name of the input text file
+ * \param[in] binary_name  name of the output binary file
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_porosity_from_scan_convert_to_binary(const char  *text_name,
+                                        const char  *binary_name);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute the porosity which is equal to one from
@@ -208,6 +208,9 @@ static double _checkpoint_wt_interval = -1.; /* wall-clock interval */
 static double _checkpoint_wt_next = -1.;     /* next forced wall-clock value */
 static double _checkpoint_wt_last = 0.;      /* wall-clock time of last
                                                 checkpointing */
+static bool   _checkpoint_async = false;     /* asynchronous file writes */
+static bool   _checkpoint_async_pending = false; /* writes of last checkpoint
+                                                    may still be pending */
 /* Are we restarting from a NCFD file ? */
 
 static int    _restart_from_ncfd = 0;
@@ -368,6 +371,7 @@ _add_file(cs_restart_t  *r)
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method, &hints);
+      cs_file_set_default_async_write(_checkpoint_async);
       r->fh = cs_io_initialize(r->name,
                                magic_string,
                                CS_IO_MODE_WRITE,
@@ -376,6 +380,7 @@ _add_file(cs_restart_t  *r)
                                hints,
                                block_comm,
                                comm);
+      cs_file_set_default_async_write(false);
     }
   }
 #else
@@ -390,11 +395,13 @@ _add_file(cs_restart_t  *r)
     }
     else {
       cs_file_get_default_access(CS_FILE_MODE_WRITE, &method);
+      cs_file_set_default_async_write(_checkpoint_async);
       r->fh = cs_io_initialize(r->name,
                                magic_string,
                                CS_IO_MODE_WRITE,
                                method,
                                echo);
+      cs_file_set_default_async_write(false);
     }
   }
 #endif
@@ -2080,6 +2087,64 @@ cs_restart_checkpoint_done(const cs_time_step_t  *ts)
     if (wt - _checkpoint_wt_last >= _checkpoint_wt_interval)
       _checkpoint_wt_last = wt;
   }
+
+  /* With asynchronous writes, files may still be in the process of being
+     written; completion is ensured before the next restart file is opened */
+
+  if (_checkpoint_async)
+    _checkpoint_async_pending = true;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, checkpoint data is gathered to the root rank and
+ * copied to staging buffers, and actual file writes are done by a
+ * background writer thread, so the computation may proceed while a
+ * checkpoint is being written. Writes relative to a checkpoint marked as
+ * done by \ref cs_restart_checkpoint_done are completed before any
+ * following restart file is opened, or when calling
+ * \ref cs_restart_checkpoint_wait.
+ *
+ * As the writer thread does not call MPI, only checkpoint files written
+ * with standard C IO (such as with the \ref CS_FILE_STDIO_SERIAL access
+ * method) are written asynchronously; files using MPI-IO are written
+ * as usual. The default file access method is not modified, so it may be
+ * set to serial IO for checkpoint writes to benefit from this mode.
+ * Staging memory is bounded (see \ref cs_file_set_async_write_max_size).
+ * This setting is ignored if threads are not available.
+ *
+ * \param[in]  async  true for asynchronous checkpoint writes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async)
+{
+  if (_checkpoint_async && async == false)
+    cs_restart_checkpoint_wait();
+
+  _checkpoint_async = async;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of asynchronous checkpoint writes.
+ *
+ * This function does nothing if no asynchronous writes are pending.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void)
+{
+  double t0 = cs_timer_wtime();
+
+  cs_file_async_write_wait();
+  _checkpoint_async_pending = false;
+
+  _restart_wtime[CS_RESTART_MODE_WRITE] += cs_timer_wtime() - t0;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -2138,6 +2203,11 @@ cs_restart_create(const char         *name,
 
   const cs_mesh_t  *mesh = cs_glob_mesh;
 
+  /* Complete previous checkpoint if written asynchronously */
+
+  if (_checkpoint_async_pending)
+    cs_restart_checkpoint_wait();
+
   /* Ensure mesh checkpoint is updated on first call */
 
   if (    mode == CS_RESTART_MODE_WRITE
@@ -4131,6 +4201,10 @@ cs_restart_clean_multiwriters_history(void)
 void
 cs_restart_multiwriters_destroy_all(void)
 {
+  /* Ensure the last checkpoint is complete */
+
+  cs_restart_checkpoint_wait();
+
   if (_restart_multiwriter != NULL) {
     for (int i = 0; i < _n_restart_multiwriters; i++) {
       _restart_multiwriter_t *w = _restart_multiwriter[i];
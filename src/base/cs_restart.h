@@ -391,6 +391,44 @@ cs_restart_checkpoint_required(const cs_time_step_t  *ts);
 void
 cs_restart_checkpoint_done(const cs_time_step_t  *ts);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Define whether checkpoint files are written asynchronously.
+ *
+ * In asynchronous mode, checkpoint data is gathered to the root rank and
+ * copied to staging buffers, and actual file writes are done by a
+ * background writer thread, so the computation may proceed while a
+ * checkpoint is being written. Writes relative to a checkpoint marked as
+ * done by \ref cs_restart_checkpoint_done are completed before any
+ * following restart file is opened, or when calling
+ * \ref cs_restart_checkpoint_wait.
+ *
+ * As the writer thread does not call MPI, only checkpoint files written
+ * with standard C IO (such as with the \ref CS_FILE_STDIO_SERIAL access
+ * method) are written asynchronously; files using MPI-IO are written
+ * as usual. The default file access method is not modified, so it may be
+ * set to serial IO for checkpoint writes to benefit from this mode.
+ * Staging memory is bounded (see \ref cs_file_set_async_write_max_size).
+ * This setting is ignored if threads are not available.
+ *
+ * \param[in]  async  true for asynchronous checkpoint writes
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_set_async(bool  async);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Wait for completion of asynchronous checkpoint writes.
+ *
+ * This function does nothing if no asynchronous writes are pending.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_restart_checkpoint_wait(void);
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief  Check if we have a restart directory.
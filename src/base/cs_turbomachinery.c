@@ -62,6 +62,7 @@
 #include "cs_matrix_default.h"
 #include "cs_mesh.h"
 #include "cs_mesh_adjacencies.h"
+#include "cs_mesh_cartesian.h"
 #include "cs_mesh_coherency.h"
 #include "cs_mesh_location.h"
 #include "cs_mesh_quantities.h"
@@ -117,6 +118,9 @@ typedef struct {
                                                    retry position */
   double                     t_cur;             /* current time for update */
 
+  bool                       cache_interface;   /* reuse joining selection
+                                                   between mesh updates */
+
   cs_mesh_t                 *reference_mesh;    /* reference mesh (before
                                                    rotation and joining) */
 
@@ -125,6 +129,10 @@ typedef struct {
 
   int                       *cell_rotor_num;    /* cell rotation axis number */
 
+  int                       *vtx_rotor_num;     /* reference mesh vertex
+                                                   rotation axis number
+                                                   (built on first use) */
+
   bool active;
 
 } cs_turbomachinery_t;
@@ -278,10 +286,12 @@ _turbomachinery_create(void)
   tbm->n_max_join_tries = 5;
   tbm->t_cur = 0;
   tbm->dt_retry = 1e-2;
+  tbm->cache_interface = false;
 
   tbm->reference_mesh = cs_mesh_create();
   tbm->n_b_faces_ref = -1;
   tbm->cell_rotor_num = NULL;
+  tbm->vtx_rotor_num = NULL;
   tbm->model = CS_TURBOMACHINERY_NONE;
   tbm->n_couplings = 0;
 
@@ -631,26 +641,28 @@ _update_angle(cs_real_t  t)
 }
 
 /*----------------------------------------------------------------------------
- * Update mesh vertex positions
+ * Build vertex rotor number from adjacent cells.
+ *
+ * The mesh passed here always has the vertex numbering of the reference
+ * mesh (rotation is applied before joining), so the result is
+ * built once and kept for subsequent updates.
  *
  * parameters:
- *   mesh <-> mesh to update
- *   dt   <-- associated time delta (0 for current, unmodified time)
+ *   mesh <-- mesh (with reference numbering)
  *----------------------------------------------------------------------------*/
 
 static void
-_update_geometry(cs_mesh_t  *mesh,
-                 cs_real_t   dt)
+_build_vtx_rotor_num(const cs_mesh_t  *mesh)
 {
   cs_turbomachinery_t *tbm = _turbomachinery;
 
   cs_lnum_t  f_id, v_id;
 
-  cs_lnum_t  *vtx_rotor_num = NULL;
-
   const int  *cell_flag = tbm->cell_rotor_num;
 
-  BFT_MALLOC(vtx_rotor_num, mesh->n_vertices, cs_lnum_t);
+  BFT_REALLOC(tbm->vtx_rotor_num, mesh->n_vertices, int);
+
+  int  *vtx_rotor_num = tbm->vtx_rotor_num;
 
   for (v_id = 0; v_id < mesh->n_vertices; v_id++)
     vtx_rotor_num[v_id] = 0;
@@ -687,6 +699,26 @@ _update_geometry(cs_mesh_t  *mesh,
         vtx_rotor_num[mesh->b_face_vtx_lst[i]] = cell_flag[c_id];
     }
   }
+}
+
+/*----------------------------------------------------------------------------
+ * Update mesh vertex positions
+ *
+ * parameters:
+ *   mesh <-> mesh to update
+ *   dt   <-- associated time delta (0 for current, unmodified time)
+ *----------------------------------------------------------------------------*/
+
+static void
+_update_geometry(cs_mesh_t  *mesh,
+                 cs_real_t   dt)
+{
+  cs_turbomachinery_t *tbm = _turbomachinery;
+
+  if (tbm->vtx_rotor_num == NULL)
+    _build_vtx_rotor_num(mesh);
+
+  const int  *vtx_rotor_num = tbm->vtx_rotor_num;
 
   /* Now update coordinates */
 
@@ -703,14 +735,13 @@ _update_geometry(cs_mesh_t  *mesh,
                        m[j]);
   }
 
-  for (v_id = 0; v_id < mesh->n_vertices; v_id++) {
+  for (cs_lnum_t v_id = 0; v_id < mesh->n_vertices; v_id++) {
     if (vtx_rotor_num[v_id] > 0)
       _apply_vector_transfo(m[vtx_rotor_num[v_id]],
                             &(mesh->vtx_coord[3*v_id]));
   }
 
   BFT_FREE(m);
-  BFT_FREE(vtx_rotor_num);
 }
 
 /*----------------------------------------------------------------------------
@@ -1136,6 +1167,7 @@ _update_mesh(bool     restart_mode,
   cs_gradient_free_quantities();
   cs_cell_to_vertex_free();
   cs_mesh_adjacencies_update_mesh();
+  cs_mesh_cartesian_stencil_free();
 
   /* Update linear algebra APIs relative to mesh */
 
@@ -1605,6 +1637,13 @@ cs_turbomachinery_initialize(void)
   /* Complete the mesh with rotor-stator joining */
 
   if (cs_glob_n_joinings > 0) {
+    if (tbm->model == CS_TURBOMACHINERY_TRANSIENT && tbm->cache_interface) {
+      for (int j_id = 0; j_id < cs_glob_n_joinings; j_id++) {
+        cs_join_t *join = cs_glob_join_array[j_id];
+        if (join != NULL && join->param.preprocessing == false)
+          join->cache_selection = true;
+      }
+    }
     cs_real_t t_elapsed;
     cs_turbomachinery_update_mesh(0.0, &t_elapsed);
   }
@@ -1647,6 +1686,7 @@ cs_turbomachinery_finalize(void)
     BFT_FREE(tbm->rotation);
 
     BFT_FREE(tbm->cell_rotor_num);
+    BFT_FREE(tbm->vtx_rotor_num);
 
     if (tbm->reference_mesh != NULL)
       cs_mesh_destroy(tbm->reference_mesh);
@@ -1852,6 +1892,32 @@ cs_turbomachinery_set_rotation_retry(int     n_max_join_retries,
   tbm->dt_retry = dt_retry_multiplier;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether rotor/stator interface selection data should be
+ *        kept between transient mesh updates.
+ *
+ * The mesh is rebuilt from the same reference mesh at each time step,
+ * so the faces selected for joining, their adjacent faces and
+ * parallel synchronization data do not change. When caching is active,
+ * they are built once and reused by subsequent joinings, so that
+ * only the face intersections and mesh update are recomputed.
+ *
+ * Selection criteria are then evaluated only once, on the initial
+ * rotor position, so geometric criteria should not depend on that position.
+ *
+ * \param[in]  use_cache  true to keep the interface selection, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbomachinery_set_interface_cache(bool  use_cache)
+{
+  cs_turbomachinery_t *tbm = _turbomachinery;
+
+  tbm->cache_interface = use_cache;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Build rotation matrices for a given time interval.
@@ -296,6 +296,27 @@ void
 cs_turbomachinery_set_rotation_retry(int     n_max_join_retries,
                                      double  dt_retry_multiplier);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set whether rotor/stator interface selection data should be
+ *        kept between transient mesh updates.
+ *
+ * The mesh is rebuilt from the same reference mesh at each time step,
+ * so the faces selected for joining, their adjacent faces and
+ * parallel synchronization data do not change. When caching is active,
+ * they are built once and reused by subsequent joinings, so that
+ * only the face intersections and mesh update are recomputed.
+ *
+ * Selection criteria are then evaluated only once, on the initial
+ * rotor position, so geometric criteria should not depend on that position.
+ *
+ * \param[in]  use_cache  true to keep the interface selection, false otherwise
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_turbomachinery_set_interface_cache(bool  use_cache);
+
 /*----------------------------------------------------------------------------
  * Rotation of vector and tensor fields.
  *
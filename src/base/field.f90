@@ -1259,6 +1259,9 @@ contains
 
   !> \brief  Copy current values to previous values
 
+  !> Older previous values (if present) are shifted by pointer rotation,
+  !> so pointers to previous values should be obtained again after this call.
+
   !> \param[in]  id  field id
 
   subroutine field_current_to_previous(id)
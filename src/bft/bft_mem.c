@@ -70,7 +70,8 @@ BEGIN_C_DECLS
         Base memory allocation wrappers with optional tracing.
 
   The memory managment function provided here provide optional logging,
-  and tracking of non-freed pointers.
+  and tracking of non-freed pointers. When logging is active, allocation
+  counts and current/maximum sizes are also summarized by call site.
 
   Since in most of the intended applications, failure to allocate memory
   is considered fatal, failed allocations from these functions are
@@ -155,6 +156,23 @@ struct _bft_mem_block_t {
 
   void    *p_bloc;  /* Allocated memory block start adress */
   size_t   size;    /* Allocated memory block length */
+  int      site_id; /* Id of allocating call site, or -1 */
+
+};
+
+/*
+ * Structure defining allocation statistics for a given call site
+ * (file name and line number), gathered when logging is active.
+ * File names are assumed to be static strings (as given by __FILE__).
+ */
+
+struct _bft_mem_site_t {
+
+  const char  *file_name;  /* Calling source file name */
+  int          line_num;   /* Line number in calling source file */
+  size_t       n_allocs;   /* Number of allocations */
+  size_t       size_cur;   /* Current allocated size */
+  size_t       size_max;   /* Maximum allocated size */
 
 };
 
@@ -197,6 +215,21 @@ static struct _bft_mem_block_t  *_bft_mem_global_block_array = NULL;
 static unsigned long  _bft_mem_global_block_nbr = 0 ;
 static unsigned long  _bft_mem_global_block_max = 512 ;
 
+/* Open-addressing hash table of block ids (id+1, 0 for empty slots),
+   indexed by block address; its size is twice the block array size. */
+
+static unsigned long  *_bft_mem_global_block_hash = NULL;
+
+/* Allocation call site statistics, with matching open-addressing
+   hash table of site ids (id+1, 0 for empty slots). */
+
+static struct _bft_mem_site_t  *_bft_mem_global_site_array = NULL;
+
+static int  _bft_mem_global_site_nbr = 0;
+static int  _bft_mem_global_site_max = 0;
+
+static int  *_bft_mem_global_site_hash = NULL;
+
 static size_t  _bft_mem_global_alloc_cur = 0;
 static size_t  _bft_mem_global_alloc_max = 0;
 
@@ -432,6 +465,346 @@ _bft_mem_block_info_error(const void  *p)
                  p);
 }
 
+/*
+ * Hash function for a block address.
+ *
+ * parameters:
+ *   p: <-- allocated block's start adress.
+ *
+ * returns:
+ *   hash value (to be masked by the table size).
+ */
+
+static inline size_t
+_bft_mem_ptr_hash(const void  *p)
+{
+  unsigned long long k = (uintptr_t)p;
+
+  /* Mixing function from MurmurHash3, so that aligned addresses
+     are spread over all slots. */
+
+  k ^= k >> 33;
+  k *= 0xff51afd7ed558ccdULL;
+  k ^= k >> 33;
+
+  return (size_t)k;
+}
+
+/*
+ * Return the hash table slot associated with a given block address.
+ *
+ * If the address is not present, the returned slot is the empty slot
+ * at which it would be inserted.
+ *
+ * parameters:
+ *   p: <-- allocated block's start adress.
+ *
+ * returns:
+ *   slot id in _bft_mem_global_block_hash.
+ */
+
+static inline size_t
+_bft_mem_block_hash_slot(const void  *p)
+{
+  const size_t mask = 2*_bft_mem_global_block_max - 1;
+  const unsigned long *h = _bft_mem_global_block_hash;
+
+  size_t i = _bft_mem_ptr_hash(p) & mask;
+
+  while (h[i] != 0) {
+    if ((_bft_mem_global_block_array + h[i] - 1)->p_bloc == p)
+      break;
+    i = (i + 1) & mask;
+  }
+
+  return i;
+}
+
+/*
+ * Insert a block in the hash table.
+ *
+ * parameters:
+ *   idx: <-- block id in _bft_mem_global_block_array.
+ */
+
+static inline void
+_bft_mem_block_hash_insert(unsigned long  idx)
+{
+  size_t i = _bft_mem_block_hash_slot
+               ((_bft_mem_global_block_array + idx)->p_bloc);
+
+  _bft_mem_global_block_hash[i] = idx + 1;
+}
+
+/*
+ * Remove an entry from the hash table.
+ *
+ * Following entries of the same probe sequence are shifted back,
+ * so no "deleted" markers are needed.
+ *
+ * parameters:
+ *   slot: <-- slot id in _bft_mem_global_block_hash.
+ */
+
+static void
+_bft_mem_block_hash_remove(size_t  slot)
+{
+  const size_t mask = 2*_bft_mem_global_block_max - 1;
+  unsigned long *h = _bft_mem_global_block_hash;
+
+  size_t i = slot, j = slot;
+
+  while (true) {
+
+    j = (j + 1) & mask;
+    if (h[j] == 0)
+      break;
+
+    /* Home slot of entry j; it may be moved to i only if
+       its home slot is not cyclically in ]i, j] */
+
+    size_t k = _bft_mem_ptr_hash((_bft_mem_global_block_array + h[j] - 1)
+                                 ->p_bloc) & mask;
+
+    if ((i <= j) ? (i < k && k <= j) : (i < k || k <= j))
+      continue;
+
+    h[i] = h[j];
+    i = j;
+
+  }
+
+  h[i] = 0;
+}
+
+/*
+ * (Re)build the block hash table, based on the current block array size.
+ */
+
+static void
+_bft_mem_block_hash_build(void)
+{
+  size_t hash_size = 2*_bft_mem_global_block_max;
+
+  free(_bft_mem_global_block_hash);
+  _bft_mem_global_block_hash = calloc(hash_size, sizeof(unsigned long));
+
+  if (_bft_mem_global_block_hash == NULL) {
+    _bft_mem_error(__FILE__, __LINE__, errno,
+                   _("Failure to allocate \"%s\" (%lu bytes)"),
+                   "_bft_mem_global_block_hash",
+                   (unsigned long)(hash_size*sizeof(unsigned long)));
+    return;
+  }
+
+  for (unsigned long idx = 0; idx < _bft_mem_global_block_nbr; idx++)
+    _bft_mem_block_hash_insert(idx);
+}
+
+/*
+ * Hash function for a call site.
+ *
+ * parameters:
+ *   base_name: <-- base name of calling source file.
+ *   line_num:  <-- line number in calling source file.
+ *
+ * returns:
+ *   hash value (to be masked by the table size).
+ */
+
+static inline size_t
+_bft_mem_site_hash(const char  *base_name,
+                   int          line_num)
+{
+  size_t h = line_num;
+
+  for (const char *c = base_name; *c != '\0'; c++)
+    h = h*31 + (unsigned char)(*c);
+
+  return h + line_num;
+}
+
+/*
+ * Return the id of the statistics structure matching a given call site,
+ * adding it if not present yet.
+ *
+ * parameters:
+ *   file_name: <-- name of calling source file.
+ *   line_num:  <-- line number in calling source file.
+ *
+ * returns:
+ *   call site id.
+ */
+
+static int
+_bft_mem_site_id(const char  *file_name,
+                 int          line_num)
+{
+  const char *base_name = _bft_mem_basename(file_name);
+  if (base_name == NULL)
+    base_name = "";
+
+  /* Grow arrays and rebuild hash table if needed */
+
+  if (_bft_mem_global_site_nbr >= _bft_mem_global_site_max) {
+
+    int site_max = (_bft_mem_global_site_max > 0) ?
+      _bft_mem_global_site_max*2 : 256;
+
+    struct _bft_mem_site_t *site_array
+      = realloc(_bft_mem_global_site_array,
+                sizeof(struct _bft_mem_site_t) * site_max);
+    int *site_hash = calloc(2*site_max, sizeof(int));
+
+    if (site_array == NULL || site_hash == NULL) {
+      _bft_mem_error(__FILE__, __LINE__, errno,
+                     _("Memory allocation failure"));
+      return -1;
+    }
+
+    _bft_mem_global_site_array = site_array;
+    _bft_mem_global_site_max = site_max;
+
+    free(_bft_mem_global_site_hash);
+    _bft_mem_global_site_hash = site_hash;
+
+    for (int s_id = 0; s_id < _bft_mem_global_site_nbr; s_id++) {
+      struct _bft_mem_site_t *site = _bft_mem_global_site_array + s_id;
+      size_t h =   _bft_mem_site_hash(site->file_name, site->line_num)
+                 & (2*site_max - 1);
+      while (site_hash[h] != 0)
+        h = (h + 1) & (2*site_max - 1);
+      site_hash[h] = s_id + 1;
+    }
+
+  }
+
+  /* Look for existing site (string hash combined with line number) */
+
+  const size_t mask = 2*_bft_mem_global_site_max - 1;
+
+  size_t h = _bft_mem_site_hash(base_name, line_num) & mask;
+
+  while (_bft_mem_global_site_hash[h] != 0) {
+    int s_id = _bft_mem_global_site_hash[h] - 1;
+    struct _bft_mem_site_t *site = _bft_mem_global_site_array + s_id;
+    if (site->line_num == line_num && strcmp(site->file_name, base_name) == 0)
+      return s_id;
+    h = (h + 1) & mask;
+  }
+
+  /* Add new site */
+
+  int s_id = _bft_mem_global_site_nbr;
+  struct _bft_mem_site_t *site = _bft_mem_global_site_array + s_id;
+
+  site->file_name = base_name;
+  site->line_num = line_num;
+  site->n_allocs = 0;
+  site->size_cur = 0;
+  site->size_max = 0;
+
+  _bft_mem_global_site_hash[h] = s_id + 1;
+  _bft_mem_global_site_nbr += 1;
+
+  return s_id;
+}
+
+/*
+ * Update call site statistics for a change of allocated size.
+ *
+ * parameters:
+ *   site_id:  <-- call site id, or -1.
+ *   size_old: <-- previous size associated with site's block.
+ *   size_new: <-- new size associated with site's block.
+ */
+
+static inline void
+_bft_mem_site_update(int     site_id,
+                     size_t  size_old,
+                     size_t  size_new)
+{
+  if (site_id < 0)
+    return;
+
+  struct _bft_mem_site_t *site = _bft_mem_global_site_array + site_id;
+
+  site->size_cur -= size_old;
+  site->size_cur += size_new;
+
+  if (site->size_max < site->size_cur)
+    site->size_max = site->size_cur;
+}
+
+/*
+ * Compare call sites by decreasing maximum allocated size
+ * (qsort callback).
+ */
+
+static int
+_bft_mem_site_compare(const void  *a,
+                      const void  *b)
+{
+  const struct _bft_mem_site_t *s_a
+    = _bft_mem_global_site_array + *((const int *)a);
+  const struct _bft_mem_site_t *s_b
+    = _bft_mem_global_site_array + *((const int *)b);
+
+  if (s_a->size_max < s_b->size_max)
+    return 1;
+  else if (s_a->size_max > s_b->size_max)
+    return -1;
+  else if (s_a->n_allocs < s_b->n_allocs)
+    return 1;
+  else if (s_a->n_allocs > s_b->n_allocs)
+    return -1;
+
+  return 0;
+}
+
+/*
+ * Call site statistics summary.
+ *
+ * parameters:
+ *   f: <-- pointer to output file.
+ */
+
+static void
+_bft_mem_site_summary(FILE  *f)
+{
+  if (f == NULL || _bft_mem_global_site_nbr == 0)
+    return;
+
+  int *order = malloc(sizeof(int) * _bft_mem_global_site_nbr);
+  if (order == NULL)
+    return;
+
+  for (int s_id = 0; s_id < _bft_mem_global_site_nbr; s_id++)
+    order[s_id] = s_id;
+
+  qsort(order, _bft_mem_global_site_nbr, sizeof(int), _bft_mem_site_compare);
+
+  fprintf(f, "\n"
+          "Allocations by call site (by decreasing maximum size)\n"
+          "-----------------------------------------------------\n\n"
+          "  FILE NAME                  : LINE  :  N ALLOCS  :"
+          "  MAX. BYTES  : CURRENT BYTES\n");
+
+  for (int i = 0; i < _bft_mem_global_site_nbr; i++) {
+    const struct _bft_mem_site_t *site
+      = _bft_mem_global_site_array + order[i];
+    fprintf(f, "  %-27s:%6d : %10lu : %12lu : %12lu\n",
+            site->file_name, site->line_num,
+            (unsigned long)site->n_allocs,
+            (unsigned long)site->size_max,
+            (unsigned long)site->size_cur);
+  }
+
+  fprintf(f, "\n");
+
+  free(order);
+}
+
 /*
  * Return the _bft_mem_block structure corresponding to a given
  * allocated block.
@@ -447,18 +820,16 @@ static struct _bft_mem_block_t *
 _bft_mem_block_info(const void *p_get)
 {
   struct _bft_mem_block_t  *pinfo = NULL;
-  unsigned long idx;
 
-  if (_bft_mem_global_block_array != NULL) {
+  if (_bft_mem_global_block_hash != NULL) {
 
-    for (idx = _bft_mem_global_block_nbr - 1;
-         idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_get;
-         idx--);
+    size_t slot = _bft_mem_block_hash_slot(p_get);
+    unsigned long h = _bft_mem_global_block_hash[slot];
 
-    if ((_bft_mem_global_block_array + idx)->p_bloc != p_get)
+    if (h == 0)
       _bft_mem_block_info_error(p_get);
     else {
-      pinfo = _bft_mem_global_block_array + idx;
+      pinfo = _bft_mem_global_block_array + h - 1;
       assert(p_get == pinfo->p_bloc);
     }
 
@@ -483,14 +854,13 @@ _bft_mem_block_info_try(const void *p_get)
 {
   struct _bft_mem_block_t  *pinfo = NULL;
 
-  if (_bft_mem_global_block_array != NULL) {
+  if (_bft_mem_global_block_hash != NULL) {
 
-    unsigned long idx = _bft_mem_global_block_nbr - 1;
-    while (idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_get)
-      idx--;
+    size_t slot = _bft_mem_block_hash_slot(p_get);
+    unsigned long h = _bft_mem_global_block_hash[slot];
 
-    if ((_bft_mem_global_block_array + idx)->p_bloc == p_get) {
-      pinfo = _bft_mem_global_block_array + idx;
+    if (h != 0) {
+      pinfo = _bft_mem_global_block_array + h - 1;
       assert(p_get == pinfo->p_bloc);
     }
 
@@ -522,11 +892,15 @@ _bft_mem_block_size(const void  *p_in)
 
 /*
  * Fill a _bft_mem_block_t structure for an allocated pointer.
+ *
+ * Call site statistics are only gathered when logging is active.
  */
 
 static void
 _bft_mem_block_malloc(void          *p_new,
-                      const size_t   size_new)
+                      const size_t   size_new,
+                      const char    *file_name,
+                      int            line_num)
 {
   struct _bft_mem_block_t *pinfo;
 
@@ -549,6 +923,8 @@ _bft_mem_block_malloc(void          *p_new,
       return;
     }
 
+    _bft_mem_block_hash_build();
+
   }
 
   _bft_mem_global_block_nbr += 1;
@@ -559,27 +935,45 @@ _bft_mem_block_malloc(void          *p_new,
 
   pinfo->p_bloc = p_new;
   pinfo->size   = size_new;
+  pinfo->site_id = -1;
+
+  if (_bft_mem_global_file != NULL) {
+    pinfo->site_id = _bft_mem_site_id(file_name, line_num);
+    if (pinfo->site_id > -1) {
+      _bft_mem_global_site_array[pinfo->site_id].n_allocs += 1;
+      _bft_mem_site_update(pinfo->site_id, 0, size_new);
+    }
+  }
+
+  _bft_mem_block_hash_insert(_bft_mem_global_block_nbr - 1);
 }
 
 /*
  * Update a _bft_mem_block_t structure for an reallocated pointer.
+ *
+ * The block must have been removed from the hash table before the
+ * reallocation (see _bft_mem_block_hash_remove), as its previous address
+ * may not be used once freed or moved; it is reinserted here.
+ *
+ * parameters:
+ *   pinfo:    <-> block structure
+ *   p_new:    <-- new block start adress
+ *   size_new: <-- new block size
  */
 
 static void
-_bft_mem_block_realloc(const void    *p_old,
-                       void          *p_new,
-                       size_t         size_new)
+_bft_mem_block_realloc(struct _bft_mem_block_t  *pinfo,
+                       void                     *p_new,
+                       size_t                    size_new)
 {
-  struct _bft_mem_block_t *pinfo;
-
   assert(size_new != 0);
 
-  pinfo = _bft_mem_block_info(p_old);
+  _bft_mem_site_update(pinfo->site_id, pinfo->size, size_new);
 
-  if (pinfo != NULL) {
-    pinfo->p_bloc = p_new;
-    pinfo->size   = size_new;
-  }
+  pinfo->p_bloc = p_new;
+  pinfo->size   = size_new;
+
+  _bft_mem_block_hash_insert(pinfo - _bft_mem_global_block_array);
 }
 
 /*
@@ -590,16 +984,14 @@ static void
 _bft_mem_block_free(const void *p_free)
 {
   struct _bft_mem_block_t *pinfo, *pmove;
-  unsigned long idx;
 
   if (_bft_mem_global_block_array == NULL)
     return;
 
-  for (idx = _bft_mem_global_block_nbr - 1;
-       idx > 0 && (_bft_mem_global_block_array + idx)->p_bloc != p_free;
-       idx--);
+  size_t slot = _bft_mem_block_hash_slot(p_free);
+  unsigned long h = _bft_mem_global_block_hash[slot];
 
-  if ((_bft_mem_global_block_array + idx)->p_bloc != p_free)
+  if (h == 0)
     _bft_mem_error(__FILE__, __LINE__, 0,
                    _("Adress [%10p] does not correspond to "
                      "the beginning of an allocated block."),
@@ -607,13 +999,25 @@ _bft_mem_block_free(const void *p_free)
 
   else {
 
+    unsigned long idx = h - 1;
+
+    pinfo = _bft_mem_global_block_array + idx;
+    _bft_mem_site_update(pinfo->site_id, pinfo->size, 0);
+
+    _bft_mem_block_hash_remove(slot);
+
     /* We move the contents of the array's final block to the position
        of the freed block, and shorten the array's useful part by one. */
 
-    pinfo = _bft_mem_global_block_array + idx;
     pmove = _bft_mem_global_block_array + _bft_mem_global_block_nbr - 1;
-    pinfo->p_bloc = pmove->p_bloc;
-    pinfo->size   = pmove->size;
+
+    if (pmove != pinfo) {
+      slot = _bft_mem_block_hash_slot(pmove->p_bloc);
+      _bft_mem_global_block_hash[slot] = idx + 1;
+      pinfo->p_bloc = pmove->p_bloc;
+      pinfo->size   = pmove->size;
+      pinfo->site_id = pmove->site_id;
+    }
 
     _bft_mem_global_block_nbr -= 1;
 
@@ -669,6 +1073,8 @@ bft_mem_init(const char *log_file_name)
     return;
   }
 
+  _bft_mem_block_hash_build();
+
   if (log_file_name != NULL) {
 
     _bft_mem_global_file = fopen(log_file_name, "w");
@@ -740,6 +1146,8 @@ void bft_mem_end(void)
 
     _bft_mem_summary(_bft_mem_global_file);
 
+    _bft_mem_site_summary(_bft_mem_global_file);
+
     /* List of non-freed pointers */
 
     if (_bft_mem_global_block_array != NULL) {
@@ -750,7 +1158,14 @@ void bft_mem_end(void)
            pinfo < _bft_mem_global_block_array + _bft_mem_global_block_nbr;
            pinfo++) {
 
-        fprintf(_bft_mem_global_file,"[%10p]\n", pinfo->p_bloc);
+        if (pinfo->site_id > -1) {
+          const struct _bft_mem_site_t *site
+            = _bft_mem_global_site_array + pinfo->site_id;
+          fprintf(_bft_mem_global_file, "[%10p] %s:%d\n", pinfo->p_bloc,
+                  site->file_name, site->line_num);
+        }
+        else
+          fprintf(_bft_mem_global_file,"[%10p]\n", pinfo->p_bloc);
         non_free++;
 
       }
@@ -771,6 +1186,16 @@ void bft_mem_end(void)
     _bft_mem_global_block_array = NULL;
   }
 
+  free(_bft_mem_global_block_hash);
+  _bft_mem_global_block_hash = NULL;
+
+  free(_bft_mem_global_site_array);
+  free(_bft_mem_global_site_hash);
+  _bft_mem_global_site_array = NULL;
+  _bft_mem_global_site_hash = NULL;
+  _bft_mem_global_site_nbr = 0;
+  _bft_mem_global_site_max = 0;
+
   _bft_mem_global_block_nbr   = 0 ;
   _bft_mem_global_block_max   = 512 ;
 
@@ -862,7 +1287,7 @@ bft_mem_malloc(size_t       ni,
       fflush(_bft_mem_global_file);
     }
 
-    _bft_mem_block_malloc(p_loc, alloc_size);
+    _bft_mem_block_malloc(p_loc, alloc_size, file_name, line_num);
 
     _bft_mem_global_n_allocs += 1;
 
@@ -939,24 +1364,43 @@ bft_mem_realloc(void        *ptr,
 
   /* When possible, get previous size to compute difference. */
 
+  struct _bft_mem_block_t *pinfo = NULL;
+
   if (_bft_mem_global_initialized) {
 
+    /* The lock is held until the block is updated, as its entry
+       in the block array may be moved by a concurrent free otherwise */
+
 #if defined(HAVE_OPENMP)
     in_parallel = omp_in_parallel();
     if (in_parallel)
       omp_set_lock(&_bft_mem_lock);
 #endif
 
-    struct _bft_mem_block_t *pinfo = _bft_mem_block_info_try(ptr);
-    if (pinfo != NULL)
+    pinfo = _bft_mem_block_info_try(ptr);
+
+    if (pinfo != NULL && pinfo->size != new_size) {
+
+      /* Remove the block from the hash table while its address is
+         still valid; it is reinserted with its new address. */
+
       old_size = pinfo->size;
+      _bft_mem_block_hash_remove(_bft_mem_block_hash_slot(ptr));
+
+    }
+    else {
 
 #if defined(HAVE_OPENMP)
-    if (in_parallel)
-      omp_unset_lock(&_bft_mem_lock);
+      if (in_parallel)
+        omp_unset_lock(&_bft_mem_lock);
 #endif
 
-    if (pinfo == NULL) {
+      /* If the old size is known to equal the new size,
+         nothing needs to be done. */
+
+      if (pinfo != NULL)
+        return ptr;
+
       if (_bft_alt_get_size_func != NULL) {
         old_size = _bft_alt_get_size_func(ptr);
         if (old_size > 0)
@@ -964,13 +1408,8 @@ bft_mem_realloc(void        *ptr,
                                      var_name, file_name, line_num);
       }
       _bft_mem_block_info_error(ptr);
-    }
-
-    /* If the old size is known to equal the new size,
-       nothing needs to be done. */
 
-    if (new_size == old_size)
-      return ptr;
+    }
 
   }
 
@@ -978,61 +1417,64 @@ bft_mem_realloc(void        *ptr,
 
   p_loc = realloc(ptr, new_size);
 
-  if (p_loc == NULL) {
-    _bft_mem_error(file_name, line_num, errno,
-                   _("Failure to reallocate \"%s\" (%lu bytes)"),
-                   var_name, (unsigned long)new_size);
-    return NULL;
-  }
-  else if (_bft_mem_global_initialized == 0)
+  if (pinfo == NULL) {
+    if (p_loc == NULL)
+      _bft_mem_error(file_name, line_num, errno,
+                     _("Failure to reallocate \"%s\" (%lu bytes)"),
+                     var_name, (unsigned long)new_size);
     return p_loc;
+  }
+
+  if (p_loc == NULL) {
+
+    /* The previous block is unchanged */
+
+    _bft_mem_block_realloc(pinfo, ptr, old_size);
 
-  {
 #if defined(HAVE_OPENMP)
     if (in_parallel)
-      omp_set_lock(&_bft_mem_lock);
+      omp_unset_lock(&_bft_mem_lock);
 #endif
 
-    /* FIXME: size_diff overestimated when _bft_mem_global_initialized == 0,
-       so bft_mem_size_current/bft_mem_size_max will return incorrect values
-       in this case.
-       Maybe these functions should simply return 0 in the case. */
+    _bft_mem_error(file_name, line_num, errno,
+                   _("Failure to reallocate \"%s\" (%lu bytes)"),
+                   var_name, (unsigned long)new_size);
+    return NULL;
 
-    long size_diff = new_size - old_size;
+  }
 
-    _bft_mem_global_alloc_cur += size_diff;
+  long size_diff = new_size - old_size;
 
-    if (size_diff > 0) {
-      if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
-        _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
-    }
+  _bft_mem_global_alloc_cur += size_diff;
 
-    if (_bft_mem_global_file != NULL) {
-      char sgn = (size_diff > 0) ? '+' : '-';
-      fprintf(_bft_mem_global_file, "\nrealloc: %-27s:%6d : %-39s: %9lu",
-              _bft_mem_basename(file_name), line_num,
-              var_name, (unsigned long)new_size);
-      fprintf(_bft_mem_global_file, " : (%c%9lu) : %12lu : [%10p]",
-              sgn,
-              (unsigned long) ((size_diff > 0) ? size_diff : -size_diff),
-              (unsigned long)_bft_mem_global_alloc_cur,
-              p_loc);
-      fflush(_bft_mem_global_file);
-    }
+  if (size_diff > 0) {
+    if (_bft_mem_global_alloc_max < _bft_mem_global_alloc_cur)
+      _bft_mem_global_alloc_max = _bft_mem_global_alloc_cur;
+  }
+
+  if (_bft_mem_global_file != NULL) {
+    char sgn = (size_diff > 0) ? '+' : '-';
+    fprintf(_bft_mem_global_file, "\nrealloc: %-27s:%6d : %-39s: %9lu",
+            _bft_mem_basename(file_name), line_num,
+            var_name, (unsigned long)new_size);
+    fprintf(_bft_mem_global_file, " : (%c%9lu) : %12lu : [%10p]",
+            sgn,
+            (unsigned long) ((size_diff > 0) ? size_diff : -size_diff),
+            (unsigned long)_bft_mem_global_alloc_cur,
+            p_loc);
+    fflush(_bft_mem_global_file);
+  }
 
-    _bft_mem_block_realloc(ptr, p_loc, new_size);
+  _bft_mem_block_realloc(pinfo, p_loc, new_size);
 
-    _bft_mem_global_n_reallocs += 1;
+  _bft_mem_global_n_reallocs += 1;
 
 #if defined(HAVE_OPENMP)
-    if (in_parallel)
-      omp_unset_lock(&_bft_mem_lock);
+  if (in_parallel)
+    omp_unset_lock(&_bft_mem_lock);
 #endif
 
-    return p_loc;
-  }
-
-  return NULL; /* Avoid a compiler warning */
+  return p_loc;
 }
 
 /*!
@@ -1206,7 +1648,7 @@ bft_mem_memalign(size_t       alignment,
       fflush(_bft_mem_global_file);
     }
 
-    _bft_mem_block_malloc(p_loc, alloc_size);
+    _bft_mem_block_malloc(p_loc, alloc_size, file_name, line_num);
 
     _bft_mem_global_n_allocs += 1;
 
@@ -1255,6 +1697,11 @@ bft_mem_get_block_size(void  *ptr)
 
     block_size = _bft_mem_block_size(ptr);
 
+#if defined(HAVE_OPENMP)
+    if (in_parallel)
+      omp_unset_lock(&_bft_mem_lock);
+#endif
+
   }
   else
     _bft_mem_error(__FILE__, __LINE__, 0,
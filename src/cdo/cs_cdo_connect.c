@@ -354,6 +354,107 @@ _build_e2e_through_cell(const cs_cdo_connect_t     *connect)
   return e2e;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Build a coloring of the cells such that two cells sharing an entity
+ *         (vertex or face according to the given connectivity) have a
+ *         different color. A greedy (first-fit) algorithm is used.
+ *         Cells of a same color can be assembled concurrently without any
+ *         synchronization since they do not write in the same rows.
+ *
+ * \param[in]  n_ent    number of entities (vertices or faces)
+ * \param[in]  c2x      cell --> entities connectivity
+ *
+ * \return a pointer to a new allocated cs_adjacency_t structure storing the
+ *         color --> cells connectivity
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_adjacency_t *
+_build_cell_colors(cs_lnum_t                  n_ent,
+                   const cs_adjacency_t      *c2x)
+{
+  const cs_lnum_t  n_cells = c2x->n_elts;
+
+  cs_adjacency_t  *x2c = cs_adjacency_transpose(n_ent, c2x);
+
+  int  n_colors = 0, n_max_colors = 16;
+  int  *c_color = NULL;
+  cs_lnum_t  *color_tag = NULL;
+
+  BFT_MALLOC(c_color, n_cells, int);
+  BFT_MALLOC(color_tag, n_max_colors, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    c_color[c_id] = -1;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+
+    /* Tag the colors already used by a cell sharing an entity */
+
+    for (cs_lnum_t j = c2x->idx[c_id]; j < c2x->idx[c_id+1]; j++) {
+
+      const cs_lnum_t  x_id = c2x->ids[j];
+
+      for (cs_lnum_t k = x2c->idx[x_id]; k < x2c->idx[x_id+1]; k++) {
+        const int  _color = c_color[x2c->ids[k]];
+        if (_color > -1)
+          color_tag[_color] = c_id;
+      }
+
+    }
+
+    /* First color which is not tagged */
+
+    int  color = 0;
+    while (color < n_colors && color_tag[color] == c_id)
+      color++;
+
+    if (color == n_colors) { /* Add a new color */
+
+      if (n_colors == n_max_colors) {
+        n_max_colors *= 2;
+        BFT_REALLOC(color_tag, n_max_colors, cs_lnum_t);
+      }
+      color_tag[n_colors] = -1;
+      n_colors++;
+
+    }
+
+    c_color[c_id] = color;
+
+  } /* Loop on cells */
+
+  cs_adjacency_destroy(&x2c);
+  BFT_FREE(color_tag);
+
+  /* Gather cells by color (cells are kept in an increasing order inside a
+     color to preserve the memory locality) */
+
+  cs_adjacency_t  *colors = cs_adjacency_create(0, -1, n_colors);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    colors->idx[c_color[c_id] + 1] += 1;
+
+  for (int i = 0; i < n_colors; i++)
+    colors->idx[i+1] += colors->idx[i];
+
+  BFT_MALLOC(colors->ids, colors->idx[n_colors], cs_lnum_t);
+
+  cs_lnum_t  *shift = NULL;
+  BFT_MALLOC(shift, n_colors, cs_lnum_t);
+  for (int i = 0; i < n_colors; i++)
+    shift[i] = colors->idx[i];
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    colors->ids[shift[c_color[c_id]]++] = c_id;
+
+  BFT_FREE(shift);
+  BFT_FREE(c_color);
+
+  return colors;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Compute max number of entities by cell and the max range between
@@ -1088,6 +1189,18 @@ cs_cdo_connect_init(cs_mesh_t      *mesh,
   else
     connect->e2e = NULL;
 
+  /* Build the cell colorings used for a lock-free multithreaded assembly of
+     the linear systems (computed once and shared among equations) */
+
+  connect->vtx_colors = NULL;
+  connect->face_colors = NULL;
+
+  if ((vb_scheme_flag | vcb_scheme_flag) & CS_FLAG_SCHEME_COLORED)
+    connect->vtx_colors = _build_cell_colors(n_vertices, connect->c2v);
+
+  if (fb_scheme_flag & CS_FLAG_SCHEME_COLORED)
+    connect->face_colors = _build_cell_colors(n_faces, connect->c2f);
+
   /* Members to handle assembly process and parallel sync. */
 
   connect->vtx_rset = NULL;
@@ -1190,6 +1303,9 @@ cs_cdo_connect_free(cs_cdo_connect_t   *connect)
   cs_adjacency_destroy(&(connect->f2f));
   cs_adjacency_destroy(&(connect->e2e));
 
+  cs_adjacency_destroy(&(connect->vtx_colors));
+  cs_adjacency_destroy(&(connect->face_colors));
+
   BFT_FREE(connect->cell_type);
   BFT_FREE(connect->cell_flag);
 
@@ -1379,6 +1495,27 @@ cs_cdo_connect_summary(const cs_cdo_connect_t  *connect,
 
   } /* At least one equation with a scheme with DoFs at edges */
 
+  /* Information about the cell colorings (lock-free assembly) */
+
+  const cs_adjacency_t  *colors[2] = {connect->vtx_colors,
+                                      connect->face_colors};
+  const char  *ent_names[2] = {"vertex", "face"};
+
+  for (int k = 0; k < 2; k++) {
+
+    if (colors[k] == NULL)
+      continue;
+
+    cs_lnum_t  n_colors = colors[k]->n_elts;
+    if (cs_glob_n_ranks > 1)
+      cs_parall_max(1, CS_LNUM_TYPE, &n_colors);
+
+    cs_log_printf(CS_LOG_DEFAULT,
+                  " --dim-- number of cell colors (%s-based assembly): %d\n",
+                  ent_names[k], (int)n_colors);
+
+  }
+
 #if CS_CDO_CONNECT_DBG > 0 && defined(DEBUG) && !defined(NDEBUG)
   cs_cdo_connect_dump(connect);
 #endif
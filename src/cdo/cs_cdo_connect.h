@@ -137,6 +137,13 @@ typedef struct {
   cs_adjacency_t       *f2f;    /* face to faces through cells */
   cs_adjacency_t       *e2e;    /* edge to edges through cells */
 
+  /* Cell colorings for a lock-free multithreaded assembly (allocated only if
+     needed). Two cells with the same color share no vertex (resp. no face).
+     Stored as a color --> cells connectivity */
+
+  cs_adjacency_t       *vtx_colors;
+  cs_adjacency_t       *face_colors;
+
 } cs_cdo_connect_t;
 
 /*============================================================================
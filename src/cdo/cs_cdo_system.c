@@ -258,6 +258,55 @@ _set_block_assembly_func(void)
  * Private function prototypes
  *============================================================================*/
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Set the assembly function associated to a block according to the
+ *        metadata of the block. The returned function does not rely on any
+ *        synchronization (atomic or critical sections) between threads. This
+ *        is only valid if cellwise systems assembled concurrently do not
+ *        share any row (for instance, cells of the same color)
+ *
+ * \param[in] bi         block info structure to consider
+ *
+ * \return a pointer to a function
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_cdo_assembly_func_t *
+_assign_lock_free_assembly_func(const cs_cdo_system_block_info_t   bi)
+{
+  if (bi.matrix_class == CS_CDO_SYSTEM_MATRIX_HYPRE) {
+
+    if (bi.stride == 1)
+      return cs_cdo_assembly_matrix_scal_generic;
+    else if (bi.stride == 3)
+      return cs_cdo_assembly_matrix_e33_generic;
+
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {  /* Parallel */
+
+    if (bi.stride == 1)
+      return cs_cdo_assembly_matrix_mpis;
+    else if (bi.stride == 3)
+      return (bi.unrolled) ? cs_cdo_assembly_eblock33_matrix_mpis :
+        cs_cdo_assembly_block33_matrix_mpis;
+    else
+      return cs_cdo_assembly_eblock_matrix_mpis;
+
+  }
+#endif /* defined(HAVE_MPI) */
+
+  if (bi.stride == 1)
+    return cs_cdo_assembly_matrix_seqs;
+  else if (bi.stride == 3)
+    return (bi.unrolled) ? cs_cdo_assembly_eblock33_matrix_seqs :
+      cs_cdo_assembly_block33_matrix_seqs;
+  else
+    return cs_cdo_assembly_eblock_matrix_seqs;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Set the assembly function associated to a block according to the
@@ -1223,6 +1272,7 @@ cs_cdo_system_add_dblock(cs_cdo_system_helper_t       *sh,
     db->mav = NULL;
     db->assembly_func = _assign_assembly_func(b->info);
     db->slave_assembly_func = _assign_slave_assembly_func(b->info);
+    db->lock_free_assembly_func = _assign_lock_free_assembly_func(b->info);
 
     if (db->assembly_func == NULL && db->slave_assembly_func == NULL)
       bft_error(__FILE__, __LINE__, 0,
@@ -181,12 +181,18 @@ typedef struct {
    *      function pointer to operate the assembly stage when the system helper
    *      is declared as slave (this is the same for all matrices). Useful for
    *      coupled systems.
+   *
+   * \var lock_free_assembly_func
+   *      function pointer to operate the assembly stage without any
+   *      synchronization between threads. Only valid when threads assemble
+   *      cellwise systems writing in disjoint rows (cells of the same color)
    */
 
   cs_matrix_t                    *matrix;
   cs_matrix_assembler_values_t   *mav;
   cs_cdo_assembly_func_t         *assembly_func;
   cs_cdo_assembly_func_t         *slave_assembly_func;
+  cs_cdo_assembly_func_t         *lock_free_assembly_func;
 
   /* The following structures can be shared if the same block configuration
      is requested */
@@ -583,21 +583,45 @@ _sfb_cw_rhs_normalization(cs_param_resnorm_type_t     type,
   return _rhs_norm;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the cell coloring to consider for a lock-free assembly.
+ *         Two cells of the same color share no face so that they can be
+ *         assembled concurrently without any synchronization.
+ *
+ * \param[in]  eqp    pointer to a cs_equation_param_t structure
+ *
+ * \return a pointer to the color --> cells connectivity or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline const cs_adjacency_t *
+_sfb_get_cell_colors(const cs_equation_param_t   *eqp)
+{
+  if (eqp->omp_assembly_choice != CS_PARAM_ASSEMBLE_OMP_COLORED)
+    return NULL;
+
+  return cs_shared_connect->face_colors;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Perform the assembly step
  *
- * \param[in]      csys   pointer to a cellwise view of the system
- * \param[in, out] block  pointer to a block structure
- * \param[in, out] rhs    right-hand side array
- * \param[in, out] eqc    context for this kind of discretization
- * \param[in, out] asb    pointer to a cs_cdo_assembly_t structure
+ * \param[in]      csys       pointer to a cellwise view of the system
+ * \param[in, out] block      pointer to a block structure
+ * \param[in]      lock_free  true if cells assembled concurrently share no
+ *                            face (colored loop on cells)
+ * \param[in, out] rhs        right-hand side array
+ * \param[in, out] eqc        context for this kind of discretization
+ * \param[in, out] asb        pointer to a cs_cdo_assembly_t structure
  */
 /*----------------------------------------------------------------------------*/
 
 static void
 _sfb_assemble(const cs_cell_sys_t         *csys,
               cs_cdo_system_block_t       *block,
+              bool                         lock_free,
               cs_real_t                   *rhs,
               cs_cdofb_scaleq_t           *eqc,
               cs_cdo_assembly_t           *asb)
@@ -606,17 +630,30 @@ _sfb_assemble(const cs_cell_sys_t         *csys,
   assert(block->type == CS_CDO_SYSTEM_BLOCK_DEFAULT);
   cs_cdo_system_dblock_t  *db = block->block_pointer;
 
-  /* Matrix assembly */
-
-  db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
-
   /* RHS assembly (only on faces since a static condensation has been performed
      to reduce the size) so that n_dofs = n_fc */
 
-# pragma omp critical
-  {
+  if (lock_free) { /* No other thread writes in the same rows */
+
+    db->lock_free_assembly_func(csys->mat, csys->dof_ids, db->range_set, asb,
+                                db->mav);
+
     for (short int f = 0; f < csys->n_dofs; f++)
       rhs[csys->dof_ids[f]] += csys->rhs[f];
+
+  }
+  else {
+
+    /* Matrix assembly */
+
+    db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
+
+#   pragma omp critical
+    {
+      for (short int f = 0; f < csys->n_dofs; f++)
+        rhs[csys->dof_ids[f]] += csys->rhs[f];
+    }
+
   }
 
   if (eqc->source_terms != NULL) { /* Source term */
@@ -1320,6 +1357,11 @@ cs_cdofb_scaleq_interpolate(const cs_mesh_t            *mesh,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _sfb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
 #if defined(HAVE_OPENMP) /* Determine the default number of OpenMP threads */
@@ -1360,112 +1402,127 @@ cs_cdofb_scaleq_interpolate(const cs_mesh_t            *mesh,
      * Main loop on cells to build the linear system
      * --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
-                            csys, cb);
+        /* Set the local mesh structure for the current cell */
 
-      /* Build and add the diffusion/advection/reaction term to the local
-         system. */
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge, csys, cb);
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
+        /* Set the local (i.e. cellwise) structures for the current cell */
 
-        /* Reset the local contribution */
+        _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
+                              csys, cb);
 
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Build and add the diffusion/advection/reaction term to the local
+           system. */
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
+        _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge,
+                            csys, cb);
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
+
+          /* Reset the local contribution */
+
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-        csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
 
-      } /* End of term source */
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
-      /* BOUNDARY CONDITIONS + CONDENSATION
-       * ================================== */
+          csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
 
-      /* Apply a part of BC before the condensation */
+        } /* End of term source */
 
-      _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* BOUNDARY CONDITIONS + CONDENSATION
+         * ================================== */
 
-      { /* Reduce the system size since one has the knowledge of the cell
-           value */
+        /* Apply a part of BC before the condensation */
 
-        /* Reshape the local system */
+        _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-        for (short int i = 0; i < cm->n_fc; i++) {
+        { /* Reduce the system size since one has the knowledge of the cell
+             value */
 
-          double  *old_i = csys->mat->val + csys->n_dofs*i;   /* Old "i" row  */
-          double  *new_i = csys->mat->val + cm->n_fc*i;       /* New "i" row */
+          /* Reshape the local system */
 
-          for (short int j = 0; j < cm->n_fc; j++)
-            new_i[j] = old_i[j];
+          for (short int i = 0; i < cm->n_fc; i++) {
 
-          /* Update RHS: RHS = RHS - Afc*pc */
+            double  *old_i = csys->mat->val + csys->n_dofs*i; /* Old "i" row */
+            double  *new_i = csys->mat->val + cm->n_fc*i;     /* New "i" row */
 
-          csys->rhs[i] -= cell_values[csys->c_id] * old_i[cm->n_fc];
+            for (short int j = 0; j < cm->n_fc; j++)
+              new_i[j] = old_i[j];
 
-        }
+            /* Update RHS: RHS = RHS - Afc*pc */
 
-        csys->n_dofs = cm->n_fc;
-        csys->mat->n_rows = csys->mat->n_cols = cm->n_fc;
+            csys->rhs[i] -= cell_values[csys->c_id] * old_i[cm->n_fc];
 
-      }
+          }
+
+          csys->n_dofs = cm->n_fc;
+          csys->mat->n_rows = csys->mat->n_cols = cm->n_fc;
+
+        }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> Cell system matrix after condensation",
-                         csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> Cell system matrix after condensation",
+                           csys);
 #endif
 
-      /* Remaining part of boundary conditions */
+        /* Remaining part of boundary conditions */
 
-      _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
+        /* Compute a cellwise norm of the RHS for the normalization of the
+           residual during the resolution of the linear system */
 
-      rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* ASSEMBLY PROCESS
-       * ================ */
+        /* ASSEMBLY PROCESS
+         * ================ */
 
-      _sfb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _sfb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -1561,6 +1618,11 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _sfb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
 #if defined(HAVE_OPENMP) /* Determine the default number of OpenMP threads */
@@ -1601,98 +1663,114 @@ cs_cdofb_scaleq_solve_steady_state(bool                        cur2prev,
      * Main loop on cells to build the linear system
      * --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
-                            csys, cb);
+        /* Set the local mesh structure for the current cell */
 
-      /* Build and add the diffusion/advection/reaction terms to the local
-         system. Mass matrix is computed inside if needed during the building */
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge, csys, cb);
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
+        /* Set the local (i.e. cellwise) structures for the current cell */
 
-        /* Reset the local contribution */
+        _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
+                              csys, cb);
 
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Build and add the diffusion/advection/reaction terms to the local
+           system. Mass matrix is computed inside if needed during the
+           building */
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
+        _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge,
+                            csys, cb);
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
 
-        csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
+          /* Reset the local contribution */
+
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
-      } /* End of term source */
+          csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
 
-      /* BOUNDARY CONDITIONS + STATIC CONDENSATION
-       * ========================================= */
+        } /* End of term source */
 
-      /* Apply a part of BC before the static condensation */
+        /* BOUNDARY CONDITIONS + STATIC CONDENSATION
+         * ========================================= */
 
-      _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Apply a part of BC before the static condensation */
 
-      /* STATIC CONDENSATION
-       * Static condensation of the local system matrix of size n_fc + 1 into
-       * a matrix of size n_fc.
-       * Store data in rc_tilda and acf_tilda to compute the values at cell
-       * centers after solving the system */
+        _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-      cs_static_condensation_scalar_eq(connect->c2f,
-                                       eqc->rc_tilda, eqc->acf_tilda,
-                                       cb, csys);
+        /* STATIC CONDENSATION
+         * Static condensation of the local system matrix of size n_fc + 1 into
+         * a matrix of size n_fc.
+         * Store data in rc_tilda and acf_tilda to compute the values at cell
+         * centers after solving the system */
+
+        cs_static_condensation_scalar_eq(connect->c2f,
+                                         eqc->rc_tilda, eqc->acf_tilda,
+                                         cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> Cell system matrix after static condensation",
-                         csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> Cell system matrix after static condensation",
+                           csys);
 #endif
 
-      /* Remaining part of boundary conditions */
+        /* Remaining part of boundary conditions */
 
-      _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
+        /* Compute a cellwise norm of the RHS for the normalization of the
+           residual during the resolution of the linear system */
 
-      rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* ASSEMBLY PROCESS
-       * ================ */
+        /* ASSEMBLY PROCESS
+         * ================ */
 
-      _sfb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _sfb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -1795,6 +1873,11 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _sfb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
 #if defined(HAVE_OPENMP) /* Determine the default number of OpenMP threads */
@@ -1843,146 +1926,162 @@ cs_cdofb_scaleq_solve_implicit(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
-                            csys, cb);
+        /* Set the local mesh structure for the current cell */
 
-      /* Build and add the diffusion/advection/reaction terms to the local
-         system. Mass matrix is computed inside if needed during the building */
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge, csys, cb);
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
+        /* Set the local (i.e. cellwise) structures for the current cell */
 
-        /* Reset the local contribution */
+        _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
+                              csys, cb);
 
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Build and add the diffusion/advection/reaction terms to the local
+           system. Mass matrix is computed inside if needed during the
+           building */
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
+        _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge,
+                            csys, cb);
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        time_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
 
-        csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
+          /* Reset the local contribution */
 
-      } /* End of term source */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      /* First part of the BOUNDARY CONDITIONS
-       *                   ===================
-       * Apply a part of BC before the time scheme */
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
 
-      _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          time_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
 
-      /* UNSTEADY TERM + TIME SCHEME
-       * =========================== */
+          csys->rhs[cm->n_fc] += csys->source[cm->n_fc];
 
-      if (!(eqb->time_pty_uniform))
-        cb->tpty_val = cs_property_value_in_cell(cm,
-                                                 eqp->time_property,
-                                                 time_eval);
+        } /* End of term source */
 
-      if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping
-                                                      or Hodge-Voronoi */
+        /* First part of the BOUNDARY CONDITIONS
+         *                   ===================
+         * Apply a part of BC before the time scheme */
 
-        const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
+        _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-        /* Simply add an entry in mat[cell, cell] */
+        /* UNSTEADY TERM + TIME SCHEME
+         * =========================== */
 
-        csys->rhs[cm->n_fc] += ptyc * csys->val_n[cm->n_fc];
-        csys->mat->val[cm->n_fc*csys->n_dofs + cm->n_fc] += ptyc;
+        if (!(eqb->time_pty_uniform))
+          cb->tpty_val = cs_property_value_in_cell(cm,
+                                                   eqp->time_property,
+                                                   time_eval);
 
-      }
-      else { /* Use the mass matrix */
+        if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping
+                                                        or Hodge-Voronoi */
 
-        const double  tpty_coef = cb->tpty_val * inv_dtcur;
-        const cs_sdm_t  *mass_mat = mass_hodge->matrix;
+          const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-         *       >> Update the cellwise system with the time matrix */
+          /* Simply add an entry in mat[cell, cell] */
 
-        /* Update rhs with csys->mat*p^n */
+          csys->rhs[cm->n_fc] += ptyc * csys->val_n[cm->n_fc];
+          csys->mat->val[cm->n_fc*csys->n_dofs + cm->n_fc] += ptyc;
 
-        double  *time_pn = cb->values;
-        cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
-        for (short int i = 0; i < csys->n_dofs; i++)
-          csys->rhs[i] += tpty_coef*time_pn[i];
+        }
+        else { /* Use the mass matrix */
 
-        /* Update the cellwise system with the time matrix */
+          const double  tpty_coef = cb->tpty_val * inv_dtcur;
+          const cs_sdm_t  *mass_mat = mass_hodge->matrix;
 
-        cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+          /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+           *       >> Update the cellwise system with the time matrix */
 
-      }
+          /* Update rhs with csys->mat*p^n */
+
+          double  *time_pn = cb->values;
+          cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
+          for (short int i = 0; i < csys->n_dofs; i++)
+            csys->rhs[i] += tpty_coef*time_pn[i];
+
+          /* Update the cellwise system with the time matrix */
+
+          cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+
+        }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> Cell system matrix after time treatment",
-                         csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> Cell system matrix after time treatment",
+                           csys);
 #endif
 
-      /* STATIC CONDENSATION
-       * ===================
-       * Static condensation of the local system matrix of size n_fc + 1 into
-       * a matrix of size n_fc.
-       * Store data in rc_tilda and acf_tilda to compute the values at cell
-       * centers after solving the system */
+        /* STATIC CONDENSATION
+         * ===================
+         * Static condensation of the local system matrix of size n_fc + 1 into
+         * a matrix of size n_fc.
+         * Store data in rc_tilda and acf_tilda to compute the values at cell
+         * centers after solving the system */
 
-      cs_static_condensation_scalar_eq(connect->c2f,
-                                       eqc->rc_tilda,
-                                       eqc->acf_tilda,
-                                       cb, csys);
+        cs_static_condensation_scalar_eq(connect->c2f,
+                                         eqc->rc_tilda,
+                                         eqc->acf_tilda,
+                                         cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> Cell system matrix after static condensation",
-                         csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> Cell system matrix after static condensation",
+                           csys);
 #endif
 
-      /* Remaining part of BOUNDARY CONDITIONS
-       * =================================== */
+        /* Remaining part of BOUNDARY CONDITIONS
+         * =================================== */
 
-      _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
+        /* Compute a cellwise norm of the RHS for the normalization of the
+           residual during the resolution of the linear system */
 
-      rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* ASSEMBLY PROCESS
-       * ================ */
+        /* ASSEMBLY PROCESS
+         * ================ */
 
-      _sfb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _sfb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -2099,6 +2198,11 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _sfb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
 # pragma omp parallel if (quant->n_cells > CS_THR_MIN)
   {
 #if defined(HAVE_OPENMP) /* Determine the default number of OpenMP threads */
@@ -2150,189 +2254,205 @@ cs_cdofb_scaleq_solve_theta(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
+
+        cb->cell_flag = connect->cell_flag[c_id];
+
+        /* Set the local mesh structure for the current cell */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+
+        /* Set the local (i.e. cellwise) structures for the current cell */
+
+        _sfb_init_cell_system(cm, eqp, eqb, val_f_pre, val_c_pre,
+                              csys, cb);
+
+        /* Build and add the diffusion/advection/reaction terms to the local
+           system. Mass matrix is computed inside if needed during the
+           building */
+
+        _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge,
                             csys, cb);
 
-      /* Build and add the diffusion/advection/reaction terms to the local
-         system. Mass matrix is computed inside if needed during the building */
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
+          if (compute_initial_source) { /* First time step */
+
+            /* Reset the local contribution */
 
-      _sfb_conv_diff_reac(eqp, eqb, eqc, cm, mass_hodge, diff_hodge, csys, cb);
+            memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-        if (compute_initial_source) { /* First time step */
+            cs_source_term_compute_cellwise(eqp->n_source_terms,
+                        (cs_xdef_t *const *)eqp->source_terms,
+                                            cm,
+                                            eqb->source_mask,
+                                            eqb->compute_source,
+                                            t_cur,
+                                            mass_hodge,
+                                            cb,
+                                            csys->source);
+
+            csys->rhs[cm->n_fc] += tcoef * csys->source[cm->n_fc];
+
+          }
+          else { /* Add the contribution of the previous time step */
+
+            csys->rhs[cm->n_fc] += tcoef * eqc->source_terms[cm->c_id];
+
+          }
 
           /* Reset the local contribution */
 
           memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+
           cs_source_term_compute_cellwise(eqp->n_source_terms,
                       (cs_xdef_t *const *)eqp->source_terms,
                                           cm,
                                           eqb->source_mask,
                                           eqb->compute_source,
-                                          t_cur,
+                                          cb->t_st_eval,
                                           mass_hodge,
                                           cb,
                                           csys->source);
 
-          csys->rhs[cm->n_fc] += tcoef * csys->source[cm->n_fc];
-
-        }
-        else { /* Add the contribution of the previous time step */
-
-          csys->rhs[cm->n_fc] += tcoef * eqc->source_terms[cm->c_id];
-
-        }
-
-        /* Reset the local contribution */
-
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+          csys->rhs[cm->n_fc] += eqp->theta * csys->source[cm->n_fc];
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        } /* End of term source */
 
-        csys->rhs[cm->n_fc] += eqp->theta * csys->source[cm->n_fc];
+         /* First part of BOUNDARY CONDITIONS
+          *               ===================
+          * Apply a part of BC before time (csys->mat is going to be multiplied
+          * by theta when applying the time scheme) */
 
-      } /* End of term source */
+        _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-       /* First part of BOUNDARY CONDITIONS
-        *               ===================
-        * Apply a part of BC before time (csys->mat is going to be multiplied
-        * by theta when applying the time scheme) */
+        /* UNSTEADY TERM + TIME SCHEME
+         * =========================== */
 
-      _sfb_apply_bc_partly(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* STEP.1 >> Compute the contribution of the "adr" to the RHS:
+         *           tcoef*adr_pn where adr_pn = csys->mat * p_n */
 
-      /* UNSTEADY TERM + TIME SCHEME
-       * =========================== */
+        double  *adr_pn = cb->values;
+        cs_sdm_square_matvec(csys->mat, csys->val_n, adr_pn);
+        for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
+          csys->rhs[i] -= tcoef * adr_pn[i];
 
-      /* STEP.1 >> Compute the contribution of the "adr" to the RHS:
-       *           tcoef*adr_pn where adr_pn = csys->mat * p_n */
+        /* STEP.2 >> Multiply csys->mat by theta */
 
-      double  *adr_pn = cb->values;
-      cs_sdm_square_matvec(csys->mat, csys->val_n, adr_pn);
-      for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
-        csys->rhs[i] -= tcoef * adr_pn[i];
+        for (int i = 0; i < csys->n_dofs*csys->n_dofs; i++)
+          csys->mat->val[i] *= eqp->theta;
 
-      /* STEP.2 >> Multiply csys->mat by theta */
+        /* STEP.3 >> Handle the mass matrix
+         * Two contributions for the mass matrix
+         *  a) add to csys->mat
+         *  b) add to rhs mass_mat * p_n */
 
-      for (int i = 0; i < csys->n_dofs*csys->n_dofs; i++)
-        csys->mat->val[i] *= eqp->theta;
-
-      /* STEP.3 >> Handle the mass matrix
-       * Two contributions for the mass matrix
-       *  a) add to csys->mat
-       *  b) add to rhs mass_mat * p_n */
-
-      if (!(eqb->time_pty_uniform))
-        cb->tpty_val = cs_property_value_in_cell(cm,
-                                                 eqp->time_property,
-                                                 cb->t_pty_eval);
+        if (!(eqb->time_pty_uniform))
+          cb->tpty_val = cs_property_value_in_cell(cm,
+                                                   eqp->time_property,
+                                                   cb->t_pty_eval);
 
-      if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
+        if (eqb->sys_flag & CS_FLAG_SYS_TIME_DIAG) { /* Mass lumping */
 
-        const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
+          const double  ptyc = cb->tpty_val * cm->vol_c * inv_dtcur;
 
-        /* Only the cell row is involved in the time evolution */
+          /* Only the cell row is involved in the time evolution */
 
-        csys->rhs[cm->n_fc] += ptyc*csys->val_n[cm->n_fc];
+          csys->rhs[cm->n_fc] += ptyc*csys->val_n[cm->n_fc];
 
-        /* Simply add an entry in mat[cell, cell] */
+          /* Simply add an entry in mat[cell, cell] */
 
-        csys->mat->val[cm->n_fc*(csys->n_dofs + 1)] += ptyc;
+          csys->mat->val[cm->n_fc*(csys->n_dofs + 1)] += ptyc;
 
-      }
-      else { /* Use the mass matrix */
+        }
+        else { /* Use the mass matrix */
 
-        const double  tpty_coef = cb->tpty_val * inv_dtcur;
-        const cs_sdm_t  *mass_mat = mass_hodge->matrix;
+          const double  tpty_coef = cb->tpty_val * inv_dtcur;
+          const cs_sdm_t  *mass_mat = mass_hodge->matrix;
 
-        /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
-           >> Update the cellwise system with the time matrix */
+          /* STEPS >> Compute the time contribution to the RHS: Mtime*pn
+             >> Update the cellwise system with the time matrix */
 
-        /* Update rhs with mass_mat*p^n */
+          /* Update rhs with mass_mat*p^n */
 
-        double  *time_pn = cb->values;
-        cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
-        for (short int i = 0; i < csys->n_dofs; i++)
-          csys->rhs[i] += tpty_coef*time_pn[i];
+          double  *time_pn = cb->values;
+          cs_sdm_square_matvec(mass_mat, csys->val_n, time_pn);
+          for (short int i = 0; i < csys->n_dofs; i++)
+            csys->rhs[i] += tpty_coef*time_pn[i];
 
-        /* Update the cellwise system with the time matrix */
+          /* Update the cellwise system with the time matrix */
 
-        cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
+          cs_sdm_add_mult(csys->mat, tpty_coef, mass_mat);
 
-      }
+        }
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system after adding time", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump("\n>> Cell system after adding time", csys);
 #endif
 
-      /* STATIC CONDENSATION
-       * ===================
-       * Static condensation of the local system matrix of size n_fc + 1 into
-       * a matrix of size n_fc.
-       * Store data in rc_tilda and acf_tilda to compute the values at cell
-       * centers after solving the system */
+        /* STATIC CONDENSATION
+         * ===================
+         * Static condensation of the local system matrix of size n_fc + 1 into
+         * a matrix of size n_fc.
+         * Store data in rc_tilda and acf_tilda to compute the values at cell
+         * centers after solving the system */
 
-      cs_static_condensation_scalar_eq(connect->c2f,
-                                       eqc->rc_tilda, eqc->acf_tilda,
-                                       cb, csys);
+        cs_static_condensation_scalar_eq(connect->c2f,
+                                         eqc->rc_tilda, eqc->acf_tilda,
+                                         cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> Cell system matrix after static condensation",
-                         csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> Cell system matrix after static condensation",
+                           csys);
 #endif
 
-      /* Remaining part of BOUNDARY CONDITIONS
-       * ===================================== */
+        /* Remaining part of BOUNDARY CONDITIONS
+         * ===================================== */
 
-      _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        _sfb_apply_remaining_bc(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOFB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
+        /* Compute a cellwise norm of the RHS for the normalization of the
+           residual during the resolution of the linear system */
 
-      rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _sfb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* ASSEMBLY PROCESS
-       * ================ */
+        /* ASSEMBLY PROCESS
+         * ================ */
 
-      _sfb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _sfb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
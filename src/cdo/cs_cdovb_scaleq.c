@@ -1132,21 +1132,45 @@ _svb_cw_rhs_normalization(cs_param_resnorm_type_t     type,
   return _rhs_norm;
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief  Retrieve the cell coloring to consider for a lock-free assembly.
+ *         Two cells of the same color share no vertex so that they can be
+ *         assembled concurrently without any synchronization.
+ *
+ * \param[in]  eqp    pointer to a cs_equation_param_t structure
+ *
+ * \return a pointer to the color --> cells connectivity or NULL
+ */
+/*----------------------------------------------------------------------------*/
+
+static inline const cs_adjacency_t *
+_svb_get_cell_colors(const cs_equation_param_t   *eqp)
+{
+  if (eqp->omp_assembly_choice != CS_PARAM_ASSEMBLE_OMP_COLORED)
+    return NULL;
+
+  return cs_shared_connect->vtx_colors;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief   Perform the assembly step for scalar-valued CDO Vb schemes
  *
- * \param[in]      csys   pointer to a cellwise view of the system
- * \param[in, out] block  pointer to a block structure
- * \param[in, out] rhs    right-hand side array
- * \param[in, out] eqc    context for this kind of discretization
- * \param[in, out] asb    pointer to a cs_cdo_assembly_t structure
+ * \param[in]      csys       pointer to a cellwise view of the system
+ * \param[in, out] block      pointer to a block structure
+ * \param[in]      lock_free  true if cells assembled concurrently share no
+ *                            vertex (colored loop on cells)
+ * \param[in, out] rhs        right-hand side array
+ * \param[in, out] eqc        context for this kind of discretization
+ * \param[in, out] asb        pointer to a cs_cdo_assembly_t structure
  */
 /*----------------------------------------------------------------------------*/
 
 static void
 _svb_assemble(const cs_cell_sys_t        *csys,
               cs_cdo_system_block_t      *block,
+              bool                        lock_free,
               cs_real_t                  *rhs,
               cs_cdovb_scaleq_t          *eqc,
               cs_cdo_assembly_t          *asb)
@@ -1155,6 +1179,22 @@ _svb_assemble(const cs_cell_sys_t        *csys,
   assert(block->type == CS_CDO_SYSTEM_BLOCK_DEFAULT);
   cs_cdo_system_dblock_t  *db = block->block_pointer;
 
+  if (lock_free) { /* No other thread writes in the same rows */
+
+    db->lock_free_assembly_func(csys->mat, csys->dof_ids, db->range_set, asb,
+                                db->mav);
+
+    for (int v = 0; v < csys->n_dofs; v++)
+      rhs[csys->dof_ids[v]] += csys->rhs[v];
+
+    if (eqc->source_terms != NULL) {
+      for (int v = 0; v < csys->n_dofs; v++)
+        eqc->source_terms[csys->dof_ids[v]] += csys->source[v];
+    }
+
+    return;
+  }
+
   /* Matrix assembly */
 
   db->assembly_func(csys->mat, csys->dof_ids, db->range_set, asb, db->mav);
@@ -2500,6 +2540,11 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _svb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
@@ -2542,83 +2587,96 @@ cs_cdovb_scaleq_solve_steady_state(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
-                            csys, cb);
+        /* Set the local mesh structure for the current cell */
 
-      /* Build and add the diffusion/advection/reaction terms into the local
-       * system.
-       * A mass matrix is also built if needed (stored in mass_hodge->matrix)
-       */
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
+        /* Set the local (i.e. cellwise) structures for the current cell */
 
-        /* Reset the local contribution */
+        _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
+                              csys, cb);
 
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Build and add the diffusion/advection/reaction terms into the local
+         * system.
+         * A mass matrix is also built if needed (stored in mass_hodge->matrix)
+         */
 
-        /* Source term contribution to the algebraic system */
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
 
-        /* Update the RHS */
+          /* Reset the local contribution */
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      } /* End of term source */
+          /* Source term contribution to the algebraic system */
+
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
+
+          /* Update the RHS */
+
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
 
-      /* Apply boundary conditions (those which are weakly enforced) */
+        } /* End of term source */
 
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Apply boundary conditions (those which are weakly enforced) */
 
-      /* Enforce values if needed (internal or Dirichlet) */
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-      _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Enforce values if needed (internal or Dirichlet) */
+
+        _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
+        /* Compute a cellwise norm of the RHS for the normalization of the
+           residual during the resolution of the linear system */
 
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* Assembly process
-       * ================ */
+        /* Assembly process
+         * ================ */
 
-      _svb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _svb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -2733,6 +2791,11 @@ cs_cdovb_scaleq_solve_steady_state_incr(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _svb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
@@ -2775,98 +2838,111 @@ cs_cdovb_scaleq_solve_steady_state_incr(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
-                            csys, cb);
+        /* Set the local mesh structure for the current cell */
 
-      cs_equation_bc_update_for_increment(csys);
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      /* Build and add the diffusion/advection/reaction terms into the local
-       * system.
-       * A mass matrix is also built if needed (stored in mass_hodge->matrix)
-       */
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+        /* Set the local (i.e. cellwise) structures for the current cell */
 
-      /* Incremental solving (a current to previous operation should have been
-       * done before calling for the first time this function so that val_n
-       * contains values from field->val which are val^{n+1,k} when one
-       * computes val^{n+1,k+1}.
-       *
-       * fld->val should be the parameter in _svb_init_cell_system()
-       */
+        _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
+                              csys, cb);
 
-      double  *mat_pk = cb->values;
-      cs_sdm_square_matvec(csys->mat, csys->val_n, mat_pk);
-      for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
-        csys->rhs[i] -= mat_pk[i];
+        cs_equation_bc_update_for_increment(csys);
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
+        /* Build and add the diffusion/advection/reaction terms into the local
+         * system.
+         * A mass matrix is also built if needed (stored in mass_hodge->matrix)
+         */
 
-        /* Reset the local contribution */
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
 
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Incremental solving (a current to previous operation should have been
+         * done before calling for the first time this function so that val_n
+         * contains values from field->val which are val^{n+1,k} when one
+         * computes val^{n+1,k+1}.
+         *
+         * fld->val should be the parameter in _svb_init_cell_system()
+         */
 
-        /* Source term contribution to the algebraic system */
+        double  *mat_pk = cb->values;
+        cs_sdm_square_matvec(csys->mat, csys->val_n, mat_pk);
+        for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
+          csys->rhs[i] -= mat_pk[i];
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
 
-        /* Update the RHS */
+          /* Reset the local contribution */
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      } /* End of term source */
+          /* Source term contribution to the algebraic system */
+
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
+
+          /* Update the RHS */
 
-      /* Apply boundary conditions (those which are weakly enforced) */
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
+
+        } /* End of term source */
 
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Apply boundary conditions (those which are weakly enforced) */
 
-      /* Enforce values if needed (internal or Dirichlet) */
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-      _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        /* Enforce values if needed (internal or Dirichlet) */
+
+        _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a cellwise norm of the RHS for the normalization of the
-         residual during the resolution of the linear system */
+        /* Compute a cellwise norm of the RHS for the normalization of the
+           residual during the resolution of the linear system */
 
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* Assembly process
-       * ================ */
+        /* Assembly process
+         * ================ */
 
-      _svb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _svb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -2986,6 +3062,11 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _svb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
@@ -3031,91 +3112,105 @@ cs_cdovb_scaleq_solve_implicit(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
-                            csys, cb);
+        /* Set the local mesh structure for the current cell */
 
-      /* Build and add the diffusion/advection/reaction term to the local
-         system. A mass matrix is also built if needed */
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
+        /* Set the local (i.e. cellwise) structures for the current cell */
 
-        /* Reset the local contribution */
+        _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
+                              csys, cb);
 
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Build and add the diffusion/advection/reaction term to the local
+           system. A mass matrix is also built if needed */
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+          /* Reset the local contribution */
 
-      } /* End of term source */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      /* Apply boundary conditions (those which are weakly enforced) */
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
 
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
+
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
+
+        } /* End of term source */
+
+        /* Apply boundary conditions (those which are weakly enforced) */
+
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-      /* Unsteady term + time scheme
-       * =========================== */
+        /* Unsteady term + time scheme
+         * =========================== */
 
-      eqc->add_unsteady_term(eqp, cm, mass_hodge, inv_dtcur, eqb, cb, csys);
+        eqc->add_unsteady_term(eqp, cm, mass_hodge, inv_dtcur, eqb, cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system after time", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump("\n>> Cell system after time", csys);
 #endif
 
-      /* Enforce values if needed (internal or Dirichlet) */
+        /* Enforce values if needed (internal or Dirichlet) */
 
-      _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a norm of the RHS for the normalization of the residual
-         of the linear system to solve */
+        /* Compute a norm of the RHS for the normalization of the residual
+           of the linear system to solve */
 
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* Assembly process
-       * ================ */
+        /* Assembly process
+         * ================ */
 
-      _svb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _svb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -3225,6 +3320,11 @@ cs_cdovb_scaleq_solve_implicit_incr(bool                        cur2prev,
 
   cs_cdo_system_helper_init_system(sh, &rhs);
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _svb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
@@ -3270,126 +3370,140 @@ cs_cdovb_scaleq_solve_implicit_incr(bool                        cur2prev,
     /* Main loop on cells to build the linear system */
     /* --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        cb->cell_flag = connect->cell_flag[c_id];
 
-      _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag,
-                            fld->val, fld->val_pre,
-                            csys, cb);
+        /* Set the local mesh structure for the current cell */
 
-      cs_equation_bc_update_for_increment(csys);
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
 
-      /* Build and add the diffusion/advection/reaction terms into the local
-       * system.
-       * A mass matrix is also built if needed (stored in mass_hodge->matrix)
-       */
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
 
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+        /* Set the local (i.e. cellwise) structures for the current cell */
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
+        _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag,
+                              fld->val, fld->val_pre,
+                              csys, cb);
 
-        /* Reset the local contribution */
+        cs_equation_bc_update_for_increment(csys);
 
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
+        /* Build and add the diffusion/advection/reaction terms into the local
+         * system.
+         * A mass matrix is also built if needed (stored in mass_hodge->matrix)
+         */
 
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
 
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += csys->source[v];
+          /* Reset the local contribution */
 
-      } /* End of term source */
+          memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      /* Incremental solving (a current to previous operation should have been
-       * done before calling for the first time this function so that val_n
-       * contains values from field->val which are val^{n+1,k} when one
-       * computes val^{n+1,k+1}.
-       *
-       * fld->val should be the parameter in _svb_init_cell_system()
-       */
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
 
-      double  *mat_pk = cb->values;
-      cs_sdm_square_matvec(csys->mat, csys->val_n, mat_pk);
-      for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
-        csys->rhs[i] -= mat_pk[i];
+          cs_source_term_compute_cellwise(eqp->n_source_terms,
+                      (cs_xdef_t *const *)eqp->source_terms,
+                                          cm,
+                                          eqb->source_mask,
+                                          eqb->compute_source,
+                                          cb->t_st_eval,
+                                          mass_hodge,
+                                          cb,
+                                          csys->source);
+
+          for (short int v = 0; v < cm->n_vc; v++)
+            csys->rhs[v] += csys->source[v];
+
+        } /* End of term source */
+
+        /* Incremental solving (a current to previous operation should have been
+         * done before calling for the first time this function so that val_n
+         * contains values from field->val which are val^{n+1,k} when one
+         * computes val^{n+1,k+1}.
+         *
+         * fld->val should be the parameter in _svb_init_cell_system()
+         */
+
+        double  *mat_pk = cb->values;
+        cs_sdm_square_matvec(csys->mat, csys->val_n, mat_pk);
+        for (short int i = 0; i < csys->n_dofs; i++) /* n_dofs = n_vc */
+          csys->rhs[i] -= mat_pk[i];
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system before time", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump("\n>> Cell system before time", csys);
 #endif
 
-      /* Unsteady term + time scheme
-       * ===========================
-       *
-       * STEPS >> Compute the time contribution to the RHS: Mtime*pn
-       *       >> Update the cellwise system with the time matrix
-       *
-       * Update the RHS with values at time t_n (stored in field->val_pre
-       * in case of an incremental solve)
-       *
-       * p^{k+1,n+1} = p^{k,n+1} + delta_p^{k+1,n+1}
-       *
-       * The unsteady term is equal to p^{k+1,n+1} - p^{n} so that
-       * p^{k+1,n+1} - p^{n} = delta_p^{k+1,n+1} + p^{k,n+1} - p^{n}
-       */
-
-      eqc->add_unsteady_term(eqp, cm, mass_hodge, inv_dtcur, eqb, cb, csys);
+        /* Unsteady term + time scheme
+         * ===========================
+         *
+         * STEPS >> Compute the time contribution to the RHS: Mtime*pn
+         *       >> Update the cellwise system with the time matrix
+         *
+         * Update the RHS with values at time t_n (stored in field->val_pre
+         * in case of an incremental solve)
+         *
+         * p^{k+1,n+1} = p^{k,n+1} + delta_p^{k+1,n+1}
+         *
+         * The unsteady term is equal to p^{k+1,n+1} - p^{n} so that
+         * p^{k+1,n+1} - p^{n} = delta_p^{k+1,n+1} + p^{k,n+1} - p^{n}
+         */
+
+        eqc->add_unsteady_term(eqp, cm, mass_hodge, inv_dtcur, eqb, cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system after time", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump("\n>> Cell system after time", csys);
 #endif
 
-      /* Apply boundary conditions (those which are weakly enforced) */
+        /* Apply boundary conditions (those which are weakly enforced) */
 
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-      /* Enforce values if needed (internal or Dirichlet) */
+        /* Enforce values if needed (internal or Dirichlet) */
 
-      _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a norm of the RHS for the normalization of the residual
-         of the linear system to solve */
+        /* Compute a norm of the RHS for the normalization of the residual
+           of the linear system to solve */
 
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* Assembly process
-       * ================ */
+        /* Assembly process
+         * ================ */
 
-      _svb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _svb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -3542,6 +3656,11 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
 
   }
 
+  /* Cell coloring if a lock-free assembly is requested */
+
+  const cs_adjacency_t  *c_colors = _svb_get_cell_colors(eqp);
+  const int  n_colors = (c_colors == NULL) ? 1 : c_colors->n_elts;
+
   /* ------------------------- */
   /* Main OpenMP block on cell */
   /* ------------------------- */
@@ -3591,111 +3710,125 @@ cs_cdovb_scaleq_solve_theta(bool                        cur2prev,
      * Main loop on cells to build the linear system
      * --------------------------------------------- */
 
-#   pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
-    for (cs_lnum_t c_id = 0; c_id < quant->n_cells; c_id++) {
+    for (int color = 0; color < n_colors; color++) {
 
-      /* Set the current cell flag */
+      const cs_lnum_t  c_start = (c_colors == NULL) ? 0 : c_colors->idx[color];
+      const cs_lnum_t  c_end = (c_colors == NULL) ?
+        quant->n_cells : c_colors->idx[color+1];
 
-      cb->cell_flag = connect->cell_flag[c_id];
+#     pragma omp for CS_CDO_OMP_SCHEDULE reduction(+:rhs_norm)
+      for (cs_lnum_t c_pos = c_start; c_pos < c_end; c_pos++) {
 
-      /* Set the local mesh structure for the current cell */
+        const cs_lnum_t  c_id =
+          (c_colors == NULL) ? c_pos : c_colors->ids[c_pos];
 
-      cs_cell_mesh_build(c_id,
-                         cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb),
-                         connect, quant, cm);
+        /* Set the current cell flag */
+
+        cb->cell_flag = connect->cell_flag[c_id];
+
+        /* Set the local mesh structure for the current cell */
+
+        const cs_eflag_t  msh_flag =
+          cs_equation_builder_cell_mesh_flag(cb->cell_flag, eqb);
+
+        cs_cell_mesh_build(c_id, msh_flag, connect, quant, cm);
+
+        /* Set the local (i.e. cellwise) structures for the current cell */
+
+        _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
+                              csys, cb);
+
+        /* Build and add the diffusion/advection/reaction term to the local
+           system. A mass matrix is also built if needed (mass_hodge->matrix) */
+
+        _svb_conv_diff_reac(eqp, eqb, eqc, cm,
+                            fm, mass_hodge, diff_hodge, csys, cb);
 
-      /* Set the local (i.e. cellwise) structures for the current cell */
+        if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
+                                                      * =========== */
+          if (compute_initial_source) {
 
-      _svb_init_cell_system(cm, eqp, eqb, eqc->vtx_bc_flag, fld->val, NULL,
-                            csys, cb);
+            /* Reset the local contribution */
 
-      /* Build and add the diffusion/advection/reaction term to the local
-         system. A mass matrix is also built if needed (mass_hodge->matrix) */
+            memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
-      _svb_conv_diff_reac(eqp, eqb, eqc, cm,
-                          fm, mass_hodge, diff_hodge, csys, cb);
+            cs_source_term_compute_cellwise(eqp->n_source_terms,
+                        (cs_xdef_t *const *)eqp->source_terms,
+                                            cm,
+                                            eqb->source_mask,
+                                            eqb->compute_source,
+                                            t_cur,
+                                            mass_hodge,
+                                            cb,
+                                            csys->source);
+
+            for (short int v = 0; v < cm->n_vc; v++)
+              csys->rhs[v] += tcoef * csys->source[v];
 
-      if (cs_equation_param_has_sourceterm(eqp)) { /* SOURCE TERM
-                                                    * =========== */
-        if (compute_initial_source) {
+          }
 
           /* Reset the local contribution */
 
           memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
 
+          /* Source term contribution to the algebraic system
+             If the equation is steady, the source term has already been
+             computed and is added to the right-hand side during its
+             initialization. */
+
           cs_source_term_compute_cellwise(eqp->n_source_terms,
                       (cs_xdef_t *const *)eqp->source_terms,
                                           cm,
                                           eqb->source_mask,
                                           eqb->compute_source,
-                                          t_cur,
+                                          cb->t_st_eval,
                                           mass_hodge,
                                           cb,
                                           csys->source);
 
           for (short int v = 0; v < cm->n_vc; v++)
-            csys->rhs[v] += tcoef * csys->source[v];
-
-        }
-
-        /* Reset the local contribution */
-
-        memset(csys->source, 0, csys->n_dofs*sizeof(cs_real_t));
-
-        /* Source term contribution to the algebraic system
-           If the equation is steady, the source term has already been computed
-           and is added to the right-hand side during its initialization. */
-
-        cs_source_term_compute_cellwise(eqp->n_source_terms,
-                    (cs_xdef_t *const *)eqp->source_terms,
-                                        cm,
-                                        eqb->source_mask,
-                                        eqb->compute_source,
-                                        cb->t_st_eval,
-                                        mass_hodge,
-                                        cb,
-                                        csys->source);
+            csys->rhs[v] += eqp->theta * csys->source[v];
 
-        for (short int v = 0; v < cm->n_vc; v++)
-          csys->rhs[v] += eqp->theta * csys->source[v];
-
-      } /* End of term source */
+        } /* End of term source */
 
-      /* Apply boundary conditions (those which are weakly enforced) */
+        /* Apply boundary conditions (those which are weakly enforced) */
 
-      _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
+        _svb_apply_weak_bc(eqp, eqc, cm, fm, diff_hodge, csys, cb);
 
-      /* Unsteady term + time scheme
-       * =========================== */
+        /* Unsteady term + time scheme
+         * =========================== */
 
-      eqc->add_unsteady_term(eqp, cm, mass_hodge, inv_dtcur, eqb, cb, csys);
+        eqc->add_unsteady_term(eqp, cm, mass_hodge, inv_dtcur, eqb, cb, csys);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 1
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump("\n>> Cell system after adding time", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump("\n>> Cell system after adding time", csys);
 #endif
 
-      /* Enforce values if needed (internal or Dirichlet) */
+        /* Enforce values if needed (internal or Dirichlet) */
 
-      _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
+        _svb_enforce_values(eqp, eqb, eqc, cm, fm, diff_hodge, csys, cb);
 
 #if defined(DEBUG) && !defined(NDEBUG) && CS_CDOVB_SCALEQ_DBG > 0
-      if (cs_dbg_cw_test(eqp, cm, csys))
-        cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
+        if (cs_dbg_cw_test(eqp, cm, csys))
+          cs_cell_sys_dump(">> (FINAL) Cell system matrix", csys);
 #endif
 
-      /* Compute a norm of the RHS for the normalization of the residual
-         of the linear system to solve */
+        /* Compute a norm of the RHS for the normalization of the residual
+           of the linear system to solve */
 
-      rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
-                                            cm, csys);
+        rhs_norm += _svb_cw_rhs_normalization(eqp->sles_param->resnorm_type,
+                                              cm, csys);
 
-      /* Assembly process
-       * ================ */
+        /* Assembly process
+         * ================ */
 
-      _svb_assemble(csys, sh->blocks[0], rhs, eqc, asb);
+        _svb_assemble(csys, sh->blocks[0], c_colors != NULL, rhs, eqc,
+                      asb);
 
-    } /* Main loop on cells */
+      } /* Main loop on cells */
+
+    } /* Loop on colors */
 
   } /* OPENMP Block */
 
@@ -136,13 +136,21 @@ _set_scheme_flags(cs_domain_t    *domain)
     cs_param_space_scheme_t  scheme = cs_equation_get_space_scheme(eq);
     int  vardim = cs_equation_get_var_dim(eq);
 
+    /* A cell coloring is needed for a lock-free threaded assembly */
+
+    const cs_equation_param_t  *eqp = cs_equation_get_param(eq);
+    cs_flag_t  color_flag = 0;
+    if (cs_glob_n_threads > 1 &&
+        eqp->omp_assembly_choice == CS_PARAM_ASSEMBLE_OMP_COLORED)
+      color_flag = CS_FLAG_SCHEME_COLORED;
+
     switch (scheme) {
 
     case CS_SPACE_SCHEME_CDOVB:
       quant_flag |= CS_CDO_QUANTITIES_VB_SCHEME;
       cc->vb_scheme_flag |= CS_FLAG_SCHEME_POLY0;
       if (vardim == 1)
-        cc->vb_scheme_flag |= CS_FLAG_SCHEME_SCALAR;
+        cc->vb_scheme_flag |= CS_FLAG_SCHEME_SCALAR | color_flag;
       else if (vardim == 3)
         cc->vb_scheme_flag |= CS_FLAG_SCHEME_VECTOR;
       else
@@ -178,7 +186,9 @@ _set_scheme_flags(cs_domain_t    *domain)
          particular the scalar-valued interface can be useful */
 
       cc->fb_scheme_flag |= CS_FLAG_SCHEME_SCALAR;
-      if (vardim == 3)
+      if (vardim == 1)
+        cc->fb_scheme_flag |= color_flag;
+      else if (vardim == 3)
         cc->fb_scheme_flag |= CS_FLAG_SCHEME_VECTOR;
       else if (vardim > 3)
         bft_error(__FILE__, __LINE__, 0, "Invalid case");
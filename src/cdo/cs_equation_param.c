@@ -683,6 +683,8 @@ _set_key(cs_equation_param_t   *eqp,
       eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_CRITICAL;
     else if (strcmp(keyval, "atomic") == 0)
       eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_ATOMIC;
+    else if (strcmp(keyval, "colored") == 0)
+      eqp->omp_assembly_choice = CS_PARAM_ASSEMBLE_OMP_COLORED;
     else {
       const char *_val = keyval;
       bft_error(__FILE__, __LINE__, 0,
@@ -772,14 +774,22 @@ _set_key(cs_equation_param_t   *eqp,
       eqp->sles_param->precond = CS_PARAM_PRECOND_ILU0;
       eqp->sles_param->flexible = false;
 
-      /* Either with PETSc or with PETSc/HYPRE using Euclid */
+      /* Either with PETSc or with PETSc/HYPRE using Euclid, or with the
+         in-house (block-Jacobi) version if PETSc is not available */
 
-      eqp->sles_param->solver_class = _get_petsc_or_hypre(eqp->sles_param,
-                                                          "CS_EQKEY_PRECOND");
+      if (   cs_param_sles_check_class(CS_PARAM_SLES_CLASS_PETSC)
+          == CS_PARAM_SLES_CLASS_PETSC) {
 
-      /* Default when using PETSc */
+        eqp->sles_param->solver_class
+          = _get_petsc_or_hypre(eqp->sles_param, "CS_EQKEY_PRECOND");
 
-      eqp->sles_param->resnorm_type = CS_PARAM_RESNORM_NORM2_RHS;
+        /* Default when using PETSc */
+
+        eqp->sles_param->resnorm_type = CS_PARAM_RESNORM_NORM2_RHS;
+
+      }
+      else
+        eqp->sles_param->solver_class = CS_PARAM_SLES_CLASS_CS;
 
     }
     else if (strcmp(keyval, "icc0") == 0) {
@@ -787,14 +797,22 @@ _set_key(cs_equation_param_t   *eqp,
       eqp->sles_param->precond = CS_PARAM_PRECOND_ICC0;
       eqp->sles_param->flexible = false;
 
-      /* Either with PETSc or with PETSc/HYPRE using Euclid */
+      /* Either with PETSc or with PETSc/HYPRE using Euclid, or with the
+         in-house (block-Jacobi) version if PETSc is not available */
 
-      eqp->sles_param->solver_class = _get_petsc_or_hypre(eqp->sles_param,
-                                                          "CS_EQKEY_PRECOND");
+      if (   cs_param_sles_check_class(CS_PARAM_SLES_CLASS_PETSC)
+          == CS_PARAM_SLES_CLASS_PETSC) {
 
-      /* Default when using PETSc */
+        eqp->sles_param->solver_class
+          = _get_petsc_or_hypre(eqp->sles_param, "CS_EQKEY_PRECOND");
 
-      eqp->sles_param->resnorm_type = CS_PARAM_RESNORM_NORM2_RHS;
+        /* Default when using PETSc */
+
+        eqp->sles_param->resnorm_type = CS_PARAM_RESNORM_NORM2_RHS;
+
+      }
+      else
+        eqp->sles_param->solver_class = CS_PARAM_SLES_CLASS_CS;
 
     }
     else if (strcmp(keyval, "amg") == 0) {
@@ -1910,6 +1928,9 @@ cs_equation_param_log(const cs_equation_param_t   *eqp)
     else if (eqp->omp_assembly_choice == CS_PARAM_ASSEMBLE_OMP_ATOMIC)
       cs_log_printf(CS_LOG_SETUP, "  * %s | OpenMP.Assembly.Choice:  %s\n",
                     eqname, "atomic");
+    else if (eqp->omp_assembly_choice == CS_PARAM_ASSEMBLE_OMP_COLORED)
+      cs_log_printf(CS_LOG_SETUP, "  * %s | OpenMP.Assembly.Choice:  %s\n",
+                    eqname, "colored");
   }
 
   /* Boundary conditions */
@@ -1047,6 +1047,10 @@ typedef struct {
  * Choice of the way to perform the assembly when OpenMP is active
  * Available choices are:
  * - "atomic" or "critical"
+ * - "colored": cells are gathered by colors (two cells of the same color do
+ *   not share any DoF) so that threads write in disjoint rows without any
+ *   synchronization. Only available with scalar-valued CDO vertex-based and
+ *   face-based schemes (otherwise "atomic" is used).
  *
  * \var CS_EQKEY_PRECOND
  * Specify the preconditioner associated to an iterative solver. Be careful
@@ -1064,9 +1068,11 @@ typedef struct {
  * - "poly1": Neumann polynomial of order 1 (only with code_saturne)
  * - "poly2": Neumann polynomial of order 2 (only with code_saturne)
  * - "ssor": symmetric successive over-relaxation (only with PETSC)
- * - "ilu0": incomplete LU factorization (only with PETSc)
- * - "icc0": incomplete Cholesky factorization (for symmetric matrices and
- *           only with PETSc)
+ * - "ilu0": incomplete LU factorization (with PETSc, or block-Jacobi
+ *           in-house version if PETSc is not available)
+ * - "icc0": incomplete Cholesky factorization (for symmetric matrices;
+ *           with PETSc, or in-house block-Jacobi ILU(0) if PETSc is not
+ *           available)
  * - "lu": LU factorization (only with PETSc). It may use MUMPS ig PETSc is
  *         built with MUMPS
  * - "amg": algebraic multigrid technique (see \ref CS_EQKEY_AMG_TYPE for
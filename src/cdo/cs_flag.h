@@ -146,6 +146,7 @@ BEGIN_C_DECLS
 #define CS_FLAG_SCHEME_POLY0   (1 << 3) /*!<  8: lowest-order scheme */
 #define CS_FLAG_SCHEME_POLY1   (1 << 4) /*!< 16: Linear gradient approx. */
 #define CS_FLAG_SCHEME_POLY2   (1 << 5) /*!< 32: Quadratic gradient approx. */
+#define CS_FLAG_SCHEME_COLORED (1 << 6) /*!< 64: colored (lock-free) assembly */
 
 /*!
  * @}
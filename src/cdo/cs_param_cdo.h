@@ -98,6 +98,7 @@ typedef enum {
 
   CS_PARAM_ASSEMBLE_OMP_ATOMIC,
   CS_PARAM_ASSEMBLE_OMP_CRITICAL,
+  CS_PARAM_ASSEMBLE_OMP_COLORED,
   CS_PARAM_ASSEMBLE_OMP_N_STRATEGIES
 
 } cs_param_assemble_omp_strategy_t;
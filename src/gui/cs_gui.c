@@ -3457,6 +3457,10 @@ cs_gui_linear_solvers(void)
         sles_it_type = CS_SLES_P_SYM_GAUSS_SEIDEL;
       else if (cs_gui_strcmp(algo_choice, "PCR3"))
         sles_it_type = CS_SLES_PCR3;
+      else if (cs_gui_strcmp(algo_choice, "pipelined_conjugate_gradient"))
+        sles_it_type = CS_SLES_PIPELINED_PCG;
+      else if (cs_gui_strcmp(algo_choice, "pipelined_gmres"))
+        sles_it_type = CS_SLES_PIPELINED_GMRES;
 
       /* If choice is "automatic" or unspecified, delay
          choice to cs_sles_default, so do nothing here */
@@ -183,18 +183,6 @@ _lages1(cs_real_t           dtp,
 
   cs_real_t tkelvi = cs_physical_constants_celsius_to_kelvin;
 
-  cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9, aux10, aux11;
-  cs_real_t ter1f, ter2f, ter3f;
-  cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
-  cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
-  cs_real_t ter6x = 0.;
-  cs_real_t ter6p = 0.;
-  cs_real_t ter6f = 0.;
-  cs_real_t p11, p21, p22, p31, p32, p33;
-  cs_real_t omega2, gama2, omegam;
-  cs_real_t grga2, gagam, gaome;
-  cs_real_t tbrix1, tbrix2, tbriu;
-
   cs_lnum_t nor = cs_glob_lagr_time_step->nor;
   const int _prev_id = (extra->vel->n_time_vals > 1) ? 1 : 0;
 
@@ -228,6 +216,8 @@ _lages1(cs_real_t           dtp,
    * positions might be overwritten */
 
   cs_lnum_t n_particles_prev = p_set->n_particles - p_set->n_part_new;
+
+# pragma omp parallel for if (n_particles_prev > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < n_particles_prev; ip++) {
 
     unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -235,6 +225,19 @@ _lages1(cs_real_t           dtp,
     if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
         continue;
 
+    cs_real_t aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9;
+    cs_real_t aux10, aux11;
+    cs_real_t ter1f, ter2f, ter3f;
+    cs_real_t ter1p, ter2p, ter3p, ter4p, ter5p;
+    cs_real_t ter1x, ter2x, ter3x, ter4x, ter5x;
+    cs_real_t ter6x = 0.;
+    cs_real_t ter6p = 0.;
+    cs_real_t ter6f = 0.;
+    cs_real_t p11, p21, p22, p31, p32, p33;
+    cs_real_t omega2, gama2, omegam;
+    cs_real_t grga2, gagam, gaome;
+    cs_real_t tbrix1, tbrix2, tbriu;
+
     cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
                                                   CS_LAGR_CELL_ID);
 
@@ -735,15 +738,6 @@ _lages2(cs_real_t           dtp,
         const cs_real_3_t   force_p[],
         cs_real_t          *terbru)
 {
-  cs_real_t  aux0, aux1, aux2, aux3, aux4, aux5, aux6, aux7, aux8, aux9;
-  cs_real_t  aux10, aux11, aux12, aux17, aux18, aux19;
-  cs_real_t  aux20;
-  cs_real_t  ter1, ter2, ter3, ter4, ter5;
-  cs_real_t  sige, tapn, gamma2;
-  cs_real_t  grgam2, gagam;
-  cs_real_t  p11, p21, p22;
-  cs_real_t  tbriu = 0.;
-
   /* Particles management */
   cs_lagr_particle_set_t  *p_set = cs_glob_lagr_particle_set;
   const cs_lagr_attribute_map_t  *p_am = p_set->p_am;
@@ -768,6 +762,7 @@ _lages2(cs_real_t           dtp,
 
   cs_lnum_t n_particles_prev = p_set->n_particles - p_set->n_part_new;
 
+# pragma omp parallel for if (n_particles_prev > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < n_particles_prev; ip++) {
 
     if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
@@ -796,6 +791,7 @@ _lages2(cs_real_t           dtp,
   if (nor == 1) {
 
     /* Save tau_p^n */
+#   pragma omp parallel for if (n_particles_prev > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < n_particles_prev; ip++) {
 
       if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
@@ -808,6 +804,7 @@ _lages2(cs_real_t           dtp,
     /* Save coupling */
     if (cs_glob_lagr_time_scheme->iilagr == CS_LAGR_TWOWAY_COUPLING) {
 
+#     pragma omp parallel for if (n_particles_prev > CS_THR_MIN)
       for (cs_lnum_t ip = 0; ip < n_particles_prev; ip++) {
 
         unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -815,8 +812,8 @@ _lages2(cs_real_t           dtp,
         if (cs_lagr_particles_get_flag(p_set, ip, CS_LAGR_PART_FIXED))
           continue;
 
-        aux0     = -dtp / taup[ip];
-        aux1     =  exp(aux0);
+        cs_real_t aux0 = -dtp / taup[ip];
+        cs_real_t aux1 =  exp(aux0);
         tsfext[ip] =   taup[ip]
                      * cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS)
                      * (-aux1 + (aux1 - 1.0) / aux0);
@@ -826,6 +823,7 @@ _lages2(cs_real_t           dtp,
     }
 
     /* Load terms at t = t_n : */
+#   pragma omp parallel for if (n_particles_prev > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < n_particles_prev; ip++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -844,23 +842,24 @@ _lages2(cs_real_t           dtp,
 
       for (cs_lnum_t id = 0; id < 3; id++) {
 
-        aux0    =  -dtp / taup[ip];
-        aux1    =  -dtp / tlag[ip][id];
-        aux2    = exp(aux0);
-        aux3    = exp(aux1);
-        aux4    = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
-        aux5    = aux3 - aux2;
+        cs_real_t aux0 =  -dtp / taup[ip];
+        cs_real_t aux1 =  -dtp / tlag[ip][id];
+        cs_real_t aux2 = exp(aux0);
+        cs_real_t aux3 = exp(aux1);
+        cs_real_t aux4 = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
+        cs_real_t aux5 = aux3 - aux2;
 
         pred_part_vel_seen[id] =   0.5 * old_part_vel_seen[id]
                                  * aux3 + auxl[ip * 6 + id + 3]
                                  * (-aux3 + (aux3 - 1.0) / aux1);
 
-        ter1    = 0.5 * old_part_vel[id] * aux2;
-        ter2    = 0.5 * old_part_vel_seen[id] * aux4 * aux5;
-        ter3    =   auxl[ip * 6 + id + 3]
-                  * (  -aux2 + ((tlag[ip][id] + taup[ip]) / dtp) * (1.0 - aux2)
-                     - (1.0 + tlag[ip][id] / dtp) * aux4 * aux5);
-        ter4    = auxl[ip * 6 + id] * (-aux2 + (aux2 - 1.0) / aux0);
+        cs_real_t ter1 = 0.5 * old_part_vel[id] * aux2;
+        cs_real_t ter2 = 0.5 * old_part_vel_seen[id] * aux4 * aux5;
+        cs_real_t ter3
+          =   auxl[ip * 6 + id + 3]
+            * (  -aux2 + ((tlag[ip][id] + taup[ip]) / dtp) * (1.0 - aux2)
+               - (1.0 + tlag[ip][id] / dtp) * aux4 * aux5);
+        cs_real_t ter4 = auxl[ip * 6 + id] * (-aux2 + (aux2 - 1.0) / aux0);
         pred_part_vel[id] = ter1 + ter2 + ter3 + ter4;
 
       }
@@ -888,6 +887,7 @@ _lages2(cs_real_t           dtp,
 
     /* Compute Us */
 
+#   pragma omp parallel for if (n_particles_prev > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < n_particles_prev; ip++) {
 
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
@@ -911,24 +911,24 @@ _lages2(cs_real_t           dtp,
 
       for (cs_lnum_t id = 0; id < 3; id++) {
 
-        aux0    =  -dtp / taup[ip];
-        aux1    =  -dtp / tlag[ip][id];
-        aux2    = exp(aux0);
-        aux3    = exp(aux1);
-        aux4    = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
-        aux5    = aux3 - aux2;
-        aux6    = aux3 * aux3;
+        cs_real_t aux0 =  -dtp / taup[ip];
+        cs_real_t aux1 =  -dtp / tlag[ip][id];
+        cs_real_t aux2 = exp(aux0);
+        cs_real_t aux3 = exp(aux1);
+        cs_real_t aux4 = tlag[ip][id] / (tlag[ip][id] - taup[ip]);
+        cs_real_t aux5 = aux3 - aux2;
+        cs_real_t aux6 = aux3 * aux3;
 
-        ter1    = 0.5 * old_part_vel_seen[id] * aux3;
-        ter2    = auxl[ip * 6 + id + 3] * (1.0 - (aux3 - 1.0) / aux1);
-        ter3    =  -aux6 + (aux6 - 1.0) / (2.0 * aux1);
-        ter4    = 1.0 - (aux6 - 1.0) / (2.0 * aux1);
+        cs_real_t ter1 = 0.5 * old_part_vel_seen[id] * aux3;
+        cs_real_t ter2 = auxl[ip * 6 + id + 3] * (1.0 - (aux3 - 1.0) / aux1);
+        cs_real_t ter3 =  -aux6 + (aux6 - 1.0) / (2.0 * aux1);
+        cs_real_t ter4 = 1.0 - (aux6 - 1.0) / (2.0 * aux1);
 
-        sige    =   (  ter3 * bx[ip][id][0]
-                     + ter4 * bx[ip][id][1] )
-                  * (1.0 / (1.0 - aux6));
+        cs_real_t sige =   (  ter3 * bx[ip][id][0]
+                            + ter4 * bx[ip][id][1] )
+                         * (1.0 / (1.0 - aux6));
 
-        ter5    = 0.5 * tlag[ip][id] * (1.0 - aux6);
+        cs_real_t ter5 = 0.5 * tlag[ip][id] * (1.0 - aux6);
 
         part_vel_seen[id] =   pred_part_vel_seen[id] + ter1 + ter2
                             + sige * sqrt(ter5) * vagaus[ip][id][0];
@@ -941,27 +941,29 @@ _lages2(cs_real_t           dtp,
                      + (tlag[ip][id] / dtp) * aux4 * aux5)
           + auxl[ip * 6 + id] * (1.0 - (aux2 - 1.0) / aux0);
 
-        tapn    = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_TAUP_AUX);
+        cs_real_t tapn
+          = cs_lagr_particle_get_real(particle, p_am, CS_LAGR_TAUP_AUX);
 
-        aux7    = exp(-dtp / tapn);
-        aux8    = 1.0 - aux3 * aux7;
-        aux9    = 1.0 - aux6;
-        aux10   = 1.0 - aux7 * aux7;
-        aux11   = tapn / (tlag[ip][id] + tapn);
-        aux12   = tlag[ip][id] / (tlag[ip][id] - tapn);
-        aux17   = sige * sige * aux12 * aux12;
-        aux18   = 0.5 * tlag[ip][id] * aux9;
-        aux19   = 0.5 * tapn * aux10;
-        aux20   = tlag[ip][id] * aux11 * aux8;
+        cs_real_t aux7 = exp(-dtp / tapn);
+        cs_real_t aux8 = 1.0 - aux3 * aux7;
+        cs_real_t aux9 = 1.0 - aux6;
+        cs_real_t aux10 = 1.0 - aux7 * aux7;
+        cs_real_t aux11 = tapn / (tlag[ip][id] + tapn);
+        cs_real_t aux12 = tlag[ip][id] / (tlag[ip][id] - tapn);
+        cs_real_t aux17 = sige * sige * aux12 * aux12;
+        cs_real_t aux18 = 0.5 * tlag[ip][id] * aux9;
+        cs_real_t aux19 = 0.5 * tapn * aux10;
+        cs_real_t aux20 = tlag[ip][id] * aux11 * aux8;
 
         /* compute correlation matrix */
-        gamma2  = sige * sige * aux18;
-        grgam2  = aux17 * (aux18 - 2.0 * aux20 + aux19);
-        gagam   = sige * sige * aux12 * (aux18 - aux20);
+        cs_real_t gamma2 = sige * sige * aux18;
+        cs_real_t grgam2 = aux17 * (aux18 - 2.0 * aux20 + aux19);
+        cs_real_t gagam = sige * sige * aux12 * (aux18 - aux20);
 
         /* Gaussian vector simulation */
 
-        p11  = sqrt(CS_MAX(0.0, gamma2));
+        cs_real_t p11 = sqrt(CS_MAX(0.0, gamma2));
+        cs_real_t p21, p22;
         if (p11 > cs_math_epzero) {
           p21  = gagam / p11;
           p22  = grgam2 - p21 * p21;
@@ -975,6 +977,7 @@ _lages2(cs_real_t           dtp,
         ter4    = p21 * vagaus[ip][id][0] + p22 * vagaus[ip][id][1];
 
         /* Compute terms in Brownian movement */
+        cs_real_t tbriu = 0.;
         if (cs_glob_lagr_brownian->lamvbr == 1)
           tbriu = terbru[ip] * brgaus[ip * 6 + id + 3];
 
@@ -2746,6 +2749,7 @@ cs_lagr_sde(cs_real_t           dt_p,
       }
     }
     else {
+      /* Random draws remain serial, as the generator has a global state */
       for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++)
         cs_random_normal(9, &(vagaus[ip][0][0]));
     }
@@ -2783,6 +2787,7 @@ cs_lagr_sde(cs_real_t           dt_p,
   /* Computation of particle density */
   cs_real_t aa = 6.0 / cs_math_pi;
 
+# pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
   for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
 
     cs_real_t d3 = cs_math_pow3(cs_lagr_particles_get_real(p_set, ip,
@@ -2825,6 +2830,7 @@ cs_lagr_sde(cs_real_t           dt_p,
    *
    * */
   if (cs_glob_lagr_time_scheme->iadded_mass == 0) {
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
       cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
@@ -2838,6 +2844,7 @@ cs_lagr_sde(cs_real_t           dt_p,
   }
   /* Added-mass term?     */
   else {
+#   pragma omp parallel for if (p_set->n_particles > CS_THR_MIN)
     for (cs_lnum_t ip = 0; ip < p_set->n_particles; ip++) {
       unsigned char *particle = p_set->p_buffer + p_am->extents * ip;
       cs_lnum_t cell_id = cs_lagr_particle_get_lnum(particle, p_am,
@@ -742,6 +742,140 @@ _destroy_track_builder(cs_lagr_track_builder_t  *builder)
   return NULL;
 }
 
+/*----------------------------------------------------------------------------
+ * Determine the number of threads usable for local propagation.
+ *
+ * Boundary or internal interactions which draw random numbers (fouling,
+ * roughness, clogging), modify other particles (clogging), or call
+ * user-defined functions are not thread-safe, so propagation is done
+ * serially when any of them is present.
+ *
+ * parameters:
+ *   particles <-- pointer to particle set
+ *
+ * returns:
+ *   number of threads to use for local propagation
+ *----------------------------------------------------------------------------*/
+
+static int
+_propagation_n_threads(const cs_lagr_particle_set_t  *particles)
+{
+  int n_threads = cs_glob_n_threads;
+
+  if (n_threads < 2 || particles->n_particles < CS_THR_MIN)
+    return 1;
+
+  const cs_lagr_model_t *lagr_model = cs_glob_lagr_model;
+
+  if (lagr_model->clogging > 0 || lagr_model->roughness > 0)
+    return 1;
+
+  const cs_lagr_internal_condition_t *internal_conditions
+    = cs_glob_lagr_internal_conditions;
+
+  if (internal_conditions != NULL) {
+    const cs_lnum_t n_i_faces = cs_glob_mesh->n_i_faces;
+    for (cs_lnum_t i = 0; i < n_i_faces; i++) {
+      if (internal_conditions->i_face_zone_id[i] == CS_LAGR_BC_USER)
+        return 1;
+    }
+  }
+
+  const char *elt_type = cs_glob_lagr_boundary_conditions->elt_type;
+
+  if (elt_type != NULL) {
+    const cs_lnum_t n_b_faces = cs_glob_mesh->n_b_faces;
+    for (cs_lnum_t i = 0; i < n_b_faces; i++) {
+      if (   elt_type[i] == CS_LAGR_FOULING
+          || elt_type[i] == CS_LAGR_BC_USER)
+        return 1;
+    }
+  }
+
+  return n_threads;
+}
+
+/*----------------------------------------------------------------------------
+ * Reserve an event slot in an event set.
+ *
+ * When the shared boundary interactions event set is full, its contents
+ * are flushed to statistics. Thread-local event sets are grown instead,
+ * and merged into the shared set after local propagation.
+ *
+ * parameters:
+ *   events <-> pointer to events set
+ *
+ * returns:
+ *   id of reserved event
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_reserve_event(cs_lagr_event_set_t  *events)
+{
+  cs_lnum_t event_id = events->n_events;
+
+  if (event_id >= events->n_events_max) {
+    if (events == cs_lagr_event_set_boundary_interaction()) {
+      /* flush events */
+      cs_lagr_stat_update_event(events,
+                                CS_LAGR_STAT_GROUP_TRACKING_EVENT);
+      events->n_events = 0;
+      event_id = 0;
+    }
+    else
+      cs_lagr_event_set_resize(events, events->n_events_max*2);
+  }
+
+  return event_id;
+}
+
+/*----------------------------------------------------------------------------
+ * Append thread-local events to the shared event set.
+ *
+ * Thread-local sets are appended in thread order, so that with a static
+ * distribution of particles the resulting event sequence is the same
+ * as with a serial propagation.
+ *
+ * parameters:
+ *   events     <-> pointer to shared events set
+ *   n_threads  <-- number of thread-local event sets
+ *   t_events   <-> thread-local events sets (emptied on return)
+ *----------------------------------------------------------------------------*/
+
+static void
+_merge_thread_events(cs_lagr_event_set_t  *events,
+                     int                   n_threads,
+                     cs_lagr_event_set_t  *t_events[])
+{
+  const size_t extents = events->e_am->extents;
+
+  for (int t_id = 0; t_id < n_threads; t_id++) {
+
+    cs_lagr_event_set_t *t_e = t_events[t_id];
+
+    cs_lnum_t s_id = 0;
+
+    while (s_id < t_e->n_events) {
+
+      cs_lnum_t e_id = _reserve_event(events);
+
+      cs_lnum_t n_copy = CS_MIN(t_e->n_events - s_id,
+                                events->n_events_max - e_id);
+
+      memcpy(events->e_buffer + extents*e_id,
+             t_e->e_buffer + extents*s_id,
+             extents*n_copy);
+
+      events->n_events += n_copy;
+      s_id += n_copy;
+
+    }
+
+    t_e->n_events = 0;
+
+  }
+}
+
 /*----------------------------------------------------------------------------
  * Manage detected errors
  *
@@ -920,7 +1054,9 @@ _internal_treatment(cs_lagr_particle_set_t  *particles,
 
       particle_state = CS_LAGR_PART_TREATED;
 
+#     pragma omp atomic
       particles->n_part_dep += 1;
+#     pragma omp atomic
       particles->weight_dep += particle_stat_weight;
 
     }
@@ -964,13 +1100,7 @@ _roll_off_event(cs_lagr_particle_set_t    *particles,
 {
   /* Get event id, flushing events if necessary */
 
-  cs_lnum_t event_id = events->n_events;
-  if (event_id >= events->n_events_max) {
-    cs_lagr_stat_update_event(events,
-                              CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-    events->n_events = 0;
-    event_id = 0;
-  }
+  cs_lnum_t event_id = _reserve_event(events);
   events->n_events += 1;
 
   /* Now set event values */
@@ -1097,14 +1227,7 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
 
   if (events != NULL) {
 
-    event_id = events->n_events;
-    if (event_id >= events->n_events_max) {
-      /* flush events */
-      cs_lagr_stat_update_event(events,
-                                CS_LAGR_STAT_GROUP_TRACKING_EVENT);
-      events->n_events = 0;
-      event_id = 0;
-    }
+    event_id = _reserve_event(events);
 
     cs_lagr_event_init_from_particle(events, particles, event_id, p_id);
 
@@ -1129,7 +1252,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     particle_state = CS_LAGR_PART_OUT;
 
     if (b_type == CS_LAGR_DEPO1) {
+#     pragma omp atomic
       particles->n_part_dep += 1;
+#     pragma omp atomic
       particles->weight_dep += particle_stat_weight;
       cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_DEPOSITED);
       event_flag = event_flag | CS_EVENT_DEPOSITION;
@@ -1151,7 +1276,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
     }
 
+#   pragma omp atomic
     particles->n_part_dep += 1;
+#   pragma omp atomic
     particles->weight_dep += particle_stat_weight;
 
     /* Specific treatment in case of particle resuspension modeling */
@@ -1244,7 +1371,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
       if (!cs_glob_lagr_model->clogging && !cs_glob_lagr_model->resuspension) {
         cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_DEPOSITED);
 
+#       pragma omp atomic
         particles->n_part_dep += 1;
+#       pragma omp atomic
         particles->weight_dep += particle_stat_weight;
 
         cs_lagr_particles_set_flag(particles, p_id, CS_LAGR_PART_FIXED);
@@ -1263,7 +1392,9 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
           particle_velocity[k] = 0.0;
           particle_coord[k] = intersect_pt[k] + bc_epsilon * vect_cen[k];
         }
+#       pragma omp atomic
         particles->n_part_dep += 1;
+#       pragma omp atomic
         particles->weight_dep += particle_stat_weight;
         particle_state = CS_LAGR_PART_TREATED;
 
@@ -1777,14 +1908,17 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
     cs_real_t fr =   particle_stat_weight
                    * cs_lagr_particle_get_real(particle, p_am, CS_LAGR_MASS);
 
+#   pragma omp atomic
     bdy_conditions->particle_flow_rate[b_z_id*n_stats] -= fr;
 
     if (n_stats > 1) {
       int class_id
         = cs_lagr_particle_get_lnum(particle, p_am, CS_LAGR_STAT_CLASS);
-      if (class_id > 0 && class_id < n_stats)
+      if (class_id > 0 && class_id < n_stats) {
+#       pragma omp atomic
         bdy_conditions->particle_flow_rate[  b_z_id*n_stats
                                            + class_id] -= fr;
+      }
     }
   }
 
@@ -1795,9 +1929,11 @@ _boundary_treatment(cs_lagr_particle_set_t    *particles,
        || b_type == CS_LAGR_FOULING) {
 
     /* Number of particle-boundary interactions  */
-    if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0)
+    if (cs_glob_lagr_boundary_interactions->has_part_impact_nbr > 0) {
+#     pragma omp atomic
       bound_stat[cs_glob_lagr_boundary_interactions->inbr * n_b_faces + face_id]
         += particle_stat_weight;
+    }
 
   }
 
@@ -3081,12 +3217,25 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   _initialize_displacement(particles);
 
+  /* Thread-local event sets, merged after each local propagation pass */
+
+  int n_threads = _propagation_n_threads(particles);
+  cs_lagr_event_set_t **t_events = NULL;
+
+  if (n_threads > 1 && events != NULL) {
+    BFT_MALLOC(t_events, n_threads, cs_lagr_event_set_t *);
+    for (int t_id = 0; t_id < n_threads; t_id++)
+      t_events[t_id] = cs_lagr_event_set_create();
+  }
+
   /* Main loop on particles: global propagation */
 
   while (continue_displacement) {
 
-    /* Local propagation */
+    /* Local propagation; a static schedule ensures merged thread-local
+       events follow particle order */
 
+#   pragma omp parallel for schedule(static) if (n_threads > 1)
     for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
       /* Local copies of the current and previous particles state vectors
@@ -3097,10 +3246,16 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
       if (cur_part_state == CS_LAGR_PART_TO_SYNC) {
 
+        cs_lagr_event_set_t *_events = events;
+#if defined(HAVE_OPENMP)
+        if (t_events != NULL)
+          _events = t_events[omp_get_thread_num()];
+#endif
+
         /* Main particle displacement stage */
 
         cur_part_state = _local_propagation(particles,
-                                            events,
+                                            _events,
                                             i,
                                             displacement_step_id,
                                             failsafe_mode,
@@ -3114,6 +3269,9 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
     } /* End of loop on particles */
 
+    if (t_events != NULL)
+      _merge_thread_events(events, n_threads, t_events);
+
     /* Update of the particle set structure. Delete exited particles,
        update for particles which change domain. */
 
@@ -3131,10 +3289,17 @@ cs_lagr_tracking_particle_movement(const cs_real_t  visc_length[])
 
   } /* End of while (global displacement) */
 
+  if (t_events != NULL) {
+    for (int t_id = 0; t_id < n_threads; t_id++)
+      cs_lagr_event_set_destroy(&(t_events[t_id]));
+    BFT_FREE(t_events);
+  }
+
   /* Deposition sub-model additional loop */
 
   if (lagr_model->deposition > 0) {
 
+#   pragma omp parallel for if (particles->n_particles > CS_THR_MIN)
     for (cs_lnum_t i = 0; i < particles->n_particles; i++) {
 
       unsigned char *particle = particles->p_buffer + p_am->extents * i;
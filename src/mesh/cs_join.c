@@ -167,6 +167,38 @@ _select_entities(cs_join_t   *this_join,
 
   const char   *selection_criteria = this_join->criteria;
 
+  /* Reuse cached selection if the mesh is unchanged since it was built;
+     as the following steps are collective, the selection may be reused
+     only if it is reusable on all ranks. */
+
+  cs_join_select_t  *selection_ref = this_join->selection_ref;
+
+  int reuse_selection = 0;
+
+  if (selection_ref != NULL) {
+    if (   selection_ref->n_init_b_faces == mesh->n_b_faces
+        && selection_ref->n_init_i_faces == mesh->n_i_faces
+        && selection_ref->n_init_vertices == mesh->n_vertices)
+      reuse_selection = 1;
+  }
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, &reuse_selection, 1, MPI_INT, MPI_LAND,
+                  cs_glob_mpi_comm);
+#endif
+
+  if (reuse_selection) {
+    this_join->selection = cs_join_select_copy(selection_ref);
+    if (mesh->verbosity > 0) {
+      bft_printf(_("\n  Element selection reused from previous joining.\n"));
+      bft_printf_flush();
+    }
+    return;
+  }
+  else if (selection_ref != NULL)
+    cs_join_select_destroy(param, &(this_join->selection_ref));
+
   cs_mesh_init_group_classes(mesh);
 
   cs_mesh_quantities_b_faces(mesh, &b_face_cog, &b_face_normal);
@@ -188,6 +220,14 @@ _select_entities(cs_join_t   *this_join,
                                                param.perio_type,
                                                param.verbosity);
 
+  /* Keep a copy for future calls on a mesh rebuilt from the same
+     reference (the periodic case modifies the selection, and
+     is not handled) */
+
+  if (   this_join->cache_selection
+      && param.perio_type == FVM_PERIODICITY_NULL)
+    this_join->selection_ref = cs_join_select_copy(this_join->selection);
+
   /* Free arrays and structures needed for selection */
 
   BFT_FREE(b_face_cog);
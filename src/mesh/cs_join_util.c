@@ -311,6 +311,42 @@ _destroy_join_sync(cs_join_sync_t   **sync)
   *sync = _sync;
 }
 
+/*----------------------------------------------------------------------------
+ * Copy a structure for the synchronization of single elements.
+ *
+ * parameters:
+ *   src     <-- pointer to structure to copy
+ *   stride  <-- number of values per element (1 for vertices, 2 for edges)
+ *
+ * returns:
+ *   a pointer to a new structure used for synchronizing single elements
+ *----------------------------------------------------------------------------*/
+
+static cs_join_sync_t *
+_copy_join_sync(const cs_join_sync_t  *src,
+                int                    stride)
+{
+  cs_join_sync_t  *sync = _create_join_sync();
+
+  sync->n_elts = src->n_elts;
+  sync->n_ranks = src->n_ranks;
+
+  if (src->ranks != NULL) {
+    BFT_MALLOC(sync->ranks, src->n_ranks, int);
+    memcpy(sync->ranks, src->ranks, src->n_ranks*sizeof(int));
+  }
+  if (src->index != NULL) {
+    BFT_MALLOC(sync->index, src->n_ranks + 1, cs_lnum_t);
+    memcpy(sync->index, src->index, (src->n_ranks + 1)*sizeof(cs_lnum_t));
+  }
+  if (src->array != NULL) {
+    BFT_MALLOC(sync->array, stride*src->n_elts, cs_lnum_t);
+    memcpy(sync->array, src->array, stride*src->n_elts*sizeof(cs_lnum_t));
+  }
+
+  return sync;
+}
+
 /*----------------------------------------------------------------------------
  * Reduce numbering for the selected boundary faces.
  * After this function, we have a compact global face numbering for the
@@ -2144,6 +2180,9 @@ cs_join_create(int                      join_number,
 
   join->log_name = NULL;
 
+  join->cache_selection = false;
+  join->selection_ref = NULL;
+
   /* Copy the selection criteria for future use */
 
   l = strlen(sel_criteria);
@@ -2197,6 +2236,8 @@ cs_join_destroy(cs_join_t  **join)
     BFT_FREE(_join->log_name);
     BFT_FREE(_join->criteria);
 
+    cs_join_select_destroy(_join->param, &(_join->selection_ref));
+
     BFT_FREE(_join);
     *join = NULL;
 
@@ -2585,6 +2626,88 @@ cs_join_select_destroy(cs_join_param_t     param,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Create a copy of a cs_join_select_t structure.
+ *
+ * The selected entities only depend on the mesh on which the selection
+ * was built, so a copy may be used in place of a new selection when the
+ * same joining is applied again to an identical mesh (for example a
+ * mesh rebuilt from a reference mesh at each time step).
+ *
+ * The copy is purely local, but the selection also contains data
+ * relative to other ranks (such as compact_rank_index or the
+ * synchronization structures), so the decision to use a copy must be
+ * the same on all ranks.
+ *
+ * parameters:
+ *   src <-- pointer to structure to copy
+ *
+ * returns:
+ *   pointer to a newly created cs_join_select_t structure
+ *---------------------------------------------------------------------------*/
+
+cs_join_select_t *
+cs_join_select_copy(const cs_join_select_t  *src)
+{
+  cs_join_select_t  *selection = NULL;
+
+  assert(src != NULL);
+
+  BFT_MALLOC(selection, 1, cs_join_select_t);
+
+  /* Copy scalar members, then duplicate arrays */
+
+  *selection = *src;
+
+  BFT_MALLOC(selection->faces, src->n_faces, cs_lnum_t);
+  memcpy(selection->faces, src->faces, src->n_faces*sizeof(cs_lnum_t));
+
+  selection->compact_face_gnum = NULL;
+  if (src->compact_face_gnum != NULL) {
+    BFT_MALLOC(selection->compact_face_gnum, src->n_faces, cs_gnum_t);
+    memcpy(selection->compact_face_gnum, src->compact_face_gnum,
+           src->n_faces*sizeof(cs_gnum_t));
+  }
+
+  BFT_MALLOC(selection->compact_rank_index, cs_glob_n_ranks + 1, cs_gnum_t);
+  memcpy(selection->compact_rank_index, src->compact_rank_index,
+         (cs_glob_n_ranks + 1)*sizeof(cs_gnum_t));
+
+  BFT_MALLOC(selection->vertices, src->n_vertices, cs_lnum_t);
+  memcpy(selection->vertices, src->vertices,
+         src->n_vertices*sizeof(cs_lnum_t));
+
+  BFT_MALLOC(selection->b_adj_faces, src->n_b_adj_faces, cs_lnum_t);
+  memcpy(selection->b_adj_faces, src->b_adj_faces,
+         src->n_b_adj_faces*sizeof(cs_lnum_t));
+
+  BFT_MALLOC(selection->i_adj_faces, src->n_i_adj_faces, cs_lnum_t);
+  memcpy(selection->i_adj_faces, src->i_adj_faces,
+         src->n_i_adj_faces*sizeof(cs_lnum_t));
+
+  BFT_MALLOC(selection->b_face_state, src->n_init_b_faces, cs_join_state_t);
+  memcpy(selection->b_face_state, src->b_face_state,
+         src->n_init_b_faces*sizeof(cs_join_state_t));
+
+  BFT_MALLOC(selection->i_face_state, src->n_init_i_faces, cs_join_state_t);
+  memcpy(selection->i_face_state, src->i_face_state,
+         src->n_init_i_faces*sizeof(cs_join_state_t));
+
+  selection->per_v_couples = NULL;
+  if (src->per_v_couples != NULL) {
+    BFT_MALLOC(selection->per_v_couples, 2*src->n_couples, cs_gnum_t);
+    memcpy(selection->per_v_couples, src->per_v_couples,
+           2*src->n_couples*sizeof(cs_gnum_t));
+  }
+
+  selection->s_vertices = _copy_join_sync(src->s_vertices, 1);
+  selection->c_vertices = _copy_join_sync(src->c_vertices, 1);
+  selection->s_edges = _copy_join_sync(src->s_edges, 2);
+  selection->c_edges = _copy_join_sync(src->c_edges, 2);
+
+  return selection;
+}
+
 /*----------------------------------------------------------------------------
  * Extract vertices from a selection of faces.
  *
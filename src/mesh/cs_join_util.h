@@ -307,6 +307,12 @@ typedef struct {
 
   char              *log_name;   /* Optional log file name */
 
+  bool               cache_selection;  /* Keep a copy of the selection
+                                          for subsequent calls ? */
+  cs_join_select_t  *selection_ref;    /* Cached copy of the selection, used
+                                          when joining is applied again to
+                                          an unchanged mesh (or NULL) */
+
 } cs_join_t;
 
 /*=============================================================================
@@ -393,6 +399,29 @@ void
 cs_join_select_destroy(cs_join_param_t     param,
                        cs_join_select_t  **join_select);
 
+/*----------------------------------------------------------------------------
+ * Create a copy of a cs_join_select_t structure.
+ *
+ * The selected entities only depend on the mesh on which the selection
+ * was built, so a copy may be used in place of a new selection when the
+ * same joining is applied again to an identical mesh (for example a
+ * mesh rebuilt from a reference mesh at each time step).
+ *
+ * The copy is purely local, but the selection also contains data
+ * relative to other ranks (such as compact_rank_index or the
+ * synchronization structures), so the decision to use a copy must be
+ * the same on all ranks.
+ *
+ * parameters:
+ *   src <-- pointer to structure to copy
+ *
+ * returns:
+ *   pointer to a newly created cs_join_select_t structure
+ *---------------------------------------------------------------------------*/
+
+cs_join_select_t *
+cs_join_select_copy(const cs_join_select_t  *src);
+
 /*----------------------------------------------------------------------------
  * Extract vertices from a selection of faces.
  *
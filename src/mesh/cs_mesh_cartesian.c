@@ -100,6 +100,16 @@ static int _build_mesh_cartesian = 0;
 static int _n_structured_meshes = 0;
 static cs_mesh_cartesian_params_t **_mesh_params = NULL;
 
+/* Global number of cells per direction of the generated mesh, kept after
+   the mesh parameters are destroyed so the structure may be exploited */
+
+static cs_gnum_t _n_g_cells_dir[3] = {0, 0, 0};
+
+/* Local stencil of the mesh, shared by matrix structures and gradients */
+
+static bool _stencil_checked = false;
+static cs_mesh_cartesian_stencil_t *_stencil = NULL;
+
 /*============================================================================
  * Private functions
  *============================================================================*/
@@ -480,6 +490,148 @@ _add_nz_face(cs_mesh_builder_t  *mb,
   mb->face_vertices[4*f_id + 0] = i0 + (i+1) + j*nxp1     + k*nxp1*nyp1;
 }
 
+/*----------------------------------------------------------------------------*/
+/*! \brief Build the local 7-point stencil of a cartesian mesh.
+ *
+ * The stencil is only available if the local cells still form a contiguous
+ * range of the (i, j, k) global numbering, which is the case in serial
+ * or with block partitioning, and with no cell renumbering.
+ *
+ * \param[in] m  pointer to mesh structure
+ *
+ * \return pointer to stencil structure, or NULL if the local mesh
+ *         does not have a cartesian structure
+ */
+/*----------------------------------------------------------------------------*/
+
+static cs_mesh_cartesian_stencil_t *
+_stencil_create(const cs_mesh_t  *m)
+{
+  const cs_gnum_t *n_g = _n_g_cells_dir;
+  const cs_gnum_t g_stride[3] = {1, n_g[0], n_g[0]*n_g[1]};
+
+  const cs_lnum_t n_cells = m->n_cells;
+
+  if (n_cells < 1 || m->n_g_cells != n_g[0]*n_g[1]*n_g[2])
+    return NULL;
+
+  /* Local cells must be a contiguous range of the global (i, j, k)
+     numbering (global number 1 + i + j*nx + k*nx*ny) */
+
+  cs_gnum_t g_shift = 0;
+
+  if (m->global_cell_num != NULL) {
+    g_shift = m->global_cell_num[0] - 1;
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      if (m->global_cell_num[c_id] != g_shift + (cs_gnum_t)c_id + 1)
+        return NULL;
+    }
+  }
+
+  /* Directions in which local cells may have local neighbors */
+
+  int n_dirs = 0;
+  int dir[3];
+  cs_lnum_t shift[3];
+
+  for (int d = 0; d < 3; d++) {
+    if (n_g[d] > 1 && g_stride[d] < (cs_gnum_t)n_cells) {
+      dir[n_dirs] = d;
+      shift[n_dirs] = g_stride[d];
+      n_dirs++;
+    }
+  }
+
+  if (n_dirs < 1)
+    return NULL;
+
+  cs_mesh_cartesian_stencil_t *s = NULL;
+  BFT_MALLOC(s, 1, cs_mesh_cartesian_stencil_t);
+
+  s->n_cells = n_cells;
+  s->n_dirs = n_dirs;
+  for (int i = 0; i < 3; i++) {
+    s->dir[i] = (i < n_dirs) ? dir[i] : -1;
+    s->shift[i] = (i < n_dirs) ? shift[i] : 0;
+  }
+
+  BFT_MALLOC(s->cell_nbr, n_cells, unsigned char);
+  BFT_MALLOC(s->i_face_dir, m->n_i_faces, signed char);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    s->cell_nbr[c_id] = 0;
+
+  /* Match interior faces with stencil directions; strides of directions
+     with neighbors are all different, so at most one direction matches */
+
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  s->n_x_faces = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+
+    cs_lnum_t ii = i_face_cells[f_id][0];
+    cs_lnum_t jj = i_face_cells[f_id][1];
+
+    signed char f_dir = -1;
+
+    if (ii < n_cells && jj < n_cells) {
+      cs_lnum_t c_lo = CS_MIN(ii, jj);
+      cs_lnum_t c_hi = CS_MAX(ii, jj);
+      for (int i = 0; i < n_dirs; i++) {
+        if (c_hi - c_lo != shift[i])
+          continue;
+        int d = dir[i];
+        cs_gnum_t ijk_d = ((g_shift + c_lo) / g_stride[d]) % n_g[d];
+        unsigned char f_mask = 1 << (2*i);
+        if (ijk_d + 1 < n_g[d] && (s->cell_nbr[c_lo] & f_mask) == 0) {
+          s->cell_nbr[c_lo] |= f_mask;
+          s->cell_nbr[c_hi] |= (f_mask << 1);
+          f_dir = i;
+        }
+        break;
+      }
+    }
+
+    s->i_face_dir[f_id] = f_dir;
+    if (f_dir < 0)
+      s->n_x_faces += 1;
+
+  }
+
+  BFT_MALLOC(s->x_face_id, s->n_x_faces, cs_lnum_t);
+
+  cs_lnum_t j = 0;
+  for (cs_lnum_t f_id = 0; f_id < m->n_i_faces; f_id++) {
+    if (s->i_face_dir[f_id] < 0)
+      s->x_face_id[j++] = f_id;
+  }
+
+  return s;
+}
+
+/*----------------------------------------------------------------------------*/
+/*! \brief Destroy a cartesian mesh stencil structure.
+ *
+ * \param[in, out] s  pointer to stencil structure pointer
+ */
+/*----------------------------------------------------------------------------*/
+
+static void
+_stencil_destroy(cs_mesh_cartesian_stencil_t  **s)
+{
+  if (s == NULL || *s == NULL)
+    return;
+
+  cs_mesh_cartesian_stencil_t *_s = *s;
+
+  BFT_FREE(_s->cell_nbr);
+  BFT_FREE(_s->i_face_dir);
+  BFT_FREE(_s->x_face_id);
+
+  BFT_FREE(*s);
+}
+
 /*============================================================================
  * Public function definitions
  *============================================================================*/
@@ -924,6 +1076,10 @@ cs_mesh_cartesian_connectivity(cs_mesh_t          *m,
   m->n_g_cells = n_g_cells;
   m->n_g_vertices = n_g_vtx;
 
+  _n_g_cells_dir[0] = nx;
+  _n_g_cells_dir[1] = ny;
+  _n_g_cells_dir[2] = nz;
+
   cs_mesh_builder_define_block_dist(mb,
                                     cs_glob_rank_id,
                                     cs_glob_n_ranks,
@@ -1079,6 +1235,48 @@ cs_mesh_cartesian_params_destroy(void)
   _n_structured_meshes = 0;
 }
 
+/*----------------------------------------------------------------------------*/
+/*! \brief Return the local 7-point stencil of a cartesian mesh.
+ *
+ * The (i, j, k) structure of the generated mesh is kept after its
+ * parameters are destroyed, so this may be called at any time. The
+ * stencil is built on the first call, and shared by all its users
+ * (matrix structures and gradients) until
+ * \ref cs_mesh_cartesian_stencil_free is called.
+ *
+ * \param[in] m  pointer to mesh structure
+ *
+ * \return pointer to stencil structure, or NULL if the local mesh
+ *         does not have a cartesian structure
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_mesh_cartesian_stencil_t *
+cs_mesh_cartesian_get_stencil(const cs_mesh_t  *m)
+{
+  if (_stencil_checked == false) {
+    _stencil = _stencil_create(m);
+    _stencil_checked = true;
+  }
+
+  return _stencil;
+}
+
+/*----------------------------------------------------------------------------*/
+/*! \brief Free the shared cartesian mesh stencil.
+ *
+ * This must be called when the mesh topology changes (before matrix
+ * structures are updated), and at the end of the computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cartesian_stencil_free(void)
+{
+  _stencil_destroy(&_stencil);
+  _stencil_checked = false;
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -31,6 +31,13 @@
 
 #include "cs_defs.h"
 
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+
+/*----------------------------------------------------------------------------*/
+
+BEGIN_C_DECLS
+
 /*============================================================================
  * Type definitions
  *============================================================================*/
@@ -47,6 +54,34 @@ typedef enum {
 
 typedef struct _cs_mesh_cartesian_params_t cs_mesh_cartesian_params_t;
 
+/*----------------------------------------------------------------------------
+ * Local 7-point stencil of a cartesian mesh.
+ *
+ * Neighbors of a local cell c are cells c +/- shift[d] for each direction d
+ * in which cells have neighbors. Interior faces matching no stencil
+ * direction (adjacent to ghost cells, periodic, or duplicate faces)
+ * are listed separately, and must be handled in the usual face-based way.
+ *----------------------------------------------------------------------------*/
+
+typedef struct {
+
+  cs_lnum_t       n_cells;      /* Local number of cells */
+
+  int             n_dirs;       /* Number of stencil directions */
+  int             dir[3];       /* Matching mesh direction (0: X, 1: Y, 2: Z) */
+  cs_lnum_t       shift[3];     /* Cell id offset for each stencil direction */
+
+  unsigned char  *cell_nbr;     /* Neighbor flags for each cell: bit 2*d
+                                   set if cell + shift[d] is a neighbor,
+                                   bit 2*d + 1 set if cell - shift[d] is */
+  signed char    *i_face_dir;   /* Stencil direction of each interior face,
+                                   or -1 for faces out of stencil */
+
+  cs_lnum_t       n_x_faces;    /* Number of interior faces out of stencil */
+  cs_lnum_t      *x_face_id;    /* Ids of interior faces out of stencil */
+
+} cs_mesh_cartesian_stencil_t;
+
 /*============================================================================
  * Public C function prototypes
  *============================================================================*/
@@ -215,6 +250,40 @@ cs_mesh_cartesian_connectivity(cs_mesh_t          *m,
 void
 cs_mesh_cartesian_params_destroy(void);
 
+/*----------------------------------------------------------------------------*/
+/*! \brief Return the local 7-point stencil of a cartesian mesh.
+ *
+ * The (i, j, k) structure of the generated mesh is kept after its
+ * parameters are destroyed, so this may be called at any time. The
+ * stencil is built on the first call, and shared by all its users
+ * (matrix structures and gradients) until
+ * \ref cs_mesh_cartesian_stencil_free is called.
+ *
+ * \param[in] m  pointer to mesh structure
+ *
+ * \return pointer to stencil structure, or NULL if the local mesh
+ *         does not have a cartesian structure
+ */
+/*----------------------------------------------------------------------------*/
+
+const cs_mesh_cartesian_stencil_t *
+cs_mesh_cartesian_get_stencil(const cs_mesh_t  *m);
+
+/*----------------------------------------------------------------------------*/
+/*! \brief Free the shared cartesian mesh stencil.
+ *
+ * This must be called when the mesh topology changes (before matrix
+ * structures are updated), and at the end of the computation.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_mesh_cartesian_stencil_free(void);
+
+/*----------------------------------------------------------------------------*/
+
+END_C_DECLS
+
 /*----------------------------------------------------------------------------*/
 
 #endif /* __CS_MESH_CARTESIAN_H__ */
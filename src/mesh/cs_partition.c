@@ -210,6 +210,13 @@ static int                       *_part_extra_partitions_list = NULL;
 
 static bool                       _part_uniform_sfc_block_size = false;
 
+/* Optional cell weights for next partitioning (with matching global
+   cell numbers, in initial distribution) */
+
+static cs_lnum_t                  _part_n_weighted_cells = 0;
+static cs_gnum_t                 *_part_cell_weight_gnum = NULL;
+static cs_real_t                 *_part_cell_weights = NULL;
+
 #if defined(WIN32) || defined(_WIN32)
 static const char _dir_separator = '\\';
 #else
@@ -269,6 +276,56 @@ _init_reduced_communicator(int  part_step)
 
 #endif /* defined(HAVE_MPI) */
 
+/*----------------------------------------------------------------------------
+ * Compute the load imbalance of a partition based on cell weights.
+ *
+ * parameters:
+ *   n_cells <-- local number of cells
+ *   n_parts <-- number of partitions
+ *   part    <-- cell partition number (0 to n-1)
+ *   weight  <-- cell weights
+ *
+ * returns:
+ *   ratio of the maximum to the mean sum of weights per partition
+ *----------------------------------------------------------------------------*/
+
+static double
+_part_weight_imbalance(cs_lnum_t        n_cells,
+                       int              n_parts,
+                       const int        part[],
+                       const cs_real_t  weight[])
+{
+  double *part_weight;
+  BFT_MALLOC(part_weight, n_parts, double);
+
+  for (int i = 0; i < n_parts; i++)
+    part_weight[i] = 0.;
+
+  for (cs_lnum_t j = 0; j < n_cells; j++)
+    part_weight[part[j]] += weight[j];
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, part_weight, n_parts, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+#endif
+
+  double w_sum = 0., w_max = 0.;
+  for (int i = 0; i < n_parts; i++) {
+    w_sum += part_weight[i];
+    if (part_weight[i] > w_max)
+      w_max = part_weight[i];
+  }
+
+  BFT_FREE(part_weight);
+
+  double retval = 1.;
+  if (w_sum > 0)
+    retval = w_max * n_parts / w_sum;
+
+  return retval;
+}
+
 /*----------------------------------------------------------------------------
  * Display the distribution of cells per partition in serial mode
  *
@@ -276,12 +333,14 @@ _init_reduced_communicator(int  part_step)
  *   cell_range <-- first and past-the-last cell numbers for this rank
  *   n_parts    <-- number of partitions
  *   part       <-- cell partition number
+ *   weight     <-- cell weights, or NULL
  *----------------------------------------------------------------------------*/
 
 static void
-_cell_part_histogram(cs_gnum_t   cell_range[2],
-                     int         n_parts,
-                     const   int part[])
+_cell_part_histogram(cs_gnum_t        cell_range[2],
+                     int              n_parts,
+                     const int        part[],
+                     const cs_real_t  weight[])
 {
   int i, k;
   size_t j;
@@ -380,8 +439,253 @@ _cell_part_histogram(cs_gnum_t   cell_range[2],
   }
 
   BFT_FREE(n_part_cells);
+
+  if (weight != NULL) {
+    double imbalance = _part_weight_imbalance(n_cells, n_parts, part, weight);
+    bft_printf(_("  Cell weight imbalance (max/mean): %.3f\n"), imbalance);
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Distribute cell weights defined by cs_partition_set_cell_weights()
+ * to a given block distribution.
+ *
+ * parameters:
+ *   n_g_cells <-- global number of cells
+ *   bi        <-- block distribution info for cells
+ *
+ * returns:
+ *   newly allocated cell weights for the local block, or NULL if
+ *   no weights are defined
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t *
+_cell_weights_to_block(cs_gnum_t             n_g_cells,
+                       cs_block_dist_info_t  bi)
+{
+  if (_part_cell_weight_gnum == NULL)
+    return NULL;
+
+  cs_real_t *block_weight = NULL;
+  cs_lnum_t n_block_cells = 0;
+  if (bi.gnum_range[1] > bi.gnum_range[0])
+    n_block_cells = bi.gnum_range[1] - bi.gnum_range[0];
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1) {
+    cs_all_to_all_t
+      *d = cs_all_to_all_create_from_block(_part_n_weighted_cells,
+                                           CS_ALL_TO_ALL_USE_DEST_ID,
+                                           _part_cell_weight_gnum,
+                                           bi,
+                                           cs_glob_mpi_comm);
+    if (cs_all_to_all_n_elts_dest(d) != n_block_cells)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Cell weights for partitioning do not match the mesh\n"
+                  "(%llu global cells)."), (unsigned long long)n_g_cells);
+    BFT_MALLOC(block_weight, n_block_cells, cs_real_t);
+    cs_all_to_all_copy_array(d,
+                             CS_REAL_TYPE,
+                             1,
+                             false,
+                             _part_cell_weights,
+                             block_weight);
+    cs_all_to_all_destroy(&d);
+  }
+#endif
+
+  if (cs_glob_n_ranks == 1) {
+    if ((cs_gnum_t)_part_n_weighted_cells != n_g_cells)
+      bft_error(__FILE__, __LINE__, 0,
+                _("Cell weights for partitioning do not match the mesh\n"
+                  "(%llu global cells)."), (unsigned long long)n_g_cells);
+    BFT_MALLOC(block_weight, n_block_cells, cs_real_t);
+    for (cs_lnum_t i = 0; i < _part_n_weighted_cells; i++)
+      block_weight[_part_cell_weight_gnum[i] - 1] = _part_cell_weights[i];
+  }
+
+  return block_weight;
+}
+
+/*----------------------------------------------------------------------------
+ * Define cell ranks so as to balance cell weights along a given ordering.
+ *
+ * Each rank is assigned a contiguous segment of cells (in the given
+ * order) whose cumulative weight is as close as possible to the mean
+ * weight per rank.
+ *
+ * parameters:
+ *   n_g_cells   <-- global number of cells
+ *   n_ranks     <-- number of ranks in partition
+ *   n_cells     <-- local number of cells
+ *   cell_order  <-- global cell position in ordering (1 to n)
+ *   cell_weight <-- cell weights
+ *   cell_rank   --> cell rank (0 to n-1)
+ *   comm        <-- associated MPI communicator
+ *----------------------------------------------------------------------------*/
+
+#if defined(HAVE_MPI)
+
+static void
+_cell_rank_by_weight(cs_gnum_t        n_g_cells,
+                     int              n_ranks,
+                     cs_lnum_t        n_cells,
+                     const cs_gnum_t  cell_order[],
+                     const cs_real_t  cell_weight[],
+                     int              cell_rank[],
+                     MPI_Comm         comm)
+
+#else
+
+static void
+_cell_rank_by_weight(cs_gnum_t        n_g_cells,
+                     int              n_ranks,
+                     cs_lnum_t        n_cells,
+                     const cs_gnum_t  cell_order[],
+                     const cs_real_t  cell_weight[],
+                     int              cell_rank[])
+
+#endif
+{
+  cs_lnum_t n_o_cells = n_cells;
+  cs_gnum_t o_gnum_start = 1;
+  cs_real_t *o_weight = NULL;
+
+  int comm_rank = 0, comm_size = 1;
+
+#if defined(HAVE_MPI)
+  if (comm != MPI_COMM_NULL) {
+    MPI_Comm_rank(comm, &comm_rank);
+    MPI_Comm_size(comm, &comm_size);
+  }
+#endif
+
+  /* Weights in ordered block distribution */
+
+#if defined(HAVE_MPI)
+  cs_all_to_all_t *d = NULL;
+  if (comm_size > 1) {
+    cs_block_dist_info_t bi = cs_block_dist_compute_sizes(comm_rank,
+                                                          comm_size,
+                                                          1,
+                                                          0,
+                                                          n_g_cells);
+    d = cs_all_to_all_create_from_block(n_cells,
+                                        CS_ALL_TO_ALL_USE_DEST_ID,
+                                        cell_order,
+                                        bi,
+                                        comm);
+    o_weight = cs_all_to_all_copy_array(d,
+                                        CS_REAL_TYPE,
+                                        1,
+                                        false,
+                                        cell_weight,
+                                        NULL);
+    n_o_cells = cs_all_to_all_n_elts_dest(d);
+    o_gnum_start = bi.gnum_range[0];
+  }
+#endif
+
+  if (comm_size == 1) {
+    BFT_MALLOC(o_weight, n_cells, cs_real_t);
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      o_weight[cell_order[i] - 1] = cell_weight[i];
+  }
+
+  /* Cumulative weights */
+
+  double w_sum = 0.;
+  for (cs_lnum_t i = 0; i < n_o_cells; i++)
+    w_sum += o_weight[i];
+
+  double w_shift = 0., w_tot = w_sum;
+
+#if defined(HAVE_MPI)
+  if (comm_size > 1) {
+    MPI_Exscan(&w_sum, &w_shift, 1, MPI_DOUBLE, MPI_SUM, comm);
+    if (comm_rank == 0)
+      w_shift = 0.;
+    MPI_Allreduce(&w_sum, &w_tot, 1, MPI_DOUBLE, MPI_SUM, comm);
+  }
+#endif
+
+  /* Assign ranks based on the position of each cell's mid-weight;
+     fall back to uniform distribution if weights are all zero */
+
+  int *o_rank;
+  BFT_MALLOC(o_rank, n_o_cells, int);
+
+  if (w_tot > 0) {
+    double w = w_shift;
+    for (cs_lnum_t i = 0; i < n_o_cells; i++) {
+      int r = (int)((w + 0.5*o_weight[i]) * n_ranks / w_tot);
+      o_rank[i] = CS_MIN(r, n_ranks - 1);
+      w += o_weight[i];
+    }
+  }
+  else {
+    for (cs_lnum_t i = 0; i < n_o_cells; i++)
+      o_rank[i] = ((o_gnum_start + i - 1) * n_ranks) / n_g_cells;
+  }
+
+  BFT_FREE(o_weight);
+
+  /* Return ranks to initial distribution */
+
+#if defined(HAVE_MPI)
+  if (d != NULL) {
+    cs_all_to_all_copy_array(d,
+                             CS_INT_TYPE,
+                             1,
+                             true,  /* reverse */
+                             o_rank,
+                             cell_rank);
+    cs_all_to_all_destroy(&d);
+  }
+#endif
+
+  if (comm_size == 1) {
+    for (cs_lnum_t i = 0; i < n_cells; i++)
+      cell_rank[i] = o_rank[cell_order[i] - 1];
+  }
+
+  BFT_FREE(o_rank);
+}
+
+#if   defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
+   || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+
+/*----------------------------------------------------------------------------
+ * Scale cell weights to the integer range [1, 1000] used for graph-based
+ * partitioning.
+ *
+ * parameters:
+ *   n_cells     <-- local number of cells
+ *   cell_weight <-> cell weights
+ *----------------------------------------------------------------------------*/
+
+static void
+_scale_cell_weights(cs_lnum_t   n_cells,
+                    cs_real_t   cell_weight[])
+{
+  double w_max = 0.;
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    w_max = CS_MAX(w_max, cell_weight[i]);
+
+#if defined(HAVE_MPI)
+  if (cs_glob_n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, &w_max, 1, MPI_DOUBLE, MPI_MAX,
+                  cs_glob_mpi_comm);
+#endif
+
+  double scale = (w_max > 0) ? 1000. / w_max : 1.;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_weight[i] = CS_MAX(floor(cell_weight[i]*scale + 0.5), 1.);
 }
 
+#endif
+
 #if defined(HAVE_MPI)
 
 /*----------------------------------------------------------------------------
@@ -944,6 +1248,7 @@ _precompute_cell_center_l(const cs_mesh_builder_t  *mb,
  *   n_ranks     <-- number of ranks in partition
  *   mb          <-- pointer to mesh builder helper structure
  *   sfc_type    <-- type of space-filling curve
+ *   cell_weight <-- cell weights, or NULL
  *   cell_rank   --> cell rank (1 to n numbering)
  *   comm        <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
@@ -955,6 +1260,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const cs_real_t           cell_weight[],
                   int                       cell_rank[],
                   MPI_Comm                  comm)
 
@@ -965,6 +1271,7 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
                   int                       n_ranks,
                   const cs_mesh_builder_t  *mb,
                   fvm_io_num_sfc_t          sfc_type,
+                  const cs_real_t           cell_weight[],
                   int                       cell_rank[])
 
 #endif
@@ -1019,7 +1326,26 @@ _cell_rank_by_sfc(cs_gnum_t                 n_g_cells,
 
   /* Determine rank based on global numbering with SFC ordering; */
 
-  if (_part_uniform_sfc_block_size == false) {
+  if (cell_weight != NULL) {
+#if defined(HAVE_MPI)
+    _cell_rank_by_weight(n_g_cells,
+                         n_ranks,
+                         n_cells,
+                         cell_num,
+                         cell_weight,
+                         cell_rank,
+                         comm);
+#else
+    _cell_rank_by_weight(n_g_cells,
+                         n_ranks,
+                         n_cells,
+                         cell_num,
+                         cell_weight,
+                         cell_rank);
+#endif
+  }
+
+  else if (_part_uniform_sfc_block_size == false) {
 
     cs_gnum_t cells_per_rank = n_g_cells / n_ranks;
     cs_lnum_t rmdr = n_g_cells - cells_per_rank * (cs_gnum_t)n_ranks;
@@ -1364,19 +1690,23 @@ _metis_cell_cells(size_t       n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights (integer values), or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
 static void
-_part_metis(size_t   n_cells,
-            int      n_parts,
-            idx_t   *cell_idx,
-            idx_t   *cell_neighbors,
-            int     *cell_part)
+_part_metis(size_t            n_cells,
+            int               n_parts,
+            idx_t            *cell_idx,
+            idx_t            *cell_neighbors,
+            const cs_real_t  *cell_weight,
+            int              *cell_part)
 {
   size_t i;
   double  start_time, end_time;
 
+  idx_t  *vwgt = NULL;
+
   idx_t   _n_constraints = 1;
 
   idx_t    edgecut    = 0; /* <-- Number of faces on partition */
@@ -1393,6 +1723,12 @@ _part_metis(size_t   n_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, idx_t);
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(vwgt, n_cells, idx_t);
+    for (i = 0; i < n_cells; i++)
+      vwgt[i] = cell_weight[i];
+  }
+
   if (n_parts < 8) {
 
     bft_printf(_("\n"
@@ -1404,7 +1740,7 @@ _part_metis(size_t   n_cells,
                              &_n_constraints,
                              cell_idx,
                              cell_neighbors,
-                             NULL,       /* vwgt:   cell weights */
+                             vwgt,       /* vwgt:   cell weights */
                              NULL,       /* vsize:  size of the vertices */
                              NULL,       /* adjwgt: face weights */
                              &_n_parts,
@@ -1427,7 +1763,7 @@ _part_metis(size_t   n_cells,
                         &_n_constraints,
                         cell_idx,
                         cell_neighbors,
-                        NULL,       /* vwgt:   cell weights */
+                        vwgt,       /* vwgt:   cell weights */
                         NULL,       /* vsize:  size of the vertices */
                         NULL,       /* adjwgt: face weights */
                         &_n_parts,
@@ -1441,6 +1777,8 @@ _part_metis(size_t   n_cells,
 
   end_time = cs_timer_wtime();
 
+  BFT_FREE(vwgt);
+
   bft_printf(_("\n"
                "  Total number of faces on parallel boundaries: %llu\n"
                "  wall-clock time: %f s\n\n"),
@@ -1471,18 +1809,20 @@ _part_metis(size_t   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights (integer values), or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
 
 static void
-_part_parmetis(cs_gnum_t   n_g_cells,
-               cs_gnum_t   cell_range[2],
-               int         n_parts,
-               idx_t      *cell_idx,
-               idx_t      *cell_neighbors,
-               int        *cell_part,
-               MPI_Comm    comm)
+_part_parmetis(cs_gnum_t         n_g_cells,
+               cs_gnum_t         cell_range[2],
+               int               n_parts,
+               idx_t            *cell_idx,
+               idx_t            *cell_neighbors,
+               const cs_real_t  *cell_weight,
+               int              *cell_part,
+               MPI_Comm          comm)
 {
   size_t i;
   double  start_time, end_time;
@@ -1542,6 +1882,14 @@ _part_parmetis(cs_gnum_t   n_g_cells,
     idx_t  options[3] = {0, 1, 15}; /* By default if options[0] = 0 */
     idx_t  numflag  = 0; /* 0 to n-1 numbering (C type) */
     idx_t  wgtflag  = 0; /* No weighting for faces or cells */
+    idx_t  *vwgt    = NULL;
+
+    if (cell_weight != NULL) {
+      wgtflag = 2; /* Weights on cells only */
+      BFT_MALLOC(vwgt, n_cells, idx_t);
+      for (i = 0; i < n_cells; i++)
+        vwgt[i] = cell_weight[i];
+    }
 
     real_t wgt = 1.0/n_parts;
     real_t ubvec[]  = {1.5};
@@ -1556,7 +1904,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                    (vtxdist,
                     cell_idx,
                     cell_neighbors,
-                    NULL,       /* vwgt:   cell weights */
+                    vwgt,       /* vwgt:   cell weights */
                     NULL,       /* adjwgt: face weights */
                     &wgtflag,
                     &numflag,
@@ -1570,6 +1918,7 @@ _part_parmetis(cs_gnum_t   n_g_cells,
                     &comm);
 
     BFT_FREE(tpwgts);
+    BFT_FREE(vwgt);
 
     edgecut = _edgecut;
 
@@ -1865,15 +2214,17 @@ _scotch_cell_cells(size_t        n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights (integer values), or NULL
  *   cell_part     --> cell partition
  *----------------------------------------------------------------------------*/
 
 static void
-_part_scotch(SCOTCH_Num   n_cells,
-             int          n_parts,
-             SCOTCH_Num  *cell_idx,
-             SCOTCH_Num  *cell_neighbors,
-             int         *cell_part)
+_part_scotch(SCOTCH_Num        n_cells,
+             int               n_parts,
+             SCOTCH_Num       *cell_idx,
+             SCOTCH_Num       *cell_neighbors,
+             const cs_real_t  *cell_weight,
+             int              *cell_part)
 {
   SCOTCH_Num  i;
   SCOTCH_Graph  grafdat;  /* Scotch graph object to interface with libScotch */
@@ -1885,6 +2236,7 @@ _part_scotch(SCOTCH_Num   n_cells,
 
   SCOTCH_Num    edgecut = 0; /* <-- Number of faces on partition */
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *velotab = NULL;
 
   /* Initialization */
 
@@ -1895,6 +2247,12 @@ _part_scotch(SCOTCH_Num   n_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, SCOTCH_Num);
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(velotab, n_cells, SCOTCH_Num);
+    for (i = 0; i < n_cells; i++)
+      velotab[i] = cell_weight[i];
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains\n"
                "   (SCOTCH_graphPart).\n"),
@@ -1910,7 +2268,7 @@ _part_scotch(SCOTCH_Num   n_cells,
                         n_cells,            /* vertnbr */
                         cell_idx,           /* verttab */
                         NULL,               /* vendtab: verttab + 1 or NULL */
-                        NULL,               /* velotab: vertex weights */
+                        velotab,            /* velotab: vertex weights */
                         NULL,               /* vlbltab; vertex labels */
                         cell_idx[n_cells],  /* edgenbr */
                         cell_neighbors,     /* edgetab */
@@ -1928,6 +2286,8 @@ _part_scotch(SCOTCH_Num   n_cells,
 
   SCOTCH_graphExit(&grafdat);
 
+  BFT_FREE(velotab);
+
   /* Free possible temporary */
 
   if (sizeof(SCOTCH_Num) != sizeof(int)) {
@@ -1986,18 +2346,20 @@ _part_scotch(SCOTCH_Num   n_cells,
  *   n_parts       <-- number of partitions
  *   cell_cell_idx <-- cell->cells index
  *   cell_cell     <-- cell->cells connectivity
+ *   cell_weight   <-- cell weights (integer values), or NULL
  *   cell_part     --> cell partition
  *   comm          <-- associated MPI communicator
  *----------------------------------------------------------------------------*/
 
 static void
-_part_ptscotch(cs_gnum_t    n_g_cells,
-               cs_gnum_t    cell_range[2],
-               int          n_parts,
-               SCOTCH_Num  *cell_idx,
-               SCOTCH_Num  *cell_neighbors,
-               int         *cell_part,
-               MPI_Comm     comm)
+_part_ptscotch(cs_gnum_t         n_g_cells,
+               cs_gnum_t         cell_range[2],
+               int               n_parts,
+               SCOTCH_Num       *cell_idx,
+               SCOTCH_Num       *cell_neighbors,
+               const cs_real_t  *cell_weight,
+               int              *cell_part,
+               MPI_Comm          comm)
 {
   int  n_ranks;
   SCOTCH_Dgraph  grafdat;  /* Scotch graph object to interface with libScotch */
@@ -2009,6 +2371,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
   SCOTCH_Num    n_cells = cell_range[1] - cell_range[0];
   SCOTCH_Num  *_cell_part = NULL;
+  SCOTCH_Num  *veloloctab = NULL;
 
   /* Initialization */
 
@@ -2021,6 +2384,12 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
   else
     BFT_MALLOC(_cell_part, n_cells, SCOTCH_Num);
 
+  if (cell_weight != NULL) {
+    BFT_MALLOC(veloloctab, n_cells, SCOTCH_Num);
+    for (SCOTCH_Num i = 0; i < n_cells; i++)
+      veloloctab[i] = cell_weight[i];
+  }
+
   bft_printf(_("\n"
                " Partitioning %llu cells to %d domains on %d ranks\n"
                "   (SCOTCH_dgraphPart).\n"),
@@ -2038,7 +2407,7 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
                 n_cells,            /* vertlocmax (= vertlocnbr) */
                 cell_idx,           /* vertloctab */
                 NULL,               /* vendloctab: vertloctab + 1 or NULL */
-                NULL,               /* veloloctab: vertex weights */
+                veloloctab,         /* veloloctab: vertex weights */
                 NULL,               /* vlblloctab; vertex labels */
                 cell_idx[n_cells],  /* edgelocnbr */
                 cell_idx[n_cells],  /* edgelocsiz */
@@ -2089,6 +2458,8 @@ _part_ptscotch(cs_gnum_t    n_g_cells,
 
   SCOTCH_dgraphExit(&grafdat);
 
+  BFT_FREE(veloloctab);
+
   /* Shift cell_part values to 1 to n numbering and free possible temporary */
 
   if (sizeof(SCOTCH_Num) != sizeof(int)) {
@@ -2675,14 +3046,16 @@ _read_cell_rank(cs_mesh_t          *mesh,
  * Define a naive partitioning by blocks.
  *
  * parameters:
- *   mesh      <-- pointer to mesh structure
- *   mb        <-- pointer to mesh builder structure
- *   cell_part --> assigned cell partition
+ *   mesh        <-- pointer to mesh structure
+ *   mb          <-- pointer to mesh builder structure
+ *   cell_weight <-- cell weights, or NULL
+ *   cell_part   --> assigned cell partition
  *----------------------------------------------------------------------------*/
 
 static void
 _block_partititioning(const cs_mesh_t          *mesh,
                       const cs_mesh_builder_t  *mb,
+                      const cs_real_t           cell_weight[],
                       int                      *cell_part)
 {
   cs_lnum_t i;
@@ -2691,6 +3064,33 @@ _block_partititioning(const cs_mesh_t          *mesh,
   cs_lnum_t block_size = mesh->n_g_cells / n_ranks;
   cs_lnum_t n_cells = mb->cell_bi.gnum_range[1] - mb->cell_bi.gnum_range[0];
 
+  /* With weights, cut blocks so as to balance weights */
+
+  if (cell_weight != NULL) {
+    cs_gnum_t *cell_num;
+    BFT_MALLOC(cell_num, n_cells, cs_gnum_t);
+    for (i = 0; i < n_cells; i++)
+      cell_num[i] = mb->cell_bi.gnum_range[0] + i;
+#if defined(HAVE_MPI)
+    _cell_rank_by_weight(mesh->n_g_cells,
+                         n_ranks,
+                         n_cells,
+                         cell_num,
+                         cell_weight,
+                         cell_part,
+                         cs_glob_mpi_comm);
+#else
+    _cell_rank_by_weight(mesh->n_g_cells,
+                         n_ranks,
+                         n_cells,
+                         cell_num,
+                         cell_weight,
+                         cell_part);
+#endif
+    BFT_FREE(cell_num);
+    return;
+  }
+
   if (mesh->n_g_cells % n_ranks)
     block_size += 1;
 
@@ -3098,6 +3498,217 @@ cs_partition_add_partitions(int  n_extra_partitions,
            sizeof(int)*n_extra_partitions);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Define cell weights for the next partitioning.
+ *
+ * Weights represent the expected computational cost of each cell
+ * (for example, based on measured timings, the number of Lagrangian
+ * particles per cell, or the cost of chemistry). When defined, the
+ * partitioning algorithms balance the sum of cell weights rather than
+ * the number of cells per rank. Weights are used by the next call to
+ * \ref cs_partition only.
+ *
+ * Partitioning is done when the mesh is read, so this function should be
+ * called before that stage, typically from \ref cs_user_partition.
+ * Cells are identified by their global number in the mesh input,
+ * which for a mesh output by a previous run is the global cell number
+ * of that run. Each cell must be defined exactly once over all ranks,
+ * so weights may for example be read on a single rank.
+ *
+ * During a computation, \ref cs_partition_write_weighted should be
+ * used instead, the new partitioning being applied at restart.
+ *
+ * \param[in]  n_cells    number of cells defined on this rank
+ * \param[in]  cell_gnum  global number (1 to n) of each cell, or NULL
+ *                        for cells 1 to n_cells
+ * \param[in]  weights    weight of each cell, or NULL to unset weights
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(cs_lnum_t         n_cells,
+                              const cs_gnum_t   cell_gnum[],
+                              const cs_real_t   weights[])
+{
+  BFT_FREE(_part_cell_weight_gnum);
+  BFT_FREE(_part_cell_weights);
+  _part_n_weighted_cells = 0;
+
+  if (weights == NULL)
+    return;
+
+  _part_n_weighted_cells = n_cells;
+  BFT_MALLOC(_part_cell_weight_gnum, n_cells, cs_gnum_t);
+  BFT_MALLOC(_part_cell_weights, n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++) {
+    _part_cell_weight_gnum[i]
+      = (cell_gnum != NULL) ? cell_gnum[i] : (cs_gnum_t)(i+1);
+    _part_cell_weights[i] = weights[i];
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Compute a partitioning of the current mesh balancing given cell
+ *        weights, and write it for subsequent runs if the current load
+ *        imbalance exceeds a given threshold.
+ *
+ * This allows rebalancing a computation whose cost distribution evolves
+ * (due to moving particles or flames for example): checkpoint files
+ * being independent of the partitioning, restarting from a checkpoint
+ * using the partitioning written to
+ * "partition_output/domain_number_<n_ranks>" migrates all
+ * computational data to the new distribution.
+ *
+ * Partitioning uses the space-filling curve selected for the main
+ * partitioning stage, or a Morton curve in the mesh bounding box
+ * if another algorithm is selected, so it is cheap enough to be
+ * called during a computation. This is a collective operation.
+ *
+ * \param[in]  mesh       pointer to mesh structure
+ * \param[in]  cell_cen   cell centers (size: 3*n_cells)
+ * \param[in]  weights    weight of each local cell (size: n_cells)
+ * \param[in]  threshold  imbalance (max/mean) above which the new
+ *                        partitioning is written
+ *
+ * \return  load imbalance of the current partitioning (ratio of the
+ *          maximum to the mean sum of weights per rank)
+ */
+/*----------------------------------------------------------------------------*/
+
+double
+cs_partition_write_weighted(const cs_mesh_t  *mesh,
+                            const cs_real_t   cell_cen[],
+                            const cs_real_t   weights[],
+                            double            threshold)
+{
+  const int n_ranks = cs_glob_n_ranks;
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  /* Current imbalance */
+
+  int *cell_rank;
+  BFT_MALLOC(cell_rank, n_cells, int);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    cell_rank[i] = CS_MAX(cs_glob_rank_id, 0);
+
+  double imbalance = _part_weight_imbalance(n_cells, n_ranks,
+                                            cell_rank, weights);
+
+  bft_printf(_("\n Cell weight imbalance (max/mean): %.3f\n"), imbalance);
+
+  if (n_ranks < 2 || imbalance <= threshold) {
+    BFT_FREE(cell_rank);
+    return imbalance;
+  }
+
+  cs_timer_t t0 = cs_timer_time();
+
+  /* Order cells along space-filling curve and cut by weight */
+
+  fvm_io_num_sfc_t sfc_type = FVM_IO_NUM_SFC_MORTON_BOX;
+  cs_partition_algorithm_t a = _part_algorithm[CS_PARTITION_MAIN];
+  if (   a >= CS_PARTITION_SFC_MORTON_BOX
+      && a <= CS_PARTITION_SFC_HILBERT_CUBE)
+    sfc_type = a - CS_PARTITION_SFC_MORTON_BOX;
+
+  bft_printf(_(" Repartitioning by weighted space-filling curve: %s.\n"),
+             _(fvm_io_num_sfc_type_name[sfc_type]));
+
+  fvm_io_num_t *cell_io_num
+    = fvm_io_num_create_from_sfc((const cs_coord_t *)cell_cen,
+                                 3,
+                                 n_cells,
+                                 sfc_type);
+
+#if defined(HAVE_MPI)
+  _cell_rank_by_weight(mesh->n_g_cells,
+                       n_ranks,
+                       n_cells,
+                       fvm_io_num_get_global_num(cell_io_num),
+                       weights,
+                       cell_rank,
+                       cs_glob_mpi_comm);
+#else
+  _cell_rank_by_weight(mesh->n_g_cells,
+                       n_ranks,
+                       n_cells,
+                       fvm_io_num_get_global_num(cell_io_num),
+                       weights,
+                       cell_rank);
+#endif
+
+  cell_io_num = fvm_io_num_destroy(cell_io_num);
+
+  double new_imbalance = _part_weight_imbalance(n_cells, n_ranks,
+                                                cell_rank, weights);
+
+  bft_printf(_(" Expected cell weight imbalance:   %.3f\n"), new_imbalance);
+
+  /* Transfer to block distribution by global cell number and write */
+
+  cs_block_dist_info_t bi = cs_block_dist_compute_sizes(cs_glob_rank_id,
+                                                        n_ranks,
+                                                        1,
+                                                        0,
+                                                        mesh->n_g_cells);
+
+  cs_lnum_t n_block_cells = bi.gnum_range[1] - bi.gnum_range[0];
+  int *block_rank = NULL;
+  BFT_MALLOC(block_rank, n_block_cells, int);
+
+#if defined(HAVE_MPI)
+  {
+    cs_gnum_t *cell_gnum = NULL;
+    const cs_gnum_t *_cell_gnum = mesh->global_cell_num;
+    if (_cell_gnum == NULL) {
+      BFT_MALLOC(cell_gnum, n_cells, cs_gnum_t);
+      for (cs_lnum_t i = 0; i < n_cells; i++)
+        cell_gnum[i] = i+1;
+      _cell_gnum = cell_gnum;
+    }
+
+    cs_all_to_all_t
+      *d = cs_all_to_all_create_from_block(n_cells,
+                                           CS_ALL_TO_ALL_USE_DEST_ID,
+                                           _cell_gnum,
+                                           bi,
+                                           cs_glob_mpi_comm);
+    cs_all_to_all_copy_array(d,
+                             CS_INT_TYPE,
+                             1,
+                             false,
+                             cell_rank,
+                             block_rank);
+    cs_all_to_all_destroy(&d);
+
+    BFT_FREE(cell_gnum);
+  }
+#endif
+
+  BFT_FREE(cell_rank);
+
+  _write_output(mesh->n_g_cells, bi.gnum_range, n_ranks, block_rank);
+
+  BFT_FREE(block_rank);
+
+  cs_timer_t t1 = cs_timer_time();
+  cs_timer_counter_t dt = cs_timer_diff(&t0, &t1);
+
+  cs_log_printf(CS_LOG_PERFORMANCE,
+                _("\n"
+                  "Weighted repartitioning:\n\n"
+                  "  imbalance before:           %.3f\n"
+                  "  expected imbalance:         %.3f\n"
+                  "  wall clock time:            %.3g s\n"),
+                imbalance, new_imbalance, (double)(dt.nsec)/1.e9);
+
+  return imbalance;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Partition mesh based on current options.
@@ -3129,6 +3740,9 @@ cs_partition(cs_mesh_t             *mesh,
   cs_lnum_t  n_faces = 0;
   cs_gnum_t  *face_cells = NULL;
 
+  cs_real_t  *cell_weight = NULL;   /* weights in partitioning distribution */
+  cs_real_t  *block_weight = NULL;  /* weights in builder distribution */
+
   /* Initialize local options */
 
   if (stage == CS_PARTITION_MAIN) {
@@ -3157,13 +3771,16 @@ cs_partition(cs_mesh_t             *mesh,
       _read_cell_rank(mesh, mb, CS_IO_ECHO_OPEN_CLOSE);
       if (mb->have_cell_rank) {
         cs_partition_set_preprocess(false);
+        cs_partition_set_cell_weights(0, NULL, NULL);
         return;
       }
     }
   }
   else { /* if (cs_glob_n_ranks == 1) */
-    if (stage != CS_PARTITION_MAIN || n_extra_partitions < 1)
+    if (stage != CS_PARTITION_MAIN || n_extra_partitions < 1) {
+      cs_partition_set_cell_weights(0, NULL, NULL);
       return;
+    }
   }
 
   (void)cs_timer_wtime();
@@ -3202,6 +3819,33 @@ cs_partition(cs_mesh_t             *mesh,
 
   }
 
+  /* Distribute optional cell weights */
+
+  block_weight = _cell_weights_to_block(mesh->n_g_cells, mb->cell_bi);
+
+  if (block_weight != NULL) {
+
+    bft_printf(_("\n Partitioning based on cell weights.\n"));
+
+#if   defined(HAVE_METIS) || defined(HAVE_PARMETIS) \
+   || defined(HAVE_SCOTCH) || defined(HAVE_PTSCOTCH)
+    if (   _algorithm == CS_PARTITION_METIS
+        || _algorithm == CS_PARTITION_SCOTCH) {
+      cs_block_dist_info_t bi
+        = cs_block_dist_compute_sizes(CS_MAX(cs_glob_rank_id, 0),
+                                      cs_glob_n_ranks,
+                                      _part_rank_step[stage],
+                                      0,
+                                      mesh->n_g_cells);
+      cell_weight = _cell_weights_to_block(mesh->n_g_cells, bi);
+      _scale_cell_weights(n_cells, cell_weight);
+    }
+    else
+#endif
+      cell_weight = block_weight;
+
+  }
+
   /* Build and partition graph */
 
 #if defined(HAVE_METIS) || defined(HAVE_PARMETIS)
@@ -3261,6 +3905,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3269,7 +3914,8 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
-        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
+        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                           block_weight);
 
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
@@ -3308,6 +3954,7 @@ cs_partition(cs_mesh_t             *mesh,
                       n_ranks,
                       cell_idx,
                       cell_neighbors,
+                      cell_weight,
                       cell_part);
 
         _distribute_output(mb,
@@ -3315,7 +3962,8 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
-        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
+        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                           block_weight);
 
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
@@ -3388,6 +4036,7 @@ cs_partition(cs_mesh_t             *mesh,
                          n_ranks,
                          cell_idx,
                          cell_neighbors,
+                         cell_weight,
                          cell_part,
                          part_comm);
 
@@ -3396,7 +4045,8 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
-        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
+        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                           block_weight);
 
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
@@ -3435,6 +4085,7 @@ cs_partition(cs_mesh_t             *mesh,
                        n_ranks,
                        cell_idx,
                        cell_neighbors,
+                       cell_weight,
                        cell_part);
 
         _distribute_output(mb,
@@ -3442,7 +4093,8 @@ cs_partition(cs_mesh_t             *mesh,
                            cell_range,
                            &cell_part);
 
-        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
+        _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                           block_weight);
 
         if (write_output || i < n_extra_partitions)
           _write_output(mesh->n_g_cells,
@@ -3486,13 +4138,16 @@ cs_partition(cs_mesh_t             *mesh,
                         n_ranks,
                         mb,
                         sfc_type,
+                        cell_weight,
                         cell_part,
                         cs_glob_mpi_comm);
 #else
-      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type, cell_part);
+      _cell_rank_by_sfc(mesh->n_g_cells, n_ranks, mb, sfc_type,
+                        cell_weight, cell_part);
 #endif
 
-      _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part);
+      _cell_part_histogram(mb->cell_bi.gnum_range, n_ranks, cell_part,
+                           block_weight);
 
       if (write_output || i < n_extra_partitions)
         _write_output(mesh->n_g_cells,
@@ -3509,10 +4164,18 @@ cs_partition(cs_mesh_t             *mesh,
 
     BFT_MALLOC(cell_part, n_cells, int);
 
-    _block_partititioning(mesh, mb, cell_part);
+    _block_partititioning(mesh, mb, cell_weight, cell_part);
 
   }
 
+  /* Free weights, which are used for one partitioning only */
+
+  if (cell_weight != block_weight)
+    BFT_FREE(cell_weight);
+  BFT_FREE(block_weight);
+
+  cs_partition_set_cell_weights(0, NULL, NULL);
+
   /* Reset extra partitions list if used */
 
   if (n_extra_partitions > 0) {
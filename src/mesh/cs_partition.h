@@ -228,6 +228,73 @@ void
 cs_partition_add_partitions(int  n_extra_partitions,
                             int  extra_partitions_list[]);
 
+/*----------------------------------------------------------------------------
+ * Define cell weights for the next partitioning.
+ *
+ * Weights represent the expected computational cost of each cell
+ * (for example, based on measured timings, the number of Lagrangian
+ * particles per cell, or the cost of chemistry). When defined, the
+ * partitioning algorithms balance the sum of cell weights rather than
+ * the number of cells per rank. Weights are used by the next call to
+ * cs_partition() only.
+ *
+ * Partitioning is done when the mesh is read, so this function should be
+ * called before that stage, typically from cs_user_partition().
+ * Cells are identified by their global number in the mesh input,
+ * which for a mesh output by a previous run is the global cell number
+ * of that run. Each cell must be defined exactly once over all ranks,
+ * so weights may for example be read on a single rank.
+ *
+ * During a computation, cs_partition_write_weighted() should be
+ * used instead, the new partitioning being applied at restart.
+ *
+ * parameters:
+ *   n_cells   <-- number of cells defined on this rank
+ *   cell_gnum <-- global number (1 to n) of each cell, or NULL
+ *                 for cells 1 to n_cells
+ *   weights   <-- weight of each cell, or NULL to unset weights
+ *----------------------------------------------------------------------------*/
+
+void
+cs_partition_set_cell_weights(cs_lnum_t         n_cells,
+                              const cs_gnum_t   cell_gnum[],
+                              const cs_real_t   weights[]);
+
+/*----------------------------------------------------------------------------
+ * Compute a partitioning of the current mesh balancing given cell weights,
+ * and write it for subsequent runs if the current load imbalance exceeds
+ * a given threshold.
+ *
+ * This allows rebalancing a computation whose cost distribution evolves
+ * (due to moving particles or flames for example): checkpoint files
+ * being independent of the partitioning, restarting from a checkpoint
+ * using the partitioning written to
+ * "partition_output/domain_number_<n_ranks>" migrates all
+ * computational data to the new distribution.
+ *
+ * Partitioning uses the space-filling curve selected for the main
+ * partitioning stage, or a Morton curve in the mesh bounding box
+ * if another algorithm is selected, so it is cheap enough to be
+ * called during a computation. This is a collective operation.
+ *
+ * parameters:
+ *   mesh      <-- pointer to mesh structure
+ *   cell_cen  <-- cell centers (size: 3*n_cells)
+ *   weights   <-- weight of each local cell (size: n_cells)
+ *   threshold <-- imbalance (max/mean) above which the new
+ *                 partitioning is written
+ *
+ * returns:
+ *   load imbalance of the current partitioning (ratio of the maximum
+ *   to the mean sum of weights per rank)
+ *----------------------------------------------------------------------------*/
+
+double
+cs_partition_write_weighted(const cs_mesh_t  *mesh,
+                            const cs_real_t   cell_cen[],
+                            const cs_real_t   weights[],
+                            double            threshold);
+
 /*----------------------------------------------------------------------------
  * Compute partitioning for a given mesh.
  *
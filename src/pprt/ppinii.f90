@@ -778,6 +778,9 @@ nbchim = 0
 nbchmz = 0
 nespgi = 0
 dtchemmax = 10.d0
+iadaptchemistry = 0
+rtolchem = 1.d-3
+atolchem = 1.d-6
 do izone = 1, nozppm
   iprofc(izone) = 0
 enddo
@@ -58,6 +58,8 @@
 #include "cs_sles_it.h"
 #include "cs_timer.h"
 
+#include "cs_rad_transfer_solve.h"
+
 /*----------------------------------------------------------------------------
  *  Header for the current file
  *----------------------------------------------------------------------------*/
@@ -247,6 +249,7 @@ cs_rad_transfer_params_t _rt_params = {
   .atmo_ir_id = -1,
   .dispersion = false,
   .dispersion_coeff = 1.,
+  .dom_sweep = false,
   .time_control = {
     .type = CS_TIME_CONTROL_TIME_STEP,
     .at_start = false,
@@ -318,6 +321,8 @@ cs_rad_transfer_finalize(void)
   BFT_FREE(_rt_params.vect_s);
   BFT_FREE(_rt_params.angsol);
   BFT_FREE(_rt_params.wq);
+
+  cs_rad_transfer_dom_sweep_finalize();
 }
 
 /*----------------------------------------------------------------------------*/
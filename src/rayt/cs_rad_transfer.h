@@ -181,6 +181,11 @@ typedef struct {
                                        with point source) test case; the default
                                        value of 1 already improves precision in
                                        both cases. */
+  bool          dom_sweep;           /*!< solve DOM radiances by upwind sweeps
+                                       over the directions of each octant
+                                       rather than with iterative linear
+                                       solvers (ignored with dispersion or
+                                       atmospheric models) */
 
   cs_time_control_t  time_control;   /* Time control for radiation updates */
 
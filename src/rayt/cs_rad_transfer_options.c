@@ -361,6 +361,10 @@ cs_rad_transfer_log_setup(void)
         (CS_LOG_SETUP,
          _("    ndirec:       %d\n"),
          cs_glob_rad_transfer_params->ndirec);
+    cs_log_printf
+      (CS_LOG_SETUP,
+       _("    dom_sweep:     %s\n"),
+       cs_glob_rad_transfer_params->dom_sweep ? "true" : "false");
   }
 
   const char *imodak_value_str[]
@@ -56,11 +56,13 @@
 #include "cs_field.h"
 #include "cs_field_pointer.h"
 #include "cs_gui_util.h"
+#include "cs_halo.h"
 #include "cs_ht_convert.h"
 #include "cs_internal_coupling.h"
 #include "cs_log.h"
 #include "cs_math.h"
 #include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
 #include "cs_parall.h"
 #include "cs_parameters.h"
 #include "cs_parameters_check.h"
@@ -109,6 +111,38 @@ static int ipadom = 0;
  * Local type definitions
  *============================================================================*/
 
+/* Upwind sweep ordering for a set of directions (usually an octant) */
+
+typedef struct {
+
+  int           n_dirs;       /* number of directions */
+  cs_real_3_t  *vect_s;       /* associated directions */
+
+  cs_lnum_t     n_forced;     /* number of cells forced to break cycles,
+                                 over all directions */
+
+  cs_lnum_t    *n_levels;     /* number of levels of each direction */
+  cs_lnum_t    *order;        /* cell ids ordered by level for each
+                                 direction (size: n_dirs*n_cells) */
+  cs_lnum_t    *level_shift;  /* start of each direction's levels
+                                 in level_idx (size: n_dirs + 1) */
+  cs_lnum_t    *level_idx;    /* levels index in order */
+
+} _dom_sweep_order_t;
+
+/*============================================================================
+ * Static global variables
+ *============================================================================*/
+
+/* Cells to interior faces adjacency and sweep orderings, which depend
+   only on the mesh and directions, are kept from one call to the next */
+
+static cs_lnum_t  *_sweep_c2f_idx = NULL;
+static cs_lnum_t  *_sweep_c2f = NULL;
+
+static int                  _n_sweep_orders = 0;
+static _dom_sweep_order_t  *_sweep_orders = NULL;
+
 /*============================================================================
  * Public function definitions for fortran API
  *============================================================================*/
@@ -299,6 +333,362 @@ _order_by_direction(void)
   BFT_FREE(s);
 }
 
+/*----------------------------------------------------------------------------
+ * Build the cells to interior faces connectivity used by DOM sweeps.
+ *
+ * Faces adjacent to each cell are listed by increasing id; ghost cells
+ * are not included.
+ *
+ * parameters:
+ *   m       <-- pointer to mesh structure
+ *   c2f_idx --> cells to interior faces index (size: n_cells + 1)
+ *   c2f     --> cells to interior faces adjacency
+ *----------------------------------------------------------------------------*/
+
+static void
+_dom_sweep_cell_i_faces(const cs_mesh_t   *m,
+                        cs_lnum_t        **c2f_idx,
+                        cs_lnum_t        **c2f)
+{
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  cs_lnum_t *_c2f_idx, *_c2f, *c_count;
+
+  BFT_MALLOC(_c2f_idx, n_cells + 1, cs_lnum_t);
+  BFT_MALLOC(c_count, n_cells, cs_lnum_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    c_count[c_id] = 0;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = i_face_cells[f_id][k];
+      if (c_id < n_cells)
+        c_count[c_id] += 1;
+    }
+  }
+
+  _c2f_idx[0] = 0;
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    _c2f_idx[c_id+1] = _c2f_idx[c_id] + c_count[c_id];
+    c_count[c_id] = 0;
+  }
+
+  BFT_MALLOC(_c2f, _c2f_idx[n_cells], cs_lnum_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    for (int k = 0; k < 2; k++) {
+      cs_lnum_t c_id = i_face_cells[f_id][k];
+      if (c_id < n_cells) {
+        _c2f[_c2f_idx[c_id] + c_count[c_id]] = f_id;
+        c_count[c_id] += 1;
+      }
+    }
+  }
+
+  BFT_FREE(c_count);
+
+  *c2f_idx = _c2f_idx;
+  *c2f = _c2f;
+}
+
+/*----------------------------------------------------------------------------
+ * Build the upwind sweep order of local cells for a given direction.
+ *
+ * Cells are grouped in successive levels (wavefronts), so that each cell
+ * only depends on cells of previous levels or on ghost cells. When
+ * dependency cycles are present (which may happen with warped faces),
+ * a remaining cell is forced in a single-cell level, using lagged values
+ * for its unordered upstream neighbors, and ordering resumes from there.
+ *
+ * parameters:
+ *   n_cells       <-- number of local cells
+ *   c2f_idx       <-- cells to interior faces index
+ *   c2f           <-- cells to interior faces adjacency
+ *   i_face_cells  <-- interior faces to cells connectivity
+ *   i_face_normal <-- interior face normals
+ *   vect_s        <-- direction
+ *   n_up          --- work array (size: n_cells)
+ *   order         --> cell ids ordered by level (size: n_cells)
+ *   level_idx     --> levels index in order (size: n_cells + 1)
+ *   n_forced      --> number of cells forced to break cycles
+ *
+ * returns:
+ *   number of levels
+ *----------------------------------------------------------------------------*/
+
+static cs_lnum_t
+_dom_sweep_order(cs_lnum_t           n_cells,
+                 const cs_lnum_t     c2f_idx[],
+                 const cs_lnum_t     c2f[],
+                 const cs_lnum_2_t   i_face_cells[],
+                 const cs_real_3_t   i_face_normal[],
+                 const cs_real_t     vect_s[3],
+                 cs_lnum_t           n_up[],
+                 cs_lnum_t           order[],
+                 cs_lnum_t           level_idx[],
+                 cs_lnum_t          *n_forced)
+{
+  cs_lnum_t n_ordered = 0, n_levels = 0;
+
+  /* Count local upstream neighbors; cells with none start the sweep
+     (ordered cells are marked with n_up = -1) */
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    n_up[c_id] = 0;
+    for (cs_lnum_t j = c2f_idx[c_id]; j < c2f_idx[c_id+1]; j++) {
+      cs_lnum_t f_id = c2f[j];
+      cs_real_t flux = cs_math_3_dot_product(vect_s, i_face_normal[f_id]);
+      cs_lnum_t c_id_up = i_face_cells[f_id][1];
+      if (c_id != i_face_cells[f_id][0]) {
+        flux = -flux;
+        c_id_up = i_face_cells[f_id][0];
+      }
+      if (flux < 0. && c_id_up < n_cells)
+        n_up[c_id] += 1;
+    }
+    if (n_up[c_id] == 0) {
+      order[n_ordered++] = c_id;
+      n_up[c_id] = -1;
+    }
+  }
+
+  /* Each level releases the downstream neighbors of its cells */
+
+  level_idx[0] = 0;
+  cs_lnum_t s_id = 0, c_id_next = 0;
+
+  *n_forced = 0;
+
+  while (n_ordered < n_cells || s_id < n_ordered) {
+
+    /* Break a cycle if no cell is ready */
+
+    if (s_id == n_ordered) {
+      while (n_up[c_id_next] < 0)
+        c_id_next++;
+      order[n_ordered++] = c_id_next;
+      n_up[c_id_next] = -1;
+      *n_forced += 1;
+    }
+
+    cs_lnum_t e_id = n_ordered;
+    level_idx[++n_levels] = e_id;
+
+    for (cs_lnum_t k = s_id; k < e_id; k++) {
+      cs_lnum_t c_id = order[k];
+      for (cs_lnum_t j = c2f_idx[c_id]; j < c2f_idx[c_id+1]; j++) {
+        cs_lnum_t f_id = c2f[j];
+        cs_real_t flux = cs_math_3_dot_product(vect_s, i_face_normal[f_id]);
+        cs_lnum_t c_id_dn = i_face_cells[f_id][1];
+        if (c_id != i_face_cells[f_id][0]) {
+          flux = -flux;
+          c_id_dn = i_face_cells[f_id][0];
+        }
+        if (flux > 0. && c_id_dn < n_cells && n_up[c_id_dn] > 0) {
+          n_up[c_id_dn] -= 1;
+          if (n_up[c_id_dn] == 0) {
+            order[n_ordered++] = c_id_dn;
+            n_up[c_id_dn] = -1;
+          }
+        }
+      }
+    }
+
+    s_id = e_id;
+  }
+
+  return n_levels;
+}
+
+/*----------------------------------------------------------------------------
+ * Return the upwind sweep ordering for a set of directions, building
+ * and caching it if not already available.
+ *
+ * parameters:
+ *   n_dirs <-- number of directions
+ *   vect_s <-- directions
+ *
+ * returns:
+ *   pointer to sweep ordering structure
+ *----------------------------------------------------------------------------*/
+
+static const _dom_sweep_order_t *
+_dom_sweep_get_order(int                n_dirs,
+                     const cs_real_3_t  vect_s[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_real_3_t *i_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->i_face_normal;
+
+  for (int i = 0; i < _n_sweep_orders; i++) {
+    const _dom_sweep_order_t *so = _sweep_orders + i;
+    if (   so->n_dirs == n_dirs
+        && memcmp(so->vect_s, vect_s, n_dirs*sizeof(cs_real_3_t)) == 0)
+      return so;
+  }
+
+  if (_sweep_c2f_idx == NULL)
+    _dom_sweep_cell_i_faces(m, &_sweep_c2f_idx, &_sweep_c2f);
+
+  BFT_REALLOC(_sweep_orders, _n_sweep_orders + 1, _dom_sweep_order_t);
+  _dom_sweep_order_t *so = _sweep_orders + _n_sweep_orders;
+  _n_sweep_orders += 1;
+
+  so->n_dirs = n_dirs;
+  BFT_MALLOC(so->vect_s, n_dirs, cs_real_3_t);
+  memcpy(so->vect_s, vect_s, n_dirs*sizeof(cs_real_3_t));
+
+  BFT_MALLOC(so->n_levels, n_dirs, cs_lnum_t);
+  BFT_MALLOC(so->order, (size_t)n_dirs*n_cells, cs_lnum_t);
+  BFT_MALLOC(so->level_shift, n_dirs + 1, cs_lnum_t);
+
+  /* Build levels for each direction, then keep only the used
+     part of each levels index */
+
+  cs_lnum_t *n_up, *level_idx, *n_forced;
+  BFT_MALLOC(n_up, (size_t)n_dirs*n_cells, cs_lnum_t);
+  BFT_MALLOC(level_idx, (size_t)n_dirs*(n_cells+1), cs_lnum_t);
+  BFT_MALLOC(n_forced, n_dirs, cs_lnum_t);
+
+# pragma omp parallel for if (n_dirs > 1)
+  for (int d = 0; d < n_dirs; d++)
+    so->n_levels[d] = _dom_sweep_order(n_cells,
+                                       _sweep_c2f_idx,
+                                       _sweep_c2f,
+                                       i_face_cells,
+                                       i_face_normal,
+                                       vect_s[d],
+                                       n_up + (size_t)d*n_cells,
+                                       so->order + (size_t)d*n_cells,
+                                       level_idx + (size_t)d*(n_cells+1),
+                                       n_forced + d);
+
+  BFT_FREE(n_up);
+
+  so->n_forced = 0;
+  so->level_shift[0] = 0;
+  for (int d = 0; d < n_dirs; d++) {
+    so->n_forced += n_forced[d];
+    so->level_shift[d+1] = so->level_shift[d] + so->n_levels[d] + 1;
+  }
+
+  BFT_MALLOC(so->level_idx, so->level_shift[n_dirs], cs_lnum_t);
+
+  for (int d = 0; d < n_dirs; d++)
+    memcpy(so->level_idx + so->level_shift[d],
+           level_idx + (size_t)d*(n_cells+1),
+           (so->n_levels[d] + 1)*sizeof(cs_lnum_t));
+
+  BFT_FREE(n_forced);
+  BFT_FREE(level_idx);
+
+  return so;
+}
+
+/*----------------------------------------------------------------------------
+ * Update radiance for a range of ordered cells and a given direction.
+ *
+ * The upwind discretization of div(L.s) + ck.L = S is solved locally
+ * in each cell, using the current values of upstream cells.
+ *
+ * parameters:
+ *   s_id          <-- start id in order
+ *   e_id          <-- past-the-end id in order
+ *   order         <-- ordered cell ids
+ *   vect_s        <-- direction
+ *   c2f_idx       <-- cells to interior faces index
+ *   c2f           <-- cells to interior faces adjacency
+ *   c2b_idx       <-- cells to boundary faces index
+ *   c2b           <-- cells to boundary faces adjacency
+ *   i_face_cells  <-- interior faces to cells connectivity
+ *   i_face_normal <-- interior face normals
+ *   b_face_normal <-- boundary face normals
+ *   coefap        <-- boundary condition array for the radiance
+ *                     (explicit part)
+ *   coefbp        <-- boundary condition array for the radiance
+ *                     (implicit part)
+ *   rovsdt        <-- implicit source term
+ *   rhs           <-- explicit source term
+ *   radiance      <-> radiance for this direction
+ *
+ * returns:
+ *   maximum absolute radiance variation over the range
+ *----------------------------------------------------------------------------*/
+
+static cs_real_t
+_dom_sweep_range(cs_lnum_t                   s_id,
+                 cs_lnum_t                   e_id,
+                 const cs_lnum_t             order[],
+                 const cs_real_t             vect_s[3],
+                 const cs_lnum_t             c2f_idx[],
+                 const cs_lnum_t             c2f[],
+                 const cs_lnum_t             c2b_idx[],
+                 const cs_lnum_t             c2b[],
+                 const cs_lnum_2_t           i_face_cells[],
+                 const cs_real_3_t           i_face_normal[],
+                 const cs_real_3_t           b_face_normal[],
+                 const cs_real_t             coefap[],
+                 const cs_real_t             coefbp[],
+                 const cs_real_t             rovsdt[],
+                 const cs_real_t             rhs[],
+                 cs_real_t         *restrict radiance)
+{
+  const cs_mesh_quantities_t *mq = cs_glob_mesh_quantities;
+  const cs_lnum_t has_dc = mq->has_disable_flag;
+
+  cs_real_t d_max = 0.;
+
+  for (cs_lnum_t k = s_id; k < e_id; k++) {
+
+    cs_lnum_t c_id = order[k];
+
+    cs_real_t num = rhs[c_id];
+    cs_real_t den = rovsdt[c_id];
+
+    /* Upwind contribution of interior faces with incoming flux */
+
+    for (cs_lnum_t j = c2f_idx[c_id]; j < c2f_idx[c_id+1]; j++) {
+      cs_lnum_t f_id = c2f[j];
+      cs_real_t flux = cs_math_3_dot_product(vect_s, i_face_normal[f_id]);
+      cs_lnum_t c_id_up = i_face_cells[f_id][1];
+      if (c_id != i_face_cells[f_id][0]) {
+        flux = -flux;
+        c_id_up = i_face_cells[f_id][0];
+      }
+      if (flux < 0.) {
+        num -= flux * radiance[c_id_up];
+        den -= flux;
+      }
+    }
+
+    /* Boundary faces with incoming flux */
+
+    for (cs_lnum_t j = c2b_idx[c_id]; j < c2b_idx[c_id+1]; j++) {
+      cs_lnum_t f_id = c2b[j];
+      cs_real_t flux = cs_math_3_dot_product(vect_s, b_face_normal[f_id]);
+      if (flux < 0.) {
+        num -= flux * coefap[f_id];
+        den -= flux * (1. - coefbp[f_id]);
+      }
+    }
+
+    cs_real_t l_new = 0.;
+    if (den > DBL_MIN && has_dc * mq->c_disable_flag[has_dc * c_id] == 0)
+      l_new = num / den;
+
+    d_max = CS_MAX(d_max, CS_ABS(l_new - radiance[c_id]));
+    radiance[c_id] = l_new;
+
+  }
+
+  return d_max;
+}
+
 /*----------------------------------------------------------------------------*/
 /*!
  * \brief Radiative flux and source term computation
@@ -520,7 +910,26 @@ _cs_rad_transfer_sol(int                        gg_id,
     vcopt.nswrsm =  2;
   }
 
-  if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
+  /* Upwind sweeps over each octant's directions replace the linear solvers
+     when sources and boundary conditions do not depend on the direction */
+
+  const bool dom_sweep = (   rt_params->dom_sweep
+                          && rt_params->dispersion == false
+                          && rt_params->atmo_model == CS_RAD_ATMO_3D_NONE);
+
+  cs_real_t *sweep_radiance = NULL;
+  cs_real_3_t *sweep_vect_s = NULL;
+
+  if (dom_sweep) {
+    /* Cached sweep orderings are only valid for a fixed mesh */
+    if (cs_glob_mesh->time_dep != CS_MESH_FIXED)
+      cs_rad_transfer_dom_sweep_finalize();
+    BFT_MALLOC(sweep_radiance,
+               (size_t)(rt_params->ndirs)*n_cells_ext,
+               cs_real_t);
+    BFT_MALLOC(sweep_vect_s, rt_params->ndirs, cs_real_3_t);
+  }
+  else if (cs_glob_time_step->nt_cur == cs_glob_time_step->nt_prev + 1)
     _order_by_direction();
 
   /*                              / -> ->
@@ -708,40 +1117,80 @@ _cs_rad_transfer_sol(int                        gg_id,
           /* Resolution
              ---------- */
 
-          /* In case of a theta-scheme, set theta = 1;
-             no relaxation in steady case either */
-
-          cs_equation_iterative_solve_scalar(0,   /* idtvar */
-                                             1,   /* external sub-iteration */
-                                             -1,  /* f_id */
-                                             cname,
-                                             0,   /* iescap */
-                                             0,   /* imucpp */
-                                             -1,  /* normp */
-                                             &vcopt,
-                                             radiance_prev,
-                                             radiance_prev,
-                                             coefap,
-                                             coefbp,
-                                             cofafp,
-                                             cofbfp,
-                                             flurds,
-                                             flurdb,
-                                             viscf,
-                                             viscb,
-                                             viscf,
-                                             viscb,
-                                             NULL,
-                                             NULL,
-                                             NULL,
-                                             0, /* icvflb (upwind) */
-                                             NULL,
-                                             rovsdt,
-                                             rhs,
-                                             radiance,
-                                             dpvar,
-                                             NULL,
-                                             NULL);
+          if (dom_sweep) {
+
+            /* All directions of the octant are solved at once */
+
+            if (dir_id == 0) {
+              for (int d = 0; d < rt_params->ndirs; d++) {
+                sweep_vect_s[d][0] = ii * rt_params->vect_s[d][0];
+                sweep_vect_s[d][1] = jj * rt_params->vect_s[d][1];
+                sweep_vect_s[d][2] = kk * rt_params->vect_s[d][2];
+              }
+
+              const cs_real_3_t *_vect_s = (const cs_real_3_t *)sweep_vect_s;
+
+              cs_real_t delta = 0.;
+              int n_sweeps
+                = cs_rad_transfer_dom_sweep_solve(rt_params->ndirs,
+                                                  _vect_s,
+                                                  coefap,
+                                                  coefbp,
+                                                  rovsdt,
+                                                  rhs,
+                                                  vcopt.epsrsm,
+                                                  sweep_radiance,
+                                                  &delta);
+
+              if (verbosity > 1 || delta > vcopt.epsrsm)
+                bft_printf(_("     DOM sweeps for octant (%d, %d, %d): "
+                             "%d sweep(s), relative variation %12.5e\n"),
+                           ii, jj, kk, n_sweeps, delta);
+            }
+
+            const cs_real_t *_radiance
+              = sweep_radiance + (size_t)dir_id*n_cells_ext;
+            for (cs_lnum_t cell_id = 0; cell_id < n_cells_ext; cell_id++)
+              radiance[cell_id] = _radiance[cell_id];
+
+          }
+          else {
+
+            /* In case of a theta-scheme, set theta = 1;
+               no relaxation in steady case either */
+
+            cs_equation_iterative_solve_scalar(0,   /* idtvar */
+                                               1,   /* external sub-iteration */
+                                               -1,  /* f_id */
+                                               cname,
+                                               0,   /* iescap */
+                                               0,   /* imucpp */
+                                               -1,  /* normp */
+                                               &vcopt,
+                                               radiance_prev,
+                                               radiance_prev,
+                                               coefap,
+                                               coefbp,
+                                               cofafp,
+                                               cofbfp,
+                                               flurds,
+                                               flurdb,
+                                               viscf,
+                                               viscb,
+                                               viscf,
+                                               viscb,
+                                               NULL,
+                                               NULL,
+                                               NULL,
+                                               0, /* icvflb (upwind) */
+                                               NULL,
+                                               rovsdt,
+                                               rhs,
+                                               radiance,
+                                               dpvar,
+                                               NULL,
+                                               NULL);
+          }
 
           /* Integration of fluxes and source terms
            * Increment absorption and emission for Atmo on the fly */
@@ -883,6 +1332,8 @@ _cs_rad_transfer_sol(int                        gg_id,
 
   /* Free memory */
 
+  BFT_FREE(sweep_radiance);
+  BFT_FREE(sweep_vect_s);
   BFT_FREE(ck_u_d);
   BFT_FREE(rhs0);
   BFT_FREE(dpvar);
@@ -2233,6 +2684,216 @@ cs_rad_transfer_solve(int               bc_type[],
   BFT_FREE(iqpar);
 }
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve DOM radiances for a batch of directions using upwind sweeps.
+ *
+ * Directions are swept concurrently when there are at least as many
+ * directions as threads; otherwise, each direction is swept level by
+ * level, cells of a given level (wavefront) being handled in parallel.
+ *
+ * A single sweep is exact when the local cell dependency graph is acyclic
+ * and there is no halo; otherwise, sweeps are repeated (with halo
+ * synchronization) until the relative radiance variation drops below
+ * the given precision.
+ *
+ * The sweep ordering of each set of directions is built on first use
+ * and kept until \ref cs_rad_transfer_dom_sweep_finalize is called.
+ *
+ * \param[in]   n_dirs    number of directions in batch
+ * \param[in]   vect_s    directions
+ * \param[in]   coefap    boundary condition array for the radiance
+ *                        (explicit part)
+ * \param[in]   coefbp    boundary condition array for the radiance
+ *                        (implicit part)
+ * \param[in]   rovsdt    implicit source term
+ * \param[in]   rhs       explicit source term
+ * \param[in]   epsilon   relative precision for sweep iterations
+ * \param[out]  radiance  radiance for each direction
+ *                        (size: n_dirs*n_cells_ext, one block per direction)
+ * \param[out]  delta     final relative variation
+ *                        (0 if a single sweep is exact)
+ *
+ * \return  number of sweeps
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_rad_transfer_dom_sweep_solve(int                  n_dirs,
+                                const cs_real_3_t    vect_s[],
+                                const cs_real_t      coefap[],
+                                const cs_real_t      coefbp[],
+                                const cs_real_t      rovsdt[],
+                                const cs_real_t      rhs[],
+                                cs_real_t            epsilon,
+                                cs_real_t            radiance[],
+                                cs_real_t           *delta)
+{
+  const int n_max_sweeps = 1000;
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_halo_t *halo = m->halo;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_real_3_t *i_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->i_face_normal;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->b_face_normal;
+  const cs_lnum_t *c2b_idx = cs_glob_mesh_adjacencies->cell_b_faces_idx;
+  const cs_lnum_t *c2b = cs_glob_mesh_adjacencies->cell_b_faces;
+
+  /* Sweep levels for each direction */
+
+  const _dom_sweep_order_t *so = _dom_sweep_get_order(n_dirs, vect_s);
+
+  const cs_lnum_t *c2f_idx = _sweep_c2f_idx;
+  const cs_lnum_t *c2f = _sweep_c2f;
+  const cs_lnum_t *order = so->order;
+
+  bool iterate = (halo != NULL || so->n_forced > 0);
+
+  const bool dir_parallel = (n_dirs >= cs_glob_n_threads);
+
+  cs_real_t *d_max;
+  BFT_MALLOC(d_max, n_dirs, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < (cs_lnum_t)n_dirs*n_cells_ext; i++)
+    radiance[i] = 0.;
+
+  int n_sweeps = 0;
+  cs_real_t rel_delta = 0.;
+
+  do {
+
+    if (halo != NULL) {
+      for (int d = 0; d < n_dirs; d++)
+        cs_halo_sync_var(halo, CS_HALO_STANDARD, radiance + d*n_cells_ext);
+    }
+
+    if (dir_parallel) {
+
+#     pragma omp parallel for schedule(dynamic, 1) if (n_dirs > 1)
+      for (int d = 0; d < n_dirs; d++)
+        d_max[d] = _dom_sweep_range(0,
+                                    n_cells,
+                                    order + (size_t)d*n_cells,
+                                    vect_s[d],
+                                    c2f_idx,
+                                    c2f,
+                                    c2b_idx,
+                                    c2b,
+                                    i_face_cells,
+                                    i_face_normal,
+                                    b_face_normal,
+                                    coefap,
+                                    coefbp,
+                                    rovsdt,
+                                    rhs,
+                                    radiance + d*n_cells_ext);
+
+    }
+    else {
+
+      for (int d = 0; d < n_dirs; d++) {
+
+        const cs_lnum_t *_order = order + (size_t)d*n_cells;
+        const cs_lnum_t *_level_idx = so->level_idx + so->level_shift[d];
+        cs_real_t *_radiance = radiance + d*n_cells_ext;
+
+        d_max[d] = 0.;
+
+        for (cs_lnum_t l_id = 0; l_id < so->n_levels[d]; l_id++) {
+
+          const cs_lnum_t s_id = _level_idx[l_id];
+          const cs_lnum_t n_l_cells = _level_idx[l_id+1] - s_id;
+
+          const bool l_parallel = (n_l_cells > CS_THR_MIN);
+
+#         pragma omp parallel if (l_parallel)
+          {
+            cs_lnum_t t_s_id = 0, t_e_id = n_l_cells;
+            if (l_parallel)
+              cs_parall_thread_range(n_l_cells, sizeof(cs_real_t),
+                                     &t_s_id, &t_e_id);
+
+            cs_real_t t_max = _dom_sweep_range(s_id + t_s_id,
+                                               s_id + t_e_id,
+                                               _order,
+                                               vect_s[d],
+                                               c2f_idx,
+                                               c2f,
+                                               c2b_idx,
+                                               c2b,
+                                               i_face_cells,
+                                               i_face_normal,
+                                               b_face_normal,
+                                               coefap,
+                                               coefbp,
+                                               rovsdt,
+                                               rhs,
+                                               _radiance);
+
+#           pragma omp critical
+            d_max[d] = CS_MAX(d_max[d], t_max);
+          }
+
+        } /* End of loop on levels */
+
+      } /* End of loop on directions */
+
+    }
+
+    /* Relative variation */
+
+    cs_real_t vals[2] = {0., 0.};
+    for (int d = 0; d < n_dirs; d++) {
+      const cs_real_t *_radiance = radiance + d*n_cells_ext;
+      vals[0] = CS_MAX(vals[0], d_max[d]);
+      for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+        vals[1] = CS_MAX(vals[1], CS_ABS(_radiance[c_id]));
+    }
+    cs_parall_max(2, CS_REAL_TYPE, vals);
+
+    rel_delta = (vals[1] > 0.) ? vals[0] / vals[1] : 0.;
+    n_sweeps++;
+
+  } while (iterate && rel_delta > epsilon && n_sweeps < n_max_sweeps);
+
+  BFT_FREE(d_max);
+
+  /* Variation is meaningless when a single sweep is exact */
+  *delta = (iterate) ? rel_delta : 0.;
+
+  return n_sweeps;
+}
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached DOM sweep orderings.
+ *
+ * This should be called when the mesh is modified, and at finalization.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_dom_sweep_finalize(void)
+{
+  for (int i = 0; i < _n_sweep_orders; i++) {
+    _dom_sweep_order_t *so = _sweep_orders + i;
+    BFT_FREE(so->vect_s);
+    BFT_FREE(so->n_levels);
+    BFT_FREE(so->order);
+    BFT_FREE(so->level_shift);
+    BFT_FREE(so->level_idx);
+  }
+  BFT_FREE(_sweep_orders);
+  _n_sweep_orders = 0;
+
+  BFT_FREE(_sweep_c2f_idx);
+  BFT_FREE(_sweep_c2f);
+}
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -74,6 +74,62 @@ cs_rad_transfer_solve(int               bc_type[],
                       const cs_real_t   cp2ch[],
                       const int         ichcor[]);
 
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Solve DOM radiances for a batch of directions using upwind sweeps.
+ *
+ * Directions are swept concurrently when there are at least as many
+ * directions as threads; otherwise, each direction is swept level by
+ * level, cells of a given level (wavefront) being handled in parallel.
+ *
+ * A single sweep is exact when the local cell dependency graph is acyclic
+ * and there is no halo; otherwise, sweeps are repeated (with halo
+ * synchronization) until the relative radiance variation drops below
+ * the given precision.
+ *
+ * The sweep ordering of each set of directions is built on first use
+ * and kept until \ref cs_rad_transfer_dom_sweep_finalize is called.
+ *
+ * \param[in]   n_dirs    number of directions in batch
+ * \param[in]   vect_s    directions
+ * \param[in]   coefap    boundary condition array for the radiance
+ *                        (explicit part)
+ * \param[in]   coefbp    boundary condition array for the radiance
+ *                        (implicit part)
+ * \param[in]   rovsdt    implicit source term
+ * \param[in]   rhs       explicit source term
+ * \param[in]   epsilon   relative precision for sweep iterations
+ * \param[out]  radiance  radiance for each direction
+ *                        (size: n_dirs*n_cells_ext, one block per direction)
+ * \param[out]  delta     final relative variation
+ *                        (0 if a single sweep is exact)
+ *
+ * \return  number of sweeps
+ */
+/*----------------------------------------------------------------------------*/
+
+int
+cs_rad_transfer_dom_sweep_solve(int                  n_dirs,
+                                const cs_real_3_t    vect_s[],
+                                const cs_real_t      coefap[],
+                                const cs_real_t      coefbp[],
+                                const cs_real_t      rovsdt[],
+                                const cs_real_t      rhs[],
+                                cs_real_t            epsilon,
+                                cs_real_t            radiance[],
+                                cs_real_t           *delta);
+
+/*----------------------------------------------------------------------------*/
+/*!
+ * \brief Free cached DOM sweep orderings.
+ *
+ * This should be called when the mesh is modified, and at finalization.
+ */
+/*----------------------------------------------------------------------------*/
+
+void
+cs_rad_transfer_dom_sweep_finalize(void);
+
 /*----------------------------------------------------------------------------*/
 
 END_C_DECLS
@@ -468,6 +468,105 @@ _rescale_flowrate(cs_lnum_t         n_points,
   }
 }
 
+/*----------------------------------------------------------------------------
+ * Distribute synthetic eddies in a uniform grid of bins covering the
+ * SEM virtual box.
+ *
+ * The bin size is chosen so as to have about one eddy per bin. Eddies
+ * outside the box cannot influence any point, and are not binned.
+ *
+ * parameters:
+ *   n_structures   <-- number of synthetic eddies
+ *   position       <-- eddy positions
+ *   box_min_coord  <-- virtual box minimum coordinates
+ *   box_length     <-- virtual box dimensions
+ *   n_bins         --> number of bins in each direction
+ *   inv_bin_size   --> inverse of bin size in each direction
+ *   bin_idx        --> index of eddies in each bin (size: n_bins_tot + 1)
+ *   bin_eddy_ids   --> ids of eddies in each bin
+ *----------------------------------------------------------------------------*/
+
+static void
+_sem_bin_structures(int                 n_structures,
+                    const cs_real_3_t   position[],
+                    const cs_real_t     box_min_coord[3],
+                    const cs_real_t     box_length[3],
+                    int                 n_bins[3],
+                    cs_real_t           inv_bin_size[3],
+                    cs_lnum_t         **bin_idx,
+                    int               **bin_eddy_ids)
+{
+  cs_real_t box_volume = 1.;
+  for (int coo_id = 0; coo_id < 3; coo_id++)
+    box_volume *= CS_MAX(box_length[coo_id], EPZERO);
+
+  const cs_real_t h = cbrt(box_volume / CS_MAX(n_structures, 1));
+
+  for (int coo_id = 0; coo_id < 3; coo_id++) {
+    n_bins[coo_id] = CS_MAX((int)(box_length[coo_id] / h), 1);
+    inv_bin_size[coo_id] = (box_length[coo_id] > 0) ?
+      n_bins[coo_id] / box_length[coo_id] : 0.;
+  }
+
+  const cs_lnum_t n_bins_tot = (cs_lnum_t)n_bins[0]*n_bins[1]*n_bins[2];
+
+  int *eddy_bin_id;
+  cs_lnum_t *_bin_idx;
+  int *_bin_eddy_ids;
+
+  BFT_MALLOC(eddy_bin_id, n_structures, int);
+  BFT_MALLOC(_bin_idx, n_bins_tot + 1, cs_lnum_t);
+  BFT_MALLOC(_bin_eddy_ids, n_structures, int);
+
+  for (cs_lnum_t i = 0; i < n_bins_tot + 1; i++)
+    _bin_idx[i] = 0;
+
+  /* Count eddies per bin (shifted index) */
+
+  for (int struct_id = 0; struct_id < n_structures; struct_id++) {
+
+    int b_ijk[3];
+    eddy_bin_id[struct_id] = -1;
+
+    for (int coo_id = 0; coo_id < 3; coo_id++) {
+      cs_real_t x = position[struct_id][coo_id] - box_min_coord[coo_id];
+      if (x < 0 || x > box_length[coo_id])
+        break;
+      b_ijk[coo_id] = CS_MIN((int)(x*inv_bin_size[coo_id]),
+                             n_bins[coo_id] - 1);
+      if (coo_id == 2) {
+        cs_lnum_t b_id = ((cs_lnum_t)b_ijk[2]*n_bins[1] + b_ijk[1])*n_bins[0]
+                         + b_ijk[0];
+        eddy_bin_id[struct_id] = b_id;
+        _bin_idx[b_id + 1] += 1;
+      }
+    }
+
+  }
+
+  for (cs_lnum_t i = 0; i < n_bins_tot; i++)
+    _bin_idx[i+1] += _bin_idx[i];
+
+  /* Fill bins, keeping eddies in increasing id order */
+
+  for (int struct_id = 0; struct_id < n_structures; struct_id++) {
+    cs_lnum_t b_id = eddy_bin_id[struct_id];
+    if (b_id > -1) {
+      _bin_eddy_ids[_bin_idx[b_id]] = struct_id;
+      _bin_idx[b_id] += 1;
+    }
+  }
+
+  for (cs_lnum_t i = n_bins_tot; i > 0; i--)
+    _bin_idx[i] = _bin_idx[i-1];
+  _bin_idx[0] = 0;
+
+  BFT_FREE(eddy_bin_id);
+
+  *bin_idx = _bin_idx;
+  *bin_eddy_ids = _bin_eddy_ids;
+}
+
 /*! (DOXYGEN_SHOULD_SKIP_THIS) \endcond */
 
 /*============================================================================
@@ -1655,70 +1754,83 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
   const cs_mesh_t  *mesh = cs_glob_mesh;
   const cs_mesh_quantities_t  *mq = cs_glob_mesh_quantities;
 
-  if (inflow->volume_mode == 1) { //Generate turbulence over the whole domain
+# pragma omp parallel if (n_points > CS_THR_MIN)
+  {
+    cs_gnum_t t_count[3] = {0, 0, 0};
 
-    for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+    if (inflow->volume_mode == 1) { //Generate turbulence over the whole domain
 
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+#     pragma omp for
+      for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+
+        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
 
-        cs_real_t length_scale_min = -HUGE_VAL;
-        length_scale_min = CS_MAX(length_scale_min,
-                           2.*CS_ABS(pow(mq->cell_vol[point_id + coo_id],
-                                         1./3.)));
+          cs_real_t length_scale_min = -HUGE_VAL;
+          length_scale_min = CS_MAX(length_scale_min,
+                             2.*CS_ABS(pow(mq->cell_vol[point_id + coo_id],
+                                           1./3.)));
 
-        length_scale[point_id][coo_id]
-          =    pow(1.5*rij_l[point_id][coo_id], 1.5)
-             / eps_l[point_id];
+          length_scale[point_id][coo_id]
+            =    pow(1.5*rij_l[point_id][coo_id], 1.5)
+               / eps_l[point_id];
 
-        length_scale[point_id][coo_id]
-          = 0.5*length_scale[point_id][coo_id];
+          length_scale[point_id][coo_id]
+            = 0.5*length_scale[point_id][coo_id];
 
-        length_scale[point_id][coo_id]
-          = CS_MAX(length_scale[point_id][coo_id], length_scale_min);
+          length_scale[point_id][coo_id]
+            = CS_MAX(length_scale[point_id][coo_id], length_scale_min);
 
-        if (CS_ABS(length_scale[point_id][coo_id]-length_scale_min) < EPZERO)
-          count[coo_id]++;
+          if (  CS_ABS(length_scale[point_id][coo_id] - length_scale_min)
+              < EPZERO)
+            t_count[coo_id]++;
+
+        }
 
       }
 
     }
+    else {
+#     pragma omp for
+      for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
 
-  }
-  else{
-    for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
+        cs_lnum_t b_face_id = elt_ids[point_id];
+        cs_lnum_t cell_id = mesh->b_face_cells[b_face_id];
 
-      cs_lnum_t b_face_id = elt_ids[point_id];
-      cs_lnum_t cell_id = mesh->b_face_cells[b_face_id];
+        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
 
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+          cs_real_t length_scale_min = -HUGE_VAL;
 
-        cs_real_t length_scale_min = -HUGE_VAL;
+          for (cs_lnum_t j = mesh->b_face_vtx_idx[b_face_id];
+               j < mesh->b_face_vtx_idx[b_face_id + 1];
+               j++) {
+            cs_lnum_t vtx_id = mesh->b_face_vtx_lst[j];
+            length_scale_min
+              = CS_MAX(length_scale_min,
+                       2.*CS_ABS(mq->cell_cen[3*cell_id + coo_id]
+                                 - mesh->vtx_coord[3*vtx_id + coo_id]));
+          }
 
-        for (cs_lnum_t j = mesh->b_face_vtx_idx[b_face_id];
-             j < mesh->b_face_vtx_idx[b_face_id + 1];
-             j++) {
-          cs_lnum_t vtx_id = mesh->b_face_vtx_lst[j];
-          length_scale_min
-            = CS_MAX(length_scale_min,
-                     2.*CS_ABS(mq->cell_cen[3*cell_id + coo_id]
-                               - mesh->vtx_coord[3*vtx_id + coo_id]));
-        }
+          length_scale[point_id][coo_id]
+            = pow(1.5*rij_l[point_id ][coo_id], 1.5) / eps_l[point_id];
 
-        length_scale[point_id][coo_id]
-          = pow(1.5*rij_l[point_id ][coo_id], 1.5) / eps_l[point_id];
+          length_scale[point_id][coo_id]
+            = 0.5*length_scale[point_id][coo_id];
 
-        length_scale[point_id][coo_id]
-          = 0.5*length_scale[point_id][coo_id];
+          length_scale[point_id][coo_id]
+            = CS_MAX(length_scale[point_id][coo_id], length_scale_min);
 
-        length_scale[point_id][coo_id]
-          = CS_MAX(length_scale[point_id][coo_id], length_scale_min);
+          if (  CS_ABS(length_scale[point_id][coo_id] - length_scale_min)
+              < EPZERO)
+            t_count[coo_id]++;
 
-        if (CS_ABS(length_scale[point_id][coo_id] - length_scale_min) < EPZERO)
-          count[coo_id]++;
+        }
 
       }
-
     }
+
+#   pragma omp critical
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+      count[coo_id] += t_count[coo_id];
   }
 
   if (verbosity > 0) {
@@ -1950,11 +2062,13 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
     /* Time advancement of the eddies */
 
-    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
-
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-        inflow->position[struct_id][coo_id] += vel_m[coo_id]*t_cur;
+    const cs_real_t dx[3] = {vel_m[0]*t_cur, vel_m[1]*t_cur, vel_m[2]*t_cur};
+    cs_real_3_t *position = inflow->position;
 
+    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+      position[struct_id][0] += dx[0];
+      position[struct_id][1] += dx[1];
+      position[struct_id][2] += dx[2];
     }
 
     /* Checking if the structures are still in the box */
@@ -2033,35 +2147,78 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
   /* Computation of the eddy signal */
   /*--------------------------------*/
 
+  /* Eddies are binned so that each point only visits those in bins
+     overlapping its [x - sigma, x + sigma] neighborhood */
+
+  int n_bins[3];
+  cs_real_t inv_bin_size[3];
+  cs_lnum_t *bin_idx = NULL;
+  int *bin_eddy_ids = NULL;
+
+  _sem_bin_structures(inflow->n_structures,
+                      (const cs_real_3_t *)inflow->position,
+                      box_min_coord,
+                      box_length,
+                      n_bins,
+                      inv_bin_size,
+                      &bin_idx,
+                      &bin_eddy_ids);
+
   alpha = sqrt(box_volume / (double)inflow->n_structures);
 
+  const cs_real_3_t *position = (const cs_real_3_t *)inflow->position;
+  const cs_real_3_t *energy = (const cs_real_3_t *)inflow->energy;
+
+# pragma omp parallel for if (n_points > CS_THR_MIN)
   for (cs_lnum_t point_id = 0; point_id < n_points; point_id++) {
 
+    const cs_real_t *x_p = point_coordinates[point_id];
+    const cs_real_t *sigma = length_scale[point_id];
+
     cs_real_t distance[3];
+    int b_min[3], b_max[3];
 
-    for (int struct_id = 0; struct_id < inflow->n_structures; struct_id++) {
+    for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++) {
+      cs_real_t x0 = x_p[coo_id] - sigma[coo_id] - box_min_coord[coo_id];
+      cs_real_t x1 = x_p[coo_id] + sigma[coo_id] - box_min_coord[coo_id];
+      b_min[coo_id] = CS_MAX((int)(x0*inv_bin_size[coo_id]), 0);
+      b_max[coo_id] = CS_MIN((int)(x1*inv_bin_size[coo_id]),
+                             n_bins[coo_id] - 1);
+    }
 
-      for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-        distance[coo_id] =
-          CS_ABS(point_coordinates[point_id][coo_id]
-                 - inflow->position[struct_id][coo_id]);
+    for (int b_k = b_min[2]; b_k <= b_max[2]; b_k++) {
+      for (int b_j = b_min[1]; b_j <= b_max[1]; b_j++) {
 
-      if (   distance[0] < length_scale[point_id][0]
-          && distance[1] < length_scale[point_id][1]
-          && distance[2] < length_scale[point_id][2]) {
+        cs_lnum_t b_id_0 = ((cs_lnum_t)b_k*n_bins[1] + b_j)*n_bins[0];
 
-        cs_real_t form_function = 1.;
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          form_function *=
-            (1.-distance[coo_id]/length_scale[point_id][coo_id])
-            /sqrt(2./3.*length_scale[point_id][coo_id]);
+        for (cs_lnum_t j = bin_idx[b_id_0 + b_min[0]];
+             j < bin_idx[b_id_0 + b_max[0] + 1];
+             j++) {
 
-        for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
-          fluctuations[point_id][coo_id]
-            += inflow->energy[struct_id][coo_id]*form_function;
+          const int struct_id = bin_eddy_ids[j];
 
-      }
+          for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+            distance[coo_id]
+              = CS_ABS(x_p[coo_id] - position[struct_id][coo_id]);
 
+          if (   distance[0] < sigma[0]
+              && distance[1] < sigma[1]
+              && distance[2] < sigma[2]) {
+
+            cs_real_t form_function = 1.;
+            for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+              form_function *=   (1.-distance[coo_id]/sigma[coo_id])
+                               / sqrt(2./3.*sigma[coo_id]);
+
+            for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
+              fluctuations[point_id][coo_id]
+                += energy[struct_id][coo_id]*form_function;
+
+          }
+
+        }
+
+      }
     }
 
     for (cs_lnum_t coo_id = 0; coo_id < 3; coo_id++)
@@ -2069,6 +2226,9 @@ cs_les_synthetic_eddy_method(cs_lnum_t           n_points,
 
   }
 
+  BFT_FREE(bin_idx);
+  BFT_FREE(bin_eddy_ids);
+
   BFT_FREE(length_scale);
 }
 
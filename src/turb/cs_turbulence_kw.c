@@ -389,15 +389,16 @@ cs_turbulence_kw(cs_lnum_t        ncesmp,
 
   bool use_previous_t = true;
 
-  cs_field_gradient_scalar(f_k,
-                           use_previous_t,
-                           1,     /* inc */
-                           gradk);
-
-  cs_field_gradient_scalar(f_omg,
-                           use_previous_t,
-                           1,     /* inc */
-                           grado);
+  {
+    const cs_field_t *f_ko[2] = {f_k, f_omg};
+    cs_real_3_t *grad_ko[2] = {gradk, grado};
+
+    cs_field_gradient_scalar_multi(2,
+                                   f_ko,
+                                   use_previous_t,
+                                   1,     /* inc */
+                                   grad_ko);
+  }
 
   /* Initialization of work arrays in case of Hybrid turbulence modelling */
 
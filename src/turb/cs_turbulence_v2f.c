@@ -258,15 +258,14 @@ _gradfi_dot_gradk(const  cs_lnum_t   n_cells,
   BFT_MALLOC(grad_phi, n_cells_ext, cs_real_3_t);
   BFT_MALLOC(grad_k, n_cells_ext, cs_real_3_t);
 
-  cs_field_gradient_scalar(CS_F_(phi),
-                           true,     /* use previous t */
-                           1,        /* not on increment */
-                           grad_phi);
-
-  cs_field_gradient_scalar(CS_F_(k),
-                           true,     /* use previous t */
-                           1,        /* not on increment */
-                           grad_k);
+  const cs_field_t *fields[2] = {CS_F_(phi), CS_F_(k)};
+  cs_real_3_t *grads[2] = {grad_phi, grad_k};
+
+  cs_field_gradient_scalar_multi(2,
+                                 fields,
+                                 true,     /* use previous t */
+                                 1,        /* not on increment */
+                                 grads);
 
   for (cs_lnum_t i = 0; i < n_cells; i++) {
     grad_pk[i] = cs_math_3_dot_product(grad_phi[i], grad_k[i]);
@@ -580,6 +580,13 @@ cs_user_model(void)
 
   cs_porosity_from_scan_set_file_name("chbre_chbre33.pts");
 
+  /* Large scans are read much faster (and in parallel) in binary form;
+     a text file may be converted once using:
+     cs_porosity_from_scan_convert_to_binary("chbre_chbre33.pts",
+                                             "chbre_chbre33.pts.bin");
+     and the binary file name then used above (its format is detected
+     automatically). */
+
   /* Apply a transformation to the scanned points */
   /* Translation part */
   cs_glob_porosity_from_scan_opt->transformation_matrix[0][3] = 4.;
@@ -352,6 +352,8 @@ cs_user_linear_solvers(void)
    *  CS_SLES_P_GAUSS_SEIDEL      (process-local Gauss-Seidel)
    *  CS_SLES_P_SYM_GAUSS_SEIDEL  (process-local symmetric Gauss-Seidel)
    *  CS_SLES_PCR3                (3-layer conjugate residual)
+   *  CS_SLES_PIPELINED_PCG       (pipelined conjugate gradient)
+   *  CS_SLES_PIPELINED_GMRES     (pipelined GMRES)
    *
    *  The multigrid solver uses the conjugate gradient as a smoother
    *  and coarse solver by default, but this behavior may be modified. */
@@ -400,6 +402,17 @@ cs_user_linear_solvers(void)
   }
   /*! [sles_viz_1] */
 
+  /* Example: use previous solutions to improve the initial guess
+     of the pressure solver (useful for unsteady computations) */
+  /*-------------------------------------------------------------*/
+
+  /*! [sles_proj_1] */
+  {
+    cs_sles_t *sles_p = cs_sles_find_or_add(CS_F_(p)->id, NULL);
+    cs_sles_set_solution_projection(sles_p, 8); /* number of stored vectors */
+  }
+  /*! [sles_proj_1] */
+
   /* Example: change multigrid parameters for pressure */
   /*---------------------------------------------------*/
 
@@ -476,6 +476,13 @@ isepchemistry = 1
 ! dtchemmax: maximal time step (s) for chemistry resolution
 dtchemmax = 10.0d0
 
+! iadaptchemistry: fixed sub-steps of dtchemmax (=0, default) or per-cell
+! adaptive sub-steps (=1), controlled by the relative and absolute
+! tolerances rtolchem and atolchem
+iadaptchemistry = 1
+rtolchem = 1.d-3
+atolchem = 1.d-6
+
 ! computation / storage of downward and upward infrared radiative fluxes
 irdu = 1
 
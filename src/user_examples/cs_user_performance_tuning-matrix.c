@@ -91,6 +91,21 @@ cs_user_matrix_tuning(void)
   cs_grid_set_matrix_tuning(CS_MATRIX_SCALAR_SYM, 12);
 
   /*! [performance_tuning_matrix] */
+
+  /*! [performance_tuning_matrix_cartesian] */
+
+  /* For cartesian meshes (with block partitioning in parallel and
+   * no cell renumbering), the "structured" matrix.vector product of
+   * native matrices (storing coefficients by stencil direction) is
+   * considered by tuning. Least-squares gradients may also use the
+   * cartesian stencil. */
+
+  cs_matrix_default_set_type(CS_MATRIX_SCALAR_SYM, CS_MATRIX_NATIVE);
+  cs_matrix_default_set_type(CS_MATRIX_SCALAR, CS_MATRIX_NATIVE);
+
+  cs_gradient_set_cartesian_stencil(true);
+
+  /*! [performance_tuning_matrix_cartesian] */
 }
 
 /*----------------------------------------------------------------------------*/
@@ -145,6 +145,40 @@ cs_user_partition(void)
   }
   /*! [performance_tuning_partition_4] */
 
+  /*! [performance_tuning_partition_5] */
+  {
+    /* Example: balance an estimated cell cost rather than the number of
+     *          cells for the main partitioning.
+     *
+     * Mesh headers are already read here, so the global number of cells
+     * is known. Weights are given for cells 1 to n_g_cells on rank 0
+     * (which may read them from a file), other ranks not defining any.
+     *
+     * When the cost distribution evolves during a computation,
+     * cs_partition_write_weighted may instead be called (for example
+     * from cs_user_extra_operations) to write a partitioning
+     * used at restart. */
+
+    if (cs_glob_rank_id < 1) {
+
+      const cs_lnum_t n_g_cells = (cs_lnum_t)(cs_glob_mesh->n_g_cells);
+
+      cs_real_t *weights;
+      BFT_MALLOC(weights, n_g_cells, cs_real_t);
+
+      /* Cells numbered first assumed 4 times more costly here */
+
+      for (cs_lnum_t i = 0; i < n_g_cells; i++)
+        weights[i] = (i < n_g_cells/10) ? 4. : 1.;
+
+      cs_partition_set_cell_weights(n_g_cells, NULL, weights);
+
+      BFT_FREE(weights);
+
+    }
+  }
+  /*! [performance_tuning_partition_5] */
+
 }
 
 /*----------------------------------------------------------------------------*/
@@ -139,6 +139,11 @@ cs_user_turbomachinery_rotor(void)
        using cs_join_set_advanced_param(),
        just as for regular joinings or periodicities. */
 
+    /* Keep the interface face selection between mesh updates
+       (the selection criteria above do not depend on rotor position) */
+
+    cs_turbomachinery_set_interface_cache(true);
+
   }
   /*! [user_tbm_set_interface] */
 
@@ -20,6 +20,7 @@
 
 /*----------------------------------------------------------------------------*/
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
@@ -101,6 +102,56 @@ main (int argc, char *argv[])
     BFT_FREE(pa);
   }
 
+  /* Block bookkeeping, with reallocations which move blocks
+     (interleaved blocks are grown, so they usually can not be
+     extended in place) */
+
+  {
+    const int n_blocks = 200;
+    char *pb[200];
+    int n_moved = 0, n_errors = 0;
+
+    size_t s_ref = bft_mem_size_current();
+
+    for (int i = 0; i < n_blocks; i++) {
+      BFT_MALLOC(pb[i], 1024, char);
+      memset(pb[i], i%128, 1024);
+    }
+
+    for (int i = 0; i < n_blocks; i += 2) {
+      uintptr_t p_prev = (uintptr_t)pb[i];
+      BFT_REALLOC(pb[i], 64*1024, char);
+      if ((uintptr_t)pb[i] != p_prev)
+        n_moved++;
+      if (pb[i][1023] != i%128)
+        n_errors++;
+    }
+
+    for (int i = 0; i < n_blocks; i++) {
+      size_t s = (i%2) ? 1024 : 64*1024;
+      if (bft_mem_get_block_size(pb[i]) != s)
+        n_errors++;
+    }
+    if (bft_mem_size_current() != s_ref + (n_blocks/2)*(64 + 1))
+      n_errors++;
+
+    for (int i = 0; i < n_blocks; i += 2) {
+      BFT_REALLOC(pb[i], 2048, char);
+      if (bft_mem_get_block_size(pb[i]) != 2048 || pb[i][1023] != i%128)
+        n_errors++;
+    }
+    if (bft_mem_size_current() != s_ref + (n_blocks/2)*(2 + 1))
+      n_errors++;
+
+    for (int i = 0; i < n_blocks; i++)
+      BFT_FREE(pb[i]);
+    if (bft_mem_size_current() != s_ref)
+      n_errors++;
+
+    printf("block bookkeeping: %d of %d reallocations moved, %d errors\n",
+           n_moved, n_blocks/2, n_errors);
+  }
+
   bft_mem_end();
 
   printf("max memory usage: %lu kB\n",
@@ -0,0 +1,236 @@
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2022 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_field.h"
+#include "cs_field_default.h"
+#include "cs_field_operator.h"
+#include "cs_gradient.h"
+#include "cs_mesh.h"
+#include "cs_mesh_location.h"
+#include "cs_mesh_quantities.h"
+#include "cs_numbering.h"
+#include "cs_parameters.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+#define N_FIELDS 5
+
+/*----------------------------------------------------------------------------
+ * Build a small (distorted) cartesian mesh, with only the connectivity and
+ * quantities required by least-squares gradients.
+ *
+ * parameters:
+ *   nx <-- number of cells in each direction
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(int  nx)
+{
+  const cs_lnum_t n_cells = nx*nx*nx;
+  const cs_lnum_t n_i_faces = 3*nx*nx*(nx-1);
+  const cs_lnum_t n_b_faces = 6*nx*nx;
+
+  cs_mesh_t *m = cs_mesh_create();
+  cs_mesh_quantities_t *mq = cs_mesh_quantities_create();
+
+  cs_glob_mesh = m;
+  cs_glob_mesh_quantities = mq;
+
+  m->n_cells = n_cells;
+  m->n_cells_with_ghosts = n_cells;
+  m->n_i_faces = n_i_faces;
+  m->n_b_faces = n_b_faces;
+  m->n_b_faces_all = n_b_faces;
+  m->n_g_cells = n_cells;
+
+  BFT_MALLOC(m->i_face_cells, n_i_faces, cs_lnum_2_t);
+  BFT_MALLOC(m->b_face_cells, n_b_faces, cs_lnum_t);
+
+  BFT_MALLOC(mq->cell_cen, 3*n_cells, cs_real_t);
+  BFT_MALLOC(mq->weight, n_i_faces, cs_real_t);
+  BFT_MALLOC(mq->b_face_normal, 3*n_b_faces, cs_real_t);
+  BFT_MALLOC(mq->b_face_surf, n_b_faces, cs_real_t);
+  BFT_MALLOC(mq->b_dist, n_b_faces, cs_real_t);
+  BFT_MALLOC(mq->diipb, 3*n_b_faces, cs_real_t);
+
+  const cs_lnum_t stride[3] = {1, nx, nx*nx};
+
+  cs_lnum_t f_id = 0, b_id = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const int ijk[3] = {c_id%nx, (c_id/nx)%nx, c_id/(nx*nx)};
+    for (int i = 0; i < 3; i++) {
+      mq->cell_cen[3*c_id + i] = ijk[i] + 0.15*sin(1.3*c_id + i);
+      if (ijk[i] < nx-1) {
+        m->i_face_cells[f_id][0] = c_id;
+        m->i_face_cells[f_id][1] = c_id + stride[i];
+        mq->weight[f_id] = 0.5;
+        f_id++;
+      }
+      for (int s = 0; s < 2; s++) {
+        if (ijk[i] == s*(nx-1)) {
+          m->b_face_cells[b_id] = c_id;
+          for (int j = 0; j < 3; j++) {
+            mq->b_face_normal[3*b_id + j] = (j == i) ? 2*s - 1 : 0;
+            mq->diipb[3*b_id + j] = 0.01*j;
+          }
+          mq->b_face_surf[b_id] = 1;
+          mq->b_dist[b_id] = 0.5;
+          b_id++;
+        }
+      }
+    }
+  }
+
+  m->i_face_numbering = cs_numbering_create_default(n_i_faces);
+  m->b_face_numbering = cs_numbering_create_default(n_b_faces);
+
+  cs_mesh_update_b_cells(m);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  (void)cs_timer_wtime();
+
+  _build_mesh(12);
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+  const cs_real_3_t *cell_cen
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->cell_cen;
+
+  cs_mesh_location_initialize();
+  cs_mesh_location_build(cs_glob_mesh, -1);
+
+  cs_field_define_keys_base();
+  cs_parameters_define_field_keys();
+
+  cs_gradient_initialize();
+
+  /* Define fields; the last one has different gradient options,
+     and is handled separately by the batched function */
+
+  const cs_field_t *f[N_FIELDS];
+  cs_real_3_t *grad_ref[N_FIELDS], *grad[N_FIELDS];
+
+  for (int i = 0; i < N_FIELDS; i++) {
+
+    char name[16];
+    snprintf(name, 15, "s%d", i);
+
+    cs_field_t *_f = cs_field_create(name,
+                                     CS_FIELD_INTENSIVE | CS_FIELD_VARIABLE,
+                                     CS_MESH_LOCATION_CELLS,
+                                     1,
+                                     false);
+    cs_field_allocate_values(_f);
+    cs_field_allocate_bc_coeffs(_f, false, false, false, false);
+
+    /* Least-squares gradients, for which batched gradients are fused */
+
+    cs_equation_param_t *eqp = cs_field_get_equation_param(_f);
+    eqp->imrgra = 1;
+    if (i == N_FIELDS - 1)
+      eqp->nswrgr = 2;
+
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      const cs_real_t *x = cell_cen[c_id];
+      _f->val[c_id] =   sin(0.1*(i+1)*x[0]) + cos(0.07*i*x[1])
+                      + 0.01*i*x[2];
+    }
+
+    /* Alternate Dirichlet and Neumann boundary conditions */
+
+    for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+      _f->bc_coeffs->a[f_id] = (i % 2) ? 0.3*i : 0;
+      _f->bc_coeffs->b[f_id] = (i % 2) ? 0 : 1;
+    }
+
+    f[i] = _f;
+    BFT_MALLOC(grad_ref[i], n_cells, cs_real_3_t);
+    BFT_MALLOC(grad[i], n_cells, cs_real_3_t);
+
+  }
+
+  /* Reference: field by field */
+
+  for (int i = 0; i < N_FIELDS; i++)
+    cs_field_gradient_scalar(f[i], false, 1, grad_ref[i]);
+
+  /* Batched */
+
+  cs_field_gradient_scalar_multi(N_FIELDS, f, false, 1, grad);
+
+  for (int i = 0; i < N_FIELDS; i++) {
+    double d_max = 0, g_max = 0;
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      for (int j = 0; j < 3; j++) {
+        d_max = fmax(d_max, fabs(grad[i][c_id][j] - grad_ref[i][c_id][j]));
+        g_max = fmax(g_max, fabs(grad_ref[i][c_id][j]));
+      }
+    }
+    bft_printf("field %s: max |grad| = %12.5e, max difference = %12.5e\n",
+               f[i]->name, g_max, d_max);
+    if (d_max > 1e-12*g_max)
+      bft_printf("  error: batched and separate gradients differ\n");
+  }
+
+  /* Finalize */
+
+  for (int i = 0; i < N_FIELDS; i++) {
+    BFT_FREE(grad_ref[i]);
+    BFT_FREE(grad[i]);
+  }
+
+  cs_field_destroy_all();
+  cs_field_destroy_all_keys();
+
+  cs_gradient_finalize();
+
+  cs_mesh_location_finalize();
+
+  cs_glob_mesh_quantities = cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  bft_mem_end();
+
+  exit (EXIT_SUCCESS);
+}
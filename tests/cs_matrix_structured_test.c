@@ -0,0 +1,276 @@
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2022 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_matrix.h"
+#include "cs_mesh.h"
+#include "cs_mesh_builder.h"
+#include "cs_mesh_cartesian.h"
+#include "cs_parall.h"
+#include "cs_partition.h"
+#include "cs_preprocessor_data.h"
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Generate a cartesian mesh, partitioned by blocks (so that the local cells
+ * keep the (i, j, k) numbering) and with a standard halo.
+ *
+ * parameters:
+ *   nx <-- number of cells in each direction
+ *
+ * returns:
+ *   pointer to generated mesh
+ *----------------------------------------------------------------------------*/
+
+static cs_mesh_t *
+_build_mesh(int  nx)
+{
+  int n_cells[3] = {nx, nx, nx};
+  cs_real_t xyz[6] = {0., 0., 0., 1., 1., 1.};
+
+  cs_mesh_cartesian_create();
+  cs_mesh_cartesian_define_simple(n_cells, xyz);
+
+  cs_partition_set_algorithm(CS_PARTITION_MAIN, CS_PARTITION_BLOCK, 1, false);
+
+  cs_mesh_t *m = cs_mesh_create();
+  cs_mesh_builder_t *mb = cs_mesh_builder_create();
+
+  cs_glob_mesh = m;
+  cs_glob_mesh_builder = mb;
+
+  cs_preprocessor_data_read_headers(m, mb);
+  cs_preprocessor_data_read_mesh(m, mb);
+
+  cs_mesh_init_halo(m, mb, CS_HALO_STANDARD, 0, true);
+  cs_mesh_update_auxiliary(m);
+
+  cs_mesh_builder_destroy(&cs_glob_mesh_builder);
+  cs_mesh_cartesian_params_destroy();
+
+  return m;
+}
+
+/*----------------------------------------------------------------------------
+ * Set matrix coefficients (varying by face, so that values are not
+ * uniform).
+ *
+ * parameters:
+ *   m         <-- pointer to mesh
+ *   a         <-> pointer to matrix
+ *   symmetric <-- symmetric coefficients if true
+ *   pass      <-- pass number (to vary coefficients)
+ *   da        --- diagonal values (work array)
+ *   xa        --- extra-diagonal values (work array)
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs(const cs_mesh_t  *m,
+            cs_matrix_t      *a,
+            bool              symmetric,
+            int               pass,
+            cs_real_t         da[],
+            cs_real_t         xa[])
+{
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+
+  for (cs_lnum_t i = 0; i < m->n_cells_with_ghosts; i++)
+    da[i] = 6.5 + 0.1*pass;
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t ii = i_face_cells[f_id][0], jj = i_face_cells[f_id][1];
+    double s = sin(0.37*f_id + pass);
+    if (symmetric)
+      xa[f_id] = -1. - 0.5*s;
+    else {
+      xa[2*f_id] = -1. - 0.5*s;
+      xa[2*f_id + 1] = -1. + 0.25*s;
+    }
+    if (ii < m->n_cells)
+      da[ii] += 0.01*s;
+    if (jj < m->n_cells)
+      da[jj] -= 0.01*s;
+  }
+
+  cs_matrix_set_coefficients(a, symmetric, 1, 1, n_i_faces, i_face_cells,
+                             da, xa);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int retval = EXIT_SUCCESS;
+
+#if defined(HAVE_MPI)
+  cs_base_mpi_init(&argc, &argv);
+#else
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  cs_mesh_t *m = _build_mesh(16);
+
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_cells_ext = m->n_cells_with_ghosts;
+
+  /* Baseline and structured native matrices, on the same structure */
+
+  const cs_mesh_cartesian_stencil_t *c_stencil
+    = cs_mesh_cartesian_get_stencil(m);
+
+  int have_stencil = (c_stencil != NULL) ? 1 : 0;
+  cs_parall_min(1, CS_INT_TYPE, &have_stencil);
+
+  if (have_stencil == 0) {
+    if (rank_id == 0)
+      printf("  error: no stencil for block-partitioned cartesian mesh\n");
+    retval = EXIT_FAILURE;
+  }
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_NATIVE,
+                                 n_cells,
+                                 n_cells_ext,
+                                 m->n_i_faces,
+                                 (const cs_lnum_2_t *)m->i_face_cells,
+                                 m->halo,
+                                 m->i_face_numbering);
+
+  if (c_stencil != NULL)
+    cs_matrix_structure_set_stencil(ms,
+                                    c_stencil->n_dirs,
+                                    c_stencil->shift,
+                                    c_stencil->i_face_dir);
+
+  cs_matrix_t *a_ref = cs_matrix_create(ms);
+  cs_matrix_t *a_st = cs_matrix_create(ms);
+
+  cs_real_t *da, *xa, *x, *y_ref, *y_st;
+  BFT_MALLOC(da, n_cells_ext, cs_real_t);
+  BFT_MALLOC(xa, 2*m->n_i_faces, cs_real_t);
+  BFT_MALLOC(x, n_cells_ext, cs_real_t);
+  BFT_MALLOC(y_ref, n_cells_ext, cs_real_t);
+  BFT_MALLOC(y_st, n_cells_ext, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    x[i] = cos(0.013*i);
+
+  /* Symmetric and non-symmetric coefficients, set twice to check the
+     coefficients by stencil direction are rebuilt after each change */
+
+  for (int sym = 0; sym < 2; sym++) {
+
+    for (int pass = 0; pass < 2; pass++) {
+
+      _set_coeffs(m, a_ref, sym, pass, da, xa);
+      _set_coeffs(m, a_st, sym, pass, da, xa);
+
+      if (pass == 0) {
+        cs_matrix_variant_t *mv = cs_matrix_variant_create(a_st);
+        cs_matrix_variant_set_func(mv,
+                                   cs_matrix_get_fill_type(sym, 1, 1),
+                                   CS_MATRIX_SPMV_N_TYPES,
+                                   NULL,
+                                   "structured");
+        cs_matrix_variant_apply(a_st, mv);
+        cs_matrix_variant_destroy(&mv);
+      }
+
+      /* Full product, then extra-diagonal part only */
+
+      for (int op = 0; op < 2; op++) {
+
+        if (op == 0) {
+          cs_matrix_vector_multiply(a_ref, x, y_ref);
+          cs_matrix_vector_multiply(a_st, x, y_st);
+        }
+        else {
+          cs_matrix_vector_multiply_partial(a_ref, CS_MATRIX_SPMV_E,
+                                            x, y_ref);
+          cs_matrix_vector_multiply_partial(a_st, CS_MATRIX_SPMV_E,
+                                            x, y_st);
+        }
+
+        double d_max = 0, y_max = 0;
+        for (cs_lnum_t i = 0; i < n_cells; i++) {
+          d_max = fmax(d_max, fabs(y_st[i] - y_ref[i]));
+          y_max = fmax(y_max, fabs(y_ref[i]));
+        }
+        cs_parall_max(1, CS_DOUBLE, &d_max);
+        cs_parall_max(1, CS_DOUBLE, &y_max);
+
+        if (rank_id == 0)
+          printf("%s coefficients, pass %d, %s: "
+                 "max |y| = %12.5e, max difference = %12.5e\n",
+                 (sym) ? "symmetric" : "non-symmetric", pass,
+                 (op == 0) ? "A.x" : "E.x", y_max, d_max);
+
+        if (d_max > 1e-12*y_max) {
+          if (rank_id == 0)
+            printf("  error: structured and baseline products differ\n");
+          retval = EXIT_FAILURE;
+        }
+
+      }
+
+    }
+
+  }
+
+  BFT_FREE(y_st);
+  BFT_FREE(y_ref);
+  BFT_FREE(x);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+
+  cs_matrix_destroy(&a_st);
+  cs_matrix_destroy(&a_ref);
+  cs_matrix_structure_destroy(&ms);
+
+  cs_mesh_cartesian_stencil_free();
+  cs_glob_mesh = cs_mesh_destroy(m);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Finalize();
+#endif
+
+  exit(retval);
+}
@@ -0,0 +1,219 @@
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2022 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_file.h"
+#include "cs_io.h"
+#include "cs_mesh.h"
+#include "cs_partition.h"
+
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------
+ * Read back the partitioning written by cs_partition_write_weighted for
+ * the local block of cells, and return the imbalance (max/mean) of the
+ * cell weights per rank it leads to.
+ *
+ * parameters:
+ *   mesh    <-- pointer to mesh structure
+ *   s_id    <-- global id of first local cell
+ *   weights <-- weight of each local cell
+ *
+ * returns:
+ *   load imbalance of the new partitioning, or -1 if it was not found
+ *----------------------------------------------------------------------------*/
+
+static double
+_new_partition_imbalance(const cs_mesh_t  *mesh,
+                         cs_gnum_t         s_id,
+                         const cs_real_t   weights[])
+{
+  const int n_ranks = cs_glob_n_ranks;
+  const cs_lnum_t n_cells = mesh->n_cells;
+
+  char file_name[64];
+  snprintf(file_name, 63, "partition_output/domain_number_%d", n_ranks);
+
+  if (cs_file_isreg(file_name) == 0)
+    return -1;
+
+  int *cell_rank;
+  BFT_MALLOC(cell_rank, n_cells, int);
+
+  cs_file_access_t method;
+  cs_io_sec_header_t header;
+
+#if defined(HAVE_MPI)
+  MPI_Info hints;
+  cs_file_get_default_access(CS_FILE_MODE_READ, &method, &hints);
+  cs_io_t *fh = cs_io_initialize(file_name,
+                                 "Domain partitioning, R0",
+                                 CS_IO_MODE_READ,
+                                 method,
+                                 0,
+                                 hints,
+                                 cs_glob_mpi_comm,
+                                 cs_glob_mpi_comm);
+#else
+  cs_file_get_default_access(CS_FILE_MODE_READ, &method);
+  cs_io_t *fh = cs_io_initialize(file_name,
+                                 "Domain partitioning, R0",
+                                 CS_IO_MODE_READ,
+                                 method,
+                                 0);
+#endif
+
+  while (true) {
+    cs_io_read_header(fh, &header);
+    if (strncmp(header.sec_name, "cell:domain number", CS_IO_NAME_LEN) == 0)
+      break;
+    cs_io_skip(&header, fh);
+  }
+
+  cs_io_set_cs_lnum(&header, fh);
+  cs_io_read_block(&header, s_id + 1, s_id + n_cells + 1, cell_rank, fh);
+
+  cs_io_finalize(&fh);
+
+  /* Sum weights per (1-based) destination rank */
+
+  double *rank_load;
+  BFT_MALLOC(rank_load, n_ranks, double);
+  for (int i = 0; i < n_ranks; i++)
+    rank_load[i] = 0;
+
+  for (cs_lnum_t i = 0; i < n_cells; i++)
+    rank_load[cell_rank[i] - 1] += weights[i];
+
+#if defined(HAVE_MPI)
+  if (n_ranks > 1)
+    MPI_Allreduce(MPI_IN_PLACE, rank_load, n_ranks, MPI_DOUBLE, MPI_SUM,
+                  cs_glob_mpi_comm);
+#endif
+
+  double l_max = 0, l_sum = 0;
+  for (int i = 0; i < n_ranks; i++) {
+    l_max = fmax(l_max, rank_load[i]);
+    l_sum += rank_load[i];
+  }
+
+  BFT_FREE(rank_load);
+  BFT_FREE(cell_rank);
+
+  return l_max / (l_sum / n_ranks);
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int retval = EXIT_SUCCESS;
+
+#if defined(HAVE_MPI)
+  cs_base_mpi_init(&argc, &argv);
+#else
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  const int n_ranks = cs_glob_n_ranks;
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+  /* Cartesian mesh of nx^3 cells, distributed by blocks of cell numbers,
+     so that the bottom layers (20 times heavier) are on the first ranks. */
+
+  const int nx = 24;
+  const cs_gnum_t n_g_cells = nx*nx*nx;
+
+  cs_gnum_t s_id = (n_g_cells*rank_id) / n_ranks;
+  cs_gnum_t e_id = (n_g_cells*(rank_id+1)) / n_ranks;
+
+  cs_mesh_t *m = cs_mesh_create();
+  m->n_cells = e_id - s_id;
+  m->n_cells_with_ghosts = m->n_cells;
+  m->n_g_cells = n_g_cells;
+
+  cs_real_t *cell_cen, *weights;
+  BFT_MALLOC(m->global_cell_num, m->n_cells, cs_gnum_t);
+  BFT_MALLOC(cell_cen, 3*m->n_cells, cs_real_t);
+  BFT_MALLOC(weights, m->n_cells, cs_real_t);
+
+  for (cs_lnum_t i = 0; i < m->n_cells; i++) {
+    cs_gnum_t g_id = s_id + i;
+    m->global_cell_num[i] = g_id + 1;
+    cell_cen[3*i]     = g_id % nx + 0.5;
+    cell_cen[3*i + 1] = (g_id / nx) % nx + 0.5;
+    cell_cen[3*i + 2] = g_id / (nx*nx) + 0.5;
+    weights[i] = (cell_cen[3*i + 2] < nx/4) ? 20 : 1;
+  }
+
+  double imbalance = cs_partition_write_weighted(m, cell_cen, weights, 1.05);
+  double new_imbalance = _new_partition_imbalance(m, s_id, weights);
+
+  if (rank_id == 0) {
+    printf("\n%d ranks: initial imbalance %6.3f, ", n_ranks, imbalance);
+    if (new_imbalance < 0)
+      printf("no partitioning written\n");
+    else
+      printf("weighted partitioning imbalance %6.3f\n", new_imbalance);
+  }
+
+  /* With one rank, there is nothing to rebalance; otherwise, the weighted
+     partitioning should be written and nearly balanced (the tolerance
+     allowing for the granularity of cells along the curve). */
+
+  if (n_ranks == 1) {
+    if (fabs(imbalance - 1.) > 1e-12 || new_imbalance >= 0)
+      retval = EXIT_FAILURE;
+  }
+  else if (imbalance < 1.05 || new_imbalance < 0 || new_imbalance > 1.05)
+    retval = EXIT_FAILURE;
+
+  if (retval != EXIT_SUCCESS && rank_id == 0)
+    printf("  error: unexpected weighted partitioning\n");
+
+  BFT_FREE(weights);
+  BFT_FREE(cell_cen);
+
+  m = cs_mesh_destroy(m);
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Finalize();
+#endif
+
+  exit(retval);
+}
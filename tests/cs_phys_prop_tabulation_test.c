@@ -0,0 +1,157 @@
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2022 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bft_mem.h"
+
+#include "cs_base.h"
+#include "cs_physical_properties.h"
+
+/*----------------------------------------------------------------------------*/
+
+#if defined(HAVE_FREESTEAM)
+
+/*----------------------------------------------------------------------------
+ * Compare tabulated and direct values of a property at points located
+ * between table nodes.
+ *
+ * parameters:
+ *   property  <-- property queried
+ *   p_bounds  <-- pressure bounds
+ *   t_bounds  <-- temperature bounds
+ *   tolerance <-- tabulation tolerance
+ *
+ * returns:
+ *   max. relative difference between tabulated and direct values
+ *----------------------------------------------------------------------------*/
+
+static double
+_compare_tabulated(cs_phys_prop_type_t  property,
+                   const cs_real_t      p_bounds[2],
+                   const cs_real_t      t_bounds[2],
+                   double               tolerance)
+{
+  const cs_lnum_t n_pts = 2000;
+
+  cs_thermal_table_set("water", "freesteam", NULL, CS_PHYS_PROP_PLANE_PT, 1);
+  cs_physical_properties_set_tabulation(p_bounds, t_bounds, tolerance, NULL);
+
+  cs_real_t *p, *t, *val, *val_ref;
+  BFT_MALLOC(p, n_pts, cs_real_t);
+  BFT_MALLOC(t, n_pts, cs_real_t);
+  BFT_MALLOC(val, n_pts, cs_real_t);
+  BFT_MALLOC(val_ref, n_pts, cs_real_t);
+
+  /* Quasi-random points, which do not fall on table nodes */
+
+  for (cs_lnum_t i = 0; i < n_pts; i++) {
+    double s0 = fmod(0.5 + 0.6180339887*(i+1), 1.);
+    double s1 = fmod(0.5 + 0.7548776662*(i+1), 1.);
+    p[i] = p_bounds[0] + s0*(p_bounds[1] - p_bounds[0]);
+    t[i] = t_bounds[0] + s1*(t_bounds[1] - t_bounds[0]);
+  }
+
+  cs_phys_prop_compute(property, n_pts, 1, 1, p, t, val);
+  cs_phys_prop_freesteam(CS_PHYS_PROP_PLANE_PT, property, n_pts, p, t,
+                         val_ref);
+
+  double d_max = 0.;
+  for (cs_lnum_t i = 0; i < n_pts; i++)
+    d_max = fmax(d_max, fabs(val[i] - val_ref[i]) / fabs(val_ref[i]));
+
+  BFT_FREE(val_ref);
+  BFT_FREE(val);
+  BFT_FREE(t);
+  BFT_FREE(p);
+
+  cs_thermal_table_finalize();
+
+  return d_max;
+}
+
+#endif /* defined(HAVE_FREESTEAM) */
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  int retval = EXIT_SUCCESS;
+
+#if defined(HAVE_MPI)
+  cs_base_mpi_init(&argc, &argv);
+#else
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+#endif
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  const int rank_id = CS_MAX(cs_glob_rank_id, 0);
+
+#if defined(HAVE_FREESTEAM)
+
+  /* Liquid water, away from saturation */
+
+  const cs_real_t p_bounds[2] = {1e5, 1e7};
+  const cs_real_t t_bounds[2] = {290., 360.};
+
+  /* Reachable tolerance, then tolerance not reachable with the finest
+     grid, for which values must be computed directly where needed */
+
+  const double tolerance[2] = {1e-6, 1e-14};
+  const double max_diff[2] = {1e-5, 1e-10};
+
+  for (int i = 0; i < 2; i++) {
+    double d = _compare_tabulated(CS_PHYS_PROP_DENSITY,
+                                  p_bounds, t_bounds, tolerance[i]);
+    if (rank_id == 0)
+      printf("density, tolerance %8.2e: max. relative difference %10.3e\n",
+             tolerance[i], d);
+    if (d > max_diff[i]) {
+      if (rank_id == 0)
+        printf("  error: tabulated and direct values differ\n");
+      retval = EXIT_FAILURE;
+    }
+  }
+
+#else
+
+  if (rank_id == 0)
+    printf("freesteam not available; tabulation test skipped\n");
+
+#endif
+
+  bft_mem_end();
+
+#if defined(HAVE_MPI)
+  if (cs_glob_mpi_comm != MPI_COMM_NULL)
+    MPI_Finalize();
+#endif
+
+  exit(retval);
+}
@@ -0,0 +1,364 @@
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2022 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_math.h"
+#include "cs_matrix.h"
+#include "cs_mesh.h"
+#include "cs_mesh_adjacencies.h"
+#include "cs_mesh_quantities.h"
+#include "cs_numbering.h"
+#include "cs_rad_transfer_solve.h"
+#include "cs_sles_it.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+#define N_DIRS 6
+
+/*----------------------------------------------------------------------------
+ * Build a cartesian mesh with randomly numbered cells, with only the
+ * connectivity and quantities required by DOM sweeps.
+ *
+ * Warped face normals (with transverse components) lead to dependency
+ * cycles between cells for some directions.
+ *
+ * parameters:
+ *   nx   <-- number of cells in each direction
+ *   warp <-- amplitude of transverse face normal components
+ *----------------------------------------------------------------------------*/
+
+static void
+_build_mesh(int     nx,
+            double  warp)
+{
+  const cs_lnum_t n_cells = nx*nx*nx;
+  const cs_lnum_t n_i_faces = 3*nx*nx*(nx-1);
+  const cs_lnum_t n_b_faces = 6*nx*nx;
+
+  cs_mesh_t *m = cs_mesh_create();
+  cs_mesh_quantities_t *mq = cs_mesh_quantities_create();
+
+  cs_glob_mesh = m;
+  cs_glob_mesh_quantities = mq;
+
+  m->n_cells = n_cells;
+  m->n_cells_with_ghosts = n_cells;
+  m->n_i_faces = n_i_faces;
+  m->n_b_faces = n_b_faces;
+  m->n_b_faces_all = n_b_faces;
+  m->n_g_cells = n_cells;
+
+  BFT_MALLOC(m->i_face_cells, n_i_faces, cs_lnum_2_t);
+  BFT_MALLOC(m->b_face_cells, n_b_faces, cs_lnum_t);
+
+  BFT_MALLOC(mq->i_face_normal, 3*n_i_faces, cs_real_t);
+  BFT_MALLOC(mq->b_face_normal, 3*n_b_faces, cs_real_t);
+  BFT_MALLOC(mq->c_disable_flag, 1, int);
+  mq->c_disable_flag[0] = 0;
+
+  /* Random cell numbering, so that sweep order is not trivial */
+
+  cs_lnum_t *perm;
+  BFT_MALLOC(perm, n_cells, cs_lnum_t);
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++)
+    perm[c_id] = c_id;
+  srand(1);
+  for (cs_lnum_t c_id = n_cells - 1; c_id > 0; c_id--) {
+    cs_lnum_t r_id = rand() % (c_id + 1);
+    cs_lnum_t tmp = perm[c_id];
+    perm[c_id] = perm[r_id];
+    perm[r_id] = tmp;
+  }
+
+  const cs_lnum_t stride[3] = {1, nx, nx*nx};
+
+  cs_lnum_t f_id = 0, b_id = 0;
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    const int ijk[3] = {c_id%nx, (c_id/nx)%nx, c_id/(nx*nx)};
+    for (int i = 0; i < 3; i++) {
+      if (ijk[i] < nx-1) {
+        m->i_face_cells[f_id][0] = perm[c_id];
+        m->i_face_cells[f_id][1] = perm[c_id + stride[i]];
+        for (int j = 0; j < 3; j++) {
+          cs_real_t t = warp*sin(3.1*f_id + j);
+          mq->i_face_normal[3*f_id + j] = (j == i) ? 1 : t;
+        }
+        f_id++;
+      }
+      for (int s = 0; s < 2; s++) {
+        if (ijk[i] == s*(nx-1)) {
+          m->b_face_cells[b_id] = perm[c_id];
+          for (int j = 0; j < 3; j++)
+            mq->b_face_normal[3*b_id + j] = (j == i) ? 2*s - 1 : 0;
+          b_id++;
+        }
+      }
+    }
+  }
+
+  BFT_FREE(perm);
+
+  m->i_face_numbering = cs_numbering_create_default(n_i_faces);
+  m->b_face_numbering = cs_numbering_create_default(n_b_faces);
+
+  cs_mesh_adjacencies_initialize();
+  cs_mesh_adjacencies_update_mesh();
+}
+
+/*----------------------------------------------------------------------------
+ * Solve the upwind radiance equation for a given direction with an
+ * iterative linear solver, for reference.
+ *
+ * parameters:
+ *   vect_s   <-- direction
+ *   coefap   <-- boundary condition array (explicit part)
+ *   coefbp   <-- boundary condition array (implicit part)
+ *   rovsdt   <-- implicit source term
+ *   rhs      <-- explicit source term
+ *   radiance --> radiance
+ *----------------------------------------------------------------------------*/
+
+static void
+_solve_iterative(const cs_real_t  vect_s[3],
+                 const cs_real_t  coefap[],
+                 const cs_real_t  coefbp[],
+                 const cs_real_t  rovsdt[],
+                 const cs_real_t  rhs[],
+                 cs_real_t        radiance[])
+{
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_i_faces = m->n_i_faces;
+  const cs_lnum_2_t *i_face_cells = (const cs_lnum_2_t *)m->i_face_cells;
+  const cs_real_3_t *i_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->i_face_normal;
+  const cs_real_3_t *b_face_normal
+    = (const cs_real_3_t *)cs_glob_mesh_quantities->b_face_normal;
+
+  cs_real_t *da, *xa, *b;
+  BFT_MALLOC(da, n_cells, cs_real_t);
+  BFT_MALLOC(xa, 2*n_i_faces, cs_real_t);
+  BFT_MALLOC(b, n_cells, cs_real_t);
+
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    da[c_id] = rovsdt[c_id];
+    b[c_id] = rhs[c_id];
+    radiance[c_id] = 0;
+  }
+
+  /* Upwind convection (non-conservative form, as in the radiance equation):
+     xa[2*f] is the coefficient of row i and column j, xa[2*f+1] that
+     of row j and column i */
+
+  for (cs_lnum_t f_id = 0; f_id < n_i_faces; f_id++) {
+    cs_lnum_t ii = i_face_cells[f_id][0], jj = i_face_cells[f_id][1];
+    cs_real_t flux = cs_math_3_dot_product(vect_s, i_face_normal[f_id]);
+    xa[2*f_id] = 0, xa[2*f_id + 1] = 0;
+    if (flux > 0) {
+      da[jj] += flux;
+      xa[2*f_id + 1] = -flux;
+    }
+    else {
+      da[ii] -= flux;
+      xa[2*f_id] = flux;
+    }
+  }
+
+  for (cs_lnum_t f_id = 0; f_id < m->n_b_faces; f_id++) {
+    cs_lnum_t c_id = m->b_face_cells[f_id];
+    cs_real_t flux = cs_math_3_dot_product(vect_s, b_face_normal[f_id]);
+    if (flux < 0) {
+      da[c_id] -= flux * (1. - coefbp[f_id]);
+      b[c_id] -= flux * coefap[f_id];
+    }
+  }
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_NATIVE,
+                                 n_cells,
+                                 n_cells,
+                                 n_i_faces,
+                                 i_face_cells,
+                                 NULL,
+                                 m->i_face_numbering);
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_matrix_set_coefficients(a, false, 1, 1, n_i_faces, i_face_cells, da, xa);
+
+  cs_sles_it_t *c = cs_sles_it_create(CS_SLES_GMRES, 0, 10000, false);
+
+  int n_iter;
+  double residue;
+
+  cs_sles_it_setup(c, "radiance", a, 0);
+  cs_sles_it_solve(c, "radiance", a, 0, 1e-12, 1., &n_iter, &residue,
+                   b, radiance, 0, NULL);
+
+  cs_sles_it_destroy((void **)&c);
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(b);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+}
+
+/*----------------------------------------------------------------------------
+ * Compare sweep and iterative solutions on a given mesh.
+ *
+ * parameters:
+ *   nx   <-- number of cells in each direction
+ *   warp <-- amplitude of transverse face normal components
+ *
+ * returns:
+ *   0 if solutions match, 1 otherwise
+ *----------------------------------------------------------------------------*/
+
+static int
+_compare_solutions(int     nx,
+                   double  warp)
+{
+  _build_mesh(nx, warp);
+
+  const cs_mesh_t *m = cs_glob_mesh;
+  const cs_lnum_t n_cells = m->n_cells;
+  const cs_lnum_t n_b_faces = m->n_b_faces;
+
+  cs_real_t *coefap, *coefbp, *rovsdt, *rhs;
+  BFT_MALLOC(coefap, n_b_faces, cs_real_t);
+  BFT_MALLOC(coefbp, n_b_faces, cs_real_t);
+  BFT_MALLOC(rovsdt, n_cells, cs_real_t);
+  BFT_MALLOC(rhs, n_cells, cs_real_t);
+
+  for (cs_lnum_t f_id = 0; f_id < n_b_faces; f_id++) {
+    coefap[f_id] = 1. + 0.5*sin(f_id);
+    coefbp[f_id] = 0.2*(1. + cos(f_id));
+  }
+  for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+    rovsdt[c_id] = 0.1*(1.5 + sin(0.3*c_id));
+    rhs[c_id] = 0.5 + 0.4*cos(0.7*c_id);
+  }
+
+  cs_real_3_t vect_s[N_DIRS];
+  for (int d = 0; d < N_DIRS; d++) {
+    double t = 0.1 + 1.4*d/N_DIRS, p = 0.2 + 1.2*(d%5)/5.;
+    vect_s[d][0] = sin(t)*cos(p);
+    vect_s[d][1] = sin(t)*sin(p);
+    vect_s[d][2] = cos(t);
+  }
+
+  cs_real_t *radiance, *radiance_ref;
+  BFT_MALLOC(radiance, N_DIRS*n_cells, cs_real_t);
+  BFT_MALLOC(radiance_ref, n_cells, cs_real_t);
+
+  /* Solve twice, the second call using the cached sweep ordering */
+
+  int n_sweeps[2];
+  cs_real_t delta[2];
+
+  for (int i = 0; i < 2; i++)
+    n_sweeps[i] = cs_rad_transfer_dom_sweep_solve(N_DIRS,
+                                                  (const cs_real_3_t *)vect_s,
+                                                  coefap,
+                                                  coefbp,
+                                                  rovsdt,
+                                                  rhs,
+                                                  1e-12,
+                                                  radiance,
+                                                  delta + i);
+
+  int retval = (n_sweeps[0] != n_sweeps[1]) ? 1 : 0;
+
+  double d_max = 0, l_max = 0;
+
+  for (int d = 0; d < N_DIRS; d++) {
+    _solve_iterative(vect_s[d], coefap, coefbp, rovsdt, rhs, radiance_ref);
+    const cs_real_t *_radiance = radiance + d*n_cells;
+    for (cs_lnum_t c_id = 0; c_id < n_cells; c_id++) {
+      d_max = fmax(d_max, fabs(_radiance[c_id] - radiance_ref[c_id]));
+      l_max = fmax(l_max, fabs(radiance_ref[c_id]));
+    }
+  }
+
+  bft_printf("%d^3 cells, warp %4.2f: %d sweep(s), "
+             "max radiance %12.5e, max difference %12.5e\n",
+             nx, warp, n_sweeps[0], l_max, d_max);
+
+  if (d_max > 1e-8*l_max)
+    retval = 1;
+
+  BFT_FREE(radiance_ref);
+  BFT_FREE(radiance);
+  BFT_FREE(rhs);
+  BFT_FREE(rovsdt);
+  BFT_FREE(coefbp);
+  BFT_FREE(coefap);
+
+  /* Cached orderings depend on the mesh */
+
+  cs_rad_transfer_dom_sweep_finalize();
+
+  cs_mesh_adjacencies_finalize();
+
+  cs_glob_mesh_quantities = cs_mesh_quantities_destroy(cs_glob_mesh_quantities);
+  cs_glob_mesh = cs_mesh_destroy(cs_glob_mesh);
+
+  return retval;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  (void)cs_timer_wtime();
+
+  int n_errors = 0;
+
+  /* Acyclic dependencies (single sweep), then cycles (iterated sweeps) */
+
+  n_errors += _compare_solutions(12, 0.);
+  n_errors += _compare_solutions(12, 0.3);
+
+  if (n_errors > 0)
+    bft_printf("  error: sweep and iterative solutions differ\n");
+
+  bft_mem_end();
+
+  exit((n_errors > 0) ? EXIT_FAILURE : EXIT_SUCCESS);
+}
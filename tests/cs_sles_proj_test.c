@@ -0,0 +1,223 @@
+/*
+  This file is part of code_saturne, a general-purpose CFD tool.
+
+  Copyright (C) 1998-2022 EDF S.A.
+
+  This program is free software; you can redistribute it and/or modify it under
+  the terms of the GNU General Public License as published by the Free Software
+  Foundation; either version 2 of the License, or (at your option) any later
+  version.
+
+  This program is distributed in the hope that it will be useful, but WITHOUT
+  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+  FOR A PARTICULAR PURPOSE.  See the GNU General Public License for more
+  details.
+
+  You should have received a copy of the GNU General Public License along with
+  this program; if not, write to the Free Software Foundation, Inc., 51 Franklin
+  Street, Fifth Floor, Boston, MA 02110-1301, USA.
+*/
+
+/*----------------------------------------------------------------------------*/
+
+#include "cs_defs.h"
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "bft_mem.h"
+#include "bft_printf.h"
+
+#include "cs_blas.h"
+#include "cs_matrix.h"
+#include "cs_sles.h"
+#include "cs_sles_it.h"
+#include "cs_timer.h"
+
+/*----------------------------------------------------------------------------*/
+
+#define NX 64
+#define N_STEPS 30
+
+/*----------------------------------------------------------------------------
+ * Set coefficients of a 2D diffusion matrix on a NX x NX grid.
+ *
+ * parameters:
+ *   n_edges <-- number of edges
+ *   edges   <-- edges
+ *   t       <-- pseudo-time (coefficients vary with time if > 0)
+ *   da      --> diagonal values
+ *   xa      --> extra-diagonal values
+ *----------------------------------------------------------------------------*/
+
+static void
+_set_coeffs(cs_lnum_t          n_edges,
+            const cs_lnum_2_t  edges[],
+            double             t,
+            cs_real_t          da[],
+            cs_real_t          xa[])
+{
+  for (cs_lnum_t i = 0; i < NX*NX; i++)
+    da[i] = 1e-3;
+
+  for (cs_lnum_t e_id = 0; e_id < n_edges; e_id++) {
+    cs_lnum_t i = edges[e_id][0], j = edges[e_id][1];
+    double x = (double)(i%NX) / NX;
+    double k = 1. + 0.5*sin(6.28*x + t);
+    xa[e_id] = -k;
+    da[i] += k;
+    da[j] += k;
+  }
+}
+
+/*----------------------------------------------------------------------------
+ * Solve a sequence of related systems, with slowly varying right-hand
+ * sides and optionally varying matrix coefficients.
+ *
+ * parameters:
+ *   n_proj     <-- number of vectors for initial guess projection
+ *   var_matrix <-- vary matrix coefficients with time if true
+ *   n_iter_tot --> total number of iterations
+ *
+ * returns:
+ *   max. relative residual of solutions
+ *----------------------------------------------------------------------------*/
+
+static double
+_solve_sequence(int    n_proj,
+                bool   var_matrix,
+                int   *n_iter_tot)
+{
+  const cs_lnum_t n = NX*NX;
+  const cs_lnum_t n_edges = 2*NX*(NX-1);
+
+  cs_lnum_2_t *edges;
+  cs_real_t *da, *xa, *rhs, *x, *r;
+  BFT_MALLOC(edges, n_edges, cs_lnum_2_t);
+  BFT_MALLOC(da, n, cs_real_t);
+  BFT_MALLOC(xa, n_edges, cs_real_t);
+  BFT_MALLOC(rhs, n, cs_real_t);
+  BFT_MALLOC(x, n, cs_real_t);
+  BFT_MALLOC(r, n, cs_real_t);
+
+  cs_lnum_t e_id = 0;
+  for (cs_lnum_t i = 0; i < n; i++) {
+    if (i%NX < NX-1) {
+      edges[e_id][0] = i;
+      edges[e_id][1] = i+1;
+      e_id++;
+    }
+    if (i/NX < NX-1) {
+      edges[e_id][0] = i;
+      edges[e_id][1] = i+NX;
+      e_id++;
+    }
+  }
+
+  cs_matrix_structure_t *ms
+    = cs_matrix_structure_create(CS_MATRIX_MSR, n, n, n_edges, edges,
+                                 NULL, NULL);
+  cs_matrix_t *a = cs_matrix_create(ms);
+
+  cs_sles_it_define(-1, "proj_test", CS_SLES_PCG, 0, 10000);
+  cs_sles_t *sles = cs_sles_find_or_add(-1, "proj_test");
+  cs_sles_set_solution_projection(sles, n_proj);
+
+  double res_max = 0;
+  *n_iter_tot = 0;
+
+  for (int step = 0; step < N_STEPS; step++) {
+
+    double t = 0.02*step;
+
+    _set_coeffs(n_edges, edges, (var_matrix) ? t : 0., da, xa);
+    cs_matrix_set_coefficients(a, true, 1, 1, n_edges, edges, da, xa);
+
+    for (cs_lnum_t i = 0; i < n; i++) {
+      double xx = (double)(i%NX) / NX, yy = (double)(i/NX) / NX;
+      rhs[i] =   sin(6.28*(xx - 0.3*t))*cos(3.14*yy + t)
+               + 0.3*cos(12.*xx*yy + 2.*t);
+      x[i] = 0;
+    }
+
+    double r_norm = sqrt(cs_dot_xx(n, rhs));
+    int n_iter;
+    double residue;
+
+    cs_sles_solve(sles, a, 1e-8, r_norm, &n_iter, &residue,
+                  rhs, x, 0, NULL);
+    cs_sles_free(sles);
+
+    *n_iter_tot += n_iter;
+
+    cs_matrix_vector_multiply(a, x, r);
+    for (cs_lnum_t i = 0; i < n; i++)
+      r[i] = rhs[i] - r[i];
+    res_max = fmax(res_max, sqrt(cs_dot_xx(n, r)) / r_norm);
+
+  }
+
+  cs_matrix_destroy(&a);
+  cs_matrix_structure_destroy(&ms);
+
+  BFT_FREE(r);
+  BFT_FREE(x);
+  BFT_FREE(rhs);
+  BFT_FREE(xa);
+  BFT_FREE(da);
+  BFT_FREE(edges);
+
+  return res_max;
+}
+
+/*----------------------------------------------------------------------------*/
+
+int
+main (int argc, char *argv[])
+{
+  CS_UNUSED(argc);
+  CS_UNUSED(argv);
+
+  bft_mem_init(getenv("CS_MEM_LOG"));
+
+  (void)cs_timer_wtime();
+
+  cs_sles_initialize();
+
+  int retval = EXIT_SUCCESS;
+
+  /* Constant matrix, then matrix coefficients changing at each solve,
+     which requires updating the projection basis */
+
+  for (int var_matrix = 0; var_matrix < 2; var_matrix++) {
+
+    int n_iter[2];
+    double res_max[2];
+
+    for (int i = 0; i < 2; i++) {
+      cs_sles_finalize();
+      cs_sles_initialize();
+      res_max[i] = _solve_sequence(4*i, var_matrix, n_iter + i);
+    }
+
+    bft_printf("%s matrix: %d iterations without projection, "
+               "%d with projection\n"
+               "  max. relative residuals: %10.3e, %10.3e\n",
+               (var_matrix) ? "variable" : "constant",
+               n_iter[0], n_iter[1], res_max[0], res_max[1]);
+
+    if (res_max[1] > 1e-6 || n_iter[1] > 0.9*n_iter[0]) {
+      bft_printf("  error: projection does not reduce the "
+                 "initial residual\n");
+      retval = EXIT_FAILURE;
+    }
+
+  }
+
+  cs_sles_finalize();
+
+  bft_mem_end();
+
+  exit(retval);
+}